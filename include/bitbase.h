@@ -0,0 +1,48 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                ENDGAME BITBASES                                 ;
+;---------------------------------------------------------------------------------;
+;   KPK, KRK and KQK solved by retrograde analysis (src/host/make_bitbase.cpp)    ;
+;   into packed const tables (src/bitbase_tables.cpp) that stay in flash:         ;
+;                                                                                 ;
+;   KPK  5 bits - 0 draw, else 1 + moves to a promotion that keeps the win        ;
+;   KRK  5 bits - 0 draw, else 1 + moves the rook side needs to mate              ;
+;   KQK  4 bits - the same for the queen                                          ;
+;                                                                                 ;
+;   A bare win/draw bit would leave the search shuffling between won KPK          ;
+;   positions, the distance gives it a direction.                                 ;
+;                                                                                 ;
+;   Only positions with the lone king to move are stored, the other half is one   ;
+;   ply above them. Tables are indexed after reflecting the board so that the     ;
+;   strong side is white and the pawn on files a-d, or the strong king in the     ;
+;   a1-d1-d4 triangle; the index needs no search.                                 ;
+;                                                                                 ;
+;   bitbase_probe() is called on every node below the root when the root had      ;
+;   at most BITBASE_ROOT_PIECES pieces. Mates score BITBASE_MATE - plies to mate, ;
+;   won KPK positions BITBASE_WIN - plies to the promotion.                       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef BITBASE_H
+#define BITBASE_H
+
+#include "chess.h"
+
+#define BITBASE_KPK 0
+#define BITBASE_KRK 1
+#define BITBASE_KQK 2
+
+#define BITBASE_MATE 9000  // below the 10000 of a mate seen by the search
+#define BITBASE_WIN 5000  // won KPK, below any KQK or KRK mate
+#define BITBASE_ROOT_PIECES 4  // kings included
+
+typedef struct { const unsigned char *data; int bits, size; } Bitbase_Table_Structure;  // size in entries, data padded by 2 bytes
+
+extern const Bitbase_Table_Structure bitbase_tables[3];  // src/bitbase_tables.cpp
+
+int bitbase_index(int table, int strong_king, int piece, int weak_king);  // squares a1 = 0 .. h8 = 63 with white strong, -1 if not a stored position
+int bitbase_value(int table, int index);  // entry as stored
+int bitbase_pieces(Position_Structure *position);  // pieces on the board, kings included
+int bitbase_probe(Position_Structure *position, int side, int ply, int *score);  // 1 and score for side if the position is in a table
+
+#endif
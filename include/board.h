@@ -0,0 +1,92 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                 BOARD BACKENDS                                  ;
+;---------------------------------------------------------------------------------;
+;   Two boards behind one set of functions, so that code templated on the board   ;
+;   type (perft below) runs on either:                                            ;
+;                                                                                 ;
+;   Board_0x88_Structure      - the engine's own 0x88 board and generator, legal  ;
+;                               moves by is_legal_move()                          ;
+;   Board_Bitboard_Structure  - one 64-bit set per piece type and colour, a1 = 0, ;
+;                               attack sets from compile-time tables, copy-make   ;
+;                                                                                 ;
+;   board_load(board, fen), board_generate(board, moves) - legal moves, count,    ;
+;   board_make(board, move), board_unmake(board, move) - last made first, at most ;
+;   BOARD_MAX_PLY deep. Move words are backend specific.                          ;
+;                                                                                 ;
+;   Board_Structure is the faster of the two on the target, set by BOARD_BITBOARD:;
+;   bitboards on 64-bit hosts, 0x88 on the 32-bit ESP32 where every set operation ;
+;   takes two registers ("bench perft" measures both). The search stays on 0x88,  ;
+;   its evaluation is kept incrementally on that board.                           ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef BOARD_H
+#define BOARD_H
+
+#include <stdint.h>
+
+#include "chess.h"
+
+#ifndef BOARD_BITBOARD
+#define BOARD_BITBOARD (UINTPTR_MAX > 0xFFFFFFFFu)  // 1 - Board_Structure is Board_Bitboard_Structure
+#endif
+
+#define BOARD_MAX_PLY 32
+
+typedef unsigned long long Bitboard;
+
+// bitboard move word: bits 0..5 source, 6..11 target, 12..14 promoted piece type (4..7), flags
+#define BITBOARD_EN_PASSANT  (1u << 15)
+#define BITBOARD_CASTLING    (1u << 16)
+#define BITBOARD_DOUBLE_PUSH (1u << 17)
+
+typedef struct {
+    Engine_Structure engine;
+    int en_passant[BOARD_MAX_PLY], ply;  // engine->position.en_passant before each move
+} Board_0x88_Structure;
+
+typedef struct {
+    Bitboard pieces[8], colors[2];  // by engine piece type (both pawns at 1), white and black
+    unsigned char squares[64];  // piece type | 8 white, 16 black, as on the 0x88 board
+    int side, en_passant, castling;  // side 0 white, e.p. square 64 - none, castling rights KQkq in bits 0..3
+} Bitboard_Position_Structure;
+
+typedef struct {
+    Bitboard_Position_Structure positions[BOARD_MAX_PLY + 1]; int ply;  // positions[ply] is the current one
+} Board_Bitboard_Structure;
+
+#if BOARD_BITBOARD
+typedef Board_Bitboard_Structure Board_Structure;
+#else
+typedef Board_0x88_Structure Board_Structure;
+#endif
+
+int board_load(Board_0x88_Structure *board, const char *fen);  // 0 on bad FEN
+int board_generate(Board_0x88_Structure *board, Move *moves);
+void board_make(Board_0x88_Structure *board, Move move);
+void board_unmake(Board_0x88_Structure *board, Move move);
+
+int board_load(Board_Bitboard_Structure *board, const char *fen);
+int board_generate(Board_Bitboard_Structure *board, Move *moves);
+void board_make(Board_Bitboard_Structure *board, Move move);
+static inline void board_unmake(Board_Bitboard_Structure *board, Move move) { (void)move; board->ply--; }
+
+template <typename Board> unsigned long long perft(Board *board, int depth)  // leaf nodes, the last ply is counted without making its moves
+{
+    Move moves[MAX_MOVES]; int count; unsigned long long nodes = 0;
+
+    if (!depth) return 1;
+    count = board_generate(board, moves);
+    if (depth == 1) return count;
+
+    for(int i = 0; i < count; i++) {
+        board_make(board, moves[i]);
+        nodes += perft(board, depth - 1);
+        board_unmake(board, moves[i]);
+    }
+
+    return nodes;
+}
+
+#endif
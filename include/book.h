@@ -0,0 +1,41 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                  OPENING BOOK                                   ;
+;---------------------------------------------------------------------------------;
+;   A sorted array of 16 byte entries read in place: on the ESP32 a flash data    ;
+;   partition mapped with esp_partition_mmap, on the host a mmap'ed file. A       ;
+;   lookup is a binary search over the mapping, nothing is copied or allocated.   ;
+;                                                                                 ;
+;   Entries use Polyglot's layout and move encoding (big endian key, move,        ;
+;   weight, learn; castling as king takes rook) but the key is the engine's own   ;
+;   Zobrist hash, so books come from the host make-book tool, not from Polyglot.  ;
+;                                                                                 ;
+;   Flash: the partition is erased before writing (parttool.py write_partition),  ;
+;   the erased tail reads as all-ones keys that sort after every real entry.     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef BOOK_H
+#define BOOK_H
+
+#include <stddef.h>
+
+#include "chess.h"
+
+#define BOOK_ENTRY_SIZE 16
+
+typedef struct {
+    const unsigned char *entries; size_t count;  // NULL - no book
+    unsigned long mapping;  // spi_flash_mmap_handle_t on the ESP32, mapped length on the host
+} Book_Structure;
+
+int book_open(Book_Structure *book, const char *name);  // ESP32 partition label or host file path, 0 if missing or empty
+void book_close(Book_Structure *book);
+
+unsigned long long book_key(Position_Structure *position);  // e.p. square only if a pawn can take, castling rights only if the king can still castle
+unsigned short book_encode_move(Move move);  // Polyglot move: to file, to row, from file, from row, promotion, 3 bits each
+void book_pack_entry(unsigned char *entry, unsigned long long key, unsigned short move, unsigned short weight);  // BOOK_ENTRY_SIZE bytes
+
+Move book_move(const Book_Structure *book, Engine_Structure *engine, unsigned int random);  // 0 if out of book; random 0 - heaviest move, otherwise picked by weight
+
+#endif
@@ -0,0 +1,194 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                nibble-chess engine                              ;
+;---------------------------------------------------------------------------------;
+;   Shared declarations for src/chess.cpp so that the firmware and the native     ;
+;   host programs (src/host/) can drive the same move generator and search.       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef CHESS_H
+#define CHESS_H
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                              BOARD REPRESENTATION                               ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+typedef unsigned int Move;  // packed move word, 0 - no move
+
+//  bits  0..6  - source square        bit 29 - en passant capture
+//  bits  7..13 - target square        bit 30 - castling
+//  bits 14..19 - piece (with virgin)  bit 31 - pawn double push
+//  bits 20..25 - capture (with virgin)
+//  bits 26..28 - promoted piece type
+
+#define MOVE_EN_PASSANT  (1u << 29)
+#define MOVE_CASTLING    (1u << 30)
+#define MOVE_DOUBLE_PUSH (1u << 31)
+
+#define MOVE_SOURCE(move)   ((int)((move) & 127))
+#define MOVE_TARGET(move)   ((int)((move) >> 7 & 127))
+#define MOVE_PIECE(move)    ((int)((move) >> 14 & 63))
+#define MOVE_CAPTURE(move)  ((int)((move) >> 20 & 63))
+#define MOVE_PROMOTED(move) ((int)((move) >> 26 & 7))
+
+#define MOVE_CAPTURED_SQUARE(move) (((move) & MOVE_EN_PASSANT) ? MOVE_TARGET(move) ^ 16 : MOVE_TARGET(move))
+#define MOVE_ROOK_SQUARE(move) ((MOVE_TARGET(move) > MOVE_SOURCE(move)) ? MOVE_SOURCE(move) + 3 : MOVE_SOURCE(move) - 4)  // castling rook source
+#define MOVE_SKIP_SQUARE(move) (((move) & (MOVE_CASTLING | MOVE_DOUBLE_PUSH)) ? (MOVE_SOURCE(move) + MOVE_TARGET(move)) >> 1 : 128)  // e.p. square of the next ply
+
+#define ENCODE_MOVE(source, target, piece, capture, promoted_piece, flags) \
+    ((Move)(source) | (Move)(target) << 7 | (Move)(piece) << 14 | (Move)(capture) << 20 | (Move)(promoted_piece) << 26 | (flags))
+
+typedef struct { Move move; int score; } Scored_Move_Structure;  // move stack entry, score is used for move ordering
+typedef struct { Scored_Move_Structure *moves; int length; } Move_List_Structure;  // move list, a slice of move_stack
+typedef struct { unsigned long long hash_key; int position_score; } Undo_Structure;  // state restored by unmake_move
+
+// selective search, each can be switched off with -D SEARCH_xxx=0 to measure it
+#ifndef SEARCH_PVS
+#define SEARCH_PVS 1  // principal variation search: null window for every move after the first
+#endif
+#ifndef SEARCH_NULL_MOVE
+#define SEARCH_NULL_MOVE 1  // null-move pruning, off in check and with only king and pawns
+#endif
+#ifndef SEARCH_LMR
+#define SEARCH_LMR 1  // late-move reductions of quiet moves by move index and history
+#endif
+#ifndef SEARCH_CHECK_EXTENSION
+#define SEARCH_CHECK_EXTENSION 1  // one ply more when in check
+#endif
+#ifndef SEARCH_SEE_PRUNING
+#define SEARCH_SEE_PRUNING 1  // quiescence skips captures losing material by static exchange evaluation
+#endif
+#ifndef SEARCH_DELTA_PRUNING
+#define SEARCH_DELTA_PRUNING 1  // quiescence skips captures that can't bring the score near alpha
+#endif
+#ifndef SEARCH_BITBASES
+#define SEARCH_BITBASES 1  // KPK, KRK and KQK bitbase probes below the root, if the root has few pieces (bitbase.h)
+#endif
+
+#ifndef SEARCH_STATS
+#define SEARCH_STATS 0  // instrumented build, per iteration statistics records (stats.h); 0 - compiled out
+#endif
+
+#define STATS_CUTOFF_BUCKETS 8  // beta cutoffs by move number: 1, 2, 3, 4, 5-6, 7-10, 11-20, 21+
+
+#define MAX_PLY 64  // deepest ply with killer moves
+#define PV_LENGTH 32  // longest principal variation, also the iterative deepening depth limit
+#define MULTI_PV_MAX 4  // most lines of a MultiPV search
+#define MULTI_PV_LENGTH 8  // moves kept of each line
+
+typedef struct { int score, length; Move moves[MULTI_PV_LENGTH]; } Pv_Line_Structure;  // moves[0] is the root move
+
+typedef struct Search_Info_Structure Search_Info_Structure;
+
+struct Search_Info_Structure {  // Search info
+    int best_score; Move best_move; unsigned long long nodes, tt_probes, tt_hits, beta_cutoffs, first_move_cutoffs;
+    unsigned long long null_move_cutoffs, reductions, re_searches, check_extensions;  // re_searches - PVS and LMR moves searched again
+    unsigned long long qnodes, see_pruned, delta_pruned;  // qnodes - quiescence share of nodes
+    int null_move;  // the move into this node was a null move, no second one in a row
+    int bitbases;  // probe the bitbases, set by search_iterative from the root's pieces
+#if SEARCH_STATS
+    unsigned long long cutoff_histogram[STATS_CUTOFF_BUCKETS];
+#endif
+    int ply, thread_id; char *stack_base; long stack_peak; Move killers[MAX_PLY][2];  // thread_id - 0 main, > 0 Lazy SMP helper
+    
+    // iterative deepening
+    unsigned long start_time, soft_time_limit, hard_time_limit;  // ms, 0 - no limit
+    unsigned long long node_limit;  // limits->nodes, checked with the clock every 2048 nodes
+    volatile int stop;  // set on timeout or from outside to abort the search
+    volatile int pondering;  // set before a ponder search, cleared from outside on a ponder hit
+    int pondered;  // the clock hasn't started yet, the search thread's copy of pondering
+    int completed_depth, follow_pv, pv_line_length;
+    Move pv[PV_LENGTH][PV_LENGTH], pv_line[PV_LENGTH];  // triangular PV table, PV of the last completed iteration
+    int pv_length[PV_LENGTH];
+    int line_count; Pv_Line_Structure lines[MULTI_PV_MAX];  // MultiPV: best lines of the last completed iteration, best first
+    void (*on_iteration)(Search_Info_Structure *search_info);  // optional, called after every completed iteration
+    void (*on_poll)(Search_Info_Structure *search_info);  // optional, called with the clock check every 2048 nodes, e.g. to yield the core
+};
+
+typedef struct { int depth, movetime, time_left, increment, moves_to_go, multi_pv; unsigned long long nodes; } Search_Limits_Structure;  // ms, 0 - unlimited, movetime overrides the clock; multi_pv - lines, 0 a single PV
+
+#ifndef MOVE_STACK_SIZE
+#if defined(ARDUINO)
+#define MOVE_STACK_SIZE 2048  // moves shared by all plies, 16 KB
+#else
+#define MOVE_STACK_SIZE 8192
+#endif
+#endif
+
+#define UNDO_STACK_SIZE 256  // power of two, used as a ring so game moves that are never taken back can't overflow it
+
+#define MAX_MOVES 256  // legal moves of any position fit
+#define FEN_LENGTH 96  // FEN/EPD position fields + terminator
+
+#define START_POSITION "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -"
+
+typedef struct TT_Structure TT_Structure;  // tt.h
+
+typedef struct {  // one game, ~540 bytes so a server can keep thousands of them
+    int board_array[129];  // 0x88 board + centers positional scores
+    unsigned long long hash_key;  // Zobrist hash of pieces and side to move
+    int position_score;  // material + centre score from white's point of view
+    int side, en_passant;  // side to move, e.p./castling skip square (128 - none)
+} Position_Structure;
+
+typedef struct {  // everything a search changes, one per search thread, no engine state lives anywhere else
+    Position_Structure position;  // working copy, moves are made and taken back here
+    
+    Scored_Move_Structure move_stack[MOVE_STACK_SIZE];  // preallocated moves of all plies
+    int move_stack_top;  // first free move_stack entry
+    Undo_Structure undo_stack[UNDO_STACK_SIZE];  // hash and score before each move
+    unsigned int undo_count;
+    
+    int history_table[16][64];  // quiet move beta cutoffs by piece and target square
+    TT_Structure *tt;  // may be shared by the engines of one game, NULL - no table
+} Engine_Structure;
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    FUNCTIONS                                    ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+unsigned long long generate_hash_key(Position_Structure *position);  // hash board_array from scratch
+unsigned long long position_key(Position_Structure *position, int en_passant);  // hash_key + e.p. square, transposition table key
+
+void make_move(Engine_Structure *engine, int side, Move move);  // make move
+void unmake_move(Engine_Structure *engine, int side, Move move);  // take back
+int scan_position_score(Position_Structure *position);  // material + centre score of board_array from scratch
+int evaluate_position(Position_Structure *position, int side);  // evaluate position, O(1) from position_score
+
+// generate_moves flags
+#define ALL_MOVES     0
+#define ONLY_CAPTURES 1
+#define ONLY_QUIETS   2
+
+int generate_moves(Engine_Structure *engine, int side, int en_passant, Move_List_Structure *move_list, int moves_flag);  // generate moves onto move_stack
+int generate_captures(Engine_Structure *engine, int side, int en_passant, Move_List_Structure *move_list);  // captures only, in generate_moves order, 0 if the king can be taken
+int is_square_attacked(Position_Structure *position, int square, int side);  // square attacked by a piece of side
+int in_check(Position_Structure *position, int side);  // side's king attacked
+int static_exchange(Position_Structure *position, Move move);  // material won by capture move, least valuable attacker first; exact in sign, stops once the sign is known
+
+static inline void release_moves(Engine_Structure *engine, Move_List_Structure *move_list) { engine->move_stack_top = move_list->moves - engine->move_stack; }  // pop move list off move_stack
+
+int quiescence_search(Engine_Structure *engine, int side, int en_passant, int alpha, int beta, Search_Info_Structure *search_info);  // quiescence search
+int search_position(Engine_Structure *engine, int side, int en_passant, int alpha, int beta, int depth, Search_Info_Structure *search_info);  // search position
+int search_iterative(Engine_Structure *engine, Search_Limits_Structure *limits, Search_Info_Structure *search_info);  // iterative deepening within limits
+unsigned long time_ms();  // monotonic milliseconds
+
+int load_fen(Position_Structure *position, const char *fen);  // set up position from FEN, 0 on malformed input
+void set_position(Engine_Structure *engine, const Position_Structure *position);  // copy a game into the engine, engine->position is the game afterwards
+void play_move(Engine_Structure *engine, Move move);  // make move and pass the turn, engine->position.side/en_passant follow
+int load_moves(Engine_Structure *engine, const char *moves);  // play space separated moves, 0 on an illegal move
+Move parse_move(Engine_Structure *engine, const char *move_string);  // parse move in the engine's position, 0 if illegal
+void move_to_string(Move move, char *move_string);  // e.g. "e7e8q", needs 6 chars
+int generate_legal_moves(Engine_Structure *engine, Move *moves);  // legal moves of the engine's position, returns count (MAX_MOVES max)
+int is_legal_move(Engine_Structure *engine, Move move, int king_square, int checked);  // pseudo-legal move of the side to move keeps its king (on king_square, checked if attacked) safe
+Move parse_san(Engine_Structure *engine, const char *san);  // SAN move in the engine's position, "Nbd7", "exd8=Q+", "O-O"; 0 if illegal or ambiguous
+void move_to_san(Engine_Structure *engine, Move move, char *san);  // e.g. "Nbxd7+", "e8=Q#", "O-O"; move must be legal, needs 8 chars
+void position_to_fen(Position_Structure *position, char *fen);  // board, side, castling and e.p. fields, needs FEN_LENGTH chars
+void print_board(Position_Structure *position);  // print board
+
+#endif
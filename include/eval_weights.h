@@ -0,0 +1,31 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                       EVALUATION WEIGHTS, written by tune                       ;
+;---------------------------------------------------------------------------------;
+;   Material and the centre table of the incremental evaluation (chess.cpp).      ;
+;   The centre table scores any piece of either colour on its square, ranks 1-4   ;
+;   mirror ranks 8-5. src/host/tune.cpp starts from these values and rewrites     ;
+;   the file; the ones below are the hand-written originals.                      ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef EVAL_WEIGHTS_H
+#define EVAL_WEIGHTS_H
+
+#define EVAL_PAWN 100
+#define EVAL_KNIGHT 300
+#define EVAL_BISHOP 350
+#define EVAL_ROOK 500
+#define EVAL_QUEEN 900
+
+// files a..h
+#define EVAL_CENTRE_RANK_8  0,  0,  5,  0, -5,  0,  5,  0
+#define EVAL_CENTRE_RANK_7  5,  5,  0,  0,  0,  0,  5,  5
+#define EVAL_CENTRE_RANK_6  5, 10, 15, 20, 20, 15, 10,  5
+#define EVAL_CENTRE_RANK_5  5, 10, 20, 30, 30, 20, 10,  5
+#define EVAL_CENTRE_RANK_4  5, 10, 20, 30, 30, 20, 10,  5
+#define EVAL_CENTRE_RANK_3  5, 10, 15, 20, 20, 15, 10,  5
+#define EVAL_CENTRE_RANK_2  5,  5,  0,  0,  0,  0,  5,  5
+#define EVAL_CENTRE_RANK_1  0,  0,  5,  0, -5,  0,  5,  0
+
+#endif
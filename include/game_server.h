@@ -0,0 +1,43 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                   GAME SERVER                                   ;
+;---------------------------------------------------------------------------------;
+;   Plays one game against the client at the other end of a protocol link:        ;
+;   checks the client's moves, keeps the clocks, starts searches on the search    ;
+;   task and answers with the engine's move, board snapshots and batched search   ;
+;   progress. Everything runs in game_server_poll(), called from one task         ;
+;   (loop() on the ESP32); the link's receive side may run on another.            ;
+;                                                                                 ;
+;   Without a clock (base time 0) every engine move is searched for               ;
+;   GAME_SERVER_MOVETIME ms.                                                      ;
+;                                                                                 ;
+;   A hint is a MultiPV search of the player's position for                       ;
+;   GAME_SERVER_HINT_MOVETIME ms, the player's move cancels it.                   ;
+;                                                                                 ;
+;   With a resume region the game, clocks and the engine's table survive a        ;
+;   reset: game_server_resume() picks the game up where it was and searches if    ;
+;   the engine is to move.                                                        ;
+;                                                                                 ;
+;   A web stream (web_stream.h) mirrors the game to WebSocket clients: search     ;
+;   info while the engine thinks, every move played, and moves from a client      ;
+;   when the player is to move.                                                   ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef GAME_SERVER_H
+#define GAME_SERVER_H
+
+#include "protocol.h"
+#include "resume.h"
+#include "web_stream.h"
+
+#define GAME_SERVER_MOVETIME 5000  // ms
+#define GAME_SERVER_HINT_MOVETIME 1000
+
+void game_server_start(Protocol_Structure *protocol);  // after search_task_start, engine plays black from the start position
+int game_server_resume(Resume_Structure *resume);  // after game_server_start, the saved game if any (1, -1 if it can't be set up) and every change saved from now on
+void game_server_stream(Web_Stream_Structure *stream);  // also search info to WebSocket clients and moves from them, once the network is up
+void game_server_stop();  // cancel the search, e.g. the client disconnected; a snapshot request restarts it
+int game_server_poll();  // handle messages and search results, 1 if anything happened
+
+#endif
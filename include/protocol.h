@@ -0,0 +1,117 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                 BINARY PROTOCOL                                 ;
+;---------------------------------------------------------------------------------;
+;   Messages between the engine and the phone app, carried in frames of at most   ;
+;   one ATT payload (MTU - 3 bytes, 20 at the default MTU of 23):                 ;
+;                                                                                 ;
+;     seq u8, type u6 | first << 6 | more << 7, payload chunk                     ;
+;                                                                                 ;
+;   Each direction numbers its frames 0, 1, 2... A message longer than a frame    ;
+;   is split into frames flagged "more" except the last, its first frame is       ;
+;   flagged "first". On a sequence gap the receiver drops the half received       ;
+;   message, counts the lost frames and skips frames up to the next "first".      ;
+;                                                                                 ;
+;   Integers are little endian, squares 0..63 from a1 = 0 to h8 = 63, moves u16   ;
+;   from | to << 6 | promotion << 12 (0 none, 1 knight, 2 bishop, 3 rook,         ;
+;   4 queen). Messages:                                                           ;
+;                                                                                 ;
+;     NEW_GAME     in   engine side u8 (0 white, 1 black), start position         ;
+;     MOVE         in   move u16, the player's move                               ;
+;     ENGINE_MOVE  out  move u16, ponder move u16, score i16, depth u8,           ;
+;                       time ms u32                                               ;
+;     BOARD        out  32 bytes, a nibble per square a1 first (piece & 15 of     ;
+;                       chess.h: 0 empty, 9 P, 11 K, 12 N, 13 B, 14 R, 15 Q,      ;
+;                       black 2 p, 3 k, 4 n, 5 b, 6 r, 7 q), side u8 (0 white),   ;
+;                       castling u8 (1 K, 2 Q, 4 k, 8 q), e.p. square u8 (255)    ;
+;                  in   the same sets up a position, empty asks for a snapshot    ;
+;     CLOCK        out  white ms u32, black ms u32, running u8 (0 none, 1 white,  ;
+;                       2 black)                                                  ;
+;                  in   base ms u32, increment ms u32, 0 - fixed move time        ;
+;     PROGRESS     out  count u8, count x (depth u8, score i16, move u16,         ;
+;                       nodes u32, time ms u32), iterations batched               ;
+;     ERROR        out  code u8                                                   ;
+;     HINT         in   lines u8 (1..4), best moves for the player to move        ;
+;                  out  depth u8, count u8, count x (score i16, length u8,        ;
+;                       length x move u16), best line first, a line is the        ;
+;                       move and the expected continuation                        ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include "chess.h"
+#include "spsc_queue.h"
+
+// message types
+#define PROTOCOL_NEW_GAME    1
+#define PROTOCOL_MOVE        2
+#define PROTOCOL_ENGINE_MOVE 3
+#define PROTOCOL_BOARD       4
+#define PROTOCOL_CLOCK       5
+#define PROTOCOL_PROGRESS    6
+#define PROTOCOL_ERROR       7
+#define PROTOCOL_HINT        8
+
+// error codes
+#define PROTOCOL_ILLEGAL_MOVE 1
+#define PROTOCOL_NOT_YOUR_TURN 2
+#define PROTOCOL_BAD_MESSAGE 3
+
+#define PROTOCOL_FIRST 0x40
+#define PROTOCOL_MORE 0x80
+#define PROTOCOL_HEADER_SIZE 2
+#define PROTOCOL_MIN_FRAME 20  // ATT payload at the default MTU
+#define PROTOCOL_MAX_FRAME 244  // ATT payload at the largest BLE 4.2+ data length
+#define PROTOCOL_MAX_MESSAGE 128
+#define PROTOCOL_BOARD_SIZE 35
+#define PROTOCOL_PROGRESS_SIZE 13
+#define PROTOCOL_MAX_PROGRESS ((PROTOCOL_MAX_MESSAGE - 1) / PROTOCOL_PROGRESS_SIZE)
+#define PROTOCOL_PROGRESS_MS 100  // progress is sent at most this often, iterations in between are batched
+
+typedef struct Transport_Structure Transport_Structure;
+
+struct Transport_Structure {  // a link carrying frames: BLE characteristic, loopback...
+    int frame_size;  // bytes per frame, MTU - 3 for BLE
+    int (*send)(Transport_Structure *transport, const unsigned char *frame, int length);  // 0 if the frame couldn't be sent
+    void *context;
+};
+
+typedef struct { int type, length; unsigned char payload[PROTOCOL_MAX_MESSAGE]; } Protocol_Message_Structure;
+
+typedef struct { int depth, score; Move move; unsigned long nodes, time; } Protocol_Progress_Structure;
+
+typedef struct {  // one end of a link
+    Transport_Structure *transport;
+    unsigned char send_sequence, receive_sequence; int synchronized;  // synchronized - a frame was received, receive_sequence is expected next
+    Protocol_Message_Structure partial;  // message being reassembled, type 0 - none
+    Spsc_Queue_Structure<Protocol_Message_Structure, 8> inbox;  // complete messages, pushed by the receiving task
+    unsigned char progress[PROTOCOL_MAX_MESSAGE]; int progress_count; unsigned long progress_time;  // batch and when the last one was sent
+    unsigned long frames_sent, frames_received, frames_lost, messages_dropped;
+} Protocol_Structure;
+
+void protocol_init(Protocol_Structure *protocol, Transport_Structure *transport);
+void protocol_resynchronize(Protocol_Structure *protocol);  // new connection, accept any sequence number next; receiving task only
+void protocol_receive_frame(Protocol_Structure *protocol, const unsigned char *frame, int length);  // from the transport's receive callback
+int protocol_poll(Protocol_Structure *protocol, Protocol_Message_Structure *message);  // next complete message, 0 if none
+int protocol_send(Protocol_Structure *protocol, int type, const unsigned char *payload, int length);  // 0 if a frame couldn't be sent
+void protocol_queue_progress(Protocol_Structure *protocol, const Protocol_Progress_Structure *progress);  // batched, sent by protocol_flush_progress
+int protocol_flush_progress(Protocol_Structure *protocol, int force);  // send the batch if PROTOCOL_PROGRESS_MS passed since the last one or force, 1 if sent
+
+// payload helpers
+static inline void protocol_put_u16(unsigned char *bytes, unsigned int value) { bytes[0] = (unsigned char)value; bytes[1] = (unsigned char)(value >> 8); }
+static inline void protocol_put_u32(unsigned char *bytes, unsigned long value) { protocol_put_u16(bytes, value & 0xffff); protocol_put_u16(bytes + 2, value >> 16); }
+static inline unsigned int protocol_get_u16(const unsigned char *bytes) { return bytes[0] | bytes[1] << 8; }
+static inline unsigned long protocol_get_u32(const unsigned char *bytes) { return protocol_get_u16(bytes) | (unsigned long)protocol_get_u16(bytes + 2) << 16; }
+
+unsigned int protocol_encode_move(Move move);  // 0 for no move
+Move protocol_decode_move(Engine_Structure *engine, unsigned int move);  // pseudo-legal move of the engine's position as parse_move() finds it, 0 if none
+void protocol_encode_board(Position_Structure *position, unsigned char *board);  // PROTOCOL_BOARD_SIZE bytes
+int protocol_decode_board(const unsigned char *board, char *fen);  // FEN_LENGTH chars, 0 on a malformed board
+
+#if !defined(ESP_PLATFORM)
+void loopback_connect(Protocol_Structure *a, Protocol_Structure *b, Transport_Structure transports[2], int frame_size);  // in-process link, a frame sent by one end is received by the other on the sending thread
+#endif
+
+#endif
@@ -0,0 +1,67 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                   FAST RESUME                                   ;
+;---------------------------------------------------------------------------------;
+;   The game kept in a flash region across resets and brown-outs: the "resume"    ;
+;   data partition on the ESP32 (partitions.csv), a file of the same layout on    ;
+;   the host. Writes behave like NOR flash on both: erase sets a sector to 0xff,  ;
+;   a write only clears bits.                                                     ;
+;                                                                                 ;
+;   The region is a log of records, each with a sequence number and a CRC-32:     ;
+;                                                                                 ;
+;     GAME   start position (protocol_encode_board), engine side, clocks and      ;
+;            every move played; opens each sector                                 ;
+;     MOVE   one move and the clocks after it, appended                           ;
+;     TABLE  the deepest transposition table entries of the last search           ;
+;                                                                                 ;
+;   A sector that fills up is left as it is and the next one is erased and        ;
+;   opened with a GAME record of the whole game, so the sectors wear in turn and  ;
+;   the newest complete sector always holds the game. Loading reads the first     ;
+;   record of each sector, then replays the newest one up to the first record     ;
+;   that is erased or fails its CRC (a write cut by a reset). After a load the    ;
+;   next save opens a fresh sector, the torn tail is never written over.          ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef RESUME_H
+#define RESUME_H
+
+#include "chess.h"
+#include "protocol.h"
+#include "tt.h"
+
+#define RESUME_SECTOR_SIZE 4096  // flash erase unit
+#define RESUME_HOST_SIZE (16 * RESUME_SECTOR_SIZE)  // region file created on the host, the size of the partition
+#define RESUME_MAX_MOVES 600  // plies, a GAME record still fits a sector
+
+#ifndef RESUME_TABLE_ENTRIES
+#define RESUME_TABLE_ENTRIES 64  // transposition table entries saved after a search, 16 bytes each; 0 - none
+#endif
+
+typedef struct {
+    unsigned char start[PROTOCOL_BOARD_SIZE];  // start position
+    int engine_side;  // 8 white, 16 black
+    unsigned long clock_base, clock_increment, clock_left[2]; int clock_running;  // as the game server keeps them, ms; running 0, 8 or 16
+    int move_count; unsigned short moves[RESUME_MAX_MOVES];  // protocol_encode_move()
+} Resume_Game_Structure;
+
+typedef struct {
+    unsigned long handle;  // const esp_partition_t * on the ESP32, file descriptor on the host
+    unsigned long size; int sector_count;
+    int sector, offset;  // where the next record goes, offset RESUME_SECTOR_SIZE - the next record opens the following sector
+    unsigned long sequence;  // of the last record
+    Resume_Game_Structure game;  // the game the records add up to, written whole into each new sector
+    unsigned long writes, erases;  // records and sectors since resume_open
+} Resume_Structure;
+
+int resume_open(Resume_Structure *resume, const char *name);  // ESP32 partition label or host file path, created if missing; 0 on failure
+void resume_close(Resume_Structure *resume);
+
+int resume_load(Resume_Structure *resume);  // resume->game from the log, 0 if no game was saved
+int resume_load_table(Resume_Structure *resume, TT_Structure *tt);  // stores the saved entries in tt, count
+
+int resume_save_game(Resume_Structure *resume);  // resume->game changed as a whole: new game, position set up, clock set; 0 on a flash error
+int resume_save_move(Resume_Structure *resume, unsigned int move, const unsigned long clock_left[2], int clock_running);  // move played, appended to resume->game
+int resume_save_table(Resume_Structure *resume, TT_Structure *tt);  // hot entries of tt, best after a search; 0 on a flash error or RESUME_TABLE_ENTRIES 0
+
+#endif
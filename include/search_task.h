@@ -0,0 +1,68 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                  SEARCH TASK                                    ;
+;---------------------------------------------------------------------------------;
+;   Runs the engine in its own task so that a long search never blocks the BLE    ;
+;   stack or the Arduino loop(). On the ESP32 it is a FreeRTOS task pinned to     ;
+;   the core the radio doesn't use; on the host it is a std::thread.             ;
+;                                                                                 ;
+;   Requests and results pass through lock-free single producer / single          ;
+;   consumer queues: submit from one task (e.g. the BLE callback), poll from one  ;
+;   task (e.g. loop()). A new request cancels the search in progress, only the    ;
+;   newest queued request is searched; every request gets a final result, a       ;
+;   stopped one if it was cancelled or superseded.                                ;
+;                                                                                 ;
+;   Pondering: after the engine moves, submit the game + the result's ponder move ;
+;   with ponder set. On a ponder hit call search_task_ponder_hit() and the search ;
+;   continues as the real one; on a miss submit the real position, which cancels  ;
+;   the ponder search.                                                            ;
+;                                                                                 ;
+;   Opening book: a position found in the book is answered at once with a book    ;
+;   move picked by weight, result depth 0 and no ponder move.                     ;
+;                                                                                 ;
+;   MultiPV: a request with limits.multi_pv set (e.g. a hint for the player)      ;
+;   bypasses the book and reports the best lines with every result.               ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef SEARCH_TASK_H
+#define SEARCH_TASK_H
+
+#include "book.h"
+#include "chess.h"
+#include "tt.h"
+
+#define REQUEST_MOVES_LENGTH 1200  // 200 plies of "e7e8q "
+
+typedef struct {
+    int id;  // echoed in the results
+    char fen[96];  // empty - start position
+    char moves[REQUEST_MOVES_LENGTH];  // moves played from fen, e.g. "e2e4 e7e5"
+    Search_Limits_Structure limits;  // limits of the real search when pondering
+    int ponder;  // search the position after moves without a clock until search_task_ponder_hit()
+    int new_game;  // clear the transposition table and history first
+} Search_Request_Structure;
+
+typedef struct {
+    int id, final, stopped;  // final - last result of the request, stopped - cancelled or illegal position/move
+    int depth, score; Move best_move, ponder_move; char move_string[6], ponder_string[6];  // ponder move - expected reply, 0 if unknown
+    unsigned long long nodes; unsigned long time;  // ms
+    int line_count; Pv_Line_Structure lines[MULTI_PV_MAX];  // limits.multi_pv requests: the best lines, best first; other searches: the PV
+} Search_Result_Structure;
+
+void search_task_book(const Book_Structure *book);  // before search_task_start, book moves are played without a search; NULL - none
+int search_task_start(int threads);  // create the task searching on threads Lazy SMP threads (1..SMP_MAX_THREADS), 0 on failure
+void search_task_stop();  // cancel the search and end the task
+int search_task_submit(const Search_Request_Structure *request);  // queue request, the running search stops at its next poll; 0 and left running if the queue is full; a superseded request's final result is stopped
+void search_task_cancel();  // abort the running search, its final result is still posted
+void search_task_ponder_hit(int id);  // the predicted move of ponder request id was played, start its clock
+int search_task_poll(Search_Result_Structure *result);  // non-blocking, 0 if no result is waiting
+TT_Structure *search_task_table();  // the task's transposition table, to save or restore entries between searches
+
+#if SEARCH_STATS
+int search_task_poll_stats(unsigned char *record);  // next STATS_RECORD_SIZE byte statistics record (stats.h), 0 if none
+#else
+static inline int search_task_poll_stats(unsigned char *) { return 0; }
+#endif
+
+#endif
@@ -0,0 +1,47 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                  SENSOR BOARD                                   ;
+;---------------------------------------------------------------------------------;
+;   Turns readings of a square-sensor matrix (one occupied bit per square,       ;
+;   a1 = bit 0 .. h8 = bit 63) into moves. A reading counts once it has been     ;
+;   unchanged for SENSOR_SETTLE_MS, which swallows contact bounce and pieces      ;
+;   sliding across squares.                                                       ;
+;                                                                                 ;
+;   sensor_board_set_position() indexes the legal moves of a position by the     ;
+;   squares they change: from and to for a quiet move, only from for a capture,  ;
+;   plus the taken pawn for e.p. and the rook for castling. A settled reading is  ;
+;   then one binary search away from its move. Captures from the same square     ;
+;   change the same squares, the piece lifted off the target tells them apart;    ;
+;   promotions play board->promotion.                                             ;
+;                                                                                 ;
+;   Castle king first: a rook moved first reads as a rook move.                   ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef SENSOR_BOARD_H
+#define SENSOR_BOARD_H
+
+#include "chess.h"
+
+#define SENSOR_SETTLE_MS 60
+
+// sensor_board_update results
+#define SENSOR_NONE       0  // board as in the position
+#define SENSOR_MOVE       1  // a move was completed
+#define SENSOR_UNRESOLVED 2  // board differs from the position and no legal move explains it: piece in the air, or misplaced
+
+typedef struct { unsigned long long changed; Move move; } Sensor_Move_Structure;
+
+typedef struct {
+    unsigned long long position, settled, reading;  // occupancy of the position, of the last settled and of the last reading
+    unsigned long long lifted;  // squares of the position seen empty since it was set up
+    unsigned long reading_time;  // ms the last reading changed
+    int promotion;  // piece type promoted to: 4 knight, 5 bishop, 6 rook, 7 queen (default)
+    Sensor_Move_Structure moves[MAX_MOVES]; int move_count;  // by changed squares
+} Sensor_Board_Structure;
+
+unsigned long long position_occupancy(Position_Structure *position);  // sensor bits of position
+void sensor_board_set_position(Sensor_Board_Structure *board, Engine_Structure *engine);  // index the legal moves of engine->position, after every move
+int sensor_board_update(Sensor_Board_Structure *board, unsigned long long reading, unsigned long now, Move *move);  // call every poll, SENSOR_xxx; move on SENSOR_MOVE
+
+#endif
@@ -0,0 +1,32 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                   LAZY SMP                                      ;
+;---------------------------------------------------------------------------------;
+;   Parallel search: the caller's thread runs the iterative deepening that        ;
+;   decides the move, helper threads search copies of the same position and only  ;
+;   share what they find through the transposition table. Odd helpers start one   ;
+;   ply deeper so the threads spread over different depths.                       ;
+;                                                                                 ;
+;   The caller owns the helpers, so independent games can search in parallel     ;
+;   with their own helper sets and tables.                                        ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef SMP_H
+#define SMP_H
+
+#include "chess.h"
+
+#ifndef SMP_MAX_THREADS
+#if defined(ESP_PLATFORM)
+#define SMP_MAX_THREADS 2  // one search thread per core
+#else
+#define SMP_MAX_THREADS 16
+#endif
+#endif
+
+typedef struct { Engine_Structure engine; Search_Info_Structure search_info; Search_Limits_Structure limits; } Smp_Helper_Structure;  // state of one helper thread, too big for a task stack
+
+int search_parallel(Engine_Structure *engine, Smp_Helper_Structure *helpers, int helper_count, Search_Limits_Structure *limits, Search_Info_Structure *search_info);  // search_iterative on 1 + helper_count threads (at most SMP_MAX_THREADS) sharing engine->tt, nodes are summed over all
+
+#endif
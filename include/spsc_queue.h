@@ -0,0 +1,46 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                 LOCK-FREE QUEUE                                 ;
+;---------------------------------------------------------------------------------;
+;   Single producer single consumer ring of N (power of two) items copied in and  ;
+;   out. One task pushes, one task pops, neither ever blocks.                     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+
+template <typename T, unsigned N> struct Spsc_Queue_Structure {
+    T slots[N];
+    std::atomic<unsigned> head{0}, tail{0};  // head - next to pop, tail - next to push, free running
+
+    int push(const T *item)  // producer only
+    {
+        unsigned t = tail.load(std::memory_order_relaxed);
+
+        if (t - head.load(std::memory_order_acquire) == N) return 0;  // full
+
+        slots[t & (N - 1)] = *item;
+        tail.store(t + 1, std::memory_order_release);
+
+        return 1;
+    }
+
+    int pop(T *item)  // consumer only
+    {
+        unsigned h = head.load(std::memory_order_relaxed);
+
+        if (h == tail.load(std::memory_order_acquire)) return 0;  // empty
+
+        *item = slots[h & (N - 1)];
+        head.store(h + 1, std::memory_order_release);
+
+        return 1;
+    }
+
+    int empty() { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); }
+};
+
+#endif
@@ -0,0 +1,57 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                SEARCH STATISTICS                                ;
+;---------------------------------------------------------------------------------;
+;   Built with SEARCH_STATS=1 the search task turns every completed iteration     ;
+;   into two 20 byte records, small enough for one BLE notification at the        ;
+;   default MTU. main.cpp sends them on the stats characteristic and prints       ;
+;   them to Serial as "stats <hex>" lines; the host stats-csv tool decodes        ;
+;   either into CSV. With SEARCH_STATS=0 (default) nothing here is compiled in.   ;
+;                                                                                 ;
+;   Records, little endian:                                                       ;
+;     iteration  type 1, depth, id u16, time ms u32, nodes u32,                   ;
+;                qnodes per mille u16, branching factor x100 u16,                 ;
+;                TT hits per mille u16, stack peak bytes u16                      ;
+;     cutoffs    type 2, depth, id u16, 8 x u16 per mille of the beta cutoffs     ;
+;                by move number 1, 2, 3, 4, 5-6, 7-10, 11-20, 21+                 ;
+;   Counts are cumulative over the search, nodes / time is the NPS.               ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef STATS_H
+#define STATS_H
+
+#include "chess.h"
+
+#define STATS_RECORD_SIZE 20
+#define STATS_ITERATION 1
+#define STATS_CUTOFFS 2
+
+typedef struct {  // one search, decoded
+    int type, depth, id;
+    unsigned long time, nodes; int qnodes_permille, branching_factor, tt_hit_permille, stack_peak;  // branching factor x100
+    int cutoff_permille[STATS_CUTOFF_BUCKETS];
+} Stats_Record_Structure;
+
+typedef struct { int id; unsigned long long previous_nodes[2]; } Stats_Structure;  // nodes of the last two iterations
+
+#if SEARCH_STATS
+
+static inline int stats_cutoff_bucket(int move_number)
+{
+    return (move_number <= 4) ? move_number - 1 : (move_number <= 6) ? 4 : (move_number <= 10) ? 5 : (move_number <= 20) ? 6 : 7;
+}
+
+#define STATS_CUTOFF(search_info, move_number) ((search_info)->cutoff_histogram[stats_cutoff_bucket(move_number)]++)
+
+#else
+
+#define STATS_CUTOFF(search_info, move_number) ((void)0)
+
+#endif
+
+void stats_start(Stats_Structure *stats, int id);  // before a search
+int stats_iteration(Stats_Structure *stats, Search_Info_Structure *search_info, unsigned char records[2][STATS_RECORD_SIZE]);  // after each iteration, returns the record count
+int stats_decode(const unsigned char *bytes, Stats_Record_Structure *record);  // 0 if not a record
+
+#endif
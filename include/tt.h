@@ -0,0 +1,55 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                              TRANSPOSITION TABLE                                ;
+;---------------------------------------------------------------------------------;
+;   Buckets of four 16 byte entries (one 64 byte cache line) indexed by the       ;
+;   Zobrist position key. The size is a power of two number of buckets chosen    ;
+;   from TT_SIZE_KB at build time or tt_init() at run time.                       ;
+;                                                                                 ;
+;   A table is an object owned by the caller: one per game, shared by the Lazy    ;
+;   SMP threads searching that game, or none at all (engine->tt = NULL).          ;
+;                                                                                 ;
+;   Lazy SMP threads share the table without locks: a slot holds the entry data   ;
+;   and key ^ data, so a slot torn by two threads writing at once fails the key   ;
+;   check and reads as a miss.                                                    ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef TT_H
+#define TT_H
+
+#include <stddef.h>
+
+#ifndef TT_SIZE_KB
+#if defined(BOARD_HAS_PSRAM)
+#define TT_SIZE_KB 2048  // ESP32 with PSRAM
+#elif defined(ARDUINO)
+#define TT_SIZE_KB 32  // ESP32 internal SRAM, shared with the BLE stack
+#else
+#define TT_SIZE_KB 65536  // native host
+#endif
+#endif
+
+// bound types
+#define TT_LOWER 1  // score >= beta, fail high
+#define TT_UPPER 2  // score <= alpha, fail low
+#define TT_EXACT 3
+
+typedef struct { unsigned int move; short score; unsigned char depth, flags; } TT_Entry_Structure;  // flags: bound | generation << 2
+
+typedef struct TT_Structure TT_Structure;
+
+struct TT_Structure {  // all zero - not configured yet, TT_SIZE_KB is allocated by the first tt_new_search()
+    struct TT_Bucket_Structure *volatile buckets;
+    size_t bucket_mask;  // number of buckets - 1
+    int configured, generation;
+};
+
+size_t tt_init(TT_Structure *tt, size_t size_in_bytes);  // (re)allocate table, 0 frees and disables it, returns the size actually allocated
+void tt_clear(TT_Structure *tt);  // forget all entries
+void tt_new_search(TT_Structure *tt);  // age entries, allocates TT_SIZE_KB on first use
+int tt_probe(TT_Structure *tt, unsigned long long key, TT_Entry_Structure *entry);  // copy of the entry matching key, 0 if none or tt is NULL
+void tt_store(TT_Structure *tt, unsigned long long key, int depth, int bound, int score, unsigned int move);  // move is a packed Move
+int tt_hot_entries(TT_Structure *tt, unsigned long long *keys, TT_Entry_Structure *entries, int max_entries);  // deepest entries of the current search, count
+
+#endif
@@ -0,0 +1,62 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                              WEBSOCKET INFO STREAM                              ;
+;---------------------------------------------------------------------------------;
+;   A minimal WebSocket server (RFC 6455) on non-blocking BSD sockets: lwIP on    ;
+;   the ESP32 once Wi-Fi is up (wifi_link.h), the loopback interface on the host. ;
+;   Everything runs in web_stream_poll() and web_stream_flush(), called from the  ;
+;   task that polls the game server; nothing blocks and the search task never     ;
+;   waits on a client.                                                            ;
+;                                                                                 ;
+;   Out, text frames of one JSON object each:                                     ;
+;                                                                                 ;
+;     {"depth":9,"score":31,"nodes":812345,"nps":296000,"time":2744,              ;
+;      "pv":"e2e4 e7e5 g1f3"}                        search info, coalesced       ;
+;     {"move":"e7e5"}                                a move played, either side   ;
+;     {"fen":"..."}                                  the board, on request        ;
+;     {"error":"illegal move"}                                                    ;
+;                                                                                 ;
+;   In, text frames: a move ("e2e4", "e7e8q") or "board".                         ;
+;                                                                                 ;
+;   Search info is coalesced: only the newest iteration is kept and it is sent    ;
+;   at most every WEB_STREAM_INFO_MS. A client whose output buffer still holds    ;
+;   the last frame skips the info, one that can't take a move is dropped.         ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef WEB_STREAM_H
+#define WEB_STREAM_H
+
+#include "chess.h"
+
+#define WEB_STREAM_PORT 8080
+#define WEB_STREAM_CLIENTS 2
+#define WEB_STREAM_INFO_MS 200  // info frames at most this often
+#define WEB_STREAM_INPUT 1024  // the handshake request, a browser's included, or one incoming frame
+#define WEB_STREAM_OUTPUT 1024  // frames the socket didn't take yet
+#define WEB_STREAM_TEXT 256  // outgoing message, incoming message
+
+typedef struct { int depth, score; unsigned long long nodes; unsigned long time; int pv_length; Move pv[MULTI_PV_LENGTH]; } Web_Stream_Info_Structure;
+
+typedef struct {
+    int socket, open;  // socket -1 - free slot, open - handshake done
+    int input_length, output_length; unsigned char input[WEB_STREAM_INPUT], output[WEB_STREAM_OUTPUT];
+} Web_Client_Structure;
+
+typedef struct {
+    int listener, port;  // port actually bound, e.g. for port 0
+    Web_Client_Structure clients[WEB_STREAM_CLIENTS];
+    Web_Stream_Info_Structure info; int info_pending; unsigned long info_time;  // newest info not sent yet, time_ms() of the last one sent
+    unsigned long infos_sent, infos_coalesced, clients_dropped;
+} Web_Stream_Structure;
+
+int web_stream_open(Web_Stream_Structure *stream, int port, int loopback);  // listen on port, 127.0.0.1 only if loopback; 0 on failure
+void web_stream_close(Web_Stream_Structure *stream);
+int web_stream_poll(Web_Stream_Structure *stream, char *text, int size);  // accept, handshake and read clients: 1 and a text message if one arrived
+int web_stream_clients(Web_Stream_Structure *stream);  // clients past the handshake
+
+void web_stream_info(Web_Stream_Structure *stream, const Web_Stream_Info_Structure *info);  // replaces any info not sent yet
+int web_stream_flush(Web_Stream_Structure *stream, int force);  // send the pending info if WEB_STREAM_INFO_MS passed or force, 1 if anything was written
+void web_stream_send(Web_Stream_Structure *stream, const char *text);  // a message to every client, queued ahead of any pending info
+
+#endif
@@ -0,0 +1,26 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                   WI-FI LINK                                    ;
+;---------------------------------------------------------------------------------;
+;   Station mode bring-up that never blocks setup() or loop(): wifi_link_start()  ;
+;   only asks the driver to connect, the driver's events mark the link up or      ;
+;   down, and wifi_link_poll() retries after WIFI_LINK_RETRY_MS, doubled after    ;
+;   every failure up to WIFI_LINK_RETRY_MAX_MS, so a missing access point costs   ;
+;   nothing but a retry now and then.                                             ;
+;                                                                                 ;
+;   Credentials come from the build (-D WIFI_SSID, -D WIFI_PASSWORD, filled from  ;
+;   the environment in platformio.ini), never from the source.                    ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#ifndef WIFI_LINK_H
+#define WIFI_LINK_H
+
+#define WIFI_LINK_RETRY_MS 1000  // first reconnect delay
+#define WIFI_LINK_RETRY_MAX_MS 60000
+
+void wifi_link_start(const char *ssid, const char *password);  // returns at once, an empty ssid leaves Wi-Fi off
+int wifi_link_poll();  // from loop(): retries when the backoff ran out, 1 on the poll the link came up
+int wifi_link_connected();
+
+#endif
@@ -0,0 +1,85 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                ENDGAME BITBASES                                 ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <stdlib.h>
+
+#include "bitbase.h"
+
+static inline int transpose(int square) { return (square & 7) * 8 + (square >> 3); }  // reflect in the a1-h8 diagonal
+
+int bitbase_index(int table, int strong_king, int piece, int weak_king)
+{
+    int file, rank;
+
+    if (table == BITBASE_KPK) {
+        if ((piece & 7) > 3) { strong_king ^= 7; piece ^= 7; weak_king ^= 7; }  // pawn on files a-d
+        if (piece < 8 || piece >= 56) return -1;
+
+        return (((piece >> 3) - 1) * 4 + (piece & 7)) * 4096 + strong_king * 64 + weak_king;
+    }
+
+    if ((strong_king & 7) > 3) { strong_king ^= 7; piece ^= 7; weak_king ^= 7; }  // strong king in the a1-d1-d4 triangle
+    if (strong_king >> 3 > 3) { strong_king ^= 56; piece ^= 56; weak_king ^= 56; }
+    if (strong_king >> 3 > (strong_king & 7)) { strong_king = transpose(strong_king); piece = transpose(piece); weak_king = transpose(weak_king); }
+
+    file = strong_king & 7; rank = strong_king >> 3;
+    return (file * (file + 1) / 2 + rank) * 4096 + piece * 64 + weak_king;
+}
+
+int bitbase_value(int table, int index)  // O(1): the entry's bits lie within three bytes
+{
+    const Bitbase_Table_Structure *bitbase = &bitbase_tables[table];
+    int bit = index * bitbase->bits; const unsigned char *data = bitbase->data + (bit >> 3);
+
+    return ((data[0] | data[1] << 8 | data[2] << 16) >> (bit & 7)) & ((1 << bitbase->bits) - 1);
+}
+
+int bitbase_pieces(Position_Structure *position)
+{
+    int square = 0, pieces = 0;
+
+    do {
+        pieces += position->board_array[square] != 0;
+        square = (square + 9) & ~0x88;
+    } while (square);
+
+    return pieces;
+}
+
+int bitbase_probe(Position_Structure *position, int side, int ply, int *score)
+{
+    int *board_array = position->board_array, square = 0, pieces = 0, kings[2] = { 0, 0 }, piece = 0, piece_square = 0, table, strong, index, value;
+
+    do { // kings and one other piece
+        int square_piece = board_array[square];
+
+        if (square_piece) {
+            if (++pieces > 3) return 0;
+            if ((square_piece & 7) == 3) kings[square_piece >> 4 & 1] = (7 - (square >> 4)) * 8 + (square & 7);
+            else { piece = square_piece; piece_square = (7 - (square >> 4)) * 8 + (square & 7); }
+        }
+        square = (square + 9) & ~0x88;
+    } while (square);
+
+    strong = piece & 24;
+    if (pieces != 3 || strong == side) return 0;  // only the lone king's moves are stored
+    if (abs((kings[0] & 7) - (kings[1] & 7)) < 2 && abs((kings[0] >> 3) - (kings[1] >> 3)) < 2) return 0;  // strong king in check, left to the king capture
+
+    switch (piece & 7) {
+        case 1: case 2: table = BITBASE_KPK; break;
+        case 6: table = BITBASE_KRK; break;
+        case 7: table = BITBASE_KQK; break;
+        default: return 0;
+    }
+
+    if (strong == 16) { kings[0] ^= 56; kings[1] ^= 56; piece_square ^= 56; }  // black strong: flip the board, the pawn then runs up it
+    if ((index = bitbase_index(table, kings[strong >> 4 & 1], piece_square, kings[strong >> 3 & 1])) < 0) return 0;
+    value = bitbase_value(table, index);
+
+    *score = value ? -(((table == BITBASE_KPK) ? BITBASE_WIN : BITBASE_MATE) - ply - 2 * (value - 1)) : 0;  // nearer wins score higher
+
+    return 1;
+}
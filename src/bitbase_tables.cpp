@@ -0,0 +1,4500 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                     ENDGAME BITBASES, written by make_bitbase                   ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include "bitbase.h"
+
+static const unsigned char kpk_data[61442] = {  // KPK, 98304 entries of 5 bits
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x18, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0xb5, 0xd6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0xb0,
+    0xd6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xd6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x18, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x18, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x07, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0xa0,
+    0x54, 0x4a, 0x00, 0x00, 0xa0, 0x94, 0x52, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0xa5, 0x52, 0x32, 0x00, 0x00, 0xa5, 0x94, 0x32, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x90, 0xd2, 0x31, 0x00, 0x00, 0xa0, 0x94, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x94, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0xa4, 0x73, 0xce, 0x39, 0x00, 0x24, 0x84, 0x10, 0x42, 0x00, 0x00, 0x90, 0x12, 0x42, 0x00, 0x00, 0x90, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x40,
+    0x4a, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x9c, 0x73,
+    0xce, 0x31, 0x00, 0x80, 0x94, 0x10, 0x32, 0x00, 0x80, 0x94, 0x52, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00,
+    0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x80, 0xd0, 0x31, 0x00,
+    0x00, 0x90, 0x52, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x52, 0x32, 0x00, 0x00, 0x00, 0x40,
+    0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x60,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00,
+    0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00,
+    0x00, 0x80, 0x10, 0x3a, 0x00, 0x00, 0x80, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x10, 0x3a,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x9c, 0x73, 0xce, 0x31, 0x00, 0x00, 0x84, 0xce, 0x31, 0x00, 0x00, 0x84, 0x10,
+    0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x18, 0x63,
+    0x8c, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x70, 0xce, 0x31, 0x00, 0x00, 0x80, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x00,
+    0x00, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x9c, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x63, 0x8c, 0x31, 0x00,
+    0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x80, 0x8c, 0x31, 0x00, 0x00, 0x80, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80,
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x92, 0x31, 0x00, 0x00, 0x00, 0x92, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x32, 0x00, 0x00, 0x00, 0x80, 0x32, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x9c, 0x73,
+    0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00,
+    0x80, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00,
+    0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x73, 0x8e, 0x31, 0x00, 0x80, 0x73, 0x8e, 0x31, 0x00, 0x00, 0x70, 0x8e, 0x31, 0x00, 0x00, 0x70, 0x8e, 0x31,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x9c, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c,
+    0x31, 0x00, 0x00, 0x70, 0x8e, 0x31, 0x00, 0x00, 0x70, 0x8e, 0x31, 0x00, 0x00, 0x70, 0x8e, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x9c, 0x73,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31, 0x00, 0x00,
+    0x00, 0xce, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x80, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00,
+    0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xd2, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x80, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce,
+    0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x60,
+    0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00,
+    0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x70, 0x8c, 0x31, 0x00, 0x00, 0x70, 0x8c, 0x31, 0x00,
+    0x00, 0x80, 0x8c, 0x31, 0x00, 0x00, 0x80, 0x8c, 0x31, 0x00, 0x00, 0x80, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e,
+    0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00,
+    0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00,
+    0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c,
+    0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x80, 0x73, 0x8c, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00,
+    0x00, 0x8e, 0x31, 0x00, 0x00, 0x70, 0x8e, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xd0, 0x31, 0x00, 0x00, 0x00, 0xd2, 0x31, 0x00,
+    0x00, 0x00, 0xd2, 0x31, 0x00, 0x00, 0x00, 0xd2, 0x31, 0x00, 0x00, 0x00, 0xd2, 0x31, 0x00, 0x00, 0x00, 0xd2, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x18,
+    0xe1, 0x6b, 0x00, 0x00, 0x10, 0xe1, 0x6b, 0x00, 0x00, 0x10, 0xe1, 0x6b, 0x00, 0x00, 0x10, 0xe1, 0x6b, 0x00, 0x00, 0x10, 0xe1, 0x6b, 0x00, 0x00,
+    0x10, 0xe1, 0x6b, 0x00, 0x00, 0x10, 0xe1, 0x6b, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x18, 0xe1, 0x6b, 0x00, 0x00, 0x10, 0xe1, 0x6b, 0x00,
+    0x00, 0x10, 0xe1, 0x6b, 0x00, 0x00, 0x10, 0xe1, 0x6b, 0x00, 0x00, 0x10, 0xe1, 0x6b, 0x00, 0x00, 0x10, 0xe1, 0x6b, 0x00, 0x00, 0x10, 0xe1, 0x6b,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0,
+    0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00,
+    0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00,
+    0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b,
+    0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00,
+    0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0xac, 0xb5, 0xd6, 0x5a, 0x00, 0x00, 0xf8, 0x1c, 0x5b, 0x00, 0x00, 0xf8, 0x1c, 0x5b, 0x00, 0x00, 0xf8, 0x1c,
+    0x5b, 0x00, 0x00, 0xf8, 0x1c, 0x5b, 0x00, 0x00, 0xf8, 0x1c, 0x5b, 0xef, 0xbd, 0xf7, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x06, 0x00, 0xb0, 0xd6, 0x5a, 0x00, 0x00, 0xf0, 0x1c, 0x5b, 0x00,
+    0x00, 0xf0, 0x1c, 0x5b, 0x00, 0x00, 0xf0, 0x1c, 0x5b, 0x00, 0x00, 0xf0, 0x1c, 0x5b, 0x00, 0x00, 0xf0, 0x1c, 0x5b, 0xef, 0xbd, 0xf7, 0x1c, 0x5b,
+    0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xd6, 0x5a, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x1c,
+    0x5b, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0xef, 0xbd, 0xf7, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00,
+    0xc0, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00,
+    0x00, 0x00, 0x5b, 0x10, 0x42, 0x08, 0x21, 0x5b, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00,
+    0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x62, 0x5c,
+    0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x94, 0x00, 0x00, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xe7, 0x9c, 0x73, 0x8e, 0x31, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x00, 0x38, 0xa7, 0x94, 0x52, 0x00,
+    0x3c, 0xd7, 0x96, 0x52, 0x0f, 0x3c, 0xd7, 0x96, 0x52, 0x00, 0x3c, 0xd7, 0x96, 0x52, 0xce, 0x39, 0xd7, 0x96, 0x52, 0xce, 0x39, 0xd7, 0x96, 0x52,
+    0xe7, 0x20, 0x84, 0x10, 0x42, 0x00, 0x00, 0xa5, 0x94, 0x4a, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x00, 0xd7, 0x96, 0x52, 0xc0, 0x01, 0xd7, 0x96,
+    0x52, 0x00, 0x00, 0xd7, 0x96, 0x52, 0xce, 0x39, 0xd7, 0x96, 0x52, 0xce, 0x39, 0xd7, 0x96, 0x52, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0xa0,
+    0x54, 0x4a, 0x0e, 0x00, 0xa0, 0x94, 0x52, 0x0f, 0x00, 0xd0, 0x96, 0x52, 0x0f, 0x3c, 0xd0, 0x96, 0x52, 0x0f, 0x00, 0xd0, 0x96, 0x52, 0xce, 0x39,
+    0xd7, 0x96, 0x52, 0xce, 0x39, 0xd7, 0x96, 0x52, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x52, 0x3a, 0x00, 0x00, 0x00, 0x94, 0x52, 0x00,
+    0x00, 0x00, 0x96, 0x52, 0x00, 0x00, 0x08, 0x96, 0x52, 0x00, 0x00, 0x00, 0x96, 0x52, 0xef, 0xbd, 0xf7, 0x96, 0x52, 0xef, 0xbd, 0xf7, 0x96, 0x52,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x52, 0x00, 0x00, 0x00, 0x80, 0x52, 0x00, 0x00, 0x10, 0x81,
+    0x52, 0x00, 0x00, 0x00, 0x80, 0x52, 0x00, 0x00, 0x00, 0xa1, 0x52, 0x10, 0x42, 0x08, 0xa1, 0x52, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x24, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+    0x00, 0x62, 0x5c, 0x00, 0x00, 0x00, 0x62, 0x5c, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x94, 0x00, 0x00, 0x00, 0x80, 0x94,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x94,
+    0x12, 0x42, 0x00, 0x80, 0x94, 0x52, 0x4a, 0x00, 0xb4, 0x96, 0x52, 0x4a, 0x00, 0xb4, 0xa6, 0x52, 0x4a, 0xcd, 0xb5, 0xa6, 0x52, 0x4a, 0xce, 0x35,
+    0xa6, 0x52, 0x4a, 0x8c, 0x31, 0xa6, 0x52, 0x4a, 0x00, 0x80, 0x74, 0xce, 0x39, 0x00, 0x80, 0x84, 0x10, 0x42, 0x00, 0x80, 0x94, 0x52, 0x42, 0x00,
+    0x80, 0x94, 0x52, 0x4a, 0x00, 0x00, 0xa6, 0x52, 0x4a, 0x8d, 0x35, 0xa6, 0x52, 0x4a, 0xad, 0x35, 0xa6, 0x52, 0x4a, 0x8c, 0x31, 0xa6, 0x52, 0x4a,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x73, 0xce, 0x39, 0x00, 0x00, 0x90, 0x12, 0x42, 0x0d, 0x00, 0x90, 0x52, 0x4a, 0x0d, 0x00, 0xa0, 0x52,
+    0x4a, 0xcd, 0x35, 0xa7, 0x52, 0x4a, 0xcd, 0x39, 0xa7, 0x52, 0x4a, 0x8c, 0x31, 0xa6, 0x52, 0x4a, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x52, 0x4a, 0x00, 0x00, 0xf7, 0x52, 0x4a, 0xef, 0xbd,
+    0xf7, 0x52, 0x4a, 0xad, 0xb5, 0xd6, 0x52, 0x4a, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00,
+    0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0xf0, 0xa0, 0x4a, 0x00, 0x00, 0x00, 0xa1, 0x4a, 0x10, 0x42, 0xe8, 0x9c, 0x4a,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x60, 0x4c, 0x00, 0x00, 0x00, 0x62, 0x4c, 0x00, 0x00, 0x00, 0xde, 0x4b, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x94, 0x00, 0x00,
+    0x00, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x80, 0x94, 0x10, 0x42, 0x00, 0x30, 0x96, 0x10,
+    0x42, 0x00, 0x2c, 0x96, 0x10, 0x42, 0x8b, 0x31, 0x96, 0x10, 0x42, 0x8c, 0xad, 0x84, 0x10, 0x42, 0x00, 0x00, 0x74, 0xce, 0x39, 0x00, 0x00, 0x74,
+    0xce, 0x39, 0x00, 0x00, 0x84, 0xce, 0x39, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x80, 0x84, 0x10, 0x42, 0x4b, 0xad,
+    0x84, 0x10, 0x42, 0x6b, 0xad, 0x84, 0x10, 0x42, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x73, 0xce, 0x39, 0x00,
+    0x00, 0x80, 0xd0, 0x39, 0x0c, 0x00, 0x80, 0x10, 0x42, 0x0b, 0x00, 0x80, 0x10, 0x42, 0x8c, 0x2d, 0x86, 0x10, 0x42, 0x8b, 0x31, 0x86, 0x10, 0x42,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0x10,
+    0x42, 0x00, 0x00, 0x00, 0x12, 0x42, 0xef, 0x3d, 0xd6, 0x12, 0x42, 0xad, 0xb5, 0xd6, 0x12, 0x42, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x73,
+    0x8c, 0x31, 0x00, 0x00, 0x70, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00,
+    0xd0, 0x1c, 0x42, 0x10, 0x42, 0xe8, 0x1c, 0x42, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x90, 0x31, 0x00, 0x00, 0x00, 0x90, 0x31, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xdc, 0x43, 0x00, 0x00, 0x00, 0xde, 0x43,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x83, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x73, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00,
+    0x00, 0x70, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0xb4, 0x86, 0xce, 0x39, 0x00, 0x20, 0x84, 0xce, 0x39, 0x08, 0x21, 0x84, 0xce, 0x39,
+    0x00, 0x00, 0x74, 0xce, 0x39, 0x00, 0x00, 0x84, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce,
+    0x39, 0x00, 0x00, 0x84, 0xce, 0x39, 0x00, 0x80, 0x73, 0xce, 0x39, 0xe8, 0xa0, 0x73, 0xce, 0x39, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63,
+    0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x70, 0xce, 0x31, 0x0d, 0x00, 0x70, 0xce, 0x31, 0x09, 0x00,
+    0x80, 0xce, 0x31, 0x4a, 0xa1, 0x84, 0xce, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x73, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00,
+    0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31, 0xad, 0xb5, 0xa4, 0xce, 0x31,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x73, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80,
+    0x31, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x10, 0x42, 0xa8, 0xd6, 0x39, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0xd0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x16, 0x3b, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x40, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x38,
+    0x97, 0x8c, 0x31, 0x00, 0xa4, 0x84, 0x8c, 0x31, 0x00, 0x80, 0x73, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00,
+    0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x80, 0x73, 0xce, 0x39, 0x00, 0x80, 0x73, 0xce, 0x39,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c,
+    0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0e, 0x00, 0x60, 0x8c, 0x31, 0x09, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x90, 0x31, 0x00, 0x00, 0x00, 0x90, 0x31, 0x00, 0x00, 0x00, 0x90, 0x31, 0x00, 0x00,
+    0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00,
+    0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80,
+    0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0xbc, 0x87, 0x90, 0x31, 0x00, 0x80, 0x73, 0xce, 0x39, 0x00, 0x00, 0x00,
+    0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00,
+    0x00, 0xc0, 0x39, 0x00, 0x00, 0x84, 0xce, 0x39, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00,
+    0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x0f, 0x00, 0x70, 0x8e, 0x31,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0,
+    0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x3a, 0x00, 0x00, 0x00, 0x40, 0x3a, 0x00, 0x00, 0x00, 0x40, 0x3a, 0x00, 0x00, 0x00, 0x40, 0x3a, 0x00, 0x00, 0x00, 0x40, 0x3a, 0x00, 0x00,
+    0x00, 0x40, 0x3a, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xe1, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00,
+    0x00, 0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xe1, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0,
+    0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x10, 0x00, 0x00,
+    0xe1, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0x00, 0x00,
+    0x00, 0xe0, 0x73, 0x00, 0x00, 0x00, 0xe0, 0x73, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x10, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00,
+    0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73,
+    0x06, 0x00, 0x00, 0x80, 0x31, 0x10, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0,
+    0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x06, 0x00, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0xd0,
+    0x1a, 0x63, 0x00, 0x00, 0xf0, 0x5c, 0x63, 0x00, 0x00, 0xf0, 0x5c, 0x63, 0x00, 0x00, 0xf0, 0x5c, 0x63, 0x00, 0x00, 0xf0, 0x5c, 0x63, 0x00, 0x00,
+    0xf0, 0x5c, 0x63, 0xce, 0x39, 0xe7, 0x5c, 0x63, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0xc6, 0x18, 0x5b, 0x00, 0x00, 0xf0, 0x5c, 0x63, 0x00,
+    0x00, 0xf0, 0x5c, 0x63, 0x00, 0x00, 0xf0, 0x5c, 0x63, 0x00, 0x00, 0xf0, 0x5c, 0x63, 0x00, 0x00, 0xf0, 0x5c, 0x63, 0xce, 0x39, 0xe7, 0x5c, 0x63,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x6b, 0x01, 0x00,
+    0xd6, 0x5a, 0x0f, 0x00, 0x00, 0x5c, 0x63, 0x0f, 0x00, 0x00, 0x5c, 0x63, 0x0f, 0x00, 0x00, 0x5c, 0x63, 0x0f, 0x00, 0x00, 0x5c, 0x63, 0x0f, 0x00,
+    0x00, 0x5c, 0x63, 0xce, 0x39, 0xe7, 0x5c, 0x63, 0x06, 0x00, 0x00, 0x80, 0x31, 0x0d, 0x00, 0x00, 0xc0, 0x5a, 0x0f, 0x00, 0x00, 0x40, 0x63, 0x0f,
+    0x00, 0x00, 0x40, 0x63, 0x0f, 0x00, 0x00, 0x40, 0x63, 0x0f, 0x00, 0x00, 0x40, 0x63, 0x0f, 0x00, 0x00, 0x40, 0x63, 0xce, 0x39, 0xe7, 0x5c, 0x63,
+    0x06, 0x00, 0x00, 0x00, 0x30, 0x0d, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60, 0xef, 0xbd, 0xf7, 0xde, 0x63, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x06, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0xa0, 0x94, 0x52, 0x00, 0x00, 0xc0, 0xd8, 0x5a, 0x00, 0x00, 0xd0, 0xd8, 0x5a, 0x0f, 0x00, 0xd0, 0xd8,
+    0x5a, 0x00, 0x00, 0xd0, 0xd8, 0x5a, 0xce, 0x39, 0xd7, 0xd8, 0x5a, 0xce, 0x39, 0xd7, 0xd8, 0x5a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0xa5,
+    0x94, 0x52, 0x00, 0x00, 0xc6, 0xd6, 0x52, 0x00, 0x00, 0xd7, 0xd8, 0x52, 0xc0, 0x01, 0xd7, 0xd8, 0x52, 0x00, 0x00, 0xd7, 0xd8, 0x52, 0xad, 0xb5,
+    0xd6, 0xd8, 0x52, 0xad, 0xb5, 0xd6, 0xd8, 0x52, 0xe7, 0x1c, 0x84, 0x10, 0x42, 0x0a, 0x00, 0xa0, 0x94, 0x52, 0x0a, 0x00, 0xb0, 0x96, 0x52, 0x0d,
+    0x00, 0xd0, 0xd8, 0x52, 0x0d, 0x34, 0xd0, 0xd8, 0x52, 0x0d, 0x00, 0xd0, 0xd8, 0x52, 0xad, 0xb5, 0xd6, 0xd8, 0x52, 0xad, 0xb5, 0xd6, 0xd8, 0x52,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x4a, 0x01, 0x00, 0x94, 0x4a, 0x8c, 0x01, 0x00, 0x94, 0x52, 0xcd, 0x01, 0x00, 0xd8, 0x52, 0xcd, 0x01, 0x07, 0xd8,
+    0x52, 0xcd, 0x01, 0x00, 0xd8, 0x52, 0xad, 0xb5, 0xd6, 0xd8, 0x52, 0xad, 0xb5, 0xd6, 0xd8, 0x52, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x0a, 0x00, 0x00,
+    0x40, 0x4a, 0x0c, 0x00, 0x00, 0x80, 0x52, 0x0d, 0x00, 0x00, 0xc0, 0x52, 0x0d, 0x00, 0xf0, 0xc0, 0x52, 0x0d, 0x00, 0x00, 0xc0, 0x52, 0xcd, 0x39,
+    0xe7, 0xdc, 0x52, 0xcd, 0x39, 0xe7, 0xdc, 0x52, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x0d, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xde, 0x53, 0xef, 0xbd, 0xf7, 0xde, 0x53,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x84, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x06, 0x00, 0x90, 0x52, 0x4a, 0x00, 0x00, 0xc0, 0x94, 0x4a, 0x00,
+    0x00, 0xc0, 0x96, 0x4a, 0x00, 0x00, 0xc0, 0x96, 0x4a, 0x0d, 0x00, 0xb0, 0x96, 0x4a, 0xce, 0x39, 0xb7, 0x96, 0x4a, 0x6b, 0xad, 0xb5, 0x96, 0x4a,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x06, 0x00, 0x90, 0x52, 0x42, 0x00, 0x00, 0x90, 0x52, 0x4a, 0x00, 0x80, 0xb5, 0x94, 0x4a, 0x00, 0x00, 0xb6, 0x94,
+    0x4a, 0x8d, 0x35, 0xb6, 0x94, 0x4a, 0xad, 0x35, 0xb6, 0x94, 0x4a, 0x4a, 0x29, 0xa5, 0x94, 0x4a, 0x0b, 0x00, 0xb0, 0xce, 0x39, 0x0b, 0x00, 0xb0,
+    0x10, 0x42, 0x0b, 0x00, 0xb0, 0x52, 0x4a, 0x09, 0x00, 0xa0, 0x54, 0x4a, 0x0b, 0x00, 0xb0, 0x54, 0x4a, 0x8b, 0x2d, 0xb6, 0x54, 0x4a, 0x8b, 0x31,
+    0xb6, 0x54, 0x4a, 0x4a, 0x29, 0xa5, 0x54, 0x4a, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x09, 0x00, 0x70, 0xce, 0x39, 0x09, 0x00, 0x00, 0x52, 0x42, 0x6b,
+    0x01, 0x00, 0x52, 0x4a, 0x8b, 0x01, 0x00, 0x54, 0x4a, 0x8b, 0x35, 0xd6, 0x54, 0x4a, 0x8b, 0xb5, 0xd6, 0x54, 0x4a, 0x4a, 0x29, 0xa5, 0x54, 0x4a,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x09, 0x00, 0x60, 0x8c, 0x31, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x0c, 0x00, 0x00, 0x40, 0x4a, 0x0c, 0x00, 0x00, 0x40,
+    0x4a, 0x0b, 0x00, 0xd0, 0x5c, 0x4a, 0xcb, 0x39, 0xe7, 0x5c, 0x4a, 0x6b, 0xad, 0xb5, 0x56, 0x4a, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x0d, 0x00, 0x60,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xdc, 0x53, 0x00, 0x00,
+    0x00, 0xde, 0x53, 0xef, 0xbd, 0xf7, 0x18, 0x53, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x83, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x40, 0x6b,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x70, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x06, 0x00, 0x90,
+    0x12, 0x42, 0x06, 0x00, 0xc0, 0x12, 0x42, 0x00, 0x00, 0xc0, 0x52, 0x42, 0x00, 0x00, 0xc0, 0x52, 0x42, 0x00, 0x00, 0xb0, 0x52, 0x42, 0xcb, 0x39,
+    0xb7, 0x52, 0x42, 0x6b, 0xad, 0x95, 0x52, 0x42, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x06, 0x00, 0x80, 0x10, 0x42, 0x06, 0x00, 0x80, 0x10, 0x42, 0x00,
+    0x00, 0x90, 0x12, 0x42, 0x00, 0x00, 0xa5, 0x12, 0x42, 0x00, 0x00, 0xa5, 0x12, 0x42, 0x4a, 0x29, 0xa5, 0x12, 0x42, 0x4a, 0x29, 0x95, 0x10, 0x42,
+    0x09, 0x00, 0x90, 0xce, 0x39, 0x09, 0x00, 0x90, 0xce, 0x39, 0x09, 0x00, 0x90, 0xd0, 0x39, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x90, 0x12,
+    0x42, 0x09, 0x00, 0x90, 0x12, 0x42, 0x29, 0xa5, 0x94, 0x12, 0x42, 0x29, 0xa5, 0x94, 0x10, 0x42, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x08, 0x00, 0x60,
+    0x8c, 0x31, 0x08, 0x00, 0x70, 0xce, 0x39, 0x09, 0x00, 0x00, 0x10, 0x3a, 0x4a, 0x01, 0x00, 0x10, 0x42, 0x4a, 0x01, 0x00, 0x10, 0x42, 0x4a, 0x29,
+    0xa5, 0x10, 0x42, 0x49, 0x29, 0xa5, 0x10, 0x42, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x09, 0x00, 0x60, 0x8c, 0x31, 0x0c, 0x00, 0x60, 0x8c, 0x31, 0x0c,
+    0x00, 0x00, 0xc0, 0x39, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x0b, 0x00, 0x00, 0x40, 0x42, 0xcb, 0x39, 0xb7, 0x56, 0x42, 0x69, 0xad, 0xb5, 0x56, 0x42,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x0d, 0x00, 0x70, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x18, 0x43, 0xef, 0xbd, 0xf7, 0x18, 0x43, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x6b, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x07, 0x00, 0x90, 0x12, 0x3a, 0x00, 0x00, 0x00, 0x12, 0x3a, 0x00, 0x00, 0x00, 0x12, 0x3a, 0x00, 0x00, 0x00, 0x12,
+    0x3a, 0x00, 0x00, 0xb0, 0x12, 0x3a, 0x00, 0x00, 0xb0, 0x12, 0x3a, 0x69, 0xad, 0x95, 0x12, 0x3a, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x06, 0x00, 0x70,
+    0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xd0, 0x39, 0x00, 0x80, 0xb5, 0xd0, 0x39, 0x00, 0x00,
+    0x84, 0xd0, 0x39, 0x08, 0x21, 0x84, 0xd0, 0x39, 0x08, 0x00, 0x80, 0xce, 0x39, 0x08, 0x00, 0x80, 0xd0, 0x39, 0x00, 0x00, 0x00, 0xd0, 0x39, 0x00,
+    0x00, 0x00, 0xd0, 0x39, 0x00, 0x00, 0x00, 0xd0, 0x39, 0x08, 0x00, 0x80, 0xd0, 0x39, 0x07, 0x00, 0x70, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x39,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x07, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xce,
+    0x39, 0x6b, 0x01, 0x00, 0xce, 0x39, 0x08, 0x01, 0x00, 0xd0, 0x39, 0x08, 0x21, 0x74, 0xd0, 0x39, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x09, 0x00, 0x70,
+    0x8e, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x0b, 0x00, 0x00, 0xc0, 0x39, 0x0b, 0x00,
+    0x00, 0xc0, 0x39, 0x69, 0xad, 0x95, 0xd0, 0x39, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x0d, 0x00, 0x70, 0xce, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0xef, 0xbd, 0xf7, 0x54, 0x3a,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x52, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00,
+    0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0xc0, 0x12, 0x3a, 0x00, 0x00, 0x90, 0x12, 0x3a,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80,
+    0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0xc6, 0x92, 0x31, 0x00, 0x80, 0x94, 0x90, 0x31, 0x07, 0x00, 0x70, 0xce, 0x39, 0x00, 0x00, 0x00,
+    0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x07, 0x00,
+    0x70, 0xce, 0x39, 0x07, 0x00, 0x70, 0xce, 0x39, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00,
+    0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x8c, 0x01, 0x00, 0x8c, 0x31, 0x29, 0x01, 0x00, 0x8c, 0x31,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x0c, 0x00, 0x00, 0x80, 0x31, 0x09, 0x00, 0x00, 0x80, 0x31, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x00, 0x00, 0xd0, 0x9a, 0x3a, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x80, 0xd6, 0x10, 0x32,
+    0x07, 0x00, 0x70, 0xce, 0x39, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x08, 0x00, 0x80, 0xd0, 0x39, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xad, 0x01, 0x00, 0xce, 0x31, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0d, 0x00, 0x00, 0xc0, 0x39,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x38, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x20, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00,
+    0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x20, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00,
+    0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x20, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00,
+    0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x10, 0x02, 0x00, 0x20, 0x7c, 0x10, 0x00, 0x00, 0x00, 0x7c, 0x10, 0x00, 0x00, 0x00, 0x7c, 0x10, 0x00, 0x00, 0x00,
+    0x7c, 0x10, 0x00, 0x00, 0x00, 0x7c, 0x10, 0x00, 0x00, 0x00, 0x7c, 0x10, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x18, 0x00, 0x80, 0x31, 0x10, 0x02, 0x00,
+    0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x78, 0x10, 0x00,
+    0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x78, 0xc6, 0x00, 0x00, 0x00, 0x30, 0x10, 0x02, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x78, 0x10,
+    0x00, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x78,
+    0xc6, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x18, 0x63, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00,
+    0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0xef, 0xbd, 0xf7, 0x9e, 0x6b,
+    0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x18, 0x5b, 0x00, 0x00, 0x00, 0x9e, 0x6b, 0x00, 0x00, 0x00, 0x9e, 0x6b, 0x00, 0x00, 0x00, 0x9e,
+    0x6b, 0x00, 0x00, 0x00, 0x9e, 0x6b, 0x00, 0x00, 0x00, 0x9e, 0x6b, 0xce, 0x39, 0xe7, 0x9c, 0x6b, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x0b, 0x00, 0xb0,
+    0xd6, 0x5a, 0x0e, 0x00, 0x00, 0x9e, 0x6b, 0x0e, 0x00, 0x00, 0x9e, 0x6b, 0x0e, 0x00, 0x00, 0x9e, 0x6b, 0x0e, 0x00, 0x00, 0x9e, 0x6b, 0x0e, 0x00,
+    0x00, 0x9e, 0x6b, 0xce, 0x39, 0xe7, 0x9c, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x18, 0x00, 0x80, 0x31, 0x6b, 0x2d, 0x00, 0xc0, 0x5a, 0xee, 0x01, 0x00, 0x80, 0x6b, 0xee, 0x01, 0x00, 0x80, 0x6b, 0xee, 0x01, 0x00, 0x80,
+    0x6b, 0xee, 0x01, 0x00, 0x80, 0x6b, 0xee, 0x01, 0x00, 0x80, 0x6b, 0xce, 0x39, 0xe7, 0x9c, 0x6b, 0xc6, 0x00, 0x00, 0x00, 0x30, 0x8c, 0x01, 0x00,
+    0x00, 0x58, 0xee, 0x01, 0x00, 0x00, 0x68, 0xee, 0x01, 0x00, 0x00, 0x68, 0xee, 0x01, 0x00, 0x00, 0x68, 0xee, 0x01, 0x00, 0x00, 0x68, 0xee, 0x01,
+    0x00, 0x00, 0x68, 0xce, 0x39, 0xe7, 0x9c, 0x6b, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xee, 0xbd, 0xf7, 0xde, 0x7b,
+    0xc6, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x18, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x10, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x0f, 0x00,
+    0x00, 0x00, 0x5b, 0xef, 0xbd, 0xf7, 0x1e, 0x5b, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x94, 0x52, 0x00, 0x00, 0x00, 0xd6, 0x52, 0x00,
+    0x00, 0x00, 0x1a, 0x5b, 0xe0, 0x01, 0x00, 0x1a, 0x5b, 0x00, 0x00, 0x00, 0x1a, 0x5b, 0xce, 0x39, 0xe7, 0x1a, 0x5b, 0xce, 0x39, 0xe7, 0x1a, 0x5b,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x0a, 0x00, 0xa0, 0x94, 0x52, 0x0a, 0x00, 0xb0, 0x96, 0x52, 0x0c, 0x00, 0xe0, 0x1a, 0x5b, 0x0c, 0x38, 0xe0, 0x1a,
+    0x5b, 0x0c, 0x00, 0xe0, 0x1a, 0x5b, 0xac, 0xb5, 0xd6, 0x1a, 0x5b, 0xac, 0xb5, 0xd6, 0x1a, 0x5b, 0x08, 0xa1, 0x83, 0x10, 0x42, 0x4a, 0x01, 0x00,
+    0x94, 0x52, 0x4a, 0x01, 0x00, 0x94, 0x52, 0xac, 0x01, 0x00, 0x1a, 0x5b, 0xac, 0x81, 0x06, 0x1a, 0x5b, 0xac, 0x01, 0x00, 0x1a, 0x5b, 0xac, 0xb5,
+    0xd6, 0x1a, 0x5b, 0xac, 0xb5, 0xd6, 0x1a, 0x5b, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x6a, 0x2d, 0x00, 0x80, 0x52, 0xac,
+    0x39, 0x00, 0x00, 0x5b, 0xac, 0x39, 0xe0, 0x00, 0x5b, 0xac, 0x39, 0x00, 0x00, 0x5b, 0xac, 0xb5, 0xd6, 0x1a, 0x5b, 0xac, 0xb5, 0xd6, 0x1a, 0x5b,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x4a, 0x01, 0x00, 0x00, 0x48, 0x6b, 0x01, 0x00, 0x00, 0x50, 0xac, 0x01, 0x00, 0x00, 0x58, 0xac, 0x01, 0x00, 0x1e,
+    0x58, 0xac, 0x01, 0x00, 0x00, 0x58, 0xac, 0x39, 0xe7, 0x9c, 0x5b, 0xac, 0x39, 0xe7, 0x9c, 0x5b, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x8c, 0x01, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+    0x00, 0xc0, 0x7b, 0xec, 0xbd, 0xf7, 0xde, 0x7b, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x00, 0x00, 0x18, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00,
+    0x53, 0x0e, 0x00, 0x00, 0x00, 0x53, 0x0f, 0x00, 0x00, 0x00, 0x53, 0xec, 0xbd, 0xf7, 0x1e, 0x53, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x00, 0x00,
+    0x52, 0x4a, 0x00, 0x00, 0x00, 0x96, 0x52, 0x00, 0x00, 0x00, 0x96, 0x52, 0x00, 0x00, 0x00, 0x96, 0x52, 0xae, 0x01, 0x00, 0x96, 0x52, 0xce, 0x39,
+    0xe7, 0x96, 0x52, 0x6a, 0xad, 0xb5, 0x96, 0x52, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x09, 0x00, 0x00, 0x52, 0x4a, 0x09,
+    0x00, 0xa0, 0x54, 0x4a, 0x0a, 0x00, 0xc0, 0x96, 0x4a, 0xaa, 0xb1, 0xc6, 0x96, 0x4a, 0xaa, 0xb5, 0xc6, 0x96, 0x4a, 0x4a, 0x29, 0xa5, 0x94, 0x4a,
+    0x67, 0x01, 0x00, 0xd6, 0x39, 0x68, 0x01, 0x00, 0x16, 0x42, 0x69, 0x01, 0x00, 0x56, 0x4a, 0x29, 0x01, 0x00, 0x52, 0x4a, 0x6a, 0x01, 0x00, 0x96,
+    0x4a, 0x6a, 0xb1, 0xc5, 0x96, 0x4a, 0x6a, 0x31, 0xc6, 0x96, 0x4a, 0x4a, 0x29, 0xa5, 0x94, 0x4a, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x29, 0x01, 0x00,
+    0xce, 0x39, 0x29, 0x01, 0x00, 0x40, 0x4a, 0x49, 0x29, 0x00, 0x40, 0x4a, 0x6a, 0x31, 0x00, 0x80, 0x4a, 0x6a, 0xb1, 0xc6, 0x9a, 0x4a, 0x6a, 0xb1,
+    0xd6, 0x9a, 0x4a, 0x4a, 0x29, 0xa5, 0x94, 0x4a, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x29, 0x01, 0x00, 0x8c, 0x31, 0x6a, 0x01, 0x00, 0x00, 0x40, 0x6a,
+    0x01, 0x00, 0x00, 0x48, 0x6a, 0x01, 0x00, 0x00, 0x48, 0x6a, 0x01, 0x00, 0x9a, 0x4b, 0x6a, 0x39, 0xe7, 0x9c, 0x4b, 0x6a, 0xad, 0xb5, 0x96, 0x4a,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x8c, 0x01, 0x00, 0x8c, 0x31, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x00, 0x00, 0x80, 0x7b, 0x0c, 0x00, 0x00, 0xc0, 0x7b, 0xec, 0xbd, 0xf7, 0x1e, 0x5b, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x68, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xe7, 0x00, 0x00, 0x18, 0x53, 0x07, 0x00, 0x00, 0x00, 0x53, 0x00,
+    0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0c, 0x00, 0x00, 0x00, 0x53, 0xec, 0xbd, 0xf7, 0x1e, 0x53,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x00, 0x00, 0x52, 0x42, 0xc6, 0x00, 0x00, 0x56, 0x42, 0x00, 0x00, 0x00, 0x56, 0x4a, 0x00, 0x00, 0x00, 0x56,
+    0x4a, 0x00, 0x00, 0x00, 0x56, 0x4a, 0x6a, 0x39, 0xe7, 0x56, 0x4a, 0x6a, 0xad, 0xa5, 0x52, 0x4a, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x00, 0x00,
+    0x10, 0x42, 0xe7, 0x00, 0x00, 0x10, 0x42, 0x08, 0x00, 0x00, 0x52, 0x42, 0x08, 0x00, 0x90, 0x52, 0x42, 0x08, 0x00, 0xa0, 0x52, 0x42, 0x28, 0xa9,
+    0xa4, 0x52, 0x42, 0x28, 0x29, 0xa5, 0x12, 0x42, 0x27, 0x01, 0x00, 0xd2, 0x39, 0x27, 0x01, 0x00, 0xd2, 0x39, 0x28, 0x01, 0x00, 0x12, 0x3a, 0x08,
+    0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x28, 0x01, 0x00, 0x12, 0x42, 0x28, 0xa1, 0x84, 0x12, 0x42, 0x28, 0xa5, 0x94, 0x12, 0x42,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x08, 0x01, 0x00, 0x8c, 0x31, 0x08, 0x01, 0x00, 0xce, 0x39, 0x29, 0x01, 0x00, 0x00, 0x42, 0x29, 0x25, 0x00, 0x00,
+    0x42, 0x29, 0x29, 0x00, 0x00, 0x42, 0x29, 0xa9, 0xa4, 0x12, 0x42, 0x28, 0x29, 0xa5, 0x12, 0x42, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x29, 0x01, 0x00,
+    0x8c, 0x31, 0x69, 0x01, 0x00, 0x8c, 0x31, 0x69, 0x01, 0x00, 0x00, 0x38, 0x69, 0x01, 0x00, 0x00, 0x40, 0x69, 0x01, 0x00, 0x00, 0x48, 0x69, 0x39,
+    0xe7, 0x96, 0x4a, 0x29, 0xa9, 0xb5, 0x96, 0x4a, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x8c, 0x01, 0x00, 0xce, 0x31, 0x0c, 0x00, 0x00, 0xc0, 0x31, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x5b, 0xec, 0xbd, 0xf7, 0x1e, 0x5b,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xe7, 0x00, 0x00,
+    0x18, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x00, 0x53, 0xea, 0xbd, 0xf7, 0x1e, 0x53, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xe7, 0x00, 0x00, 0x52, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00,
+    0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x56, 0x42, 0x00, 0x00, 0x00, 0x56, 0x42, 0x28, 0x29, 0xa5, 0x52, 0x42,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x00, 0x00, 0xce, 0x39, 0x06, 0x00, 0x00, 0xc0, 0x39, 0x06, 0x00, 0x00, 0xc0, 0x39, 0x07, 0x00, 0x00, 0x00,
+    0x3a, 0x07, 0x00, 0xa0, 0x14, 0x3a, 0x08, 0x00, 0x80, 0x10, 0x3a, 0xe8, 0x20, 0x84, 0x10, 0x3a, 0x07, 0x01, 0x00, 0xd0, 0x39, 0x08, 0x01, 0x00,
+    0x10, 0x3a, 0x08, 0x00, 0x00, 0x00, 0x3a, 0x08, 0x00, 0x00, 0x00, 0x3a, 0x08, 0x00, 0x00, 0x00, 0x3a, 0x08, 0x01, 0x00, 0x10, 0x3a, 0xe7, 0x00,
+    0x00, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xe7, 0x00, 0x00, 0x8c, 0x31, 0x07, 0x00, 0x00, 0x80, 0x31, 0x07,
+    0x00, 0x00, 0x80, 0x31, 0x08, 0x00, 0x00, 0xc0, 0x39, 0x48, 0x29, 0x00, 0xc0, 0x39, 0x08, 0x21, 0x00, 0x00, 0x3a, 0x08, 0x21, 0x84, 0x0e, 0x3a,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x29, 0x01, 0x00, 0xce, 0x31, 0x09, 0x00, 0x00, 0x00, 0x30, 0x09, 0x00, 0x00, 0x00, 0x30, 0x09, 0x00, 0x00, 0x00,
+    0x30, 0x69, 0x01, 0x00, 0x00, 0x38, 0x69, 0x01, 0x00, 0x00, 0x38, 0x29, 0x29, 0xa5, 0x12, 0x3a, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x8c, 0x01, 0x00,
+    0xce, 0x39, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0xec, 0xbd, 0xf7, 0x9e, 0x4a, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x56, 0x42, 0x00, 0x00, 0x00, 0x52, 0x42, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0xb0, 0x56, 0x32, 0x06, 0x00, 0x90, 0x12, 0x32,
+    0xe7, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0xce, 0x39, 0xe7, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x69, 0x2d,
+    0x00, 0x80, 0x31, 0x28, 0x25, 0x00, 0x80, 0x31, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x69, 0x01, 0x00, 0x00, 0x30, 0x29, 0x01, 0x00, 0x00, 0x30,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x53, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0xc0, 0x18, 0x42, 0xe7, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x10, 0x3a,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x31, 0x00, 0xc0, 0x39, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x38, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xc6, 0x18, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0xb0, 0xd6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0xb5,
+    0xd6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0xb0, 0xd6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xd6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00,
+    0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xc6, 0x18, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0xa5, 0x52, 0x32, 0x00, 0x00, 0xa5, 0x94, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x90,
+    0xd2, 0x31, 0x00, 0x00, 0xa0, 0x94, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x94, 0x32, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0x07, 0x21, 0x84,
+    0x10, 0x42, 0x00, 0x00, 0x90, 0x12, 0x42, 0x00, 0x00, 0x90, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x00,
+    0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x40, 0x4a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x9c, 0x73, 0xce, 0x31, 0x00, 0x80, 0x94, 0x10, 0x32, 0x00,
+    0x80, 0x94, 0x52, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x80, 0xd0, 0x31, 0x00, 0x00, 0x90, 0x52, 0x32, 0x00, 0x00, 0x00, 0x40,
+    0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x52, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00,
+    0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00,
+    0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x40, 0x32,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xe7, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00, 0x00, 0x80, 0x10, 0x3a, 0x00, 0x00, 0x80, 0x10,
+    0x3a, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x10, 0x3a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x18, 0x63,
+    0x8c, 0x31, 0x00, 0x9c, 0x73, 0xce, 0x31, 0x00, 0x00, 0x84, 0xce, 0x31, 0x00, 0x00, 0x84, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x00,
+    0x00, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00,
+    0x00, 0x70, 0xce, 0x31, 0x00, 0x00, 0x80, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x10,
+    0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0x00, 0x00, 0x00, 0x10, 0x32, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+    0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x80, 0x73, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00,
+    0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x73, 0x8e,
+    0x31, 0x00, 0x80, 0x73, 0x8e, 0x31, 0x00, 0x00, 0x70, 0x8e, 0x31, 0x00, 0x00, 0x70, 0x8e, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x64,
+    0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x70, 0x8e, 0x31, 0x00, 0x00,
+    0x70, 0x8e, 0x31, 0x00, 0x00, 0x70, 0x8e, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x70, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00,
+    0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80,
+    0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0xc0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x70,
+    0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00,
+    0x80, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00,
+    0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x70, 0x8c, 0x31, 0x00, 0x00, 0x70, 0x8c, 0x31, 0x00, 0x00, 0x80, 0x8c, 0x31, 0x00, 0x00, 0x80, 0x8c,
+    0x31, 0x00, 0x00, 0x80, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00,
+    0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00,
+    0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe7, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce,
+    0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00,
+    0x00, 0x8c, 0x31, 0x00, 0x80, 0x73, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00,
+    0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x70, 0x8e, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xd0, 0x31, 0x00, 0x00, 0x00, 0xd2, 0x31, 0x00, 0x00, 0x00, 0xd2, 0x31, 0x00, 0x00, 0x00, 0xd2,
+    0x31, 0x00, 0x00, 0x00, 0xd2, 0x31, 0x00, 0x00, 0x00, 0xd2, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+    0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xe1, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00,
+    0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xe1, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0,
+    0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0xe1, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0x00, 0x00,
+    0x00, 0xe0, 0x6b, 0x00, 0x00, 0x00, 0xe0, 0x6b, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00,
+    0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b,
+    0xc6, 0x18, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0,
+    0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0xc0, 0x6b, 0xc6, 0x18, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
+    0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0xc6, 0x18, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0xac, 0xb5,
+    0xd6, 0x5a, 0x00, 0x80, 0xf7, 0x1c, 0x5b, 0x00, 0x00, 0xf0, 0x1c, 0x5b, 0x00, 0x00, 0xf0, 0x1c, 0x5b, 0x00, 0x00, 0xf0, 0x1c, 0x5b, 0x00, 0x00,
+    0xf0, 0x1c, 0x5b, 0x00, 0x00, 0xf0, 0x1c, 0x5b, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0xb5, 0xd6, 0x5a, 0x00, 0x80, 0xf7, 0x1c, 0x5b, 0x00,
+    0x00, 0xf0, 0x1c, 0x5b, 0x00, 0x00, 0xf0, 0x1c, 0x5b, 0x00, 0x00, 0xf0, 0x1c, 0x5b, 0x00, 0x00, 0xf0, 0x1c, 0x5b, 0x00, 0x00, 0xf0, 0x1c, 0x5b,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x07, 0x00, 0xb0, 0xd6, 0x5a, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x1c,
+    0x5b, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0xd6, 0x5a, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00,
+    0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0x1c, 0x5b, 0xc6, 0x18, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00,
+    0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b,
+    0xc6, 0x18, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0xc6, 0x18, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe7, 0x9c, 0x73, 0x8e, 0x31, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x00, 0x00, 0xd7, 0x96, 0x52, 0x00, 0x00, 0xd7, 0x96,
+    0x52, 0x00, 0x00, 0xd7, 0x96, 0x52, 0x00, 0x00, 0xd7, 0x96, 0x52, 0x00, 0x00, 0xd7, 0x96, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x07, 0x00, 0xa0, 0x54, 0x4a, 0x06, 0x00, 0xa0, 0x94, 0x52, 0x00,
+    0x00, 0xd0, 0x96, 0x52, 0x00, 0x00, 0xd0, 0x96, 0x52, 0x00, 0x00, 0xd0, 0x96, 0x52, 0x00, 0x00, 0xd0, 0x96, 0x52, 0x00, 0x00, 0xd0, 0x96, 0x52,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x52, 0x3a, 0x00, 0x00, 0x00, 0x94, 0x52, 0x00, 0x00, 0x00, 0x96, 0x52, 0x00, 0x00, 0x00, 0x96,
+    0x52, 0x00, 0x00, 0x00, 0x96, 0x52, 0x00, 0x00, 0x00, 0x96, 0x52, 0x00, 0x00, 0x00, 0x96, 0x52, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x52, 0x00, 0x00, 0x00, 0x80, 0x52, 0x00, 0x00, 0x00, 0x80, 0x52, 0x00, 0x00, 0x00, 0x80, 0x52, 0x00, 0x00,
+    0x00, 0x80, 0x52, 0x00, 0x00, 0x00, 0x80, 0x52, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x26, 0xa5, 0x94, 0x12, 0x42, 0x00, 0xa4, 0x94, 0x52, 0x4a, 0x00,
+    0xb4, 0x96, 0x52, 0x4a, 0x00, 0xb4, 0xa6, 0x52, 0x4a, 0x0d, 0xb4, 0xa6, 0x52, 0x4a, 0x00, 0x34, 0xa6, 0x52, 0x4a, 0x8c, 0x31, 0xa6, 0x52, 0x4a,
+    0x08, 0xa1, 0x73, 0xce, 0x39, 0xe8, 0x20, 0x84, 0x10, 0x42, 0x00, 0x80, 0x94, 0x52, 0x42, 0x00, 0x80, 0x94, 0x52, 0x4a, 0x00, 0x00, 0xa6, 0x52,
+    0x4a, 0x80, 0x01, 0xa6, 0x52, 0x4a, 0x00, 0x00, 0xa6, 0x52, 0x4a, 0x8c, 0x31, 0xa6, 0x52, 0x4a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xe7, 0x98, 0x73,
+    0xce, 0x39, 0x06, 0x00, 0x90, 0x12, 0x42, 0x0d, 0x00, 0x90, 0x52, 0x4a, 0x0d, 0x00, 0xa0, 0x52, 0x4a, 0x0d, 0x34, 0xa0, 0x52, 0x4a, 0x0d, 0x00,
+    0xa0, 0x52, 0x4a, 0x8c, 0x31, 0xa6, 0x52, 0x4a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x00,
+    0x00, 0x00, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x52, 0x4a, 0x00, 0x00, 0x07, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x52, 0x4a, 0xad, 0xb5, 0xd6, 0x52, 0x4a,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x80,
+    0x4a, 0x00, 0x00, 0xf0, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0xe0, 0x9c, 0x4a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0xde, 0x4b, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x88, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x84,
+    0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x80, 0x94, 0x10, 0x42, 0x00, 0x30, 0x96, 0x10, 0x42, 0x00, 0x2c, 0x96, 0x10, 0x42, 0x8b, 0x31,
+    0x96, 0x10, 0x42, 0x8c, 0xad, 0x84, 0x10, 0x42, 0x08, 0xa1, 0x73, 0xce, 0x39, 0x00, 0x00, 0x74, 0xce, 0x39, 0x00, 0x00, 0x84, 0xce, 0x39, 0x00,
+    0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x80, 0x84, 0x10, 0x42, 0x4b, 0xad, 0x84, 0x10, 0x42, 0x6b, 0xad, 0x84, 0x10, 0x42,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x73, 0xce, 0x39, 0x00, 0x00, 0x80, 0xd0, 0x39, 0x0c, 0x00, 0x80, 0x10,
+    0x42, 0x0b, 0x00, 0x80, 0x10, 0x42, 0x8c, 0x2d, 0x86, 0x10, 0x42, 0x8b, 0x31, 0x86, 0x10, 0x42, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x60,
+    0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x00, 0x12, 0x42, 0x00, 0x00,
+    0xd6, 0x12, 0x42, 0xad, 0xb5, 0xd6, 0x12, 0x42, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00,
+    0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0xd0, 0x1c, 0x42, 0x00, 0x00, 0xe0, 0x1c, 0x42,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xdc, 0x43, 0x00, 0x00, 0x00, 0xde, 0x43, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc0, 0x83, 0x00, 0x00, 0x00, 0x00, 0x84, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00, 0x00, 0x70, 0xce, 0x39, 0x00, 0x80, 0x86, 0xce,
+    0x39, 0x00, 0xb4, 0x86, 0xce, 0x39, 0x00, 0x20, 0x84, 0xce, 0x39, 0x08, 0x21, 0x84, 0xce, 0x39, 0x08, 0x21, 0x74, 0xce, 0x39, 0x00, 0x00, 0x80,
+    0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x84, 0xce, 0x39, 0x00, 0x00, 0x84, 0xce, 0x39, 0x00, 0x80,
+    0x73, 0xce, 0x39, 0xe8, 0xa0, 0x73, 0xce, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00,
+    0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x70, 0xce, 0x31, 0x0d, 0x00, 0x70, 0xce, 0x31, 0x09, 0x00, 0x80, 0xce, 0x31, 0x4a, 0xa1, 0x84, 0xce, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x80, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c,
+    0x31, 0x00, 0x00, 0x00, 0xce, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31, 0xad, 0xb5, 0xa4, 0xce, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x8e, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00,
+    0x00, 0xc0, 0x39, 0x00, 0x00, 0xa0, 0xd6, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x16, 0x3b,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00,
+    0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x90, 0x8c, 0x31, 0x00, 0x38, 0x97, 0x8c, 0x31, 0x00, 0xa4, 0x84, 0x8c, 0x31,
+    0xe7, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce,
+    0x39, 0x00, 0x00, 0x90, 0xce, 0x39, 0x00, 0x80, 0x73, 0xce, 0x39, 0x00, 0x80, 0x73, 0xce, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x90, 0x8c, 0x31, 0x0e, 0x00,
+    0x60, 0x8c, 0x31, 0x09, 0x00, 0x60, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00,
+    0x00, 0x00, 0x90, 0x31, 0x00, 0x00, 0x00, 0x90, 0x31, 0x00, 0x00, 0x00, 0x90, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0,
+    0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00,
+    0x00, 0x94, 0x31, 0x00, 0xbc, 0x87, 0x90, 0x31, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00,
+    0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xd4, 0x39, 0x00, 0x00, 0x84, 0xce, 0x39,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80,
+    0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x94, 0x31, 0x0f, 0x00, 0x70, 0x8e, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00,
+    0x00, 0xd4, 0x31, 0x00, 0x00, 0x00, 0xce, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x40, 0x3a, 0x00,
+    0x00, 0x00, 0x40, 0x3a, 0x00, 0x00, 0x00, 0x40, 0x3a, 0x00, 0x00, 0x00, 0x40, 0x3a, 0x00, 0x00, 0x00, 0x40, 0x3a, 0x00, 0x00, 0x00, 0xc0, 0x39,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xde, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0,
+    0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0xde, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00,
+    0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xde, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00,
+    0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xde, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0,
+    0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x00, 0x00, 0xc0, 0x73, 0xc6, 0x18, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0xc6, 0x18, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xc6, 0x18, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x00, 0x00, 0xe0, 0x5c, 0x63, 0x00,
+    0x00, 0x00, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c, 0x63,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xe0, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c,
+    0x63, 0x00, 0x00, 0x00, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c, 0x63, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x0b, 0x00, 0xc0,
+    0xd8, 0x5a, 0x0e, 0x00, 0xe0, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c, 0x63, 0x00, 0x00,
+    0x00, 0x5c, 0x63, 0x00, 0x00, 0x00, 0x5c, 0x63, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x6b, 0x01, 0x00, 0xd6, 0x5a, 0x0e, 0x00, 0x00, 0x40, 0x63, 0x00,
+    0x00, 0x00, 0x40, 0x63, 0x00, 0x00, 0x00, 0x40, 0x63, 0x00, 0x00, 0x00, 0x40, 0x63, 0x00, 0x00, 0x00, 0x40, 0x63, 0x00, 0x00, 0x00, 0x40, 0x63,
+    0xc6, 0x18, 0x00, 0x80, 0x31, 0x0b, 0x00, 0x00, 0xc0, 0x5a, 0x0e, 0x00, 0x00, 0x40, 0x63, 0x00, 0x00, 0x00, 0x40, 0x63, 0x00, 0x00, 0x00, 0x40,
+    0x63, 0x00, 0x00, 0x00, 0x40, 0x63, 0x00, 0x00, 0x00, 0x40, 0x63, 0x00, 0x00, 0x00, 0x40, 0x63, 0xc6, 0x18, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0xa0,
+    0x94, 0x52, 0x00, 0x00, 0xc0, 0xd8, 0x5a, 0x00, 0x00, 0xd0, 0xd8, 0x5a, 0x00, 0x00, 0xd0, 0xd8, 0x5a, 0x00, 0x00, 0xd0, 0xd8, 0x5a, 0x00, 0x00,
+    0xd0, 0xd8, 0x5a, 0x00, 0x00, 0xd0, 0xd8, 0x5a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x80, 0xb5, 0xd6, 0x52, 0x00,
+    0x00, 0xd0, 0xd8, 0x52, 0x00, 0x00, 0xd0, 0xd8, 0x52, 0x00, 0x00, 0xd0, 0xd8, 0x52, 0x00, 0x00, 0xd0, 0xd8, 0x52, 0x00, 0x00, 0xd0, 0xd8, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x4a, 0x01, 0x00,
+    0x94, 0x4a, 0x4a, 0x01, 0x00, 0x94, 0x52, 0x0d, 0x00, 0x00, 0xd8, 0x52, 0x0d, 0x00, 0x00, 0xd8, 0x52, 0x0d, 0x00, 0x00, 0xd8, 0x52, 0x0d, 0x00,
+    0x00, 0xd8, 0x52, 0x0d, 0x00, 0x00, 0xd8, 0x52, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x0a, 0x00, 0x00, 0x40, 0x4a, 0x0c, 0x00, 0x00, 0x80, 0x52, 0x0d,
+    0x00, 0x00, 0xc0, 0x52, 0x0d, 0x00, 0x00, 0xc0, 0x52, 0x0d, 0x00, 0x00, 0xc0, 0x52, 0x0d, 0x00, 0x00, 0xc0, 0x52, 0x0d, 0x00, 0x00, 0xc0, 0x52,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0xa0, 0x52, 0x4a, 0x00, 0x00, 0xa0, 0x94, 0x4a, 0x00, 0x00, 0xb0, 0x96, 0x4a, 0x00, 0x00, 0xb0, 0x96,
+    0x4a, 0x0d, 0x00, 0xb0, 0x96, 0x4a, 0x00, 0x00, 0xb0, 0x96, 0x4a, 0x6b, 0xad, 0xb5, 0x96, 0x4a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0xa4, 0x94,
+    0x52, 0x42, 0x00, 0x80, 0x94, 0x52, 0x4a, 0x00, 0x80, 0xb5, 0x94, 0x4a, 0x00, 0x00, 0xb6, 0x94, 0x4a, 0x80, 0x01, 0xb6, 0x94, 0x4a, 0x00, 0x00,
+    0xb6, 0x94, 0x4a, 0x4a, 0x29, 0xa5, 0x94, 0x4a, 0x47, 0x29, 0x75, 0xce, 0x39, 0x47, 0x1d, 0x85, 0x10, 0x42, 0x0a, 0x00, 0xa0, 0x54, 0x4a, 0x09,
+    0x00, 0xa0, 0x54, 0x4a, 0x0b, 0x00, 0xb0, 0x54, 0x4a, 0x0b, 0x2c, 0xb0, 0x54, 0x4a, 0x0b, 0x00, 0xb0, 0x54, 0x4a, 0x4a, 0x29, 0xa5, 0x54, 0x4a,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x29, 0x25, 0x73, 0xce, 0x39, 0x29, 0x01, 0x00, 0x52, 0x42, 0x6b, 0x01, 0x00, 0x52, 0x4a, 0x8b, 0x01, 0x00, 0x54,
+    0x4a, 0x8b, 0x01, 0x06, 0x54, 0x4a, 0x8b, 0x01, 0x00, 0x54, 0x4a, 0x4a, 0x29, 0xa5, 0x54, 0x4a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x0a, 0x00, 0x60,
+    0x8c, 0x31, 0x0a, 0x00, 0x00, 0x00, 0x42, 0x0b, 0x00, 0x00, 0x40, 0x4a, 0x0b, 0x00, 0x00, 0x40, 0x4a, 0x0b, 0x00, 0xd0, 0x40, 0x4a, 0x0b, 0x00,
+    0x00, 0x40, 0x4a, 0x6b, 0xad, 0xb5, 0x56, 0x4a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x18, 0x53,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x00,
+    0x00, 0xb0, 0x52, 0x42, 0x00, 0x00, 0xb0, 0x52, 0x42, 0x00, 0x00, 0xb0, 0x52, 0x42, 0x0b, 0x00, 0xb0, 0x52, 0x42, 0x6b, 0xad, 0x95, 0x52, 0x42,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x80, 0x10, 0x42, 0x06, 0x00, 0x80, 0x10, 0x42, 0x00, 0x00, 0x90, 0x12, 0x42, 0x00, 0x00, 0xa5, 0x12,
+    0x42, 0x00, 0x00, 0xa5, 0x12, 0x42, 0x4a, 0x29, 0xa5, 0x12, 0x42, 0x4a, 0x29, 0x95, 0x10, 0x42, 0x07, 0x21, 0x74, 0xce, 0x39, 0x09, 0x00, 0x90,
+    0xce, 0x39, 0x09, 0x00, 0x90, 0xd0, 0x39, 0x09, 0x00, 0x90, 0x10, 0x42, 0x08, 0x00, 0x90, 0x12, 0x42, 0x09, 0x00, 0x90, 0x12, 0x42, 0x29, 0xa5,
+    0x94, 0x12, 0x42, 0x29, 0xa5, 0x94, 0x10, 0x42, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x08, 0x00, 0x60, 0x8c, 0x31, 0x08, 0x00, 0x70, 0xce, 0x39, 0x09,
+    0x00, 0x00, 0x10, 0x3a, 0x4a, 0x01, 0x00, 0x10, 0x42, 0x4a, 0x01, 0x00, 0x10, 0x42, 0x4a, 0x29, 0xa5, 0x10, 0x42, 0x49, 0x29, 0xa5, 0x10, 0x42,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x0a, 0x00, 0x00, 0x8c, 0x31, 0x0a, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x00, 0x00, 0xc0, 0x39, 0x0b, 0x00, 0x00, 0x00,
+    0x42, 0x0b, 0x00, 0x00, 0x40, 0x42, 0x0b, 0x00, 0xb0, 0x56, 0x42, 0x69, 0xad, 0xb5, 0x56, 0x42, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x18, 0x43, 0x00, 0x00, 0x00, 0x18, 0x43, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x00, 0x00, 0x00, 0x40, 0x6b,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x12, 0x3a, 0x00, 0x00, 0x00, 0x12, 0x3a, 0x00, 0x00, 0x00, 0x12, 0x3a, 0x00, 0x00, 0xb0, 0x12, 0x3a, 0x00, 0x00, 0xb0, 0x12, 0x3a, 0x00, 0x00,
+    0xb0, 0x12, 0x3a, 0x69, 0xad, 0x95, 0x12, 0x3a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00,
+    0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0xb0, 0xd0, 0x39, 0x00, 0x80, 0xb5, 0xd0, 0x39, 0x00, 0x00, 0x84, 0xd0, 0x39, 0x08, 0x21, 0x84, 0xd0, 0x39,
+    0x08, 0x21, 0x84, 0xce, 0x39, 0x00, 0x00, 0x00, 0xd0, 0x39, 0x00, 0x00, 0x00, 0xd0, 0x39, 0x00, 0x00, 0x00, 0xd0, 0x39, 0x08, 0x00, 0x80, 0xd0,
+    0x39, 0x08, 0x00, 0x80, 0xd0, 0x39, 0x07, 0x00, 0x70, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x00, 0x00, 0xce, 0x39, 0x6b, 0x01, 0x00, 0xce, 0x39, 0x08, 0x01,
+    0x00, 0xd0, 0x39, 0x08, 0x21, 0x74, 0xd0, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x90, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00,
+    0x00, 0x00, 0x80, 0x31, 0x0b, 0x00, 0x00, 0x80, 0x31, 0x0b, 0x00, 0x00, 0xc0, 0x39, 0x0b, 0x00, 0x00, 0xc0, 0x39, 0x69, 0xad, 0x95, 0xd0, 0x39,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x54, 0x3a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x52, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00,
+    0x3a, 0x00, 0x00, 0x00, 0x18, 0x3a, 0x00, 0x00, 0xc0, 0x12, 0x3a, 0x00, 0x00, 0x90, 0x12, 0x3a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x92, 0x31, 0x00, 0x00,
+    0xc6, 0x92, 0x31, 0x00, 0x80, 0x94, 0x90, 0x31, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00,
+    0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0xd2, 0x39, 0x07, 0x00, 0x70, 0xce, 0x39, 0x07, 0x00, 0x70, 0xce, 0x39,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80,
+    0x31, 0x00, 0x00, 0x00, 0x92, 0x31, 0x8c, 0x01, 0x00, 0x8c, 0x31, 0x29, 0x01, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x0c, 0x00,
+    0x00, 0x80, 0x31, 0x09, 0x00, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x80, 0x3a, 0x00, 0x00, 0xd0, 0x9a, 0x3a,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x80, 0x32, 0x00, 0x80, 0xd6, 0x10, 0x32, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+    0x00, 0x80, 0x3a, 0x08, 0x00, 0x80, 0xd0, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x80, 0x32, 0xad, 0x01, 0x00, 0xce, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x80, 0x3a, 0x0d, 0x00, 0x00, 0xc0, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0xc0, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78,
+    0x06, 0x00, 0x60, 0x8c, 0x31, 0x0f, 0x00, 0x00, 0xc0, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0x0f, 0x00, 0x00,
+    0xc0, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0xc6, 0x18, 0x00, 0x80, 0x31, 0x0f, 0x00, 0x00, 0xc0, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78,
+    0xc6, 0x18, 0x03, 0x00, 0x30, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80,
+    0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0xd6, 0x5a, 0x00, 0x00, 0x00, 0x9c, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00,
+    0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x0b, 0x00, 0xb0, 0xd6, 0x5a, 0x00, 0x00, 0x00, 0x9c, 0x6b, 0x00,
+    0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x6b,
+    0xc6, 0x00, 0x00, 0x8c, 0x31, 0x6b, 0x01, 0x00, 0xd6, 0x5a, 0xce, 0x01, 0x00, 0x9c, 0x6b, 0x0e, 0x00, 0x00, 0x80, 0x6b, 0x0e, 0x00, 0x00, 0x80,
+    0x6b, 0x0e, 0x00, 0x00, 0x80, 0x6b, 0x0e, 0x00, 0x00, 0x80, 0x6b, 0x0e, 0x00, 0x00, 0x80, 0x6b, 0xc6, 0x18, 0x00, 0x80, 0x31, 0x6b, 0x2d, 0x00,
+    0xc0, 0x5a, 0xce, 0x01, 0x00, 0x00, 0x68, 0x0e, 0x00, 0x00, 0x00, 0x68, 0x0e, 0x00, 0x00, 0x00, 0x68, 0x0e, 0x00, 0x00, 0x00, 0x68, 0x0e, 0x00,
+    0x00, 0x00, 0x68, 0x0e, 0x00, 0x00, 0x00, 0x68, 0xc6, 0x18, 0x03, 0x00, 0x30, 0x6b, 0x01, 0x00, 0x00, 0x58, 0xce, 0x01, 0x00, 0x00, 0x68, 0x0e,
+    0x00, 0x00, 0x00, 0x68, 0x0e, 0x00, 0x00, 0x00, 0x68, 0x0e, 0x00, 0x00, 0x00, 0x68, 0x0e, 0x00, 0x00, 0x00, 0x68, 0x0e, 0x00, 0x00, 0x00, 0x68,
+    0xc6, 0x18, 0x63, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x5a, 0x00, 0x00, 0x00, 0xc0, 0x5a, 0x00,
+    0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x94, 0x52, 0x00, 0x00, 0x00, 0xd6, 0x52, 0x00, 0x00, 0x00, 0x1a, 0x5b, 0x00, 0x00, 0x00, 0x1a,
+    0x5b, 0x00, 0x00, 0x00, 0x1a, 0x5b, 0x00, 0x00, 0x00, 0x1a, 0x5b, 0x00, 0x00, 0x00, 0x1a, 0x5b, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x0a, 0x00, 0xa0,
+    0x94, 0x52, 0x0a, 0x00, 0xa0, 0x94, 0x52, 0x0c, 0x00, 0x00, 0x1a, 0x5b, 0x0c, 0x00, 0x00, 0x1a, 0x5b, 0x0c, 0x00, 0x00, 0x1a, 0x5b, 0x0c, 0x00,
+    0x00, 0x1a, 0x5b, 0x0c, 0x00, 0x00, 0x1a, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0xac, 0x01, 0x00, 0x00, 0x5b, 0xac, 0x01, 0x00, 0x00,
+    0x5b, 0xac, 0x01, 0x00, 0x00, 0x5b, 0xac, 0x01, 0x00, 0x00, 0x5b, 0xac, 0x01, 0x00, 0x00, 0x5b, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x4a, 0x01, 0x00,
+    0x00, 0x48, 0x6b, 0x01, 0x00, 0x00, 0x50, 0xac, 0x01, 0x00, 0x00, 0x58, 0xac, 0x01, 0x00, 0x00, 0x58, 0xac, 0x01, 0x00, 0x00, 0x58, 0xac, 0x01,
+    0x00, 0x00, 0x58, 0xac, 0x01, 0x00, 0x00, 0x58, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00,
+    0xc0, 0x52, 0x00, 0x00, 0x00, 0xc0, 0x52, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x00, 0x53, 0x0c, 0x00, 0x00, 0x00, 0x53, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x00, 0x00, 0x54, 0x4a, 0x00, 0x00, 0x00, 0x94, 0x52, 0x00,
+    0x00, 0x00, 0x94, 0x52, 0x00, 0x00, 0x00, 0x96, 0x52, 0xa0, 0x01, 0x00, 0x96, 0x52, 0x00, 0x00, 0x00, 0x96, 0x52, 0x6a, 0xad, 0xb5, 0x96, 0x52,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xe7, 0x98, 0x94, 0x52, 0x4a, 0x09, 0x00, 0x90, 0x52, 0x4a, 0x09, 0x00, 0xa0, 0x54, 0x4a, 0x0a, 0x00, 0xc0, 0x96,
+    0x4a, 0x0a, 0x30, 0xc0, 0x96, 0x4a, 0x0a, 0x00, 0xc0, 0x96, 0x4a, 0x4a, 0x29, 0xa5, 0x94, 0x4a, 0xe7, 0x28, 0xa5, 0xce, 0x39, 0x08, 0xa9, 0xa3,
+    0x10, 0x42, 0x4a, 0x01, 0x00, 0x94, 0x4a, 0x2a, 0x01, 0x00, 0x92, 0x4a, 0x6a, 0x01, 0x00, 0x96, 0x4a, 0x6a, 0x81, 0x05, 0x96, 0x4a, 0x6a, 0x01,
+    0x00, 0x96, 0x4a, 0x4a, 0x29, 0xa5, 0x94, 0x4a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x29, 0xa5, 0x64, 0xce, 0x39, 0x29, 0x25, 0x00, 0x40, 0x4a, 0x49,
+    0x29, 0x00, 0x40, 0x4a, 0x6a, 0x31, 0x00, 0x80, 0x4a, 0x6a, 0x31, 0xc0, 0x80, 0x4a, 0x6a, 0x31, 0x00, 0x80, 0x4a, 0x4a, 0x29, 0xa5, 0x94, 0x4a,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x49, 0x01, 0x00, 0x8c, 0x31, 0x4a, 0x01, 0x00, 0x00, 0x40, 0x4a, 0x01, 0x00, 0x00, 0x48, 0x6a, 0x01, 0x00, 0x00,
+    0x48, 0x6a, 0x01, 0x00, 0x1a, 0x48, 0x6a, 0x01, 0x00, 0x00, 0x48, 0x6a, 0xad, 0xb5, 0x96, 0x4a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x0b, 0x00, 0x00,
+    0x80, 0x31, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x80, 0x03, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x5b, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x52, 0x00, 0x00, 0x00, 0xc0, 0x52, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00,
+    0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0c, 0x00, 0x00, 0x00, 0x53, 0x0c, 0x00, 0x00, 0x00, 0x53, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00,
+    0x54, 0x42, 0x06, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x00, 0x54, 0x4a, 0x00, 0x00, 0x00, 0x56, 0x4a, 0x00, 0x00, 0x00, 0x56, 0x4a, 0x6a, 0x01,
+    0x00, 0x56, 0x4a, 0x6a, 0xad, 0xa5, 0x52, 0x4a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x00, 0x00, 0x10, 0x42, 0xe7, 0x00, 0x00, 0x10, 0x42, 0x08,
+    0x00, 0x00, 0x52, 0x42, 0x08, 0x00, 0x90, 0x52, 0x42, 0x08, 0x00, 0xa0, 0x52, 0x42, 0x28, 0xa9, 0xa4, 0x52, 0x42, 0x28, 0x29, 0xa5, 0x12, 0x42,
+    0xe7, 0x20, 0x84, 0xce, 0x39, 0x27, 0x01, 0x00, 0xd2, 0x39, 0x28, 0x01, 0x00, 0x12, 0x3a, 0x28, 0x01, 0x00, 0x12, 0x42, 0x08, 0x01, 0x00, 0x10,
+    0x42, 0x28, 0x01, 0x00, 0x12, 0x42, 0x28, 0xa1, 0x84, 0x12, 0x42, 0x28, 0xa5, 0x94, 0x12, 0x42, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x08, 0x01, 0x00,
+    0x8c, 0x31, 0x08, 0x01, 0x00, 0xce, 0x39, 0x29, 0x01, 0x00, 0x00, 0x42, 0x29, 0x25, 0x00, 0x00, 0x42, 0x29, 0x29, 0x00, 0x00, 0x42, 0x29, 0xa9,
+    0xa4, 0x12, 0x42, 0x28, 0x29, 0xa5, 0x12, 0x42, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x49, 0x01, 0x00, 0x80, 0x31, 0x49, 0x01, 0x00, 0x80, 0x31, 0x49,
+    0x01, 0x00, 0x00, 0x38, 0x69, 0x01, 0x00, 0x00, 0x40, 0x69, 0x01, 0x00, 0x00, 0x48, 0x69, 0x01, 0x00, 0x96, 0x4a, 0x29, 0xa9, 0xb5, 0x96, 0x4a,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x0b, 0x00, 0x00, 0x00, 0x30, 0x0b, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x5b, 0x0c, 0x00, 0x00, 0x00, 0x5b, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x52, 0x00, 0x00, 0x00, 0xc0, 0x52, 0x00,
+    0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0a, 0x00, 0x00, 0x00, 0x53,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x08, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x56,
+    0x42, 0x00, 0x00, 0x00, 0x56, 0x42, 0x00, 0x00, 0x00, 0x56, 0x42, 0x28, 0x29, 0xa5, 0x52, 0x42, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00,
+    0xc0, 0x39, 0x06, 0x00, 0x00, 0xc0, 0x39, 0x06, 0x00, 0x00, 0xc0, 0x39, 0x07, 0x00, 0x00, 0x14, 0x3a, 0x07, 0x00, 0xa0, 0x14, 0x3a, 0x08, 0x00,
+    0x80, 0x10, 0x3a, 0xe8, 0x20, 0x84, 0x10, 0x3a, 0x07, 0x21, 0x84, 0xd0, 0x39, 0x08, 0x00, 0x00, 0x00, 0x3a, 0x08, 0x00, 0x00, 0x00, 0x3a, 0x08,
+    0x00, 0x00, 0x00, 0x3a, 0x08, 0x01, 0x00, 0x10, 0x3a, 0x08, 0x01, 0x00, 0x10, 0x3a, 0xe7, 0x00, 0x00, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x39,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x07, 0x00, 0x00, 0x80, 0x31, 0x07, 0x00, 0x00, 0x80, 0x31, 0x07, 0x00, 0x00, 0x80, 0x31, 0x48, 0x01, 0x00, 0xc0,
+    0x39, 0x48, 0x29, 0x00, 0xc0, 0x39, 0x08, 0x21, 0x00, 0x00, 0x3a, 0x08, 0x21, 0x84, 0x0e, 0x3a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x09, 0x00, 0x00,
+    0x00, 0x32, 0x09, 0x00, 0x00, 0x00, 0x30, 0x09, 0x00, 0x00, 0x00, 0x30, 0x69, 0x01, 0x00, 0x00, 0x30, 0x69, 0x01, 0x00, 0x00, 0x38, 0x69, 0x01,
+    0x00, 0x00, 0x38, 0x29, 0x29, 0xa5, 0x12, 0x3a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x0b, 0x00, 0x00, 0x00, 0x38, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x80, 0x4a,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc0, 0x42, 0x00, 0x00, 0x00, 0x56, 0x42, 0x00, 0x00, 0x00, 0x52, 0x42,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x09, 0x00, 0x00, 0x40, 0x32, 0x06, 0x00, 0xb0, 0x56, 0x32, 0x06, 0x00, 0x90, 0x12, 0x32, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x09, 0x00, 0x00, 0x40, 0x3a, 0xe7, 0x00,
+    0x00, 0xce, 0x39, 0xe7, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x09, 0x00, 0x00, 0x40, 0x32, 0x69, 0x2d, 0x00, 0x80, 0x31, 0x28, 0x25, 0x00, 0x80, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x0b, 0x00, 0x00, 0x00, 0x40, 0x69, 0x01, 0x00, 0x00, 0x30, 0x29, 0x01, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x53, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x18, 0x53, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0xc0, 0x18, 0x42,
+    0xe7, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x08, 0x01, 0x00, 0x10, 0x3a, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x88, 0x31, 0x00, 0xc0, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x8c, 0x01, 0x00, 0x00, 0x38,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x14, 0x00, 0x40, 0x29, 0xa5, 0x14, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x02, 0x00, 0x28, 0xa5, 0x94, 0x02,
+    0x00, 0x28, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x52, 0x0a, 0x00, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x14, 0x00, 0x40, 0x29, 0xa5, 0x14, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x02, 0x00, 0x28, 0xa5, 0x94, 0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x00, 0x00, 0xa5, 0x94, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x90, 0x52, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52,
+    0x4a, 0x29, 0x00, 0x80, 0x94, 0x50, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x80, 0x50, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x14, 0x00,
+    0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x73, 0x4c, 0x29, 0x00, 0x00, 0x84, 0x4e, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x70, 0x4e, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00,
+    0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x70, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00,
+    0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00,
+    0x00, 0x63, 0x4c, 0x29, 0x00, 0x80, 0x73, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4e, 0x29, 0x00, 0x00, 0x00, 0x4e, 0x29, 0x00, 0x00, 0x00, 0x4e, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x60, 0x4c,
+    0x29, 0x00, 0x00, 0x00, 0x4e, 0x29, 0x00, 0x00, 0x00, 0x4e, 0x29, 0x00, 0x00, 0x00, 0x4e, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4e, 0x29, 0x00, 0x00,
+    0x00, 0x4e, 0x29, 0x00, 0x00, 0x00, 0x4e, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c,
+    0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x63, 0x4a, 0x29, 0x00, 0x00,
+    0x60, 0x4a, 0x29, 0x00, 0x00, 0x60, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00,
+    0x80, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x60, 0x4a, 0x29, 0x00, 0x00, 0x60, 0x4a, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a,
+    0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x29, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00,
+    0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a,
+    0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x53, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00,
+    0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x60, 0x4a, 0x29, 0x00,
+    0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00,
+    0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00,
+    0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x60, 0x4a, 0x29, 0x00, 0x00, 0x60, 0x4a, 0x29, 0x00, 0x00, 0x60, 0x4a,
+    0x29, 0x00, 0x00, 0x60, 0x4a, 0x29, 0x00, 0x00, 0x60, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00,
+    0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0,
+    0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00,
+    0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00,
+    0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b,
+    0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0,
+    0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0xa5, 0x14, 0x00, 0x40, 0x29, 0xa5, 0x14, 0x00,
+    0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x02, 0x00, 0x28, 0xa5, 0x94, 0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xa5, 0x94, 0x52, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0xa5, 0x94, 0x52,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0xe0, 0x9c, 0x2a, 0x00,
+    0x00, 0x00, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a,
+    0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x00, 0xe0, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c,
+    0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50,
+    0x4a, 0x29, 0x00, 0x00, 0xe0, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a, 0x00, 0x00,
+    0x00, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x9c, 0x2a, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x80, 0x2a, 0x00,
+    0x00, 0x00, 0x80, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x2a,
+    0xa5, 0x14, 0x00, 0x40, 0x29, 0xa5, 0x14, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x80, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x2a, 0x00, 0x00, 0x00, 0x80,
+    0x2a, 0x00, 0x00, 0x00, 0x80, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x2a, 0xa5, 0x94, 0x02, 0x00, 0x28, 0xa5, 0x94, 0x02,
+    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xa5, 0x94, 0x52, 0x0a, 0x00, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xc6, 0x18, 0x63, 0x4a, 0x29, 0x00, 0x18, 0x63,
+    0x4a, 0x29, 0x00, 0xa4, 0x94, 0x52, 0x2a, 0x00, 0x80, 0xd6, 0x52, 0x2a, 0x00, 0x00, 0xd0, 0x52, 0x2a, 0x00, 0x00, 0xd0, 0x52, 0x2a, 0x00, 0x00,
+    0xd0, 0x52, 0x2a, 0x00, 0x00, 0xd0, 0x52, 0x2a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x94, 0x52, 0x2a, 0x00,
+    0x80, 0xd6, 0x52, 0x2a, 0x00, 0x00, 0xd0, 0x52, 0x2a, 0x00, 0x00, 0xd0, 0x52, 0x2a, 0x00, 0x00, 0xd0, 0x52, 0x2a, 0x00, 0x00, 0xd0, 0x52, 0x2a,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x06, 0x00, 0x90, 0x12, 0x2a, 0x00, 0x00, 0x00, 0x52, 0x2a, 0x00, 0x00, 0x00, 0x52,
+    0x2a, 0x00, 0x00, 0x00, 0x52, 0x2a, 0x00, 0x00, 0x00, 0x52, 0x2a, 0x00, 0x00, 0x00, 0x52, 0x2a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x00, 0x00,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x10, 0x2a, 0x00, 0x00, 0x00, 0x52, 0x2a, 0x00, 0x00, 0x00, 0x52, 0x2a, 0x00, 0x00, 0x00, 0x52, 0x2a, 0x00, 0x00,
+    0x00, 0x52, 0x2a, 0x00, 0x00, 0x00, 0x52, 0x2a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x14, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x2a, 0x00, 0x00, 0x00, 0x40, 0x2a, 0x00, 0x00, 0x00, 0x40, 0x2a, 0x00, 0x00, 0x00, 0x40, 0x2a, 0x00, 0x00, 0x00, 0x40, 0x2a,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x20, 0x84, 0xd0, 0x29, 0x00, 0x20, 0x84, 0x10, 0x2a, 0x00, 0x00, 0x86, 0x10,
+    0x2a, 0x00, 0x00, 0x86, 0x10, 0x2a, 0x00, 0x00, 0x86, 0x10, 0x2a, 0x00, 0x00, 0x86, 0x10, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x06, 0x00, 0x70, 0x8e, 0x29, 0x05,
+    0x00, 0x80, 0xd0, 0x29, 0x00, 0x00, 0x80, 0x10, 0x2a, 0x00, 0x00, 0x80, 0x10, 0x2a, 0x00, 0x00, 0x80, 0x10, 0x2a, 0x00, 0x00, 0x80, 0x10, 0x2a,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0xce, 0x29, 0x00, 0x00, 0x00, 0x10,
+    0x2a, 0x00, 0x00, 0x00, 0x10, 0x2a, 0x00, 0x00, 0x00, 0x10, 0x2a, 0x00, 0x00, 0x00, 0x10, 0x2a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00,
+    0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xe5, 0x9c, 0x73, 0xce, 0x29, 0x00,
+    0x9c, 0x73, 0xce, 0x29, 0x00, 0x20, 0x74, 0xce, 0x29, 0x00, 0x2c, 0x74, 0xce, 0x29, 0x0b, 0x2c, 0x74, 0xce, 0x29, 0x00, 0xac, 0x73, 0xce, 0x29,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xe7, 0x1c, 0x63, 0x8c, 0x31, 0xc7, 0x1c, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x73, 0x8c, 0x31, 0x00, 0x80, 0x73, 0xce,
+    0x31, 0x00, 0x80, 0x73, 0xce, 0x31, 0x40, 0x81, 0x73, 0xce, 0x31, 0x00, 0x80, 0x73, 0xce, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0xc6, 0x94, 0x52, 0x4a, 0x29, 0x05, 0x00, 0x60, 0x8c, 0x29, 0x08, 0x00, 0x70, 0x8e, 0x29, 0x0b, 0x00, 0x70, 0xce, 0x29, 0x0b, 0x2c,
+    0x70, 0xce, 0x29, 0x0b, 0x00, 0x70, 0xce, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00,
+    0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x8c, 0x29, 0x00, 0x00, 0x00, 0xce, 0x29, 0x00, 0x00, 0x06, 0xce, 0x29, 0x00, 0x00, 0x00, 0xce, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0xc0, 0x29, 0x00, 0x00, 0xd0, 0xc0, 0x29, 0x00, 0x00, 0x00, 0xc0, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x1c, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x2b,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x63, 0x8c, 0x29, 0x00, 0x00, 0x63, 0x8c, 0x29, 0x00, 0x00, 0x63, 0x8c, 0x29, 0x00, 0x9c, 0x63, 0x8c, 0x29, 0x00, 0x98,
+    0x63, 0x8c, 0x29, 0xe6, 0x9c, 0x63, 0x8c, 0x29, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xe7, 0x1c, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x63, 0x8c, 0x31, 0x00,
+    0x80, 0x63, 0x8c, 0x31, 0x00, 0x80, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xe6, 0x18, 0x63, 0x8c, 0x31,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a,
+    0x29, 0x07, 0x00, 0x60, 0x4c, 0x29, 0x09, 0x00, 0x60, 0x4c, 0x29, 0xe8, 0xa0, 0x63, 0x4c, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00,
+    0x00, 0x4c, 0x29, 0x00, 0x80, 0x84, 0x4c, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00,
+    0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x00, 0xa0, 0x92, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x96, 0x2a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a,
+    0x29, 0x00, 0x00, 0x54, 0x4a, 0x29, 0x00, 0x20, 0x54, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00,
+    0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00,
+    0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x08, 0x00, 0x50, 0x4a, 0x29, 0x08, 0x00, 0x50, 0x4a, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x60, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a,
+    0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00,
+    0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x70, 0x4a, 0x29, 0x00, 0xa4, 0x64, 0x4a, 0x29,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c,
+    0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x70, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00,
+    0x70, 0x4a, 0x29, 0x09, 0x00, 0x50, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00,
+    0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x00, 0x00, 0x80,
+    0x29, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
+    0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
+    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68,
+    0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00,
+    0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
+    0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0xa5, 0x14, 0x00, 0x40, 0x29, 0xa5, 0x14, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
+    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68,
+    0xa5, 0x94, 0x02, 0x00, 0x28, 0xa5, 0x94, 0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x00, 0xa5, 0x94, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x18, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00,
+    0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x18, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00,
+    0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x18, 0x5b, 0x00,
+    0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b,
+    0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x18, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00,
+    0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xa5, 0x14, 0x00, 0x40, 0x29, 0xa5, 0x14, 0x00,
+    0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+    0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0xa5, 0x94, 0x02, 0x00, 0x28, 0xa5, 0x94, 0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00,
+    0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58,
+    0xa5, 0x94, 0x52, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0xa5, 0x94, 0x52,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x90, 0x52, 0x4a, 0x00,
+    0x00, 0xb0, 0x96, 0x4a, 0x00, 0x00, 0x00, 0x96, 0x4a, 0x00, 0x00, 0x00, 0x96, 0x4a, 0x00, 0x00, 0x00, 0x96, 0x4a, 0x00, 0x00, 0x00, 0x96, 0x4a,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x94, 0x52, 0x4a, 0x00, 0x00, 0xb0, 0x96, 0x4a, 0x00, 0x00, 0x00, 0x96,
+    0x4a, 0x00, 0x00, 0x00, 0x96, 0x4a, 0x00, 0x00, 0x00, 0x96, 0x4a, 0x00, 0x00, 0x00, 0x96, 0x4a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x05, 0x00, 0x50,
+    0x4a, 0x29, 0x09, 0x00, 0x90, 0x52, 0x4a, 0x0b, 0x00, 0xb0, 0x96, 0x4a, 0x00, 0x00, 0x00, 0x96, 0x4a, 0x00, 0x00, 0x00, 0x96, 0x4a, 0x00, 0x00,
+    0x00, 0x96, 0x4a, 0x00, 0x00, 0x00, 0x96, 0x4a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0x29, 0x01, 0x00, 0x52, 0x42, 0x0b,
+    0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x14, 0x00, 0x40, 0x29, 0x09, 0x00, 0x00, 0x00, 0x42, 0x0b, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80,
+    0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x02,
+    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x80, 0x10, 0x42, 0x00, 0x00, 0x90, 0x12, 0x42, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x00, 0x00,
+    0xa0, 0x12, 0x42, 0x00, 0x00, 0xa0, 0x12, 0x42, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x84, 0x10, 0x3a, 0x00,
+    0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x00, 0x00, 0xa0, 0x12, 0x42,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x08, 0x01, 0x00, 0xce, 0x31, 0x08, 0x01, 0x00, 0x10, 0x3a, 0x0a, 0x00, 0x00, 0x12, 0x42, 0x0a, 0x00, 0x00, 0x12, 0x42, 0x0a, 0x00,
+    0x00, 0x12, 0x42, 0x0a, 0x00, 0x00, 0x12, 0x42, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x08, 0x00, 0x00, 0x40, 0x29, 0x09,
+    0x00, 0x00, 0xc0, 0x39, 0x0a, 0x00, 0x00, 0x00, 0x42, 0x0a, 0x00, 0x00, 0x00, 0x42, 0x0a, 0x00, 0x00, 0x00, 0x42, 0x0a, 0x00, 0x00, 0x00, 0x42,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x05, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xce, 0x39, 0x00, 0x00, 0x80, 0xd0,
+    0x39, 0x00, 0x00, 0x80, 0xd0, 0x39, 0x0a, 0x00, 0x80, 0xd0, 0x39, 0x00, 0x00, 0x80, 0xd0, 0x39, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0xa5, 0x9c, 0x73, 0xce, 0x39, 0x00, 0x80, 0x73, 0xce, 0x39, 0x00, 0x00, 0x84, 0xce, 0x39, 0x00, 0x80, 0x84, 0xce, 0x39, 0x20, 0x81,
+    0x84, 0xce, 0x39, 0x00, 0x80, 0x84, 0xce, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x21, 0x64, 0x8c, 0x31, 0x06, 0x19, 0x64, 0x8c, 0x31, 0x07,
+    0x00, 0x70, 0x8e, 0x31, 0x07, 0x00, 0x70, 0xce, 0x39, 0x07, 0x00, 0x80, 0xce, 0x39, 0x07, 0x20, 0x80, 0xce, 0x39, 0x07, 0x00, 0x80, 0xce, 0x39,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xe7, 0x9c, 0x52, 0x4a, 0x29, 0xe7, 0x00, 0x00, 0x8c, 0x31, 0x08, 0x01, 0x00, 0xce,
+    0x31, 0x28, 0x01, 0x00, 0xce, 0x39, 0x28, 0x81, 0x04, 0xce, 0x39, 0x27, 0x01, 0x00, 0xce, 0x39, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x08, 0x00, 0x50, 0x4a, 0x29, 0x08, 0x00, 0x00, 0x40, 0x29, 0x08, 0x00, 0x00, 0x80, 0x31, 0x08, 0x00, 0x00, 0xc0, 0x39, 0x08, 0x00,
+    0xa0, 0xc0, 0x39, 0x08, 0x00, 0x00, 0xc0, 0x39, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x16, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x68, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x80, 0x8e, 0x31, 0x00,
+    0x00, 0x80, 0x8e, 0x31, 0x00, 0x00, 0x80, 0x8e, 0x31, 0x00, 0x00, 0x80, 0x8e, 0x31, 0x00, 0x00, 0x80, 0x8e, 0x31, 0x08, 0x00, 0x80, 0x8c, 0x31,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x05, 0x00, 0x60, 0x8c, 0x31, 0x05, 0x00, 0x60, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8c,
+    0x31, 0x00, 0x80, 0x73, 0x8c, 0x31, 0x00, 0x80, 0x73, 0x8c, 0x31, 0xe7, 0x9c, 0x73, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xe6, 0x9c, 0x63,
+    0x8c, 0x31, 0x07, 0x00, 0x70, 0x8c, 0x31, 0x07, 0x00, 0x70, 0x8c, 0x31, 0x07, 0x00, 0x70, 0x8c, 0x31, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x06, 0x00,
+    0x60, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x06, 0x00, 0x50, 0x4a, 0x29, 0x06,
+    0x00, 0x50, 0x4a, 0x29, 0x06, 0x00, 0x00, 0x4a, 0x29, 0xe7, 0x00, 0x00, 0x8c, 0x29, 0xc7, 0x00, 0x00, 0x8c, 0x29, 0xe7, 0x1c, 0x73, 0x8c, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x08, 0x00, 0x00, 0x4a, 0x29, 0x08, 0x00, 0x00, 0x4a, 0x29, 0x08, 0x00, 0x00, 0x40,
+    0x29, 0x08, 0x00, 0x00, 0x40, 0x29, 0x08, 0x00, 0x00, 0x80, 0x29, 0x07, 0x00, 0x70, 0x90, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x50, 0x32, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x52,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x80, 0x8e, 0x31, 0x00, 0x00,
+    0x80, 0x8e, 0x31, 0x00, 0x00, 0x80, 0x8c, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00,
+    0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x80, 0x4a, 0x29, 0x00, 0x00, 0x84, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c,
+    0x31, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x06, 0x00, 0x60, 0x8c, 0x31, 0x06, 0x00, 0x60, 0x8c, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x08, 0x00, 0x00, 0x4a, 0x29, 0x08, 0x01,
+    0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00,
+    0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x08, 0x00, 0x00, 0x40, 0x29, 0x08, 0x00, 0x00, 0x40, 0x29, 0x07, 0x00, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80,
+    0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x92, 0x31, 0x00, 0x00, 0x90, 0x8c, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00,
+    0x00, 0x4e, 0x29, 0x00, 0x80, 0x94, 0x4c, 0x29, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00,
+    0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x06, 0x00, 0x60, 0x8c, 0x31,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x4e, 0x29, 0x29, 0x01, 0x00, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x00,
+    0x00, 0x80, 0x29, 0x09, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x14, 0x00, 0x40, 0x29, 0xa5, 0x14, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x02, 0x00, 0x28, 0xa5, 0x94, 0x02,
+    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x0a, 0x00, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0xc0, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+    0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0xc0, 0x5a, 0x00,
+    0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58,
+    0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x0b, 0x00, 0x00, 0xc0, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00,
+    0x4a, 0x29, 0x0b, 0x00, 0x00, 0xc0, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+    0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0xa5, 0x14, 0x00, 0x40, 0x29, 0xa5, 0x14, 0x00, 0x40, 0x29, 0x0b, 0x00, 0x00, 0xc0, 0x5a, 0x00,
+    0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x58,
+    0xa5, 0x94, 0x02, 0x00, 0x28, 0xa5, 0x94, 0x02, 0x00, 0x28, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x00, 0xa5, 0x94, 0x52,
+    0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0xa5, 0x94, 0x52, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x80, 0x52, 0x00, 0x00, 0x00, 0x80, 0x52, 0x00, 0x00, 0x00, 0x80,
+    0x52, 0x00, 0x00, 0x00, 0x80, 0x52, 0x00, 0x00, 0x00, 0x80, 0x52, 0x00, 0x00, 0x00, 0x80, 0x52, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x94, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00,
+    0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x09, 0x00, 0x90, 0x52, 0x4a, 0x00,
+    0x00, 0x00, 0x94, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0x29, 0x01, 0x00, 0x52, 0x4a, 0x4a, 0x01, 0x00, 0x94, 0x4a, 0x0a, 0x00, 0x00, 0x80,
+    0x4a, 0x0a, 0x00, 0x00, 0x80, 0x4a, 0x0a, 0x00, 0x00, 0x80, 0x4a, 0x0a, 0x00, 0x00, 0x80, 0x4a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x14, 0x00,
+    0x40, 0x29, 0x29, 0x25, 0x00, 0x40, 0x4a, 0x4a, 0x01, 0x00, 0x00, 0x48, 0x0a, 0x00, 0x00, 0x00, 0x48, 0x0a, 0x00, 0x00, 0x00, 0x48, 0x0a, 0x00,
+    0x00, 0x00, 0x48, 0x0a, 0x00, 0x00, 0x00, 0x48, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x02, 0x00, 0x28, 0x29, 0x01, 0x00, 0x00, 0x40, 0x4a,
+    0x01, 0x00, 0x00, 0x48, 0x0a, 0x00, 0x00, 0x00, 0x48, 0x0a, 0x00, 0x00, 0x00, 0x48, 0x0a, 0x00, 0x00, 0x00, 0x48, 0x0a, 0x00, 0x00, 0x00, 0x48,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00,
+    0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x40, 0x4a,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x00, 0x52, 0x42, 0x00, 0x00, 0x00, 0x52,
+    0x42, 0x00, 0x00, 0x00, 0x52, 0x42, 0x00, 0x00, 0x00, 0x52, 0x42, 0x00, 0x00, 0x00, 0x52, 0x42, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x07, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x00, 0x12, 0x42, 0x08, 0x00, 0x00, 0x12, 0x42, 0x08, 0x00,
+    0x00, 0x12, 0x42, 0x08, 0x00, 0x00, 0x12, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x08, 0x21, 0x00, 0xc0, 0x39, 0x08, 0x21, 0x00, 0x00, 0x42, 0x28, 0x01, 0x00, 0x00,
+    0x42, 0x28, 0x01, 0x00, 0x00, 0x42, 0x28, 0x01, 0x00, 0x00, 0x42, 0x28, 0x01, 0x00, 0x00, 0x42, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x08, 0x01, 0x00, 0x00, 0x28, 0x29, 0x01, 0x00, 0x00, 0x38, 0x29, 0x01, 0x00, 0x00, 0x40, 0x29, 0x01, 0x00, 0x00, 0x40, 0x29, 0x01,
+    0x00, 0x00, 0x40, 0x29, 0x01, 0x00, 0x00, 0x40, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x05, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x0a, 0x00,
+    0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0xd0, 0x39, 0x00,
+    0x00, 0x00, 0xd0, 0x39, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x20, 0x01, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x10, 0x3a,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x73, 0xce, 0x39, 0x06, 0x00, 0x70, 0xce, 0x39, 0x07, 0x00, 0x80, 0xd0,
+    0x39, 0x07, 0x00, 0x80, 0xd0, 0x39, 0x07, 0x20, 0x80, 0xd0, 0x39, 0x07, 0x00, 0x80, 0xce, 0x39, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x20, 0x84,
+    0x8c, 0x31, 0xc6, 0x20, 0x83, 0x8c, 0x31, 0xe7, 0x00, 0x00, 0xce, 0x31, 0xe7, 0x00, 0x00, 0xce, 0x39, 0xe7, 0x00, 0x00, 0xce, 0x39, 0xe7, 0x80,
+    0x03, 0xce, 0x39, 0xe7, 0x00, 0x00, 0xce, 0x39, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xe7, 0x9c, 0x53, 0x4a, 0x29, 0xe7,
+    0x1c, 0x00, 0x80, 0x31, 0x07, 0x21, 0x00, 0xc0, 0x39, 0x07, 0x21, 0x00, 0xc0, 0x39, 0x07, 0x21, 0x80, 0xc0, 0x39, 0xe7, 0x20, 0x00, 0xc0, 0x39,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x07, 0x01, 0x00, 0x4a, 0x29, 0x07, 0x01, 0x00, 0x00, 0x28, 0x08, 0x01, 0x00, 0x00,
+    0x30, 0x08, 0x01, 0x00, 0x00, 0x38, 0x08, 0x01, 0x00, 0x12, 0x38, 0x08, 0x01, 0x00, 0x00, 0x38, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x09, 0x00, 0x00, 0x40, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+    0x00, 0x80, 0x02, 0x09, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40,
+    0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x08, 0x00, 0x00, 0x40, 0x42, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x05, 0x00, 0x00, 0xd0, 0x31, 0x05, 0x00, 0x00, 0xd0, 0x31, 0x00, 0x00, 0x00, 0xd0, 0x31, 0x00, 0x00, 0x00, 0xd0, 0x31, 0x00, 0x00,
+    0x00, 0xd0, 0x31, 0xe8, 0x00, 0x00, 0x8e, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x8c, 0x31, 0xa5,
+    0x00, 0x00, 0x8c, 0x31, 0x05, 0x00, 0x00, 0x8c, 0x31, 0x06, 0x00, 0x70, 0x8e, 0x31, 0x06, 0x00, 0x60, 0x8e, 0x31, 0xe6, 0x98, 0x73, 0x8e, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x9c, 0x73, 0x8c, 0x31, 0xe6, 0x00, 0x00, 0x8e, 0x31, 0xe6, 0x00, 0x00, 0x8e, 0x31, 0xe6, 0x00, 0x00, 0x8e,
+    0x31, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0xc6, 0x00, 0x00, 0x4a, 0x29, 0xc6, 0x00, 0x00, 0x4a, 0x29, 0xc6, 0x00, 0x00, 0x40, 0x29, 0xe6, 0x1c, 0x00, 0x80, 0x31, 0xe6, 0x18,
+    0x00, 0x80, 0x31, 0xe6, 0x9c, 0x63, 0x8e, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x07, 0x01, 0x00, 0x40, 0x29, 0x07,
+    0x01, 0x00, 0x40, 0x29, 0x07, 0x01, 0x00, 0x00, 0x28, 0x07, 0x01, 0x00, 0x00, 0x28, 0x07, 0x01, 0x00, 0x00, 0x30, 0xe6, 0x00, 0x00, 0x0e, 0x32,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x09, 0x00, 0x00, 0x00, 0x28, 0x09, 0x00, 0x00, 0x00, 0x28, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4a, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00,
+    0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x06, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0,
+    0x31, 0x00, 0x00, 0x00, 0xd0, 0x31, 0x00, 0x00, 0x00, 0xd0, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x05, 0x00, 0x00, 0x40, 0x29, 0x05, 0x00, 0x00, 0x40, 0x29, 0x05, 0x00, 0x00, 0x40, 0x29, 0x05, 0x00, 0x00, 0x50, 0x29, 0x05, 0x00,
+    0x80, 0x50, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00, 0x80, 0x31, 0x06,
+    0x00, 0x00, 0x80, 0x31, 0x06, 0x00, 0x00, 0x80, 0x31, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x00, 0x00, 0x8c, 0x31,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x05, 0x00, 0x00, 0x40, 0x29, 0x05, 0x00, 0x00, 0x40, 0x29, 0x05, 0x00, 0x00, 0x40,
+    0x29, 0x05, 0x01, 0x00, 0x40, 0x29, 0x05, 0x21, 0x00, 0x40, 0x29, 0xa5, 0x14, 0x00, 0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x07, 0x00, 0x00, 0x80, 0x29, 0x07, 0x00, 0x00, 0x00, 0x28, 0x07, 0x00, 0x00, 0x00, 0x28, 0x07, 0x01, 0x00, 0x00, 0x28, 0x07, 0x01,
+    0x00, 0x00, 0x28, 0xe6, 0x00, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x09, 0x00, 0x00, 0x00, 0x30, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x42, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x00, 0x92, 0x31,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x07, 0x00, 0x00, 0xc0, 0x29, 0x05, 0x00, 0x90, 0x92, 0x29, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x07, 0x00,
+    0x00, 0xc0, 0x31, 0xc6, 0x00, 0x00, 0x8c, 0x31, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x07, 0x00, 0x00, 0xc0, 0x29, 0x26, 0x25, 0x00, 0x40, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x09, 0x00, 0x00, 0x00, 0x30, 0x26, 0x01, 0x00, 0x00, 0x28, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00,
+    0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42,
+    0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40,
+    0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02,
+    0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42,
+    0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00,
+    0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x60, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x63, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x00,
+    0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x80, 0x52, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00,
+    0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08,
+    0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a,
+    0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00,
+    0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00,
+    0x80, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08,
+    0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x80, 0x42, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00,
+    0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x50, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42,
+    0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42,
+    0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00,
+    0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42,
+    0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0xa4, 0x94, 0x42, 0x08, 0x21, 0x00, 0x94, 0x42, 0x08, 0x21, 0x00, 0x94, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x90, 0x12, 0x21, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x12, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x90, 0x12, 0x21, 0x00, 0x00, 0x00, 0x12,
+    0x21, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x12, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x40,
+    0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x90, 0x12, 0x21, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00,
+    0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x12, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02,
+    0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x9c, 0x73, 0x0e, 0x21, 0x00, 0x00, 0x84, 0x0e, 0x21, 0x00, 0x00, 0x80, 0x0e, 0x21, 0x00, 0x00,
+    0x80, 0x0e, 0x21, 0x00, 0x00, 0x80, 0x0e, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00,
+    0x80, 0x73, 0x0c, 0x21, 0x00, 0x00, 0x84, 0x0e, 0x21, 0x00, 0x00, 0x80, 0x0e, 0x21, 0x00, 0x00, 0x80, 0x0e, 0x21, 0x00, 0x00, 0x80, 0x0e, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x05, 0x00, 0x60, 0x0c, 0x21, 0x00, 0x00, 0x00, 0x0e,
+    0x21, 0x00, 0x00, 0x00, 0x0e, 0x21, 0x00, 0x00, 0x00, 0x0e, 0x21, 0x00, 0x00, 0x00, 0x0e, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x0e, 0x21, 0x00, 0x00, 0x00, 0x0e, 0x21, 0x00, 0x00,
+    0x00, 0x0e, 0x21, 0x00, 0x00, 0x00, 0x0e, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x10, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x18, 0x63, 0x0c, 0x21, 0x00, 0x18, 0x63, 0x0c,
+    0x21, 0x00, 0x80, 0x63, 0x0c, 0x21, 0x00, 0x80, 0x63, 0x0c, 0x21, 0x00, 0x80, 0x63, 0x0c, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x05,
+    0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x50, 0x0a, 0x21, 0x00, 0x00, 0x60, 0x0c, 0x21, 0x00, 0x00, 0x60, 0x0c, 0x21, 0x00, 0x00, 0x60, 0x0c, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x0e, 0x21, 0x00, 0x00, 0x70, 0x0e, 0x21, 0x00, 0x00, 0x70, 0x0e, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x10, 0x21, 0x00, 0x00, 0x00, 0x10, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0xa4,
+    0x94, 0x52, 0x0a, 0x21, 0x00, 0x94, 0x52, 0x0a, 0x21, 0x00, 0x94, 0x52, 0x0a, 0x21, 0x00, 0x98, 0x52, 0x0a, 0x21, 0xa6, 0x98, 0x52, 0x0a, 0x21,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xc6, 0x98, 0x52, 0x4a, 0x29, 0xa6, 0x98, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a,
+    0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0xa6, 0x98, 0x52, 0x4a, 0x29, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0xa5, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x08, 0x00, 0x40, 0x08, 0x21, 0x06, 0x00,
+    0x60, 0x08, 0x21, 0x08, 0x99, 0x62, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x80, 0x63, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x80, 0x0e, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x12, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x10,
+    0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00,
+    0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08,
+    0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x07, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08,
+    0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x80, 0x42, 0x08, 0x21, 0x00, 0x94, 0x42, 0x08, 0x21, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x00, 0x50, 0x4a, 0x29, 0x00, 0x80,
+    0x52, 0x4a, 0x29, 0x00, 0x80, 0x52, 0x4a, 0x29, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x08, 0x00, 0x40, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x50, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x0a, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02,
+    0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42,
+    0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00,
+    0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42,
+    0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x52, 0x22, 0x00, 0x00, 0x00, 0x40,
+    0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42,
+    0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x52, 0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x00, 0x00,
+    0x00, 0x40, 0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x52, 0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x00, 0x00, 0x00, 0x40, 0x22,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x52, 0x22, 0x00, 0x00, 0x00, 0x40,
+    0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x00, 0x00, 0x00, 0x40, 0x22, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00,
+    0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x70, 0xce, 0x21, 0x00, 0x00, 0x80, 0xd0, 0x21, 0x00, 0x00, 0x00, 0xd0, 0x21, 0x00, 0x00, 0x00, 0xd0, 0x21, 0x00, 0x00, 0x00, 0xd0, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x80, 0x73, 0xce, 0x21, 0x00, 0x00, 0x80, 0xd0,
+    0x21, 0x00, 0x00, 0x00, 0xd0, 0x21, 0x00, 0x00, 0x00, 0xd0, 0x21, 0x00, 0x00, 0x00, 0xd0, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x07, 0x00, 0x70, 0x8e, 0x21, 0x08, 0x00, 0x80, 0xd0, 0x21, 0x00, 0x00, 0x00, 0xd0, 0x21, 0x00, 0x00,
+    0x00, 0xd0, 0x21, 0x00, 0x00, 0x00, 0xd0, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0xe7,
+    0x00, 0x00, 0x8c, 0x21, 0x08, 0x00, 0x00, 0xc0, 0x21, 0x00, 0x00, 0x00, 0xc0, 0x21, 0x00, 0x00, 0x00, 0xc0, 0x21, 0x00, 0x00, 0x00, 0xc0, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x07, 0x00, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0xc0,
+    0x21, 0x00, 0x00, 0x00, 0xc0, 0x21, 0x00, 0x00, 0x00, 0xc0, 0x21, 0x00, 0x00, 0x00, 0xc0, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x22, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x60, 0x8c, 0x21, 0x00, 0x00, 0x60, 0x8c, 0x21, 0x00, 0x00, 0x70, 0x8c, 0x21, 0x00, 0x00,
+    0x70, 0x8c, 0x21, 0x00, 0x00, 0x70, 0x8c, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x63, 0x8c, 0x21, 0x00, 0x00, 0x63, 0x8c, 0x21, 0x00, 0x00, 0x70, 0x8c, 0x21, 0x00, 0x00, 0x70, 0x8c, 0x21, 0x00, 0x00, 0x70, 0x8c, 0x21,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0xc6, 0x00, 0x00, 0x08, 0x21, 0xc6, 0x00, 0x00, 0x4a, 0x21, 0x07, 0x00, 0x00, 0x8c, 0x21, 0x07, 0x00,
+    0x00, 0x8c, 0x21, 0x07, 0x00, 0x00, 0x8c, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x06,
+    0x00, 0x00, 0x00, 0x21, 0x06, 0x00, 0x00, 0x00, 0x21, 0x07, 0x00, 0x00, 0xc0, 0x21, 0x07, 0x00, 0x00, 0xce, 0x21, 0x07, 0x00, 0x00, 0xce, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x60, 0x4a, 0x21, 0x00, 0x00, 0x60, 0x4a,
+    0x21, 0x00, 0x00, 0x60, 0x4a, 0x21, 0x00, 0x00, 0x50, 0x4a, 0x21, 0x07, 0x00, 0x50, 0x4a, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x94, 0x52, 0x4a, 0x21, 0x00, 0x80, 0x52, 0x4a, 0x21, 0x00, 0x80, 0x52, 0x4a, 0x21, 0x00, 0x00,
+    0x53, 0x4a, 0x21, 0xc6, 0x18, 0x53, 0x4a, 0x21, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xc5, 0x18, 0x53, 0x4a, 0x29, 0xc5,
+    0x14, 0x53, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0xc5, 0x14, 0x53, 0x4a, 0x29,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0xa5, 0x14, 0x42, 0x08, 0x21, 0xa5, 0x00, 0x00, 0x08,
+    0x21, 0xa5, 0x00, 0x00, 0x08, 0x21, 0xc5, 0x00, 0x00, 0x0c, 0x21, 0xc5, 0x14, 0x53, 0x0c, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x06, 0x00, 0x40, 0x08, 0x21, 0x06, 0x00, 0x00, 0x00, 0x21, 0x06, 0x00, 0x00, 0x00, 0x21, 0x05, 0x00,
+    0x00, 0x00, 0x21, 0x05, 0x00, 0x70, 0x0c, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xd0, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x22, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x60, 0x4a, 0x21, 0x00, 0x00, 0x60, 0x4a, 0x21, 0x00, 0x00, 0x60, 0x4a, 0x21, 0x00, 0x00, 0x50, 0x4a, 0x21, 0x00, 0x00, 0x50, 0x4a, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08,
+    0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00,
+    0x50, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04,
+    0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x06, 0x00, 0x00, 0x08, 0x21, 0x06, 0x00, 0x00, 0x08,
+    0x21, 0x06, 0x00, 0x00, 0x00, 0x21, 0x05, 0x00, 0x00, 0x00, 0x21, 0x05, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x4a, 0x21, 0x00, 0x00, 0x00, 0x4a, 0x21, 0x00, 0x00, 0x00, 0x4a, 0x21, 0x00, 0x00,
+    0x50, 0x4a, 0x21, 0x00, 0x00, 0x50, 0x4a, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x50, 0x08, 0x21, 0x00, 0x80, 0x52, 0x08, 0x21,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a,
+    0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x50, 0x4a, 0x29, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x08, 0x21, 0x05, 0x00,
+    0x00, 0x08, 0x21, 0xa5, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x0a, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x05, 0x00, 0x00, 0x00, 0x21, 0x05, 0x00, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x40, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00,
+    0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42,
+    0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40,
+    0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02,
+    0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42,
+    0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x09, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00,
+    0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x09, 0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x09,
+    0x00, 0x00, 0x40, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x00, 0x00, 0x00,
+    0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+    0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x06,
+    0x00, 0x70, 0xce, 0x39, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3a,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0xe7, 0x00, 0x00, 0xce, 0x31, 0x08, 0x01, 0x00, 0x10,
+    0x3a, 0x08, 0x00, 0x00, 0x00, 0x3a, 0x08, 0x00, 0x00, 0x00, 0x3a, 0x08, 0x00, 0x00, 0x00, 0x3a, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0xe7, 0x1c, 0x00, 0x80, 0x31, 0x08, 0x01, 0x00, 0x00, 0x38, 0x08, 0x00, 0x00, 0x00, 0x38, 0x08, 0x00,
+    0x00, 0x00, 0x38, 0x08, 0x00, 0x00, 0x00, 0x38, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0xe7,
+    0x00, 0x00, 0x00, 0x20, 0x08, 0x01, 0x00, 0x00, 0x38, 0x08, 0x00, 0x00, 0x00, 0x38, 0x08, 0x00, 0x00, 0x00, 0x38, 0x08, 0x00, 0x00, 0x00, 0x38,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x8c,
+    0x31, 0x00, 0x00, 0x00, 0x8e, 0x31, 0x07, 0x00, 0x00, 0x8e, 0x31, 0x07, 0x00, 0x00, 0x8e, 0x31, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x60, 0x8c, 0x31, 0x05, 0x00, 0x60, 0x8c, 0x31, 0x06, 0x00, 0x00, 0x8e, 0x31, 0x06, 0x00,
+    0x00, 0x8e, 0x31, 0x06, 0x00, 0x00, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0xc6, 0x18, 0x00, 0x00, 0x21, 0xc6, 0x18, 0x00, 0x40,
+    0x29, 0xe6, 0x00, 0x00, 0x80, 0x31, 0xe6, 0x00, 0x00, 0x80, 0x31, 0xe6, 0x00, 0x00, 0x80, 0x31, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0xc6, 0x00, 0x00, 0x00, 0x20, 0xc6, 0x00, 0x00, 0x00, 0x20, 0xe6, 0x00, 0x00, 0x00, 0x38, 0xe6, 0x00,
+    0x00, 0xc0, 0x39, 0xe6, 0x00, 0x00, 0xc0, 0x39, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x00, 0x40,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00,
+    0x00, 0xc0, 0x31, 0x08, 0x00, 0x00, 0x80, 0x31, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0xe6, 0x00, 0x00, 0x4a, 0x29,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x90, 0x52, 0x4a, 0x29, 0x04, 0x00, 0x50, 0x4a,
+    0x29, 0x04, 0x00, 0x50, 0x4a, 0x29, 0x06, 0x00, 0x60, 0x4a, 0x29, 0xa6, 0x98, 0x62, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0xa5, 0x18, 0x63, 0x4a, 0x29, 0xa5, 0x98, 0x62, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00,
+    0x00, 0x4a, 0x29, 0xa5, 0x98, 0x62, 0x4a, 0x29, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0xa5,
+    0x94, 0x42, 0x08, 0x21, 0xa5, 0x14, 0x00, 0x00, 0x21, 0xa5, 0x14, 0x00, 0x00, 0x21, 0xa5, 0x18, 0x00, 0x80, 0x21, 0xa5, 0x98, 0x62, 0x8a, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0xc5, 0x00, 0x00, 0x08, 0x21, 0xc5, 0x00, 0x00, 0x00,
+    0x20, 0xc5, 0x00, 0x00, 0x00, 0x20, 0xa5, 0x00, 0x00, 0x00, 0x20, 0xa5, 0x00, 0x00, 0x8e, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x07, 0x00, 0x00, 0x00, 0x21, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3a, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0,
+    0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x00, 0x4c, 0x29, 0x04, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x00, 0x00,
+    0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x04, 0x00, 0x00, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a,
+    0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0xc5,
+    0x00, 0x00, 0x00, 0x21, 0xc5, 0x00, 0x00, 0x00, 0x21, 0xc5, 0x00, 0x00, 0x00, 0x20, 0xa5, 0x00, 0x00, 0x00, 0x20, 0xa5, 0x00, 0x00, 0x00, 0x20,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x07, 0x00, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x00,
+    0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x00, 0x00, 0x00, 0x80, 0x31,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x05, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x40,
+    0x29, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00,
+    0x00, 0x0a, 0x21, 0x04, 0x00, 0x50, 0x0a, 0x21, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x05,
+    0x00, 0x00, 0x40, 0x29, 0x05, 0x00, 0x00, 0x40, 0x29, 0x05, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29, 0xa5, 0x00, 0x00, 0x4a, 0x29,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x00,
+    0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0xa4, 0x00, 0x00, 0x00, 0x21, 0xa4, 0x14, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x05, 0x00, 0x00, 0x40, 0x21, 0x05, 0x00, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00, 0x00, 0x20, 0xa5, 0x00,
+    0x00, 0x00, 0x20, 0xa5, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x07,
+    0x00, 0x00, 0x00, 0x28, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31,
+    0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00,
+    0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31,
+    0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30,
+    0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63,
+    0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x01,
+    0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00,
+    0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63,
+    0x0c, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63,
+    0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03,
+    0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6,
+    0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0x06,
+    0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00,
+    0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08,
+    0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x40, 0x08, 0x21, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80,
+    0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0x06, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01,
+    0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31,
+    0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x64, 0x90, 0x31, 0xc6, 0x18, 0x00, 0x90, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31,
+    0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03,
+    0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x0c, 0x00,
+    0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63,
+    0x8c, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x00, 0x00, 0x60, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x60, 0xc6,
+    0x18, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x00, 0x00,
+    0x60, 0xc6, 0x18, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63,
+    0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x70, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x80, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x94, 0x52, 0xc6, 0x18, 0x00, 0x80, 0x52, 0xc6, 0x18, 0x00, 0x80,
+    0x52, 0xc6, 0x18, 0x00, 0x80, 0x52, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00,
+    0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x52, 0xc6, 0x18, 0x00, 0x80, 0x52, 0xc6, 0x18, 0x00, 0x80, 0x52, 0xc6, 0x18, 0x00, 0x80, 0x52, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x04, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x00, 0x00, 0x63, 0xc6, 0x18, 0x00, 0x00, 0x63, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x73, 0xc6, 0x18, 0x00, 0x80, 0x73, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x0c, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x70, 0xc6, 0x18, 0x00, 0x00, 0x70, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x10, 0x42, 0xc6,
+    0x18, 0x00, 0x10, 0x42, 0xc6, 0x18, 0x00, 0x10, 0x42, 0xc6, 0x18, 0x04, 0x10, 0x42, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x04, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x04, 0x10, 0x30, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x80, 0x32, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x60, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08,
+    0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80,
+    0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6,
+    0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00,
+    0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31,
+    0x06, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30,
+    0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01,
+    0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31,
+    0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00,
+    0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63,
+    0x0c, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63,
+    0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xcc,
+    0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x00, 0x00,
+    0x00, 0xcc, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03,
+    0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xcc,
+    0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xce, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63,
+    0x8c, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xd0, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x50, 0xca, 0x18, 0x00, 0x00, 0x50, 0xca, 0x18, 0x07, 0x00, 0x50, 0xca, 0x18, 0x07, 0x00, 0x50, 0xca, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x52, 0xca,
+    0x18, 0x00, 0x00, 0x50, 0xca, 0x18, 0x06, 0x00, 0x50, 0xca, 0x18, 0x06, 0x00, 0x50, 0xca, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x05, 0x00, 0x50, 0xca, 0x18, 0x05, 0x00, 0x50, 0xca, 0x18, 0x05, 0x00,
+    0x50, 0xca, 0x18, 0x05, 0x00, 0x50, 0xca, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x00, 0x00, 0xc6, 0x18, 0xa5, 0x00, 0x00, 0xc6, 0x18, 0x05, 0x00, 0x00, 0xcc, 0x18, 0x05, 0x00, 0x60, 0xcc, 0x18, 0x05, 0x00, 0x60, 0xcc, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x05, 0x00, 0x00, 0xc0,
+    0x18, 0x05, 0x00, 0x00, 0xc0, 0x18, 0x05, 0x00, 0x60, 0xce, 0x18, 0x05, 0x00, 0x70, 0xce, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0xce, 0x18, 0x00, 0x00, 0x00, 0xce, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x40, 0xc8, 0x18, 0x00, 0x00, 0x40, 0xc8, 0x18, 0x00, 0x00,
+    0x40, 0xc8, 0x18, 0x06, 0x00, 0x40, 0xc8, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x42, 0xc8, 0x18, 0x00, 0x00, 0x42, 0xc8, 0x18, 0x00, 0x00, 0x42, 0xc8, 0x18, 0xa0, 0x00, 0x42, 0xc8, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x84, 0x00, 0x00, 0xc6, 0x18, 0x84, 0x00, 0x00, 0xc6, 0x18, 0x84, 0x00,
+    0x00, 0xc6, 0x18, 0x84, 0x00, 0x02, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x04, 0x00, 0x00, 0xc0, 0x18, 0x04, 0x00, 0x00, 0xc0, 0x18, 0x04, 0x00, 0x00, 0xc0, 0x18, 0x04, 0x00, 0x50, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x40, 0xc8,
+    0x18, 0x00, 0x00, 0x40, 0xc8, 0x18, 0x00, 0x00, 0x40, 0xc8, 0x18, 0x00, 0x00, 0x40, 0xc8, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80,
+    0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6,
+    0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x04, 0x00, 0x30, 0xc6, 0x18, 0x04, 0x00, 0x00, 0xc0, 0x18, 0x04, 0x00,
+    0x00, 0xc0, 0x18, 0x04, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x40, 0xc8, 0x18, 0x00, 0x00, 0x40, 0xc8, 0x18, 0x00, 0x00, 0x40, 0xc8, 0x18, 0x00, 0x00, 0x40, 0xc8, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6,
+    0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x04, 0x00,
+    0x40, 0x08, 0x21, 0x04, 0x00, 0x40, 0x08, 0x21, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x04, 0x00, 0x00, 0xc6,
+    0x18, 0x04, 0x00, 0x00, 0xc6, 0x18, 0x04, 0x00, 0x00, 0xc0, 0x18, 0x04, 0x00, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31,
+    0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31,
+    0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00,
+    0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31,
+    0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30,
+    0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63,
+    0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x01,
+    0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63,
+    0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00,
+    0x00, 0x80, 0x19, 0x08, 0x00, 0x00, 0x80, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00,
+    0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0x00, 0x80, 0x19, 0x07, 0x00, 0x00, 0x80, 0x19,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x06, 0x00, 0x00, 0x80,
+    0x19, 0x06, 0x00, 0x00, 0x80, 0x19, 0x06, 0x00, 0x00, 0x80, 0x19, 0x06, 0x00, 0x00, 0x80, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x06, 0x00, 0x00, 0x80, 0x19, 0x06, 0x00, 0x00, 0x80, 0x19, 0x06, 0x00,
+    0x00, 0x80, 0x19, 0x06, 0x00, 0x00, 0x80, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63,
+    0x0c, 0x00, 0xc0, 0x18, 0x06, 0x00, 0x00, 0x80, 0x19, 0x06, 0x00, 0x00, 0x80, 0x19, 0x06, 0x00, 0x00, 0x80, 0x19, 0x06, 0x00, 0x00, 0x80, 0x19,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x8c, 0x01, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00,
+    0x18, 0x06, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0xc0, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00,
+    0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x1a, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x63,
+    0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x40,
+    0x19, 0x00, 0x00, 0x00, 0x40, 0x19, 0x07, 0x00, 0x00, 0x40, 0x19, 0x07, 0x00, 0x00, 0x40, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x4a, 0x19, 0x00, 0x00, 0x00, 0x4a, 0x19, 0xc7, 0x00,
+    0x00, 0x4a, 0x19, 0xe7, 0x00, 0x00, 0x4a, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03,
+    0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x50, 0x4a, 0x19, 0x06, 0x00, 0x00, 0x4a, 0x19, 0xc6, 0x00, 0x00, 0x4a, 0x19, 0xc6, 0x00, 0x00, 0x4a, 0x19,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0xa5, 0x00, 0x00, 0x4a,
+    0x19, 0xa5, 0x00, 0x00, 0x4a, 0x19, 0xa5, 0x00, 0x00, 0x4a, 0x19, 0xa5, 0x00, 0x00, 0x4a, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0xa5, 0x14, 0x00, 0xc0, 0x18, 0xa5, 0x00, 0x00, 0x80, 0x19, 0xa5, 0x00,
+    0x00, 0x8c, 0x19, 0xa5, 0x00, 0x00, 0x8c, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x01, 0x00, 0x18, 0xa5, 0x00, 0x00, 0x00, 0x18, 0xa5, 0x00, 0x00, 0x00, 0x18, 0xa5, 0x00, 0x00, 0xcc, 0x19, 0xa5, 0x00, 0x00, 0xce, 0x19,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xc0, 0x19, 0x05, 0x00, 0x00, 0xc0, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x40, 0x19, 0x00, 0x00, 0x00, 0x40, 0x19, 0x00, 0x00, 0x00, 0x40, 0x19, 0x06, 0x00, 0x00, 0x40, 0x19,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x08,
+    0x19, 0x00, 0x00, 0x00, 0x08, 0x19, 0x00, 0x00, 0x00, 0x08, 0x19, 0xa3, 0x00, 0x00, 0x08, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x40, 0x08, 0x19, 0x03, 0x00, 0x40, 0x08, 0x19, 0x03, 0x00,
+    0x40, 0x08, 0x19, 0x03, 0x10, 0x40, 0x08, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x84, 0x10, 0x00, 0xc0,
+    0x18, 0x84, 0x10, 0x00, 0xc0, 0x18, 0x84, 0x10, 0x00, 0xc0, 0x18, 0x84, 0x10, 0x40, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x84, 0x00, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x00, 0x18, 0x84, 0x00,
+    0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0xca, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x80, 0x19,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x00, 0x40, 0x19, 0x00, 0x00, 0x00, 0x40, 0x19, 0x00, 0x00,
+    0x00, 0x40, 0x19, 0x00, 0x00, 0x00, 0x40, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0x08, 0x19, 0x00, 0x00, 0x00, 0x08, 0x19, 0x00, 0x00, 0x00, 0x08, 0x19, 0x00, 0x00, 0x00, 0x08, 0x19,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6,
+    0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00,
+    0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x84, 0x00, 0x00, 0xc6,
+    0x18, 0x84, 0x00, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x00, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x05, 0x00, 0x00, 0xc0, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x40,
+    0x19, 0x00, 0x00, 0x00, 0x40, 0x19, 0x00, 0x00, 0x00, 0x40, 0x19, 0x00, 0x00, 0x00, 0x40, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x00, 0x08, 0x19, 0x03, 0x00, 0x00, 0x08, 0x19, 0x00, 0x00,
+    0x00, 0x08, 0x19, 0x00, 0x00, 0x00, 0x08, 0x19, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x03, 0x00, 0x00, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08,
+    0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x84, 0x00, 0x00, 0x08, 0x21, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00,
+    0x00, 0xc0, 0x18, 0x63, 0x0c, 0x00, 0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x84, 0x00, 0x00, 0xc0, 0x18, 0x84, 0x00, 0x00, 0xc0, 0x18, 0x84, 0x00, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x00, 0x18,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x05, 0x00, 0x00, 0x00,
+    0x18, 0x05, 0x00, 0x00, 0x00, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01,
+    0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21,
+    0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02,
+    0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00,
+    0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42,
+    0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00,
+    0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42,
+    0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42,
+    0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04,
+    0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00,
+    0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00,
+    0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00,
+    0x00, 0x80, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x00,
+    0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00,
+    0x01, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x00, 0x00,
+    0x30, 0xc6, 0x18, 0x00, 0x00, 0x30, 0xc6, 0x18, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00,
+    0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00,
+    0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21,
+    0x04, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20,
+    0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01,
+    0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x62, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00,
+    0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42,
+    0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42,
+    0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02,
+    0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42,
+    0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00,
+    0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80,
+    0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04,
+    0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x8c, 0x21, 0x84, 0x10, 0x00, 0x80,
+    0x21, 0x84, 0x10, 0x60, 0x80, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x04, 0x10, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84,
+    0x10, 0x03, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x60, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00,
+    0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00,
+    0x20, 0x04, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10,
+    0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6,
+    0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x00, 0x80, 0x31, 0xc6, 0x18, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00,
+    0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21,
+    0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00,
+    0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21,
+    0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20,
+    0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42,
+    0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01,
+    0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42,
+    0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00,
+    0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42,
+    0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42,
+    0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02,
+    0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x30, 0x84, 0x10, 0x00, 0x00, 0x30, 0x84, 0x10, 0x00, 0x00, 0x30, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84,
+    0x10, 0x00, 0x80, 0x31, 0x84, 0x10, 0x00, 0x00, 0x30, 0x84, 0x10, 0x00, 0x0c, 0x30, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00,
+    0x20, 0x84, 0x10, 0x82, 0x00, 0x22, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x63, 0x00, 0x00, 0x84, 0x10, 0x03, 0x00, 0x00, 0x84, 0x10, 0x03, 0x0c, 0x20, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80,
+    0x10, 0x03, 0x00, 0x00, 0x80, 0x10, 0x03, 0x00, 0x00, 0x80, 0x10, 0x03, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x30, 0x84, 0x10, 0x00, 0x00,
+    0x30, 0x84, 0x10, 0x00, 0x00, 0x30, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00,
+    0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x03, 0x00, 0x00, 0x80, 0x10, 0x03, 0x00, 0x00, 0x80, 0x10, 0x03, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x02, 0x00, 0x30, 0x84, 0x10, 0x00, 0x00, 0x30, 0x84, 0x10, 0x00, 0x00, 0x30, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00,
+    0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63,
+    0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18, 0x03, 0x00, 0x30, 0xc6, 0x18,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x03, 0x00, 0x20, 0x84, 0x10, 0x03, 0x00,
+    0x00, 0x80, 0x10, 0x03, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01,
+    0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00,
+    0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21,
+    0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21,
+    0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02,
+    0x00, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00,
+    0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42,
+    0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00,
+    0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84,
+    0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42,
+    0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80,
+    0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42,
+    0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04,
+    0x00, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00,
+    0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84,
+    0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00,
+    0x10, 0x02, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00, 0x00, 0x42, 0x08, 0x21, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x04, 0x00, 0x42, 0x08, 0x21, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x86, 0x10, 0x00, 0x00,
+    0x00, 0x86, 0x10, 0x42, 0x00, 0x00, 0x86, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x30, 0x86, 0x10, 0x02, 0x00, 0x00, 0x86, 0x10, 0x42, 0x80, 0x01, 0x86, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84,
+    0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x00, 0x00, 0x84, 0x10, 0x42, 0x10, 0x40, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x62, 0x0c, 0x00, 0x80, 0x10, 0x62, 0x00,
+    0x00, 0x80, 0x10, 0x62, 0x80, 0x01, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01, 0x00, 0x10, 0x62, 0x00, 0x00, 0x00, 0x10, 0x62, 0x00, 0x00, 0x00, 0x10, 0x62, 0x00, 0x00, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x86, 0x10, 0x00, 0x00, 0x00, 0x86, 0x10, 0x00, 0x00, 0x00, 0x86, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00,
+    0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x62, 0x00, 0x00, 0x00, 0x10, 0x62, 0x00,
+    0x00, 0x00, 0x10, 0x62, 0x00, 0x00, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00,
+    0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x00, 0x86, 0x10, 0x00, 0x00, 0x00, 0x86, 0x10, 0x00, 0x00, 0x00, 0x86, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x02, 0x00, 0x20, 0x84, 0x10, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31,
+    0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x00,
+    0x00, 0xc6, 0x18, 0x63, 0x00, 0x00, 0xc6, 0x18, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10, 0x42, 0x08, 0x00, 0x80, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x10, 0x62, 0x00, 0x00, 0x84, 0x10, 0x62, 0x00, 0x00, 0x00, 0x10, 0x62, 0x00, 0x00, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+};
+
+static const unsigned char krk_data[25602] = {  // KRK, 40960 entries of 5 bits
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xc8, 0x18, 0x5b, 0x00, 0x40, 0x08,
+    0x9d, 0x6b, 0x08, 0x42, 0x08, 0x21, 0x7c, 0xe9, 0x41, 0x08, 0x21, 0x7c, 0xe8, 0x41, 0x08, 0x21, 0x7c, 0xc9, 0x41, 0x08, 0x21, 0x74, 0xc8, 0x41,
+    0x08, 0xe1, 0x73, 0xa9, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0x00, 0xf0, 0x18, 0x5b, 0x00, 0x00, 0x00, 0x9f, 0x6b, 0x4c, 0x41, 0x08, 0x21, 0x7c, 0x8c,
+    0x41, 0x08, 0x21, 0x7c, 0x4b, 0x41, 0x08, 0x21, 0x7c, 0x6b, 0x41, 0x08, 0x21, 0x74, 0x4a, 0x41, 0x08, 0xe1, 0x73, 0x4a, 0x3d, 0x08, 0xe1, 0x73,
+    0x00, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0x00, 0xa0, 0x6b, 0xcd, 0x39, 0x08, 0x21, 0x7c, 0xcd, 0x39, 0x08, 0x21, 0x7c, 0xad, 0x35, 0x08, 0x21,
+    0x7c, 0xac, 0x35, 0x08, 0x21, 0x74, 0x8c, 0x31, 0x08, 0xe1, 0x73, 0x8b, 0x31, 0x08, 0xe1, 0x73, 0x00, 0x40, 0x00, 0xc0, 0x6b, 0x00, 0x40, 0x00,
+    0xc0, 0x7b, 0xed, 0x41, 0x08, 0xdf, 0x7b, 0xed, 0xbd, 0xf7, 0xde, 0x7b, 0xed, 0xbd, 0xf7, 0xde, 0x7b, 0xcc, 0xbd, 0xf7, 0xdc, 0x73, 0xcc, 0x39,
+    0xf7, 0xde, 0x73, 0xab, 0x39, 0xf7, 0xdc, 0x73, 0x00, 0xb4, 0x07, 0x00, 0x70, 0x00, 0x3c, 0x08, 0x00, 0x70, 0xed, 0x41, 0x08, 0xa1, 0x73, 0xed,
+    0x41, 0x08, 0xa1, 0x73, 0xed, 0x41, 0x08, 0x61, 0x6b, 0xcc, 0x41, 0x08, 0x61, 0x6b, 0xcc, 0x41, 0x08, 0x61, 0x6b, 0xab, 0x3d, 0x08, 0x61, 0x6b,
+    0x00, 0xb0, 0xf6, 0x00, 0x00, 0x00, 0xbc, 0x07, 0x01, 0x00, 0xed, 0x41, 0x08, 0x21, 0x64, 0xed, 0x41, 0x08, 0x21, 0x5c, 0xed, 0x41, 0x08, 0x21,
+    0x64, 0xcc, 0x41, 0x08, 0x21, 0x5c, 0xcc, 0x41, 0x08, 0x21, 0x5c, 0xab, 0xbd, 0x07, 0x21, 0x54, 0x00, 0x30, 0xc6, 0x1c, 0x00, 0x00, 0xbc, 0xe7,
+    0x1e, 0x00, 0xed, 0x41, 0x08, 0x21, 0x7c, 0xed, 0x41, 0x08, 0x21, 0x7c, 0xed, 0x41, 0x08, 0x21, 0x7c, 0xcc, 0x41, 0x08, 0x21, 0x74, 0xcc, 0x41,
+    0x08, 0xe1, 0x73, 0xab, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0xa0, 0x84, 0x12, 0x4a, 0x00, 0xc0, 0xf7, 0x9c, 0x6b, 0x10, 0x42, 0x08, 0x21, 0x7c, 0x10,
+    0x42, 0x08, 0x21, 0x7c, 0x0c, 0x42, 0x08, 0x21, 0x7c, 0xcc, 0x41, 0x08, 0x21, 0x7c, 0xcc, 0x41, 0x08, 0xe1, 0x7b, 0xab, 0xbd, 0xf7, 0x9c, 0x73,
+    0x00, 0xa0, 0x84, 0x12, 0x4a, 0x00, 0xc4, 0x08, 0x9d, 0x6b, 0x28, 0xc6, 0x18, 0x23, 0x7c, 0x29, 0xc6, 0x18, 0x23, 0x7c, 0x08, 0xc6, 0x18, 0x23,
+    0x7c, 0xc9, 0xc5, 0x18, 0x23, 0x7c, 0xc8, 0x41, 0x08, 0x21, 0x7c, 0xa9, 0xbd, 0xf7, 0xde, 0x7b, 0x00, 0x00, 0x80, 0x10, 0x42, 0x00, 0x00, 0x10,
+    0x9f, 0x6b, 0x0b, 0x00, 0x10, 0x23, 0x7c, 0x6b, 0xc5, 0x18, 0x23, 0x7c, 0x4b, 0xc5, 0x18, 0x23, 0x7c, 0x6b, 0xc5, 0x18, 0x23, 0x7c, 0x4a, 0x41,
+    0x08, 0x21, 0x7c, 0x4a, 0x3d, 0x08, 0xe1, 0x7b, 0x00, 0x00, 0x00, 0x12, 0x42, 0x00, 0x00, 0x00, 0xa2, 0x6b, 0xee, 0x01, 0x00, 0x22, 0x7c, 0xee,
+    0xbd, 0x18, 0x23, 0x7c, 0xac, 0x31, 0x08, 0x21, 0x7c, 0xac, 0x35, 0x08, 0x21, 0x7c, 0x8c, 0x31, 0x08, 0x21, 0x7c, 0x8b, 0x31, 0x08, 0xe1, 0x7b,
+    0x00, 0x28, 0x00, 0x40, 0x4a, 0x00, 0x44, 0x00, 0x00, 0x7c, 0x10, 0x46, 0x00, 0x00, 0x7c, 0x10, 0xc6, 0x18, 0x21, 0x7c, 0x0c, 0x42, 0x08, 0xdf,
+    0x7b, 0xcc, 0xbd, 0xf7, 0xde, 0x7b, 0xcc, 0x39, 0xf7, 0xde, 0x7b, 0xab, 0x39, 0xf7, 0xde, 0x7b, 0x00, 0xa4, 0x04, 0x00, 0x48, 0x00, 0xbc, 0x08,
+    0x00, 0x70, 0x0f, 0xc6, 0x08, 0x00, 0x70, 0x0f, 0xc6, 0x18, 0xa3, 0x73, 0x0c, 0xc6, 0x18, 0xa3, 0x73, 0xcc, 0xc5, 0x18, 0xa3, 0x73, 0xcc, 0x41,
+    0x08, 0xa1, 0x73, 0xab, 0x3d, 0x08, 0x61, 0x6b, 0x00, 0xa4, 0x94, 0x00, 0x00, 0x00, 0xbc, 0x17, 0x01, 0x00, 0x0f, 0xc2, 0x18, 0x01, 0x00, 0x0f,
+    0xc6, 0x18, 0x63, 0x64, 0x0c, 0xc6, 0x18, 0x23, 0x64, 0xcc, 0xc5, 0x18, 0x23, 0x5c, 0xcc, 0x41, 0x08, 0x21, 0x64, 0xab, 0xbd, 0x07, 0x21, 0x5c,
+    0x00, 0xa4, 0x94, 0x12, 0x00, 0x00, 0xbc, 0xe7, 0x20, 0x00, 0x0e, 0xc2, 0x18, 0x23, 0x00, 0x0e, 0xc6, 0x18, 0x23, 0x84, 0x0c, 0xc6, 0x18, 0x23,
+    0x7c, 0xcc, 0xc5, 0x18, 0x23, 0x7c, 0xcc, 0x41, 0x08, 0x21, 0x7c, 0xab, 0xbd, 0xf7, 0xde, 0x7b, 0x00, 0x30, 0xb6, 0x96, 0x52, 0x00, 0x28, 0xa6,
+    0x96, 0x52, 0x00, 0x40, 0x08, 0x21, 0x7c, 0x00, 0x40, 0x08, 0x21, 0x84, 0x0f, 0x42, 0x08, 0x21, 0x84, 0xec, 0x41, 0x08, 0x21, 0x84, 0xcc, 0x41,
+    0x08, 0xe1, 0x7b, 0xab, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0xac, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xa5, 0x96, 0x52, 0x00, 0x80, 0x18, 0x23, 0x7c, 0x00,
+    0x80, 0x18, 0x23, 0x84, 0x28, 0xc6, 0x18, 0x23, 0x84, 0xe8, 0xc5, 0x18, 0x23, 0x84, 0xc8, 0x41, 0x08, 0x21, 0x7c, 0xa8, 0xbd, 0xf7, 0xde, 0x7b,
+    0x00, 0xac, 0xb5, 0x96, 0x52, 0x00, 0x00, 0xb0, 0x96, 0x52, 0x0b, 0x00, 0x10, 0x63, 0x7c, 0x0b, 0x00, 0x10, 0x63, 0x84, 0x6b, 0xc5, 0x18, 0x63,
+    0x84, 0x6b, 0xc5, 0x18, 0x63, 0x84, 0x4a, 0xc5, 0x18, 0x63, 0x7c, 0x4a, 0x3d, 0x08, 0xe1, 0x7b, 0x00, 0x2c, 0xb6, 0x96, 0x52, 0x00, 0x00, 0x00,
+    0x96, 0x52, 0xcd, 0x01, 0x00, 0x22, 0x84, 0xcd, 0x01, 0x00, 0x22, 0x84, 0xcd, 0xb9, 0x18, 0x23, 0x84, 0xac, 0x35, 0x08, 0x21, 0x84, 0x8c, 0x31,
+    0x08, 0x21, 0x7c, 0x8b, 0x31, 0x08, 0xe1, 0x7b, 0x00, 0x30, 0xc6, 0x18, 0x5b, 0x00, 0x30, 0x00, 0x00, 0x5b, 0x0f, 0x42, 0x00, 0x00, 0x84, 0x0f,
+    0x42, 0x00, 0x00, 0x84, 0x0f, 0x42, 0x08, 0x21, 0x84, 0xec, 0x41, 0x08, 0x21, 0x84, 0xcc, 0x39, 0xf7, 0xde, 0x7b, 0xab, 0x39, 0xf7, 0xde, 0x7b,
+    0x00, 0x30, 0xc6, 0xd8, 0x5a, 0x00, 0x30, 0x06, 0x00, 0x58, 0x2f, 0xc6, 0x08, 0x00, 0x78, 0x2f, 0xc6, 0x08, 0x00, 0x78, 0x2f, 0xc6, 0x18, 0xe3,
+    0x7b, 0xec, 0xc5, 0x18, 0xa3, 0x73, 0xcc, 0xc5, 0x18, 0xa3, 0x73, 0xab, 0x3d, 0x08, 0xa1, 0x73, 0x00, 0xac, 0xc5, 0x18, 0x5b, 0x00, 0xac, 0xc5,
+    0x00, 0x00, 0x2f, 0xc6, 0x18, 0x01, 0x00, 0x2f, 0xc6, 0x18, 0x01, 0x00, 0x2f, 0xc6, 0x18, 0x63, 0x64, 0xec, 0xc5, 0x18, 0x63, 0x64, 0xcc, 0xc5,
+    0x18, 0x63, 0x64, 0xab, 0xbd, 0x07, 0x21, 0x5c, 0x00, 0xac, 0xb5, 0xd6, 0x5a, 0x00, 0xac, 0xb5, 0x16, 0x00, 0x2f, 0xc6, 0x18, 0x23, 0x00, 0x2f,
+    0xc6, 0x18, 0x23, 0x00, 0x2f, 0xc6, 0x18, 0x63, 0x8c, 0xec, 0xc5, 0x18, 0x63, 0x84, 0xcc, 0x41, 0x08, 0x21, 0x7c, 0xab, 0xbd, 0xf7, 0xde, 0x7b,
+    0x00, 0xb4, 0xd6, 0x18, 0x5b, 0x00, 0x38, 0xd7, 0x1a, 0x63, 0x00, 0x38, 0xd7, 0x1a, 0x63, 0x00, 0x40, 0x08, 0x21, 0x84, 0x00, 0x40, 0x08, 0x21,
+    0x84, 0x0e, 0x42, 0x08, 0x21, 0x84, 0xcc, 0x41, 0x08, 0xe1, 0x7b, 0xab, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x38, 0xc7, 0x18, 0x5b, 0x00, 0xbc, 0xd7,
+    0x1a, 0x63, 0x00, 0x80, 0xc7, 0x1a, 0x63, 0x00, 0x80, 0x08, 0x21, 0x84, 0x00, 0x80, 0x08, 0x21, 0x84, 0x29, 0xc6, 0x08, 0x21, 0x84, 0xc8, 0x41,
+    0x08, 0x21, 0x7c, 0xa8, 0xbd, 0xf7, 0xde, 0x7b, 0x00, 0xb4, 0xd6, 0x18, 0x5b, 0x00, 0x38, 0xe7, 0x1a, 0x63, 0x0b, 0x00, 0xe0, 0x1a, 0x63, 0x0c,
+    0x00, 0x10, 0x21, 0x84, 0x0b, 0x00, 0x10, 0x21, 0x84, 0x6b, 0xc5, 0x18, 0x21, 0x84, 0x4a, 0x41, 0x08, 0x21, 0x7c, 0x4a, 0x41, 0x08, 0xe1, 0x7b,
+    0x00, 0x38, 0xc7, 0x18, 0x5b, 0x00, 0xbc, 0xd7, 0x1a, 0x63, 0xee, 0x01, 0x00, 0x1a, 0x63, 0xee, 0x01, 0x00, 0xe2, 0x7b, 0xac, 0x01, 0x00, 0xe2,
+    0x7b, 0xac, 0xb5, 0x18, 0xe3, 0x7b, 0x8c, 0xb1, 0xf7, 0xde, 0x7b, 0x8b, 0xb1, 0xf7, 0xde, 0x7b, 0x00, 0xb4, 0xd6, 0x5a, 0x6b, 0x00, 0xbc, 0xe7,
+    0x9c, 0x6b, 0xee, 0x39, 0x00, 0x80, 0x6b, 0x0e, 0x42, 0x00, 0x00, 0x7c, 0x0e, 0x42, 0x00, 0x00, 0x7c, 0x0e, 0x42, 0x08, 0x21, 0x7c, 0xcc, 0x41,
+    0x08, 0xdf, 0x7b, 0xab, 0x39, 0xe7, 0x9c, 0x73, 0x00, 0x34, 0xe7, 0x5c, 0x6b, 0x00, 0x38, 0xe7, 0x5c, 0x6b, 0xce, 0x39, 0x07, 0x00, 0x68, 0x0e,
+    0xc6, 0x08, 0x00, 0x70, 0x0e, 0xc6, 0x08, 0x00, 0x70, 0x0e, 0xc6, 0x18, 0xa3, 0x73, 0xcc, 0xc5, 0x18, 0xa3, 0x73, 0xab, 0x3d, 0x08, 0xa1, 0x73,
+    0x00, 0xb0, 0xd6, 0x5a, 0x63, 0x00, 0x38, 0xe7, 0x9c, 0x63, 0xce, 0x39, 0xe7, 0x00, 0x00, 0x0e, 0x42, 0x18, 0x01, 0x00, 0x0e, 0x42, 0x18, 0x01,
+    0x00, 0x0e, 0x42, 0x18, 0x63, 0x64, 0xcc, 0x41, 0x08, 0x21, 0x64, 0xab, 0xbd, 0x07, 0x21, 0x64, 0x00, 0x30, 0xc6, 0x5a, 0x6b, 0x00, 0xb8, 0xd6,
+    0x5a, 0x6b, 0xae, 0xb9, 0xd6, 0x1a, 0x00, 0x0e, 0x42, 0x08, 0x21, 0x00, 0x0e, 0x42, 0x08, 0x21, 0x00, 0x0e, 0x42, 0x08, 0x21, 0x84, 0xcc, 0x41,
+    0x08, 0x21, 0x7c, 0xab, 0xbd, 0xf7, 0xde, 0x7b, 0x00, 0xb4, 0xd6, 0x18, 0x5b, 0x00, 0xbc, 0xf7, 0x9c, 0x6b, 0x10, 0xc2, 0xf7, 0x9e, 0x73, 0x00,
+    0xc0, 0xf7, 0x9e, 0x73, 0x00, 0xc0, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0xdc, 0x73, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xed, 0xbd, 0xf7, 0x9c, 0x73,
+    0x00, 0x40, 0xc8, 0x18, 0x5b, 0x00, 0x40, 0x08, 0x9d, 0x6b, 0x2a, 0xc6, 0x08, 0x9f, 0x73, 0x00, 0x80, 0x08, 0x9f, 0x73, 0x00, 0x80, 0x08, 0xdf,
+    0x7b, 0x00, 0x00, 0xf8, 0xde, 0x7b, 0x09, 0x42, 0xf8, 0xde, 0x7b, 0xe9, 0xbd, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0x18, 0x5b, 0x00, 0x40, 0x08,
+    0x9f, 0x6b, 0x8c, 0x41, 0x08, 0xa1, 0x73, 0x0c, 0x00, 0x00, 0xa1, 0x73, 0x0c, 0x00, 0x00, 0xe1, 0x7b, 0x0c, 0x00, 0x00, 0xe1, 0x7b, 0x8c, 0x41,
+    0x08, 0xe1, 0x7b, 0x6b, 0x41, 0x08, 0xe1, 0x7b, 0x00, 0x38, 0xe7, 0x1c, 0x5b, 0x00, 0x3c, 0x08, 0xa1, 0x6b, 0xed, 0x39, 0x08, 0x21, 0x74, 0xed,
+    0x01, 0x00, 0x20, 0x74, 0xcd, 0x01, 0x00, 0x20, 0x74, 0xcd, 0x01, 0x00, 0xe0, 0x73, 0xcd, 0x39, 0x08, 0xe1, 0x73, 0xad, 0xb5, 0xf7, 0xde, 0x73,
+    0x00, 0x40, 0x08, 0x5b, 0x6b, 0x00, 0x40, 0x08, 0xdf, 0x7b, 0x10, 0x42, 0x08, 0x21, 0x7c, 0x10, 0x42, 0x00, 0x00, 0x7c, 0x10, 0x42, 0x00, 0x00,
+    0x84, 0xed, 0x41, 0x00, 0x00, 0x84, 0xed, 0x41, 0x08, 0x21, 0x84, 0xed, 0xbd, 0x07, 0x21, 0x7c, 0x00, 0xb4, 0xf7, 0x9e, 0x73, 0x00, 0x3c, 0x08,
+    0xa1, 0x73, 0x10, 0x42, 0x08, 0xe1, 0x7b, 0x10, 0x42, 0x08, 0x00, 0x78, 0x10, 0x42, 0x08, 0x00, 0x78, 0x0f, 0x42, 0x08, 0x00, 0x70, 0x0f, 0x42,
+    0x08, 0xa1, 0x73, 0xed, 0x3d, 0x08, 0xa1, 0x73, 0x00, 0xb0, 0xf6, 0xde, 0x63, 0x00, 0xbc, 0xf7, 0xde, 0x63, 0x10, 0x42, 0x08, 0x21, 0x64, 0x10,
+    0x42, 0x08, 0x01, 0x00, 0x10, 0x42, 0x08, 0x01, 0x00, 0xef, 0x3d, 0x08, 0x01, 0x00, 0xef, 0x3d, 0x08, 0x21, 0x64, 0xed, 0xbd, 0x07, 0x21, 0x64,
+    0x00, 0x30, 0xc6, 0x9c, 0x73, 0x00, 0xbc, 0xe7, 0xde, 0x7b, 0x10, 0x42, 0x08, 0xdf, 0x7b, 0xf0, 0xc1, 0x07, 0x1f, 0x00, 0x10, 0x42, 0x08, 0x21,
+    0x00, 0xcf, 0xbd, 0xf7, 0x20, 0x00, 0xef, 0xbd, 0xf7, 0x20, 0x84, 0xcd, 0xbd, 0xf7, 0xde, 0x7b, 0x00, 0xb4, 0xd6, 0x18, 0x5b, 0x00, 0xbc, 0xf7,
+    0x9c, 0x6b, 0xed, 0x41, 0x08, 0x21, 0x7c, 0x0f, 0x42, 0x08, 0x21, 0x84, 0x00, 0x40, 0x08, 0x21, 0x84, 0x00, 0x40, 0x08, 0x21, 0x84, 0x00, 0x38,
+    0xd7, 0x5a, 0x6b, 0xce, 0x39, 0xd7, 0x5a, 0x6b, 0x00, 0xbc, 0xc7, 0x18, 0x5b, 0x00, 0x40, 0x08, 0x9d, 0x6b, 0xe9, 0xc5, 0x18, 0x23, 0x7c, 0x29,
+    0xc6, 0x18, 0x23, 0x84, 0x00, 0x80, 0x18, 0x23, 0x84, 0x00, 0x80, 0x18, 0x23, 0x84, 0x00, 0x00, 0xe7, 0x9c, 0x6b, 0xc9, 0x39, 0xe7, 0x9c, 0x6b,
+    0x00, 0xbc, 0xf7, 0x18, 0x5b, 0x00, 0xc4, 0x18, 0x9f, 0x6b, 0x8c, 0xc5, 0x18, 0x63, 0x7c, 0x8c, 0xc5, 0x18, 0x63, 0x84, 0x0c, 0x00, 0x10, 0x63,
+    0x84, 0x0c, 0x00, 0x10, 0x63, 0x84, 0x0b, 0x00, 0xf0, 0x9c, 0x73, 0x6b, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x38, 0xe7, 0x1c, 0x5b, 0x00, 0x38, 0x08,
+    0xa1, 0x6b, 0xcd, 0xb9, 0x18, 0x63, 0x7c, 0xce, 0xb9, 0x18, 0x63, 0x84, 0xce, 0x01, 0x00, 0x62, 0x84, 0xce, 0x01, 0x00, 0x62, 0x84, 0xad, 0x01,
+    0x00, 0x9c, 0x73, 0xad, 0x35, 0xe7, 0x9c, 0x73, 0x00, 0x40, 0x08, 0xdf, 0x6b, 0x00, 0x40, 0x08, 0x21, 0x7c, 0xed, 0x41, 0x08, 0x21, 0x7c, 0x0f,
+    0x42, 0x08, 0x21, 0x84, 0x0f, 0x42, 0x00, 0x00, 0x84, 0x0f, 0x42, 0x00, 0x00, 0x84, 0xce, 0x3d, 0x00, 0x80, 0x73, 0xce, 0xbd, 0xf7, 0x9c, 0x73,
+    0x00, 0xb4, 0xf7, 0x9e, 0x73, 0x00, 0xbc, 0x18, 0xa3, 0x73, 0xed, 0xc5, 0x18, 0xa3, 0x73, 0x2f, 0xc6, 0x18, 0xa3, 0x73, 0x2f, 0xc6, 0x08, 0x00,
+    0x70, 0x2f, 0xc6, 0x08, 0x00, 0x70, 0xce, 0x39, 0x07, 0x00, 0x70, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0x00, 0xb0, 0xf6, 0xde, 0x5b, 0x00, 0xbc, 0x17,
+    0x63, 0x64, 0xed, 0xc5, 0x18, 0x63, 0x64, 0x2f, 0xc6, 0x18, 0x63, 0x64, 0x2f, 0xc6, 0x18, 0x01, 0x00, 0x2f, 0xc6, 0x18, 0x01, 0x00, 0xcd, 0x39,
+    0xe7, 0x00, 0x00, 0xcd, 0x39, 0xe7, 0x9c, 0x63, 0x00, 0x30, 0xc6, 0x9c, 0x73, 0x00, 0xbc, 0xe7, 0xde, 0x7b, 0xed, 0xc1, 0x18, 0x23, 0x7c, 0x2f,
+    0xc6, 0x18, 0x63, 0x8c, 0x2f, 0xc6, 0x18, 0x23, 0x00, 0x2f, 0xc6, 0x18, 0x23, 0x00, 0xad, 0x35, 0xe7, 0x1c, 0x00, 0xad, 0x35, 0xe7, 0x9c, 0x73,
+    0x00, 0xb4, 0xd6, 0x18, 0x5b, 0x00, 0xbc, 0xf7, 0x9c, 0x6b, 0xec, 0x41, 0x08, 0x21, 0x7c, 0xed, 0x41, 0x08, 0x21, 0x7c, 0x0f, 0x42, 0x08, 0x21,
+    0x84, 0x00, 0x40, 0x08, 0x21, 0x84, 0x00, 0x40, 0x08, 0x21, 0x84, 0x00, 0xb0, 0xc5, 0xd6, 0x52, 0x00, 0xbc, 0xc7, 0x18, 0x5b, 0x00, 0x40, 0x08,
+    0x9d, 0x6b, 0xe9, 0xc1, 0x18, 0x23, 0x7c, 0xe9, 0xc5, 0x18, 0x23, 0x7c, 0x29, 0xc6, 0x18, 0x23, 0x84, 0x00, 0x80, 0x18, 0x23, 0x84, 0x00, 0x80,
+    0x08, 0x21, 0x84, 0x00, 0x00, 0xc6, 0x16, 0x5b, 0x00, 0xbc, 0xf7, 0x18, 0x5b, 0x00, 0xc4, 0x18, 0x9f, 0x6b, 0x6b, 0xc5, 0x18, 0x63, 0x7c, 0x6b,
+    0xc5, 0x18, 0x63, 0x7c, 0x8c, 0xc5, 0x18, 0x63, 0x84, 0x0c, 0x00, 0x10, 0x63, 0x84, 0x0c, 0x00, 0x10, 0x63, 0x84, 0x0b, 0x00, 0xc0, 0x18, 0x5b,
+    0x00, 0x38, 0xe7, 0x1c, 0x5b, 0x00, 0x38, 0x08, 0xa1, 0x6b, 0xcc, 0x39, 0x08, 0x21, 0x7c, 0xcd, 0x39, 0x08, 0x21, 0x7c, 0xcd, 0xb9, 0x18, 0x23,
+    0x84, 0xcd, 0x01, 0x00, 0x22, 0x84, 0xcd, 0x01, 0x00, 0x22, 0x84, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x00, 0x40, 0x08, 0xdf, 0x6b, 0x00, 0x40, 0x08,
+    0xdf, 0x7b, 0xec, 0x41, 0x08, 0xdf, 0x7b, 0xed, 0x41, 0x08, 0x21, 0x7c, 0xef, 0x41, 0x08, 0x21, 0x84, 0xef, 0x41, 0x00, 0x00, 0x84, 0xef, 0x41,
+    0x00, 0x00, 0x84, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x00, 0xb4, 0xf7, 0x5e, 0x6b, 0x00, 0xbc, 0x18, 0xa3, 0x73, 0xec, 0xc5, 0x18, 0xa3, 0x73, 0xed,
+    0xc5, 0x18, 0xa3, 0x73, 0x2f, 0xc6, 0x18, 0xa3, 0x73, 0x2f, 0xc6, 0x08, 0x00, 0x70, 0x2f, 0xc6, 0x08, 0x00, 0x70, 0x8b, 0x31, 0x06, 0x00, 0x60,
+    0x00, 0xb0, 0xf6, 0xde, 0x5b, 0x00, 0xbc, 0x07, 0x21, 0x64, 0xec, 0xc5, 0x18, 0x63, 0x5c, 0xed, 0xc5, 0x18, 0x63, 0x64, 0x0f, 0xc6, 0x18, 0x63,
+    0x64, 0x0f, 0xc6, 0x18, 0x01, 0x00, 0x0f, 0xc6, 0x18, 0x01, 0x00, 0x8b, 0x2d, 0xc6, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x9c, 0x73, 0x00, 0xbc, 0xe7,
+    0xde, 0x7b, 0xec, 0xc1, 0x18, 0x23, 0x7c, 0xed, 0xc5, 0x18, 0x63, 0x7c, 0x0f, 0xc6, 0x18, 0x63, 0x8c, 0x0f, 0xc6, 0x18, 0x23, 0x00, 0x0f, 0x42,
+    0x18, 0x23, 0x00, 0x6a, 0x2d, 0xb6, 0x18, 0x00, 0x00, 0xb4, 0xd6, 0x18, 0x5b, 0x00, 0xbc, 0xf7, 0x9c, 0x6b, 0xec, 0x41, 0x08, 0x21, 0x7c, 0xec,
+    0x41, 0x08, 0x21, 0x7c, 0xcc, 0x41, 0x08, 0x21, 0x7c, 0xee, 0x41, 0x08, 0x21, 0x7c, 0x00, 0x40, 0x08, 0xe1, 0x7b, 0x00, 0xbc, 0xf7, 0x9c, 0x73,
+    0x00, 0x38, 0xc7, 0x18, 0x5b, 0x00, 0x40, 0x08, 0x9d, 0x6b, 0xe9, 0xc1, 0x18, 0x23, 0x7c, 0xe9, 0xc5, 0x18, 0x23, 0x7c, 0xc9, 0xc5, 0x18, 0x23,
+    0x7c, 0x09, 0xc6, 0x18, 0x23, 0x7c, 0x00, 0x00, 0x08, 0x21, 0x7c, 0x00, 0x00, 0xf8, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0x18, 0x5b, 0x00, 0xc4, 0x18,
+    0x9f, 0x6b, 0x6b, 0xc5, 0x18, 0x23, 0x7c, 0x6b, 0xc5, 0x18, 0x23, 0x7c, 0x6b, 0xc5, 0x18, 0x23, 0x7c, 0x6b, 0xc5, 0x18, 0x23, 0x7c, 0x0b, 0x00,
+    0x10, 0x23, 0x7c, 0x0b, 0x00, 0x10, 0xe1, 0x7b, 0x00, 0x38, 0xe7, 0x1c, 0x5b, 0x00, 0x34, 0x08, 0xa1, 0x6b, 0xcc, 0x39, 0x08, 0x21, 0x7c, 0xac,
+    0x35, 0x08, 0x21, 0x7c, 0xac, 0x35, 0x08, 0x21, 0x7c, 0xad, 0x35, 0x08, 0x21, 0x7c, 0xad, 0x01, 0x00, 0x20, 0x7c, 0xad, 0x01, 0x00, 0xe0, 0x7b,
+    0x00, 0x40, 0x08, 0xdf, 0x6b, 0x00, 0xc0, 0x07, 0xdd, 0x73, 0xec, 0x41, 0x08, 0xdf, 0x7b, 0xec, 0xc1, 0x07, 0xdf, 0x7b, 0xcc, 0x41, 0x08, 0xdf,
+    0x7b, 0xee, 0xbd, 0x07, 0x21, 0x7c, 0xee, 0x3d, 0x00, 0x00, 0x7c, 0xee, 0x3d, 0x00, 0x00, 0x7c, 0x00, 0xb4, 0xf7, 0x5e, 0x6b, 0x00, 0xbc, 0x18,
+    0x63, 0x6b, 0xec, 0xc1, 0x18, 0x63, 0x6b, 0xec, 0xc5, 0x18, 0xa3, 0x73, 0xcc, 0xc5, 0x18, 0xa3, 0x73, 0xee, 0xc5, 0x18, 0xa3, 0x73, 0xee, 0xc1,
+    0x08, 0x00, 0x70, 0xee, 0xbd, 0x08, 0x00, 0x70, 0x00, 0xb0, 0xf6, 0xde, 0x53, 0x00, 0xbc, 0x07, 0x21, 0x5c, 0xec, 0xc1, 0x18, 0x23, 0x5c, 0xec,
+    0xc5, 0x18, 0x23, 0x64, 0xcc, 0xc5, 0x18, 0x63, 0x5c, 0xee, 0xc5, 0x18, 0x63, 0x64, 0xee, 0xc1, 0x18, 0x01, 0x00, 0xee, 0xbd, 0x17, 0x01, 0x00,
+    0x00, 0x30, 0xc6, 0x9c, 0x73, 0x00, 0xbc, 0xe7, 0x9c, 0x73, 0xec, 0xc1, 0x18, 0x23, 0x7c, 0xec, 0xc5, 0x18, 0x23, 0x7c, 0xcc, 0xc5, 0x18, 0x23,
+    0x7c, 0xce, 0xc5, 0x18, 0x23, 0x84, 0xce, 0x41, 0x08, 0x21, 0x00, 0xce, 0xbd, 0xf7, 0x20, 0x00, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7,
+    0x1a, 0x63, 0xef, 0xbd, 0xf7, 0xde, 0x73, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xee, 0xbd, 0xf7, 0xde, 0x7b, 0xee, 0xbd, 0xf7, 0xde, 0x7b, 0xee, 0xbd,
+    0xf7, 0xde, 0x7b, 0xed, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xf7, 0x96, 0x52, 0x00, 0x00, 0x08, 0x1f, 0x63, 0x8b, 0x41, 0x08, 0xe1, 0x6b, 0x8c, 0x41, 0x08, 0xe1, 0x73, 0x6b, 0x41, 0x08, 0xe1,
+    0x73, 0x6b, 0x3d, 0x08, 0xe1, 0x73, 0x4a, 0xbd, 0xf7, 0xde, 0x73, 0x4a, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0x00, 0x00, 0x9c, 0x52, 0x00, 0x00, 0x00,
+    0xa0, 0x63, 0xad, 0x35, 0x08, 0xe1, 0x6b, 0xad, 0x35, 0x08, 0xe1, 0x73, 0xad, 0x35, 0x08, 0xe1, 0x73, 0xac, 0x35, 0x08, 0xe1, 0x73, 0x8c, 0xb1,
+    0xf7, 0xde, 0x73, 0x8b, 0xb1, 0xf7, 0xde, 0x73, 0x00, 0x00, 0x00, 0x40, 0x5b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0xcd, 0xbd, 0xf7, 0x9c, 0x6b, 0xcd,
+    0xbd, 0xf7, 0x9c, 0x73, 0xcd, 0x3d, 0xf7, 0x9c, 0x73, 0xcc, 0xbd, 0xf7, 0x9c, 0x73, 0xcc, 0x39, 0xe7, 0x9c, 0x73, 0xab, 0x39, 0xe7, 0x9c, 0x73,
+    0x00, 0x00, 0x07, 0x00, 0x68, 0x00, 0x00, 0x08, 0x00, 0x68, 0xcd, 0x41, 0x08, 0x61, 0x6b, 0xcd, 0x41, 0x08, 0x21, 0x6b, 0xcd, 0x41, 0x08, 0x61,
+    0x6b, 0xcc, 0x3d, 0x08, 0x21, 0x6b, 0xcc, 0xbd, 0xf7, 0x5e, 0x6b, 0xab, 0xbd, 0xf7, 0x1e, 0x6b, 0x00, 0x80, 0xd5, 0x00, 0x00, 0x00, 0x80, 0xf7,
+    0x00, 0x00, 0xcd, 0x41, 0x08, 0xdf, 0x53, 0xcd, 0x41, 0x08, 0xe1, 0x5b, 0xcd, 0x41, 0x08, 0xe1, 0x53, 0xcc, 0x3d, 0x08, 0xe1, 0x53, 0xcc, 0xbd,
+    0xf7, 0xde, 0x4b, 0xab, 0xbd, 0xf7, 0xde, 0x53, 0x00, 0x80, 0xb5, 0x1a, 0x00, 0x00, 0x00, 0xe7, 0x1c, 0x00, 0xcd, 0x41, 0x08, 0xdf, 0x73, 0xcd,
+    0x41, 0x08, 0xe1, 0x73, 0xcd, 0x41, 0x08, 0xe1, 0x73, 0xcc, 0x3d, 0x08, 0xe1, 0x73, 0xcc, 0xbd, 0xf7, 0xde, 0x73, 0xab, 0xbd, 0xf7, 0xde, 0x73,
+    0x00, 0x80, 0x83, 0x0e, 0x3a, 0x00, 0x80, 0xf7, 0x1a, 0x63, 0xed, 0x3d, 0x08, 0xe1, 0x73, 0xed, 0x3d, 0x08, 0xe1, 0x73, 0xcd, 0x3d, 0x08, 0xe1,
+    0x73, 0xcc, 0x3d, 0x08, 0xe1, 0x73, 0xcc, 0xbd, 0xf7, 0xde, 0x73, 0xab, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x80, 0x83, 0x0e, 0x3a, 0x00, 0x00, 0xf8,
+    0x1a, 0x63, 0x08, 0x42, 0x08, 0x21, 0x74, 0x08, 0x42, 0x08, 0x21, 0x74, 0xc8, 0x41, 0x08, 0x21, 0x74, 0xc8, 0x3d, 0x08, 0xe1, 0x73, 0xc8, 0xbd,
+    0xf7, 0xde, 0x73, 0xa8, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0x80, 0x83, 0x0e, 0x3a, 0x00, 0x80, 0x18, 0x1f, 0x63, 0x4c, 0xc5, 0x18, 0x23, 0x74, 0x8c,
+    0xc5, 0x18, 0x23, 0x74, 0x4b, 0xc5, 0x18, 0x23, 0x74, 0x6b, 0x41, 0x08, 0xe1, 0x73, 0x4a, 0x41, 0x08, 0xe1, 0x73, 0x4a, 0xbd, 0xf7, 0xde, 0x73,
+    0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xa0, 0x63, 0xad, 0x01, 0x00, 0x20, 0x7c, 0xad, 0x35, 0x08, 0x21, 0x7c, 0xad, 0x35, 0x08, 0x21,
+    0x7c, 0xac, 0x35, 0x08, 0xe1, 0x73, 0x8c, 0xb1, 0xf7, 0xde, 0x73, 0x8b, 0xb1, 0xf7, 0xde, 0x73, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+    0xc0, 0x6b, 0xed, 0x41, 0x00, 0xc0, 0x73, 0xed, 0x41, 0x08, 0xdf, 0x73, 0xcd, 0x3d, 0xf7, 0x9c, 0x73, 0xcc, 0xbd, 0xf7, 0x9c, 0x73, 0xcc, 0x39,
+    0xe7, 0x9c, 0x73, 0xab, 0x39, 0xe7, 0x9c, 0x73, 0x00, 0x80, 0x04, 0x00, 0x40, 0x00, 0x80, 0x08, 0x00, 0x70, 0xcd, 0xc5, 0x08, 0x00, 0x70, 0xcd,
+    0xc5, 0x18, 0xa3, 0x73, 0xcd, 0xc5, 0x18, 0x63, 0x6b, 0xcc, 0x3d, 0x08, 0x61, 0x6b, 0xcc, 0xbd, 0xf7, 0x5e, 0x6b, 0xab, 0xbd, 0xf7, 0x1e, 0x6b,
+    0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x80, 0x07, 0x01, 0x00, 0xcd, 0x41, 0x08, 0x01, 0x00, 0xcd, 0x41, 0x08, 0x21, 0x5c, 0xcd, 0x41, 0x08, 0x21,
+    0x54, 0xcc, 0x3d, 0x08, 0xe1, 0x5b, 0xcc, 0xbd, 0xf7, 0xde, 0x53, 0xab, 0xbd, 0xf7, 0xde, 0x53, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0xe7,
+    0x1e, 0x00, 0xcd, 0x41, 0x08, 0x21, 0x00, 0xcd, 0x41, 0x08, 0x21, 0x7c, 0xcd, 0x41, 0x08, 0x21, 0x7c, 0xcc, 0x3d, 0x08, 0xe1, 0x73, 0xcc, 0xbd,
+    0xf7, 0xde, 0x73, 0xab, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0x00, 0xa5, 0x52, 0x4a, 0x00, 0x80, 0xa4, 0x52, 0x4a, 0x00, 0x40, 0x08, 0xe1, 0x73, 0x00,
+    0x40, 0x08, 0xe1, 0x7b, 0x0e, 0x42, 0x08, 0xe1, 0x7b, 0xcc, 0x41, 0x08, 0xe1, 0x7b, 0xcc, 0xbd, 0xf7, 0xde, 0x7b, 0xab, 0xbd, 0xf7, 0x9c, 0x73,
+    0x00, 0x00, 0xa5, 0x52, 0x4a, 0x00, 0x80, 0xa4, 0x52, 0x4a, 0x00, 0x00, 0x08, 0x21, 0x74, 0x00, 0x00, 0x08, 0x21, 0x7c, 0x08, 0x42, 0x08, 0x21,
+    0x7c, 0xc8, 0x41, 0x08, 0x21, 0x7c, 0xc8, 0x41, 0x08, 0xe1, 0x7b, 0xa8, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0x00, 0xa5, 0x52, 0x4a, 0x00, 0x00, 0xa0,
+    0x52, 0x4a, 0x0b, 0x00, 0x00, 0x21, 0x74, 0x0b, 0x00, 0x00, 0x21, 0x7c, 0x6b, 0x41, 0x08, 0x21, 0x7c, 0x6b, 0x41, 0x08, 0x21, 0x7c, 0x4a, 0x41,
+    0x08, 0xe1, 0x7b, 0x4a, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0x80, 0x94, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x52, 0x42, 0xad, 0x01, 0x00, 0x20, 0x7c, 0xad,
+    0x01, 0x00, 0x20, 0x7c, 0xad, 0x35, 0x08, 0x21, 0x7c, 0xac, 0x35, 0x08, 0x21, 0x7c, 0x8c, 0x31, 0x08, 0xe1, 0x7b, 0x8b, 0xb1, 0xf7, 0xde, 0x73,
+    0x00, 0x00, 0xa5, 0x94, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x4a, 0xee, 0x41, 0x00, 0xc0, 0x73, 0xee, 0x41, 0x00, 0xc0, 0x73, 0xee, 0x41, 0x08, 0xdf,
+    0x73, 0xcc, 0xbd, 0xf7, 0x9c, 0x73, 0xcc, 0x39, 0xe7, 0x9c, 0x73, 0xab, 0x39, 0xe7, 0x9c, 0x73, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0x05,
+    0x00, 0x50, 0x0e, 0xc6, 0x08, 0x00, 0x70, 0x0e, 0xc6, 0x08, 0x00, 0x70, 0x0e, 0xc6, 0x18, 0xa3, 0x73, 0xcc, 0xc5, 0x18, 0xa3, 0x73, 0xcc, 0xbd,
+    0xf7, 0x5e, 0x6b, 0xab, 0xbd, 0xf7, 0x5e, 0x6b, 0x00, 0x00, 0xa5, 0x94, 0x4a, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x0e, 0x42, 0x18, 0x01, 0x00, 0x0e,
+    0x42, 0x18, 0x01, 0x00, 0x0e, 0x42, 0x18, 0x63, 0x5c, 0xcc, 0x41, 0x08, 0x21, 0x5c, 0xcc, 0xbd, 0xf7, 0xde, 0x53, 0xab, 0xbd, 0xf7, 0xde, 0x53,
+    0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x00, 0xa5, 0x14, 0x00, 0x0e, 0x42, 0x08, 0x21, 0x00, 0x0e, 0x42, 0x08, 0x21, 0x00, 0x0e, 0x42, 0x08, 0x21,
+    0x84, 0xcc, 0x41, 0x08, 0x21, 0x7c, 0xcc, 0xbd, 0xf7, 0xde, 0x7b, 0xab, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x00, 0xc7,
+    0xd6, 0x52, 0x00, 0x38, 0xc7, 0xd6, 0x52, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xec, 0xbd,
+    0xf7, 0xde, 0x7b, 0xab, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x00, 0xc7, 0xd6, 0x52, 0x00, 0x00, 0xc7, 0xd6, 0x52, 0x00,
+    0x00, 0xf8, 0xde, 0x7b, 0x00, 0x00, 0xf8, 0xde, 0x7b, 0x09, 0x42, 0xf8, 0xde, 0x7b, 0xe8, 0xbd, 0xf7, 0xde, 0x7b, 0xa8, 0xbd, 0xf7, 0x9e, 0x73,
+    0x00, 0x80, 0xd6, 0x96, 0x52, 0x00, 0x00, 0xe7, 0xd6, 0x52, 0x0b, 0x00, 0xe0, 0xd6, 0x52, 0x0b, 0x00, 0x00, 0xdf, 0x7b, 0x0b, 0x00, 0x00, 0xdf,
+    0x7b, 0x6b, 0x41, 0x08, 0xdf, 0x7b, 0x4a, 0xbd, 0xf7, 0xde, 0x7b, 0x4a, 0xbd, 0xf7, 0x9e, 0x73, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xd6,
+    0xda, 0x52, 0xae, 0x01, 0x00, 0xda, 0x52, 0xce, 0x01, 0x00, 0xa0, 0x73, 0xcc, 0x01, 0x00, 0xa0, 0x73, 0xcc, 0x39, 0x08, 0xa1, 0x73, 0x8c, 0x31,
+    0xe7, 0x9c, 0x73, 0x8b, 0x31, 0xe7, 0x9c, 0x73, 0x00, 0x80, 0xd6, 0x94, 0x52, 0x00, 0x00, 0xe7, 0x18, 0x53, 0xcd, 0x39, 0x00, 0x00, 0x53, 0xce,
+    0x3d, 0x00, 0xc0, 0x6b, 0xce, 0x3d, 0x00, 0xc0, 0x6b, 0xce, 0xbd, 0xf7, 0xde, 0x6b, 0xcc, 0x39, 0xe7, 0x5a, 0x6b, 0xab, 0x39, 0xe7, 0x5a, 0x6b,
+    0x00, 0x00, 0xc6, 0xd6, 0x5a, 0x00, 0x00, 0xd7, 0x1a, 0x63, 0xcd, 0x35, 0x07, 0x00, 0x60, 0xef, 0x41, 0x08, 0x00, 0x70, 0xef, 0x41, 0x08, 0x00,
+    0x70, 0xef, 0x41, 0x08, 0xa1, 0x73, 0xec, 0x41, 0x08, 0x61, 0x6b, 0xab, 0xbd, 0xf7, 0x1e, 0x63, 0x00, 0x80, 0xc5, 0x18, 0x53, 0x00, 0x00, 0xd7,
+    0x18, 0x5b, 0xcd, 0x35, 0xd7, 0x00, 0x00, 0xef, 0xbd, 0x07, 0x01, 0x00, 0xef, 0xbd, 0x07, 0x01, 0x00, 0xef, 0xbd, 0x07, 0x21, 0x5c, 0xec, 0xbd,
+    0xf7, 0xde, 0x5b, 0xab, 0xbd, 0xf7, 0x9e, 0x53, 0x00, 0x80, 0xb5, 0xd6, 0x5a, 0x00, 0x80, 0xc6, 0x18, 0x63, 0xad, 0xb5, 0xc6, 0x18, 0x00, 0xef,
+    0xbd, 0xf7, 0x1e, 0x00, 0xef, 0xbd, 0xf7, 0x1e, 0x00, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xec, 0xbd, 0xf7, 0xde, 0x7b, 0xab, 0xbd, 0xf7, 0x9e, 0x73,
+    0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7, 0x1a, 0x63, 0xef, 0xbd, 0xf7, 0x5c, 0x63, 0x00, 0xbc, 0xf7, 0x5c, 0x63, 0x00, 0xbc, 0xf7, 0x9c,
+    0x73, 0x00, 0x3c, 0xe7, 0x9c, 0x73, 0xef, 0x3d, 0xe7, 0x9c, 0x73, 0xcd, 0x39, 0xe7, 0x9c, 0x73, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7,
+    0x1a, 0x63, 0x09, 0x42, 0xf8, 0x5e, 0x63, 0x00, 0x00, 0xf8, 0x5e, 0x63, 0x00, 0x00, 0xf8, 0x9e, 0x73, 0x00, 0x80, 0xf7, 0x9c, 0x73, 0xe9, 0xbd,
+    0xf7, 0x9c, 0x73, 0xe9, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x80, 0xf7, 0x96, 0x52, 0x00, 0x00, 0x08, 0x1f, 0x63, 0x8c, 0x41, 0x08, 0x61, 0x63, 0x0c,
+    0x00, 0x00, 0x61, 0x63, 0x0c, 0x00, 0x00, 0xe1, 0x73, 0x0c, 0x00, 0xf0, 0xde, 0x73, 0x8c, 0xbd, 0xf7, 0xde, 0x73, 0x6b, 0xbd, 0xf7, 0xde, 0x73,
+    0x00, 0x00, 0xe7, 0x9c, 0x52, 0x00, 0x80, 0xf7, 0x9e, 0x63, 0xcd, 0x39, 0x08, 0xe1, 0x63, 0xcd, 0x01, 0x00, 0xe0, 0x63, 0xcd, 0x01, 0x00, 0xe0,
+    0x73, 0xcd, 0x01, 0x00, 0xde, 0x73, 0xcd, 0xb9, 0xf7, 0xde, 0x73, 0xad, 0xb5, 0xf7, 0xde, 0x73, 0x00, 0x80, 0xf7, 0x18, 0x5b, 0x00, 0x00, 0x08,
+    0x9d, 0x6b, 0xef, 0x41, 0x08, 0xdf, 0x73, 0xef, 0x41, 0x00, 0xc0, 0x73, 0xef, 0x41, 0x00, 0xc0, 0x73, 0xed, 0x3d, 0x00, 0xc0, 0x73, 0xed, 0xbd,
+    0xf7, 0xde, 0x73, 0xed, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x00, 0xe7, 0x1c, 0x63, 0x00, 0x00, 0x08, 0x61, 0x6b, 0x0f, 0x42, 0x08, 0x61, 0x6b, 0x0f,
+    0x3e, 0x08, 0x00, 0x68, 0x0f, 0x42, 0x08, 0x00, 0x70, 0xee, 0xbd, 0x07, 0x00, 0x70, 0xee, 0xbd, 0xf7, 0x9e, 0x73, 0xed, 0xbd, 0xf7, 0x9e, 0x73,
+    0x00, 0x80, 0xd5, 0x5a, 0x53, 0x00, 0x80, 0xf7, 0xde, 0x5b, 0x0f, 0x42, 0x08, 0xe1, 0x5b, 0x0f, 0x3e, 0xf8, 0x00, 0x00, 0x0f, 0x42, 0x08, 0x01,
+    0x00, 0xce, 0xbd, 0xf7, 0x00, 0x00, 0xce, 0xbd, 0xf7, 0xde, 0x5b, 0xcd, 0xbd, 0xf7, 0xde, 0x53, 0x00, 0x80, 0xb5, 0x5a, 0x6b, 0x00, 0x00, 0xe7,
+    0x5a, 0x6b, 0xef, 0xbd, 0xf7, 0x9e, 0x73, 0xef, 0xbd, 0xf7, 0x1e, 0x00, 0xef, 0xbd, 0xf7, 0x1e, 0x00, 0xce, 0x39, 0xf7, 0x1e, 0x00, 0xce, 0x39,
+    0xf7, 0xde, 0x7b, 0xcd, 0x39, 0xf7, 0xde, 0x7b, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7, 0x1a, 0x63, 0xed, 0x3d, 0x08, 0xe1, 0x73, 0x0f,
+    0x42, 0x08, 0xe1, 0x7b, 0x00, 0x40, 0x08, 0xe1, 0x7b, 0x00, 0x40, 0x08, 0xe1, 0x7b, 0x00, 0x38, 0xd7, 0x5a, 0x6b, 0xce, 0x39, 0xd7, 0x5a, 0x6b,
+    0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7, 0x1a, 0x63, 0xe9, 0x41, 0x08, 0x21, 0x74, 0x29, 0xc6, 0x08, 0x21, 0x7c, 0x00, 0x80, 0x08, 0x21,
+    0x7c, 0x00, 0x80, 0x08, 0x21, 0x7c, 0x00, 0x00, 0xe7, 0x9c, 0x6b, 0xc9, 0x39, 0xe7, 0x9c, 0x6b, 0x00, 0x80, 0xf7, 0x96, 0x52, 0x00, 0x80, 0x18,
+    0x1f, 0x63, 0x8c, 0xc5, 0x18, 0x23, 0x74, 0x8c, 0xc5, 0x18, 0x23, 0x84, 0x0c, 0x00, 0x10, 0x23, 0x84, 0x0c, 0x00, 0x10, 0x23, 0x84, 0x0b, 0x00,
+    0xf0, 0x9c, 0x73, 0x6b, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x00, 0xe7, 0x9c, 0x52, 0x00, 0x00, 0x08, 0xa1, 0x63, 0xcd, 0xb9, 0x18, 0x23, 0x7c, 0xce,
+    0xb9, 0x18, 0x63, 0x7c, 0xce, 0x01, 0x00, 0x62, 0x7c, 0xce, 0x01, 0x00, 0x62, 0x7c, 0xad, 0x01, 0x00, 0x9c, 0x73, 0xad, 0x35, 0xe7, 0x9c, 0x73,
+    0x00, 0x80, 0xf7, 0x5a, 0x5b, 0x00, 0x00, 0x08, 0x9d, 0x6b, 0xed, 0x41, 0x08, 0xdf, 0x7b, 0x0f, 0x42, 0x08, 0xdf, 0x7b, 0x0f, 0x42, 0x00, 0xc0,
+    0x7b, 0x0f, 0x42, 0x00, 0xc0, 0x7b, 0xce, 0x3d, 0x00, 0x80, 0x73, 0xce, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x00, 0xe7, 0x1c, 0x63, 0x00, 0x80, 0x18,
+    0xa3, 0x73, 0xed, 0xc5, 0x18, 0x63, 0x73, 0x0f, 0xc6, 0x18, 0xa3, 0x73, 0x0f, 0xc6, 0x08, 0x00, 0x70, 0x0f, 0xc6, 0x08, 0x00, 0x70, 0xce, 0x39,
+    0x07, 0x00, 0x70, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0x00, 0x80, 0xd5, 0x5a, 0x53, 0x00, 0x80, 0x07, 0x21, 0x54, 0xed, 0x41, 0x08, 0x21, 0x5c, 0x0f,
+    0x42, 0x18, 0x63, 0x5c, 0x0f, 0x42, 0x18, 0x01, 0x00, 0x0f, 0x42, 0x18, 0x01, 0x00, 0xcd, 0x39, 0xe7, 0x00, 0x00, 0xcd, 0x39, 0xe7, 0x9c, 0x53,
+    0x00, 0x80, 0xb5, 0x5a, 0x6b, 0x00, 0x00, 0xe7, 0x9c, 0x73, 0xed, 0x41, 0x08, 0x21, 0x7c, 0x0f, 0x42, 0x08, 0x21, 0x84, 0x0f, 0x42, 0x08, 0x21,
+    0x00, 0x0f, 0x42, 0x08, 0x21, 0x00, 0xad, 0x35, 0xe7, 0x1c, 0x00, 0xad, 0x35, 0xe7, 0x9c, 0x73, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7,
+    0x1a, 0x63, 0xcc, 0x3d, 0x08, 0xe1, 0x73, 0xed, 0x41, 0x08, 0xe1, 0x7b, 0xef, 0x41, 0x08, 0xe1, 0x7b, 0x00, 0x40, 0x08, 0xe1, 0x7b, 0x00, 0xbc,
+    0xf7, 0xde, 0x7b, 0x00, 0xb0, 0xc5, 0xd6, 0x52, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7, 0x1a, 0x63, 0xc9, 0x41, 0x08, 0xe1, 0x73, 0xe9,
+    0x41, 0x08, 0x21, 0x7c, 0x09, 0x42, 0x08, 0x21, 0x7c, 0x00, 0x00, 0x08, 0x21, 0x7c, 0x00, 0x00, 0x08, 0xe1, 0x7b, 0x00, 0x00, 0xc6, 0x16, 0x5b,
+    0x00, 0x80, 0xf7, 0x96, 0x52, 0x00, 0x00, 0x08, 0x1f, 0x63, 0x6b, 0x41, 0x08, 0xe1, 0x73, 0x6b, 0x41, 0x08, 0x21, 0x7c, 0x8c, 0xc5, 0x18, 0x21,
+    0x84, 0x0c, 0x00, 0x10, 0x21, 0x84, 0x0c, 0x00, 0x10, 0x21, 0x84, 0x0b, 0x00, 0xc0, 0x18, 0x5b, 0x00, 0x00, 0xe7, 0x9c, 0x52, 0x00, 0x00, 0x08,
+    0xa1, 0x63, 0xac, 0x35, 0x08, 0xe1, 0x7b, 0xad, 0x35, 0x08, 0x21, 0x7c, 0xcd, 0xb9, 0x18, 0x23, 0x7c, 0xcd, 0x01, 0x00, 0x22, 0x7c, 0xcd, 0x01,
+    0x00, 0xe2, 0x7b, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x00, 0x80, 0xf7, 0x5a, 0x5b, 0x00, 0x00, 0x08, 0x9d, 0x6b, 0xcc, 0xc1, 0x07, 0x9d, 0x73, 0xed,
+    0x41, 0x08, 0x9d, 0x73, 0xef, 0x41, 0x08, 0xdf, 0x73, 0xef, 0x41, 0x00, 0xc0, 0x73, 0xef, 0x41, 0x00, 0xc0, 0x73, 0x8c, 0x31, 0x00, 0x00, 0x63,
+    0x00, 0x00, 0xe7, 0x5c, 0x6b, 0x00, 0x00, 0x08, 0x21, 0x6b, 0xcc, 0x41, 0x08, 0x61, 0x6b, 0xed, 0x41, 0x08, 0xa1, 0x73, 0x0f, 0xc2, 0x18, 0xa3,
+    0x73, 0x0f, 0xc2, 0x08, 0x00, 0x70, 0x0f, 0xc2, 0x08, 0x00, 0x70, 0x8b, 0x31, 0x06, 0x00, 0x60, 0x00, 0x80, 0xd5, 0x5a, 0x53, 0x00, 0x80, 0xf7,
+    0xde, 0x53, 0xcc, 0x41, 0x08, 0xe1, 0x5b, 0xed, 0x41, 0x08, 0x21, 0x54, 0x0f, 0x42, 0x18, 0x63, 0x5c, 0x0f, 0x42, 0x18, 0x01, 0x00, 0x0f, 0x42,
+    0x18, 0x01, 0x00, 0x8b, 0x2d, 0xc6, 0x00, 0x00, 0x00, 0x80, 0xb5, 0x5a, 0x6b, 0x00, 0x00, 0xe7, 0x9c, 0x73, 0xcc, 0x41, 0x08, 0xe1, 0x7b, 0xed,
+    0x41, 0x08, 0x21, 0x7c, 0xef, 0x41, 0x08, 0x21, 0x84, 0xef, 0x41, 0x08, 0x21, 0x00, 0xef, 0xbd, 0xf7, 0x20, 0x00, 0x6a, 0x2d, 0xb6, 0x18, 0x00,
+    0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7, 0x1a, 0x63, 0xec, 0xbd, 0xf7, 0xde, 0x6b, 0xec, 0xbd, 0xf7, 0xde, 0x73, 0xec, 0xbd, 0xf7, 0xde,
+    0x7b, 0xee, 0xbd, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0x9c, 0x73, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7,
+    0x1a, 0x63, 0xe9, 0x41, 0x08, 0xdf, 0x6b, 0xe9, 0x41, 0x08, 0xe1, 0x73, 0xe9, 0x41, 0x08, 0xe1, 0x7b, 0x09, 0x42, 0x08, 0xe1, 0x7b, 0x00, 0x00,
+    0x08, 0xdf, 0x7b, 0x00, 0x00, 0xf8, 0xde, 0x7b, 0x00, 0x80, 0xf7, 0x96, 0x52, 0x00, 0x00, 0x08, 0x1f, 0x63, 0x6b, 0x41, 0x08, 0xdf, 0x6b, 0x6b,
+    0x41, 0x08, 0xe1, 0x73, 0x6b, 0x41, 0x08, 0xe1, 0x7b, 0x6b, 0x41, 0x08, 0xe1, 0x7b, 0x0b, 0x00, 0x00, 0xe1, 0x7b, 0x0b, 0x00, 0x00, 0xe1, 0x7b,
+    0x00, 0x00, 0xe7, 0x9c, 0x52, 0x00, 0x00, 0x08, 0xa1, 0x63, 0xcc, 0x31, 0x08, 0xe1, 0x6b, 0xcc, 0x39, 0x08, 0xe1, 0x73, 0xac, 0x35, 0x08, 0xe1,
+    0x7b, 0xad, 0x35, 0x08, 0xe1, 0x7b, 0xad, 0x01, 0x00, 0xde, 0x7b, 0xad, 0x01, 0x00, 0xde, 0x7b, 0x00, 0x80, 0xf7, 0x5a, 0x5b, 0x00, 0x80, 0xf7,
+    0x9c, 0x6b, 0xec, 0xbd, 0xf7, 0x9c, 0x6b, 0xec, 0xbd, 0xf7, 0x9c, 0x73, 0xec, 0xbd, 0xf7, 0x9c, 0x73, 0xee, 0xbd, 0xf7, 0x9c, 0x73, 0xee, 0x3d,
+    0x00, 0x80, 0x73, 0xee, 0x3d, 0x00, 0x80, 0x73, 0x00, 0x00, 0xe7, 0x5c, 0x6b, 0x00, 0x00, 0x08, 0x21, 0x6b, 0xec, 0x41, 0x08, 0x61, 0x6b, 0xec,
+    0x41, 0x08, 0x21, 0x6b, 0xec, 0x41, 0x08, 0x61, 0x6b, 0xee, 0x41, 0x08, 0xa1, 0x73, 0xee, 0x41, 0x08, 0x00, 0x70, 0xee, 0x3d, 0x08, 0x00, 0x70,
+    0x00, 0x80, 0xd5, 0x5a, 0x53, 0x00, 0x80, 0xf7, 0xde, 0x4b, 0xec, 0x41, 0x08, 0xdf, 0x53, 0xec, 0x41, 0x08, 0xe1, 0x53, 0xec, 0x41, 0x08, 0xe1,
+    0x5b, 0xee, 0x41, 0x08, 0x21, 0x54, 0xee, 0x41, 0x08, 0x01, 0x00, 0xee, 0xbd, 0x07, 0x01, 0x00, 0x00, 0x80, 0xb5, 0x5a, 0x6b, 0x00, 0x00, 0xe7,
+    0x9c, 0x73, 0xec, 0x41, 0x08, 0xdf, 0x73, 0xec, 0x41, 0x08, 0xe1, 0x73, 0xec, 0x41, 0x08, 0xe1, 0x7b, 0xce, 0x41, 0x08, 0xe1, 0x7b, 0xce, 0xbd,
+    0xf7, 0x1e, 0x00, 0xce, 0xbd, 0xf7, 0x1e, 0x00, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xd6, 0x1a, 0x63, 0x00, 0x80, 0xf7, 0x9e, 0x6b, 0xab,
+    0xbd, 0xf7, 0x9e, 0x6b, 0xab, 0xbd, 0xf7, 0xde, 0x6b, 0xab, 0xbd, 0xf7, 0xdc, 0x6b, 0x8a, 0x39, 0xf7, 0xde, 0x6b, 0x8a, 0xb5, 0xd6, 0x5a, 0x6b,
+    0x00, 0x00, 0xe7, 0x18, 0x63, 0x00, 0x80, 0xf7, 0x9c, 0x73, 0x00, 0x80, 0xf7, 0xde, 0x73, 0xab, 0xbd, 0xf7, 0xde, 0x73, 0xab, 0xbd, 0xf7, 0xde,
+    0x6b, 0xab, 0xbd, 0xf7, 0xde, 0x6b, 0x8a, 0xb9, 0xf7, 0xde, 0x6b, 0x8a, 0x39, 0xe7, 0x9c, 0x6b, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7,
+    0x1a, 0x63, 0x00, 0x80, 0xf7, 0x9e, 0x6b, 0x4a, 0xbd, 0xf7, 0x9e, 0x6b, 0x4a, 0xbd, 0xf7, 0xde, 0x6b, 0x29, 0xbd, 0xf7, 0xde, 0x6b, 0x29, 0xb9,
+    0xf7, 0xde, 0x6b, 0x29, 0x39, 0xe7, 0x9c, 0x6b, 0x00, 0x00, 0x00, 0x98, 0x52, 0x00, 0x00, 0x00, 0x1e, 0x63, 0x00, 0x80, 0xf7, 0xde, 0x6b, 0x8b,
+    0xad, 0xf7, 0xde, 0x6b, 0x8b, 0xb1, 0xf7, 0xde, 0x6b, 0x6b, 0xad, 0xf7, 0xde, 0x6b, 0x6a, 0xad, 0xf7, 0xde, 0x6b, 0x4a, 0x29, 0xe7, 0x9c, 0x6b,
+    0x00, 0x00, 0x00, 0x40, 0x5b, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0xe7, 0x9a, 0x6b, 0xab, 0x39, 0xe7, 0x9c, 0x6b, 0xab, 0x39, 0xe7, 0x9a,
+    0x6b, 0xab, 0xb5, 0xe6, 0x9c, 0x6b, 0x8a, 0xb5, 0xe6, 0x9a, 0x6b, 0x8a, 0x31, 0xe6, 0x9c, 0x6b, 0x00, 0x00, 0x07, 0x00, 0x68, 0x00, 0x80, 0x07,
+    0x00, 0x68, 0x00, 0x80, 0xf7, 0x5e, 0x6b, 0xab, 0xbd, 0xf7, 0x1e, 0x63, 0xab, 0xbd, 0xf7, 0x1e, 0x63, 0xab, 0xbd, 0xf7, 0x1e, 0x63, 0x8a, 0xb9,
+    0xf7, 0x1e, 0x63, 0x8a, 0x39, 0xe7, 0x1c, 0x63, 0x00, 0x80, 0xd5, 0x00, 0x00, 0x00, 0x80, 0xe6, 0x00, 0x00, 0x00, 0x80, 0xf7, 0xde, 0x53, 0xab,
+    0xbd, 0xf7, 0xde, 0x5b, 0xab, 0xbd, 0xf7, 0xde, 0x53, 0xab, 0xbd, 0xf7, 0xde, 0x53, 0x8a, 0xb9, 0xf7, 0xde, 0x4b, 0x8a, 0x39, 0xe7, 0x9c, 0x53,
+    0x00, 0x80, 0xb5, 0x1a, 0x00, 0x00, 0x80, 0xd6, 0x1c, 0x00, 0x00, 0x80, 0xf7, 0xde, 0x73, 0xab, 0xbd, 0xf7, 0xde, 0x73, 0xab, 0xbd, 0xf7, 0xde,
+    0x6b, 0xab, 0xbd, 0xf7, 0xde, 0x6b, 0x8a, 0xb9, 0xf7, 0xde, 0x6b, 0x8a, 0x35, 0xe7, 0x9c, 0x6b, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xd6,
+    0x1a, 0x63, 0x00, 0x80, 0xf7, 0x9e, 0x73, 0xee, 0xbd, 0xf7, 0xde, 0x73, 0xee, 0xbd, 0xf7, 0xde, 0x73, 0xcc, 0xbd, 0xf7, 0xde, 0x73, 0xcc, 0xbd,
+    0xf7, 0xde, 0x73, 0xcc, 0x39, 0xd7, 0x5a, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x73, 0xce, 0x39, 0x00, 0x00, 0x08, 0x1b, 0x63, 0x00, 0x00, 0x08, 0x9f, 0x73, 0x4a, 0x41, 0x08, 0xdf, 0x73, 0x4a, 0x41, 0x08, 0xdf,
+    0x73, 0x29, 0xbd, 0xf7, 0xde, 0x73, 0x29, 0xb9, 0xf7, 0xde, 0x73, 0x29, 0x39, 0xe7, 0x9c, 0x6b, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00,
+    0x1e, 0x63, 0x00, 0x00, 0x00, 0xde, 0x73, 0x8b, 0xad, 0xf7, 0xde, 0x73, 0x8b, 0xb1, 0xf7, 0xde, 0x73, 0x6b, 0xad, 0xf7, 0xde, 0x73, 0x6a, 0xad,
+    0xf7, 0xde, 0x73, 0x4a, 0x29, 0xe7, 0x9c, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x80, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x73, 0xab,
+    0xbd, 0xf7, 0x9c, 0x73, 0xab, 0x39, 0xe7, 0x9c, 0x73, 0xab, 0xb5, 0xe6, 0x9c, 0x73, 0x8a, 0xb5, 0xe6, 0x9c, 0x73, 0x8a, 0x31, 0xe6, 0x9c, 0x6b,
+    0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x68, 0x00, 0x00, 0x08, 0x00, 0x68, 0xab, 0x41, 0x08, 0x61, 0x6b, 0xab, 0x41, 0x08, 0x5f,
+    0x6b, 0xab, 0xbd, 0xf7, 0x5e, 0x6b, 0x8a, 0xb9, 0xf7, 0x1e, 0x63, 0x8a, 0x39, 0xe7, 0x1c, 0x63, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x80, 0xf6,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0xab, 0xc1, 0x07, 0xdf, 0x5b, 0xab, 0x41, 0x08, 0xdf, 0x53, 0xab, 0xbd, 0xf7, 0xde, 0x5b, 0x8a, 0xb9,
+    0xf7, 0xde, 0x53, 0x8a, 0x39, 0xe7, 0x9c, 0x53, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x80, 0xd6, 0x1e, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x00, 0xab,
+    0xc1, 0x07, 0xdf, 0x7b, 0xab, 0x41, 0x08, 0xdf, 0x73, 0xab, 0xbd, 0xf7, 0xde, 0x73, 0x8a, 0xb9, 0xf7, 0xde, 0x73, 0x8a, 0x35, 0xe7, 0x9c, 0x6b,
+    0x00, 0x00, 0xa5, 0x52, 0x4a, 0x00, 0x00, 0xa5, 0x52, 0x4a, 0x00, 0x80, 0xf7, 0x9e, 0x73, 0xeb, 0xbd, 0xf7, 0xde, 0x73, 0xeb, 0xbd, 0xf7, 0xde,
+    0x73, 0xab, 0xbd, 0xf7, 0xde, 0x73, 0x8a, 0x39, 0xf7, 0xde, 0x73, 0x8a, 0xb5, 0xd6, 0x5a, 0x6b, 0x00, 0x00, 0xa5, 0x52, 0x4a, 0x00, 0x00, 0xa5,
+    0x52, 0x4a, 0x00, 0x00, 0x08, 0x9f, 0x73, 0x07, 0x42, 0x08, 0xdf, 0x73, 0x07, 0x42, 0x08, 0xdf, 0x73, 0xa7, 0xbd, 0xf7, 0xde, 0x73, 0x87, 0xb9,
+    0xf7, 0xde, 0x73, 0x87, 0x39, 0xe7, 0x9c, 0x6b, 0x00, 0x00, 0xa5, 0x52, 0x4a, 0x00, 0x80, 0xa4, 0x52, 0x4a, 0x00, 0x00, 0x08, 0xa1, 0x73, 0x2a,
+    0x41, 0x08, 0xe1, 0x73, 0x4a, 0x41, 0x08, 0xe1, 0x73, 0x29, 0x41, 0x08, 0xe1, 0x73, 0x29, 0xb9, 0xf7, 0xde, 0x73, 0x29, 0x39, 0xe7, 0x9c, 0x73,
+    0x00, 0x80, 0x94, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x52, 0x42, 0x00, 0x00, 0x00, 0xde, 0x73, 0x8b, 0x01, 0x00, 0xde, 0x73, 0x8b, 0xb1, 0xf7, 0xde,
+    0x73, 0x6b, 0xad, 0xf7, 0xde, 0x73, 0x6a, 0xad, 0xf7, 0xde, 0x73, 0x4a, 0x29, 0xe7, 0x9c, 0x73, 0x00, 0x00, 0xa5, 0x94, 0x4a, 0x00, 0x00, 0x00,
+    0x80, 0x4a, 0x00, 0x00, 0x00, 0xc0, 0x73, 0xeb, 0x3d, 0x00, 0xc0, 0x73, 0xeb, 0xbd, 0xf7, 0xde, 0x73, 0xab, 0xb5, 0xe6, 0x9c, 0x73, 0x8a, 0xb5,
+    0xe6, 0x9c, 0x73, 0x8a, 0x31, 0xe6, 0x9c, 0x73, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0x05, 0x00, 0x50, 0x00, 0x00, 0x08, 0x00, 0x68, 0x0b,
+    0x42, 0x08, 0x00, 0x68, 0x0b, 0x42, 0x08, 0x61, 0x6b, 0xab, 0x41, 0x08, 0x61, 0x6b, 0x8a, 0xb9, 0xf7, 0x5e, 0x6b, 0x8a, 0x39, 0xe7, 0x1c, 0x63,
+    0x00, 0x00, 0xa5, 0x94, 0x4a, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x0b, 0x42, 0x08, 0x01, 0x00, 0x0b, 0x42, 0x08, 0x21,
+    0x5c, 0xab, 0x3d, 0x08, 0x21, 0x5c, 0x8a, 0xb9, 0xf7, 0xde, 0x53, 0x8a, 0x39, 0xf7, 0xde, 0x53, 0x00, 0x00, 0xa5, 0x94, 0x52, 0x00, 0x00, 0xa5,
+    0x14, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0xeb, 0xc1, 0x07, 0x21, 0x00, 0xeb, 0x41, 0x08, 0x21, 0x84, 0xab, 0xbd, 0xf7, 0xde, 0x73, 0x8a, 0xb9,
+    0xf7, 0xde, 0x73, 0x8a, 0x35, 0xe7, 0x9c, 0x73, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x00, 0xc6, 0xd6, 0x52, 0x00, 0x80, 0xc5, 0xd6, 0x52, 0x00,
+    0xbc, 0xf7, 0xde, 0x73, 0x00, 0xbc, 0xf7, 0xde, 0x73, 0xec, 0xbd, 0xf7, 0xde, 0x73, 0x8a, 0xbd, 0xf7, 0xde, 0x73, 0x8a, 0xb5, 0xd6, 0x5a, 0x6b,
+    0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x00, 0xc6, 0xd6, 0x52, 0x00, 0x80, 0xc5, 0xd6, 0x52, 0x00, 0x80, 0xf7, 0xde, 0x73, 0x00, 0x80, 0xf7, 0xde,
+    0x73, 0xe7, 0xbd, 0xf7, 0xde, 0x73, 0x87, 0xbd, 0xf7, 0xde, 0x73, 0x87, 0x39, 0xe7, 0x9c, 0x6b, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x00, 0xc6,
+    0xd6, 0x52, 0x00, 0x00, 0xc0, 0xd6, 0x52, 0x09, 0x00, 0xf0, 0xde, 0x73, 0x09, 0x00, 0xf0, 0xde, 0x73, 0x29, 0xbd, 0xf7, 0xde, 0x73, 0x29, 0xbd,
+    0xf7, 0xde, 0x73, 0x09, 0x39, 0xe7, 0x9c, 0x73, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xb5, 0xd6, 0x52, 0x00, 0x00, 0x00, 0xd6, 0x52, 0x6b,
+    0x01, 0x00, 0x9c, 0x73, 0x6b, 0x01, 0x00, 0x9c, 0x73, 0x6b, 0x2d, 0xe7, 0x9c, 0x73, 0x6a, 0x2d, 0xe7, 0x9c, 0x73, 0x4a, 0x29, 0xe7, 0x9c, 0x73,
+    0x00, 0x00, 0xc6, 0x94, 0x52, 0x00, 0x00, 0xc6, 0x18, 0x53, 0x00, 0x00, 0x00, 0x00, 0x53, 0xac, 0x3d, 0x00, 0x80, 0x6b, 0xac, 0x3d, 0x00, 0x80,
+    0x6b, 0xac, 0xbd, 0xf7, 0x9c, 0x6b, 0x8a, 0xb5, 0xd6, 0x5a, 0x6b, 0x8a, 0x31, 0xd6, 0x5a, 0x6b, 0x00, 0x00, 0xc6, 0xd6, 0x5a, 0x00, 0x80, 0xd6,
+    0x1a, 0x63, 0x00, 0x80, 0x06, 0x00, 0x60, 0xec, 0x3d, 0x08, 0x00, 0x68, 0xec, 0x3d, 0x08, 0x00, 0x68, 0xec, 0x3d, 0x08, 0x61, 0x6b, 0x8a, 0xbd,
+    0xf7, 0x5e, 0x6b, 0x8a, 0x39, 0xe7, 0x1c, 0x63, 0x00, 0x80, 0xc5, 0x18, 0x53, 0x00, 0x00, 0xc6, 0x18, 0x5b, 0x00, 0x00, 0xc6, 0x00, 0x00, 0xec,
+    0xbd, 0xf7, 0x00, 0x00, 0xec, 0xbd, 0xf7, 0x00, 0x00, 0xec, 0xbd, 0xf7, 0xde, 0x5b, 0x8a, 0xbd, 0xf7, 0xde, 0x5b, 0x8a, 0x39, 0xe7, 0x9c, 0x53,
+    0x00, 0x80, 0xb5, 0xd6, 0x5a, 0x00, 0x00, 0xc6, 0x18, 0x63, 0x00, 0x80, 0xc5, 0x18, 0x00, 0xec, 0xbd, 0xf7, 0x1e, 0x00, 0xec, 0xbd, 0xf7, 0x1e,
+    0x00, 0xec, 0xbd, 0xf7, 0xde, 0x7b, 0x8a, 0xbd, 0xf7, 0xde, 0x73, 0x8a, 0x35, 0xe7, 0x9c, 0x73, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xd6,
+    0x1a, 0x63, 0x00, 0x00, 0xe7, 0x5a, 0x63, 0x00, 0x38, 0xe7, 0x5a, 0x63, 0x00, 0x38, 0xe7, 0x9c, 0x73, 0x00, 0x34, 0xd7, 0x5c, 0x73, 0xcd, 0x39,
+    0xe7, 0x9c, 0x73, 0xab, 0xb5, 0xd6, 0x5a, 0x6b, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xd6, 0x1a, 0x63, 0x00, 0x80, 0xe7, 0x5a, 0x63, 0x00,
+    0x80, 0xe7, 0x5a, 0x63, 0x00, 0x80, 0xe7, 0x9c, 0x73, 0x00, 0x00, 0xe7, 0x9c, 0x73, 0xc8, 0x39, 0xe7, 0x9c, 0x73, 0xa7, 0x39, 0xe7, 0x9c, 0x6b,
+    0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7, 0x1a, 0x63, 0x00, 0x80, 0xf7, 0x5a, 0x63, 0x0a, 0x00, 0xf0, 0x5a, 0x63, 0x0a, 0x00, 0xf0, 0x9c,
+    0x73, 0x0a, 0x00, 0xf0, 0x9c, 0x73, 0x4a, 0xbd, 0xf7, 0x9c, 0x73, 0x29, 0x39, 0xe7, 0x9c, 0x73, 0x00, 0x00, 0xc6, 0x98, 0x52, 0x00, 0x80, 0xd6,
+    0x1a, 0x63, 0x00, 0x80, 0xf7, 0x5e, 0x63, 0x8c, 0x01, 0x00, 0x5e, 0x63, 0x8c, 0x01, 0x00, 0x5e, 0x6b, 0x8a, 0x01, 0x00, 0x5c, 0x6b, 0x8a, 0x31,
+    0xe7, 0x5c, 0x6b, 0x4a, 0xa9, 0xd6, 0x5a, 0x6b, 0x00, 0x80, 0xd6, 0x18, 0x5b, 0x00, 0x80, 0xf7, 0x18, 0x63, 0x00, 0x80, 0xf7, 0x9c, 0x63, 0xed,
+    0x3d, 0x00, 0x80, 0x63, 0xed, 0x3d, 0x00, 0xc0, 0x63, 0x8c, 0x39, 0x00, 0xc0, 0x63, 0x8c, 0x39, 0xf7, 0xde, 0x63, 0x8b, 0x31, 0xc6, 0x18, 0x63,
+    0x00, 0x80, 0xd6, 0x1a, 0x63, 0x00, 0x00, 0xe7, 0x5a, 0x6b, 0x00, 0x80, 0xf7, 0x5e, 0x6b, 0xed, 0xbd, 0x07, 0x00, 0x68, 0xed, 0xbd, 0x07, 0x00,
+    0x68, 0xcd, 0xbd, 0x07, 0x00, 0x68, 0xcd, 0xbd, 0xf7, 0x5e, 0x6b, 0xab, 0xb9, 0xf7, 0x5e, 0x6b, 0x00, 0x80, 0xd5, 0x5a, 0x53, 0x00, 0x80, 0xe6,
+    0x9c, 0x5b, 0x00, 0x80, 0xf7, 0x9c, 0x5b, 0xed, 0xbd, 0xf7, 0x00, 0x00, 0xed, 0xbd, 0xf7, 0x00, 0x00, 0xcd, 0x39, 0xf7, 0x00, 0x00, 0xcd, 0x39,
+    0xf7, 0xde, 0x5b, 0xab, 0x39, 0xe7, 0x9c, 0x53, 0x00, 0x80, 0xb5, 0x5a, 0x6b, 0x00, 0x80, 0xd6, 0x5a, 0x6b, 0x00, 0x80, 0xe7, 0x9c, 0x73, 0xed,
+    0xb9, 0xe7, 0x1c, 0x00, 0xed, 0xbd, 0xe7, 0x1c, 0x00, 0xcd, 0x35, 0xe7, 0x1c, 0x00, 0xcd, 0x39, 0xe7, 0x9c, 0x73, 0xab, 0x35, 0xe7, 0x9c, 0x73,
+    0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xd6, 0x1a, 0x63, 0x00, 0x80, 0xf7, 0x9e, 0x73, 0xee, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0xbc, 0xf7, 0xde,
+    0x73, 0x00, 0xbc, 0xf7, 0xde, 0x73, 0x00, 0x34, 0xc6, 0x18, 0x63, 0xad, 0x35, 0xc6, 0x18, 0x63, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xd6,
+    0x1a, 0x63, 0x00, 0x00, 0x08, 0x9f, 0x73, 0x08, 0x42, 0x08, 0xdf, 0x73, 0x00, 0x00, 0x08, 0xdf, 0x73, 0x00, 0x00, 0xf8, 0xde, 0x73, 0x00, 0x80,
+    0xd6, 0x1a, 0x63, 0xa8, 0xb5, 0xd6, 0x1a, 0x63, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x00, 0x08, 0x1b, 0x63, 0x00, 0x00, 0x08, 0xa1, 0x73, 0x6b,
+    0x41, 0x08, 0xe1, 0x73, 0x0b, 0x00, 0x00, 0xe1, 0x73, 0x0b, 0x00, 0x00, 0xe1, 0x73, 0x0a, 0x00, 0xd0, 0x5a, 0x63, 0x4a, 0xb5, 0xd6, 0x5a, 0x63,
+    0x00, 0x00, 0xc6, 0x98, 0x52, 0x00, 0x80, 0xf7, 0x1e, 0x63, 0x00, 0x80, 0xf7, 0xde, 0x73, 0xac, 0x35, 0x08, 0xe1, 0x73, 0xac, 0x01, 0x00, 0xe0,
+    0x73, 0xab, 0x01, 0x00, 0xe0, 0x73, 0x8b, 0x01, 0x00, 0x5a, 0x63, 0x8b, 0xb1, 0xd6, 0x5a, 0x63, 0x00, 0x80, 0xd6, 0x5a, 0x5b, 0x00, 0x80, 0xf7,
+    0x9c, 0x6b, 0x00, 0x80, 0xf7, 0xde, 0x73, 0xcd, 0xbd, 0xf7, 0xde, 0x7b, 0xcd, 0x3d, 0x00, 0xc0, 0x7b, 0xad, 0x3d, 0x00, 0xc0, 0x7b, 0xac, 0x35,
+    0x00, 0x40, 0x6b, 0xac, 0xb5, 0xd6, 0x5a, 0x6b, 0x00, 0x00, 0xe7, 0x1c, 0x63, 0x00, 0x00, 0x08, 0x61, 0x6b, 0x00, 0x00, 0x08, 0x61, 0x6b, 0x0e,
+    0x42, 0x08, 0x61, 0x6b, 0x0e, 0x42, 0x08, 0x00, 0x68, 0x0e, 0x42, 0x08, 0x00, 0x68, 0xac, 0xb5, 0x06, 0x00, 0x68, 0xac, 0xb5, 0xd6, 0x5a, 0x6b,
+    0x00, 0x80, 0xd5, 0x5a, 0x53, 0x00, 0x80, 0xf6, 0xde, 0x53, 0x00, 0x00, 0x08, 0x21, 0x5c, 0xee, 0x41, 0x08, 0x21, 0x5c, 0xee, 0x41, 0x08, 0x01,
+    0x00, 0xee, 0x3d, 0x08, 0x01, 0x00, 0x8c, 0xb5, 0xd6, 0x00, 0x00, 0x8c, 0xb5, 0xd6, 0x5a, 0x53, 0x00, 0x80, 0xb5, 0x5a, 0x6b, 0x00, 0x80, 0xd6,
+    0x9c, 0x73, 0x00, 0x00, 0x08, 0xdf, 0x73, 0xee, 0xc1, 0x07, 0x21, 0x84, 0xee, 0x41, 0x08, 0x21, 0x00, 0xee, 0xbd, 0xf7, 0x20, 0x00, 0x8c, 0x31,
+    0xd6, 0x1a, 0x00, 0x8c, 0x31, 0xd6, 0x5a, 0x6b, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xd6, 0x1a, 0x63, 0x00, 0x80, 0xf7, 0x9e, 0x73, 0xab,
+    0xbd, 0xf7, 0xde, 0x73, 0xcd, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0xbc, 0xf7, 0xde, 0x73, 0x00, 0xbc, 0xf7, 0xde, 0x73, 0x00, 0xa8, 0xa5, 0x54, 0x52,
+    0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xd6, 0x1a, 0x63, 0x00, 0x00, 0x08, 0x9f, 0x73, 0xa8, 0xc1, 0x07, 0xdf, 0x73, 0xe8, 0x41, 0x08, 0xdf,
+    0x73, 0x00, 0x80, 0xf7, 0xde, 0x73, 0x00, 0x80, 0xf7, 0xde, 0x73, 0x00, 0x80, 0xa5, 0x96, 0x52, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x00, 0x08,
+    0x1b, 0x63, 0x00, 0x00, 0x08, 0x9f, 0x73, 0x4a, 0x41, 0x08, 0xe1, 0x73, 0x4a, 0x41, 0x08, 0xe1, 0x7b, 0x0a, 0x00, 0x00, 0xe1, 0x7b, 0x0a, 0x00,
+    0x00, 0xe1, 0x7b, 0x09, 0x00, 0xb0, 0x96, 0x52, 0x00, 0x00, 0xc6, 0x98, 0x52, 0x00, 0x80, 0xf7, 0x1e, 0x63, 0x00, 0x80, 0xf7, 0xde, 0x73, 0x8b,
+    0xb1, 0xf7, 0xde, 0x73, 0x8c, 0xb1, 0xf7, 0xde, 0x73, 0x8c, 0x01, 0x00, 0xde, 0x73, 0x8c, 0x01, 0x00, 0xde, 0x73, 0x6a, 0x01, 0x00, 0xd6, 0x52,
+    0x00, 0x80, 0xd6, 0x5a, 0x5b, 0x00, 0x80, 0xf7, 0x9c, 0x6b, 0x00, 0x80, 0xf7, 0x9c, 0x73, 0xab, 0xbd, 0xf7, 0x9c, 0x73, 0xcd, 0xbd, 0xf7, 0xde,
+    0x73, 0xcd, 0x39, 0x00, 0xc0, 0x73, 0xcd, 0x39, 0x00, 0xc0, 0x73, 0x6a, 0x2d, 0x00, 0xc0, 0x52, 0x00, 0x00, 0xe7, 0x1c, 0x63, 0x00, 0x80, 0xf7,
+    0x1e, 0x63, 0x00, 0x00, 0x08, 0x5f, 0x6b, 0xab, 0x41, 0x08, 0x61, 0x6b, 0xed, 0x41, 0x08, 0x61, 0x6b, 0xed, 0x41, 0x08, 0x00, 0x68, 0xed, 0x41,
+    0x08, 0x00, 0x68, 0x4a, 0xad, 0x05, 0x00, 0x50, 0x00, 0x80, 0xd5, 0x5a, 0x53, 0x00, 0x80, 0xf6, 0xde, 0x53, 0x00, 0x00, 0x08, 0xdf, 0x5b, 0xab,
+    0x41, 0x08, 0x21, 0x54, 0xed, 0x41, 0x08, 0x21, 0x5c, 0xed, 0x3d, 0x08, 0x01, 0x00, 0xed, 0x3d, 0x08, 0x01, 0x00, 0x4a, 0x2d, 0xb5, 0x00, 0x00,
+    0x00, 0x80, 0xb5, 0x5a, 0x6b, 0x00, 0x80, 0xd6, 0x9c, 0x73, 0x00, 0x00, 0x08, 0xdf, 0x73, 0xab, 0xc1, 0x07, 0xdf, 0x73, 0xcd, 0x41, 0x08, 0x21,
+    0x84, 0xcd, 0xbd, 0xf7, 0x20, 0x00, 0xcd, 0xbd, 0xf7, 0x20, 0x00, 0x2a, 0x29, 0xb5, 0x14, 0x00, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xd6,
+    0x1a, 0x63, 0x00, 0x80, 0xf7, 0x9e, 0x6b, 0xab, 0xbd, 0xf7, 0xde, 0x73, 0xab, 0xbd, 0xf7, 0xde, 0x73, 0xcd, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0xbc,
+    0xf7, 0xde, 0x73, 0x00, 0x38, 0xd7, 0x5a, 0x6b, 0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xd6, 0x1a, 0x63, 0x00, 0x00, 0x08, 0x9f, 0x6b, 0xa8,
+    0xc1, 0x07, 0xdf, 0x73, 0xa8, 0x41, 0x08, 0xdf, 0x73, 0xe8, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0x80, 0xf7, 0xde, 0x73, 0x00, 0x80, 0xe7, 0x9c, 0x6b,
+    0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x80, 0xf7, 0x1a, 0x63, 0x00, 0x00, 0x08, 0x9f, 0x6b, 0x4a, 0xc1, 0x07, 0xdf, 0x73, 0x4a, 0x41, 0x08, 0xdf,
+    0x73, 0x4a, 0x41, 0x08, 0xdf, 0x73, 0x0a, 0x00, 0x00, 0xdf, 0x73, 0x0a, 0x00, 0x00, 0x9d, 0x73, 0x00, 0x00, 0xc6, 0x98, 0x52, 0x00, 0x80, 0xf7,
+    0x1e, 0x63, 0x00, 0x80, 0xf7, 0xde, 0x6b, 0x8b, 0xad, 0xf7, 0xde, 0x73, 0x8b, 0xb1, 0xf7, 0xde, 0x73, 0x8b, 0xb1, 0xf7, 0xde, 0x73, 0x8b, 0x01,
+    0x00, 0xde, 0x73, 0x8b, 0x01, 0x00, 0x9e, 0x73, 0x00, 0x80, 0xd6, 0x5a, 0x5b, 0x00, 0x80, 0xf7, 0x9c, 0x6b, 0x00, 0x00, 0xf7, 0x9a, 0x6b, 0xab,
+    0xbd, 0xf7, 0x9c, 0x73, 0xab, 0x39, 0xe7, 0x9c, 0x73, 0xad, 0x39, 0xe7, 0x9c, 0x73, 0xad, 0x39, 0x00, 0x80, 0x73, 0xad, 0x39, 0x00, 0x80, 0x73,
+    0x00, 0x00, 0xe7, 0x1c, 0x63, 0x00, 0x80, 0xf7, 0x1e, 0x63, 0x00, 0x00, 0x08, 0x1f, 0x63, 0xab, 0xc1, 0x07, 0x1f, 0x63, 0xab, 0x41, 0x08, 0x5f,
+    0x6b, 0xcd, 0x3d, 0x08, 0x61, 0x6b, 0xcd, 0x3d, 0x08, 0x00, 0x68, 0xcd, 0x39, 0x08, 0x00, 0x68, 0x00, 0x80, 0xd5, 0x5a, 0x53, 0x00, 0x80, 0xe6,
+    0x9c, 0x4b, 0x00, 0x00, 0x08, 0xdf, 0x53, 0xab, 0xc1, 0x07, 0xdf, 0x53, 0xab, 0x41, 0x08, 0xdf, 0x5b, 0xcd, 0xbd, 0x07, 0x21, 0x54, 0xcd, 0xbd,
+    0x07, 0x01, 0x00, 0xcd, 0x39, 0x07, 0x01, 0x00, 0x00, 0x80, 0xb5, 0x5a, 0x6b, 0x00, 0x80, 0xd6, 0x5a, 0x6b, 0x00, 0x00, 0x08, 0xdf, 0x6b, 0xab,
+    0xc1, 0x07, 0xdf, 0x73, 0xab, 0x41, 0x08, 0xdf, 0x73, 0xad, 0xbd, 0xf7, 0xde, 0x7b, 0xad, 0xbd, 0xf7, 0x1e, 0x00, 0xad, 0x35, 0xe7, 0x1e, 0x00,
+    0x00, 0x00, 0xa0, 0x94, 0x4a, 0x00, 0x00, 0xe0, 0xd8, 0x52, 0xef, 0xbd, 0xf7, 0xde, 0x73, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xee, 0xbd, 0xf7, 0xde,
+    0x7b, 0xee, 0xbd, 0xf7, 0xde, 0x7b, 0xee, 0xbd, 0xf7, 0xde, 0x7b, 0xed, 0xbd, 0xf7, 0x9c, 0x73, 0x08, 0x00, 0xa0, 0x94, 0x4a, 0x08, 0x00, 0xe0,
+    0xda, 0x52, 0x09, 0x3e, 0xf8, 0xde, 0x73, 0x08, 0x42, 0x08, 0xe1, 0x7b, 0xe9, 0x41, 0x08, 0xe1, 0x7b, 0xe8, 0x41, 0x08, 0xe1, 0x7b, 0xe9, 0xbd,
+    0xf7, 0xde, 0x7b, 0xe8, 0xbd, 0xf7, 0xde, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0xd0, 0x5a, 0x4a, 0x0e, 0x00, 0x00, 0x61, 0x53, 0xae, 0x39, 0x08, 0xe1, 0x6b, 0xce, 0x39, 0x08, 0xe1, 0x6b, 0xad, 0x35, 0x08, 0xe1,
+    0x6b, 0xad, 0x35, 0x08, 0xe1, 0x6b, 0x8c, 0x31, 0xe7, 0x9c, 0x6b, 0x8c, 0x31, 0xe7, 0x9c, 0x6b, 0x03, 0x00, 0x00, 0x00, 0x4b, 0x0d, 0x00, 0x00,
+    0x80, 0x63, 0xee, 0xbd, 0xf7, 0x9c, 0x6b, 0xee, 0xbd, 0xf7, 0x9c, 0x6b, 0xee, 0xbd, 0xf7, 0x9c, 0x6b, 0xce, 0xbd, 0xf7, 0x9c, 0x6b, 0xce, 0x39,
+    0xe7, 0x9c, 0x6b, 0xad, 0x39, 0xe7, 0x5a, 0x6b, 0x03, 0x00, 0x00, 0x00, 0x58, 0x0d, 0x00, 0x00, 0x00, 0x60, 0xee, 0x41, 0x08, 0x21, 0x63, 0xee,
+    0x41, 0x08, 0x21, 0x63, 0xee, 0x41, 0x08, 0x21, 0x63, 0xce, 0x41, 0x08, 0x21, 0x63, 0xce, 0xbd, 0xf7, 0x1e, 0x63, 0xad, 0xbd, 0xf7, 0x1e, 0x63,
+    0x03, 0x00, 0xd0, 0x00, 0x00, 0x0d, 0x00, 0xf0, 0x00, 0x00, 0xee, 0xbd, 0xf7, 0xde, 0x53, 0xee, 0x41, 0x08, 0xe1, 0x4b, 0xee, 0x41, 0x08, 0xe1,
+    0x4b, 0xce, 0x41, 0x08, 0xe1, 0x43, 0xce, 0xbd, 0xf7, 0xde, 0x4b, 0xad, 0xbd, 0xf7, 0xde, 0x43, 0x03, 0x00, 0xa0, 0x16, 0x00, 0x0d, 0x00, 0xd0,
+    0x1a, 0x00, 0xee, 0xbd, 0xf7, 0xde, 0x6b, 0xee, 0xbd, 0xf7, 0xde, 0x6b, 0xee, 0xbd, 0xf7, 0xde, 0x6b, 0xce, 0xbd, 0xf7, 0xde, 0x6b, 0xce, 0xbd,
+    0xf7, 0xde, 0x6b, 0xad, 0xb9, 0xf7, 0xde, 0x6b, 0x00, 0x00, 0x60, 0x8e, 0x39, 0x00, 0x00, 0xe0, 0xd8, 0x52, 0x00, 0xbc, 0xf7, 0xde, 0x73, 0xec,
+    0xbd, 0xf7, 0xde, 0x73, 0xec, 0xbd, 0xf7, 0xde, 0x73, 0xcc, 0xbd, 0xf7, 0xde, 0x6b, 0xcc, 0xbd, 0xf7, 0xde, 0x6b, 0xab, 0xbd, 0xf7, 0x9c, 0x6b,
+    0x00, 0x00, 0x60, 0x8e, 0x39, 0x08, 0x00, 0xe0, 0xda, 0x52, 0xe9, 0x3d, 0x08, 0xe1, 0x73, 0xe8, 0x41, 0x08, 0xe1, 0x73, 0xe9, 0x41, 0x08, 0xe1,
+    0x73, 0xc8, 0x41, 0x08, 0xe1, 0x6b, 0xc9, 0xbd, 0xf7, 0xde, 0x6b, 0xa8, 0xbd, 0xf7, 0xde, 0x6b, 0x00, 0x00, 0x60, 0x8e, 0x39, 0x0b, 0x00, 0x00,
+    0xdd, 0x52, 0x6b, 0x41, 0x08, 0xe1, 0x73, 0x6b, 0x41, 0x08, 0xe1, 0x73, 0x6b, 0x41, 0x08, 0xe1, 0x73, 0x6b, 0x41, 0x08, 0xe1, 0x6b, 0x4a, 0xbd,
+    0xf7, 0xde, 0x6b, 0x4a, 0xbd, 0xf7, 0xde, 0x6b, 0x00, 0x00, 0x60, 0x8e, 0x39, 0x0c, 0x00, 0x00, 0x61, 0x53, 0xcc, 0x31, 0x08, 0xe1, 0x73, 0xcc,
+    0x39, 0x08, 0xe1, 0x73, 0xac, 0x31, 0x08, 0xe1, 0x73, 0xac, 0x35, 0x08, 0xe1, 0x6b, 0x8c, 0xb1, 0xf7, 0xde, 0x6b, 0x8b, 0xb1, 0xf7, 0xde, 0x6b,
+    0x00, 0x00, 0x00, 0x80, 0x39, 0x0c, 0x00, 0x00, 0x80, 0x63, 0xec, 0x3d, 0x00, 0x80, 0x73, 0xec, 0xbd, 0xf7, 0x9c, 0x73, 0xec, 0xbd, 0xf7, 0x9c,
+    0x73, 0xcc, 0xbd, 0xf7, 0x9c, 0x6b, 0xcc, 0x39, 0xe7, 0x9c, 0x6b, 0xab, 0x39, 0xe7, 0x5a, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0c, 0x00, 0x00,
+    0x00, 0x68, 0xec, 0x41, 0x08, 0x00, 0x68, 0xec, 0x41, 0x08, 0x61, 0x6b, 0xec, 0x41, 0x08, 0x21, 0x63, 0xcc, 0x41, 0x08, 0x21, 0x63, 0xcc, 0xbd,
+    0xf7, 0x1e, 0x63, 0xab, 0xbd, 0xf7, 0x1e, 0x63, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x00, 0xec, 0x3d, 0x08, 0x01, 0x00, 0xec,
+    0x41, 0x08, 0x21, 0x54, 0xec, 0x41, 0x08, 0xe1, 0x53, 0xcc, 0x41, 0x08, 0xe1, 0x4b, 0xcc, 0xbd, 0xf7, 0xde, 0x4b, 0xab, 0xbd, 0xf7, 0xde, 0x43,
+    0x00, 0x00, 0x80, 0x0e, 0x00, 0x0c, 0x00, 0xd0, 0x1e, 0x00, 0xec, 0xbd, 0xf7, 0x1e, 0x00, 0xec, 0xbd, 0xf7, 0xde, 0x7b, 0xec, 0xbd, 0xf7, 0xde,
+    0x73, 0xcc, 0xbd, 0xf7, 0xde, 0x6b, 0xcc, 0xbd, 0xf7, 0xde, 0x6b, 0xab, 0xb9, 0xf7, 0xde, 0x6b, 0x01, 0x00, 0x90, 0x12, 0x42, 0x00, 0x00, 0x80,
+    0x12, 0x42, 0x00, 0xbc, 0xf7, 0xde, 0x73, 0x00, 0xbc, 0xf7, 0xde, 0x73, 0xee, 0xbd, 0xf7, 0xde, 0x73, 0xcc, 0xbd, 0xf7, 0xde, 0x73, 0xcc, 0xbd,
+    0xf7, 0xde, 0x6b, 0xab, 0xbd, 0xf7, 0x9c, 0x6b, 0x03, 0x00, 0x90, 0x12, 0x42, 0x00, 0x00, 0x80, 0x12, 0x42, 0x00, 0x00, 0xf8, 0xde, 0x73, 0x00,
+    0x00, 0xf8, 0xde, 0x73, 0x08, 0x42, 0xf8, 0xde, 0x73, 0xc8, 0xbd, 0xf7, 0xde, 0x73, 0xc8, 0xbd, 0xf7, 0xde, 0x6b, 0xa8, 0xbd, 0xf7, 0xde, 0x6b,
+    0x03, 0x00, 0x90, 0x12, 0x42, 0x02, 0x00, 0x80, 0x12, 0x42, 0x0b, 0x00, 0xf0, 0xde, 0x73, 0x0b, 0x00, 0xf0, 0xde, 0x73, 0x6b, 0xbd, 0xf7, 0xde,
+    0x73, 0x6b, 0xbd, 0xf7, 0xde, 0x73, 0x4a, 0xbd, 0xf7, 0xde, 0x6b, 0x4a, 0xbd, 0xf7, 0xde, 0x6b, 0x03, 0x00, 0x80, 0x10, 0x42, 0x02, 0x00, 0x00,
+    0x10, 0x42, 0xad, 0x01, 0x00, 0xde, 0x7b, 0xad, 0x01, 0x00, 0xde, 0x7b, 0xad, 0xb5, 0xf7, 0xde, 0x7b, 0xac, 0xb5, 0xf7, 0xde, 0x73, 0x8c, 0x31,
+    0xe7, 0x9c, 0x6b, 0x8b, 0x31, 0xe7, 0x9c, 0x6b, 0x03, 0x00, 0x80, 0x10, 0x42, 0x02, 0x00, 0x00, 0x00, 0x42, 0xee, 0x3d, 0x00, 0x80, 0x73, 0xee,
+    0x3d, 0x00, 0x80, 0x73, 0xee, 0xbd, 0xf7, 0x9c, 0x73, 0xcc, 0xbd, 0xf7, 0x9c, 0x73, 0xcc, 0x39, 0xe7, 0x9c, 0x6b, 0xab, 0x39, 0xe7, 0x5a, 0x6b,
+    0x03, 0x00, 0x90, 0x52, 0x4a, 0x02, 0x00, 0x00, 0x00, 0x48, 0xee, 0x41, 0x08, 0x00, 0x68, 0xee, 0x41, 0x08, 0x00, 0x68, 0xee, 0x41, 0x08, 0x61,
+    0x6b, 0xcc, 0x41, 0x08, 0x21, 0x63, 0xcc, 0xbd, 0xf7, 0x1e, 0x63, 0xab, 0xbd, 0xf7, 0x1e, 0x63, 0x03, 0x00, 0x90, 0x52, 0x4a, 0x02, 0x00, 0x90,
+    0x00, 0x00, 0xee, 0xbd, 0x07, 0x01, 0x00, 0xee, 0xbd, 0x07, 0x01, 0x00, 0xee, 0xbd, 0x07, 0x21, 0x54, 0xcc, 0xbd, 0xf7, 0xde, 0x53, 0xcc, 0xbd,
+    0xf7, 0xde, 0x4b, 0xab, 0xbd, 0xf7, 0xde, 0x43, 0x03, 0x00, 0x90, 0x52, 0x4a, 0x02, 0x00, 0x90, 0x12, 0x00, 0xee, 0xbd, 0xf7, 0x1e, 0x00, 0xee,
+    0xbd, 0xf7, 0x1e, 0x00, 0xee, 0xbd, 0xf7, 0xde, 0x7b, 0xcc, 0xbd, 0xf7, 0xde, 0x73, 0xcc, 0xbd, 0xf7, 0xde, 0x6b, 0xab, 0xb9, 0xf7, 0xde, 0x6b,
+    0x01, 0x00, 0x90, 0x52, 0x4a, 0x0d, 0x00, 0xb0, 0x54, 0x4a, 0x00, 0xb4, 0xb6, 0x54, 0x4a, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0xde,
+    0x7b, 0xee, 0xbd, 0xf7, 0xde, 0x7b, 0xcd, 0xbd, 0xf7, 0xde, 0x73, 0xab, 0xbd, 0xf7, 0x5c, 0x63, 0x04, 0x00, 0x90, 0x52, 0x4a, 0x07, 0x00, 0xc0,
+    0x54, 0x4a, 0x00, 0x80, 0xc6, 0x54, 0x4a, 0x00, 0x00, 0xf8, 0xde, 0x7b, 0x00, 0x00, 0xf8, 0xde, 0x7b, 0x09, 0x42, 0xf8, 0xde, 0x7b, 0xc8, 0xbd,
+    0xf7, 0xde, 0x73, 0xa8, 0xbd, 0xf7, 0x5e, 0x63, 0x03, 0x00, 0x90, 0x52, 0x4a, 0x0c, 0x00, 0xd0, 0x54, 0x4a, 0x0c, 0x00, 0xd0, 0x54, 0x4a, 0x0c,
+    0x00, 0x00, 0xdf, 0x7b, 0x0c, 0x00, 0x00, 0xdf, 0x7b, 0x8c, 0x41, 0x08, 0xdf, 0x7b, 0x4a, 0xbd, 0xf7, 0xde, 0x73, 0x4a, 0xbd, 0xf7, 0x5e, 0x63,
+    0x03, 0x00, 0xb0, 0x56, 0x4a, 0x06, 0x00, 0xc0, 0x58, 0x4a, 0xa6, 0x01, 0x00, 0x58, 0x4a, 0xac, 0x01, 0x00, 0xa0, 0x73, 0xac, 0x01, 0x00, 0xa0,
+    0x73, 0xac, 0x35, 0x08, 0xa1, 0x73, 0x8c, 0x31, 0xe7, 0x9c, 0x73, 0x8b, 0x31, 0xe7, 0x5c, 0x63, 0x03, 0x00, 0x90, 0x52, 0x4a, 0x06, 0x00, 0xd0,
+    0xd6, 0x4a, 0x86, 0x35, 0x00, 0xc0, 0x4a, 0xce, 0x41, 0x00, 0xc0, 0x63, 0xce, 0x41, 0x00, 0xc0, 0x63, 0xce, 0x41, 0x08, 0xdf, 0x63, 0xcd, 0x39,
+    0xe7, 0x18, 0x63, 0xab, 0x39, 0xe7, 0x18, 0x63, 0x03, 0x00, 0xb0, 0x16, 0x42, 0x06, 0x00, 0xd0, 0x98, 0x52, 0x86, 0x35, 0x06, 0x00, 0x50, 0xee,
+    0x3d, 0x08, 0x00, 0x68, 0xee, 0x3d, 0x08, 0x00, 0x68, 0xee, 0x3d, 0x08, 0x61, 0x6b, 0xcd, 0xbd, 0xf7, 0xde, 0x5a, 0xab, 0xbd, 0xf7, 0xde, 0x5a,
+    0x03, 0x00, 0xa0, 0x54, 0x4a, 0x06, 0x00, 0xd0, 0xd8, 0x52, 0x86, 0x35, 0xd6, 0x00, 0x00, 0xee, 0xbd, 0x07, 0x01, 0x00, 0xee, 0xbd, 0x07, 0x01,
+    0x00, 0xee, 0xbd, 0x07, 0x21, 0x54, 0xcd, 0xbd, 0xf7, 0xde, 0x4b, 0xab, 0xbd, 0xf7, 0x5e, 0x43, 0x03, 0x00, 0xa0, 0x94, 0x52, 0x06, 0x00, 0xc0,
+    0x96, 0x52, 0x86, 0x31, 0xc6, 0x16, 0x00, 0xee, 0xbd, 0xf7, 0x1e, 0x00, 0xee, 0xbd, 0xf7, 0x1e, 0x00, 0xee, 0xbd, 0xf7, 0xde, 0x7b, 0xcd, 0xbd,
+    0xf7, 0xde, 0x73, 0xab, 0xb9, 0xf7, 0x5e, 0x63, 0x01, 0x00, 0xa0, 0x94, 0x4a, 0x0d, 0x00, 0xe0, 0xd8, 0x52, 0xef, 0x3d, 0xe7, 0x5c, 0x5b, 0x00,
+    0x3c, 0xe7, 0x5c, 0x5b, 0x00, 0x3c, 0xe7, 0x9c, 0x73, 0x00, 0x3c, 0xe7, 0x9c, 0x73, 0xef, 0x3d, 0xe7, 0x9c, 0x73, 0xcd, 0x39, 0xe7, 0x9c, 0x73,
+    0x06, 0x00, 0xa0, 0x94, 0x4a, 0x0a, 0x00, 0xe0, 0xda, 0x52, 0xe9, 0xbd, 0xf7, 0x5c, 0x5b, 0x00, 0x80, 0xf7, 0x5c, 0x5b, 0x00, 0x80, 0xf7, 0x9c,
+    0x73, 0x00, 0x80, 0xf7, 0x9c, 0x73, 0xe9, 0xbd, 0xf7, 0x9c, 0x73, 0xe9, 0xbd, 0xf7, 0x9c, 0x73, 0x03, 0x00, 0xa0, 0x94, 0x4a, 0x0c, 0x00, 0xf0,
+    0xdc, 0x52, 0x8c, 0xbd, 0xf7, 0x5c, 0x5b, 0x0c, 0x00, 0xf0, 0x5c, 0x5b, 0x0c, 0x00, 0xf0, 0xde, 0x73, 0x0c, 0x00, 0xf0, 0xde, 0x73, 0x8c, 0xbd,
+    0xf7, 0xde, 0x73, 0x6b, 0xbd, 0xf7, 0xde, 0x73, 0x03, 0x00, 0xd0, 0x5a, 0x4a, 0x0d, 0x00, 0xf0, 0x5e, 0x53, 0xcd, 0xb9, 0xf7, 0xde, 0x5b, 0xcd,
+    0x01, 0x00, 0xde, 0x5b, 0xcd, 0x01, 0x00, 0xde, 0x6b, 0xcd, 0x01, 0x00, 0xde, 0x6b, 0xcd, 0xb9, 0xf7, 0xde, 0x6b, 0xad, 0xb5, 0xf7, 0xde, 0x6b,
+    0x03, 0x00, 0xc0, 0x18, 0x4b, 0x0b, 0x00, 0xf0, 0x9c, 0x63, 0xcb, 0xbd, 0xf7, 0xde, 0x73, 0xcb, 0x3d, 0x00, 0xc0, 0x73, 0xed, 0x3d, 0x00, 0xc0,
+    0x73, 0xed, 0x3d, 0x00, 0xc0, 0x6b, 0xed, 0xbd, 0xf7, 0xde, 0x6b, 0xed, 0xbd, 0xf7, 0x5a, 0x6b, 0x03, 0x00, 0xe0, 0x9c, 0x52, 0x0b, 0x00, 0xf0,
+    0x1e, 0x63, 0xcb, 0xbd, 0xf7, 0x5e, 0x6b, 0xcb, 0xbd, 0x07, 0x00, 0x68, 0xee, 0xbd, 0x07, 0x00, 0x68, 0xee, 0xbd, 0x07, 0x00, 0x68, 0xee, 0xbd,
+    0xf7, 0x5e, 0x6b, 0xed, 0xbd, 0xf7, 0x1e, 0x63, 0x03, 0x00, 0xc0, 0x18, 0x43, 0x0b, 0x00, 0xf0, 0xde, 0x53, 0xcb, 0xbd, 0xf7, 0xde, 0x53, 0xcb,
+    0x3d, 0xf7, 0x00, 0x00, 0xce, 0xbd, 0xf7, 0x00, 0x00, 0xce, 0xb9, 0xf7, 0x00, 0x00, 0xce, 0xb9, 0xf7, 0xde, 0x4b, 0xcd, 0xb9, 0xf7, 0xde, 0x53,
+    0x03, 0x00, 0xa0, 0xd6, 0x5a, 0x0b, 0x00, 0xd0, 0x5a, 0x6b, 0xcb, 0x39, 0xe7, 0x9c, 0x73, 0xcb, 0x39, 0xe7, 0x1c, 0x00, 0xce, 0x39, 0xe7, 0x1e,
+    0x00, 0xce, 0x39, 0xe7, 0x1e, 0x00, 0xce, 0x39, 0xe7, 0xde, 0x7b, 0xcd, 0x39, 0xe7, 0x9c, 0x73, 0x01, 0x00, 0xa0, 0x94, 0x4a, 0x0d, 0x00, 0xe0,
+    0xd8, 0x52, 0xed, 0xbd, 0xf7, 0xde, 0x73, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0x38,
+    0xd7, 0x5a, 0x6b, 0xce, 0x39, 0xd7, 0x5a, 0x6b, 0x08, 0x00, 0xa0, 0x94, 0x4a, 0x0a, 0x00, 0xe0, 0xda, 0x52, 0xe9, 0x41, 0x08, 0xe1, 0x73, 0x0a,
+    0x42, 0x08, 0xe1, 0x7b, 0x00, 0x00, 0x08, 0xe1, 0x7b, 0x00, 0x00, 0x08, 0xe1, 0x7b, 0x00, 0x00, 0xe7, 0x9c, 0x6b, 0xc9, 0x39, 0xe7, 0x9c, 0x6b,
+    0x03, 0x00, 0xa0, 0x94, 0x4a, 0x0c, 0x00, 0x00, 0xdd, 0x52, 0x8c, 0x41, 0x08, 0xe1, 0x73, 0x8c, 0x41, 0x08, 0x21, 0x84, 0x0c, 0x00, 0x00, 0x21,
+    0x84, 0x0c, 0x00, 0x00, 0x21, 0x84, 0x0b, 0x00, 0xe0, 0x9c, 0x73, 0x6b, 0x39, 0xe7, 0x9c, 0x73, 0x03, 0x00, 0xd0, 0x5a, 0x4a, 0x0d, 0x00, 0x00,
+    0x61, 0x53, 0xcd, 0x39, 0x08, 0x21, 0x74, 0xce, 0x39, 0x08, 0x21, 0x7c, 0xce, 0x01, 0x00, 0x20, 0x7c, 0xce, 0x01, 0x00, 0x20, 0x7c, 0xad, 0x01,
+    0x00, 0x9c, 0x73, 0xad, 0x35, 0xe7, 0x9c, 0x73, 0x03, 0x00, 0xc0, 0x18, 0x4b, 0x0d, 0x00, 0xf0, 0x9c, 0x63, 0xed, 0x41, 0x08, 0xdf, 0x73, 0x0f,
+    0x42, 0x08, 0xdf, 0x7b, 0x0f, 0x42, 0x00, 0xc0, 0x7b, 0x0f, 0x42, 0x00, 0xc0, 0x7b, 0xce, 0x39, 0x00, 0x40, 0x6b, 0xce, 0x39, 0xe7, 0x5a, 0x6b,
+    0x03, 0x00, 0xe0, 0xdc, 0x5a, 0x0d, 0x00, 0x00, 0x21, 0x63, 0xed, 0x41, 0x08, 0x61, 0x6b, 0x0f, 0x42, 0x08, 0x61, 0x6b, 0x0f, 0x42, 0x08, 0x00,
+    0x68, 0x0f, 0x42, 0x08, 0x00, 0x68, 0xce, 0x39, 0x07, 0x00, 0x60, 0xce, 0x39, 0xe7, 0x1c, 0x63, 0x03, 0x00, 0xd0, 0x5a, 0x43, 0x0d, 0x00, 0x00,
+    0x21, 0x54, 0xed, 0x3d, 0x08, 0x21, 0x4c, 0x0f, 0x42, 0x08, 0x21, 0x54, 0x0f, 0x42, 0x08, 0x01, 0x00, 0x0f, 0x42, 0x08, 0x01, 0x00, 0xcd, 0x39,
+    0xe7, 0x00, 0x00, 0xcd, 0x39, 0xe7, 0x9c, 0x53, 0x03, 0x00, 0xa0, 0xd6, 0x5a, 0x0d, 0x00, 0xd0, 0x9c, 0x73, 0xed, 0xbd, 0xf7, 0xde, 0x73, 0xef,
+    0xbd, 0x07, 0x21, 0x84, 0xef, 0xbd, 0x07, 0x21, 0x00, 0xef, 0xbd, 0x07, 0x21, 0x00, 0xad, 0xb5, 0xe6, 0x1c, 0x00, 0xad, 0xb5, 0xe6, 0x9c, 0x73,
+    0x01, 0x00, 0xa0, 0x94, 0x4a, 0x0c, 0x00, 0xe0, 0xd8, 0x52, 0xcd, 0xbd, 0xf7, 0xde, 0x6b, 0xed, 0xbd, 0xf7, 0xde, 0x73, 0xef, 0xbd, 0xf7, 0xde,
+    0x7b, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0xb0, 0xc5, 0xd6, 0x52, 0x08, 0x00, 0xa0, 0x94, 0x4a, 0x0a, 0x00, 0xe0,
+    0xda, 0x52, 0xc9, 0x41, 0x08, 0xe1, 0x6b, 0xea, 0x41, 0x08, 0xe1, 0x73, 0x09, 0x42, 0x08, 0xe1, 0x7b, 0x00, 0x00, 0x08, 0xe1, 0x7b, 0x00, 0x00,
+    0x08, 0xe1, 0x7b, 0x00, 0x00, 0xc6, 0x16, 0x5b, 0x03, 0x00, 0xa0, 0x94, 0x4a, 0x0c, 0x00, 0x00, 0xdd, 0x52, 0x6c, 0x41, 0x08, 0xe1, 0x6b, 0x8c,
+    0x41, 0x08, 0x21, 0x74, 0x8c, 0x41, 0x08, 0x21, 0x84, 0x0c, 0x00, 0x00, 0x21, 0x84, 0x0c, 0x00, 0x00, 0x21, 0x84, 0x0b, 0x00, 0xc0, 0x18, 0x5b,
+    0x03, 0x00, 0xd0, 0x5a, 0x4a, 0x0c, 0x00, 0x00, 0x61, 0x53, 0xad, 0x35, 0xf8, 0xe0, 0x6b, 0xad, 0x35, 0x08, 0x21, 0x74, 0xcd, 0x39, 0x08, 0x21,
+    0x7c, 0xcd, 0x01, 0x00, 0x20, 0x7c, 0xcd, 0x01, 0x00, 0xe0, 0x7b, 0x8c, 0x01, 0x00, 0x18, 0x63, 0x03, 0x00, 0xc0, 0x18, 0x4b, 0x0c, 0x00, 0xf0,
+    0x9c, 0x63, 0xcd, 0xbd, 0xf7, 0x9c, 0x6b, 0xed, 0xbd, 0xf7, 0x9c, 0x73, 0xef, 0x41, 0x08, 0xdf, 0x73, 0xef, 0x41, 0x00, 0xc0, 0x73, 0xef, 0x41,
+    0x00, 0xc0, 0x6b, 0x8c, 0x31, 0x00, 0x00, 0x63, 0x03, 0x00, 0xe0, 0xdc, 0x5a, 0x0c, 0x00, 0x00, 0x21, 0x63, 0xcd, 0x41, 0x08, 0x21, 0x63, 0xed,
+    0x41, 0x08, 0x21, 0x63, 0x0f, 0x42, 0x08, 0x61, 0x6b, 0x0f, 0x42, 0x08, 0x00, 0x68, 0x0f, 0x42, 0x08, 0x00, 0x68, 0x8b, 0x31, 0x06, 0x00, 0x60,
+    0x03, 0x00, 0xd0, 0x5a, 0x4b, 0x0c, 0x00, 0xf0, 0xde, 0x53, 0xcd, 0x3d, 0x08, 0xe1, 0x4b, 0xed, 0x41, 0x08, 0x21, 0x54, 0xef, 0x41, 0x08, 0x21,
+    0x4c, 0xef, 0x41, 0x08, 0x01, 0x00, 0xef, 0x41, 0x08, 0x01, 0x00, 0x8b, 0x2d, 0xc6, 0x00, 0x00, 0x03, 0x00, 0xa0, 0xd6, 0x5a, 0x0c, 0x00, 0xd0,
+    0x5a, 0x6b, 0xcd, 0xbd, 0xf7, 0xde, 0x6b, 0xed, 0xbd, 0xf7, 0xde, 0x73, 0xef, 0xbd, 0xf7, 0x20, 0x84, 0xef, 0xbd, 0xf7, 0x20, 0x00, 0xef, 0xbd,
+    0xf7, 0x20, 0x00, 0x6a, 0x2d, 0xb6, 0x18, 0x00, 0x01, 0x00, 0xa0, 0x94, 0x4a, 0x0c, 0x00, 0xe0, 0xd8, 0x52, 0xcd, 0xbd, 0xf7, 0xde, 0x6b, 0xcd,
+    0xbd, 0xf7, 0xde, 0x6b, 0xcd, 0xbd, 0xf7, 0xde, 0x6b, 0xee, 0xbd, 0xf7, 0xde, 0x73, 0x00, 0xbc, 0xf7, 0xde, 0x73, 0x00, 0xbc, 0xf7, 0x9c, 0x73,
+    0x08, 0x00, 0xa0, 0x94, 0x4a, 0x09, 0x00, 0xe0, 0xda, 0x52, 0xc9, 0xbd, 0xf7, 0xde, 0x6b, 0xc9, 0xbd, 0xf7, 0xde, 0x6b, 0xc9, 0x41, 0x08, 0xdf,
+    0x6b, 0x09, 0x42, 0x08, 0xdf, 0x73, 0x00, 0x00, 0x08, 0xdf, 0x73, 0x00, 0x00, 0xf8, 0xde, 0x73, 0x03, 0x00, 0xa0, 0x94, 0x4a, 0x0c, 0x00, 0xf0,
+    0xdc, 0x52, 0x6c, 0xbd, 0xf7, 0xde, 0x6b, 0x8c, 0x41, 0x08, 0xe1, 0x6b, 0x6b, 0x41, 0x08, 0xe1, 0x6b, 0x6b, 0x41, 0x08, 0xe1, 0x73, 0x0b, 0x00,
+    0x00, 0xe1, 0x73, 0x0b, 0x00, 0x00, 0xdf, 0x73, 0x03, 0x00, 0xd0, 0x5a, 0x4a, 0x0c, 0x00, 0x00, 0x61, 0x53, 0xad, 0x35, 0xf8, 0xe0, 0x6b, 0xad,
+    0x35, 0x08, 0xe1, 0x6b, 0xad, 0xb5, 0xf7, 0xde, 0x6b, 0xad, 0xb5, 0xf7, 0xde, 0x73, 0xad, 0x01, 0x00, 0xde, 0x73, 0xad, 0x01, 0x00, 0xde, 0x73,
+    0x03, 0x00, 0xc0, 0x18, 0x4b, 0x0c, 0x00, 0xf0, 0x9c, 0x63, 0xcd, 0x3d, 0xf7, 0x9c, 0x6b, 0xcd, 0xbd, 0xf7, 0x9c, 0x6b, 0xcd, 0xbd, 0xf7, 0x9c,
+    0x6b, 0xee, 0xbd, 0xf7, 0x9c, 0x6b, 0xee, 0x3d, 0x00, 0x40, 0x6b, 0xee, 0x3d, 0x00, 0x40, 0x6b, 0x03, 0x00, 0xe0, 0xdc, 0x5a, 0x0c, 0x00, 0x00,
+    0x21, 0x63, 0xcd, 0x41, 0x08, 0x21, 0x63, 0xcd, 0x41, 0x08, 0x21, 0x63, 0xcd, 0x41, 0x08, 0x21, 0x63, 0xee, 0x41, 0x08, 0x21, 0x63, 0xee, 0x41,
+    0x08, 0x00, 0x60, 0xee, 0x3d, 0x08, 0x00, 0x60, 0x03, 0x00, 0xd0, 0x5a, 0x4b, 0x0c, 0x00, 0xf0, 0xde, 0x4b, 0xcd, 0xbd, 0xf7, 0xde, 0x4b, 0xcd,
+    0xbd, 0xf7, 0xde, 0x53, 0xcd, 0x3d, 0x08, 0xe1, 0x4b, 0xee, 0x3d, 0x08, 0x21, 0x54, 0xee, 0x3d, 0x08, 0x01, 0x00, 0xee, 0xbd, 0x07, 0x01, 0x00,
+    0x03, 0x00, 0xa0, 0xd6, 0x5a, 0x0c, 0x00, 0xd0, 0x5a, 0x6b, 0xcd, 0xbd, 0xf7, 0xde, 0x6b, 0xcd, 0xbd, 0xf7, 0xde, 0x6b, 0xcd, 0xbd, 0xf7, 0xde,
+    0x6b, 0xce, 0xbd, 0xf7, 0xde, 0x73, 0xce, 0xbd, 0xf7, 0x1e, 0x00, 0xce, 0xb9, 0xf7, 0x1e, 0x00, 0x00, 0x00, 0x90, 0x52, 0x4a, 0x00, 0x00, 0xb0,
+    0xd6, 0x52, 0x0d, 0x00, 0xe0, 0x5c, 0x63, 0xad, 0x39, 0xe7, 0x9c, 0x63, 0xad, 0x39, 0xe7, 0x9c, 0x6b, 0xac, 0x39, 0xe7, 0x9c, 0x6b, 0x8c, 0x39,
+    0xe7, 0x9c, 0x6b, 0x8c, 0xb5, 0xd6, 0x5a, 0x63, 0x03, 0x00, 0x90, 0x52, 0x4a, 0x08, 0x00, 0xb0, 0xd6, 0x52, 0x07, 0x00, 0xf0, 0x5e, 0x63, 0xa8,
+    0xb9, 0xe7, 0x9e, 0x63, 0xa7, 0xb9, 0xf7, 0x9e, 0x6b, 0xa8, 0x39, 0xe7, 0x9c, 0x6b, 0x87, 0x39, 0xe7, 0x9c, 0x6b, 0x88, 0x39, 0xe7, 0x9c, 0x63,
+    0x03, 0x00, 0xc0, 0x98, 0x52, 0x08, 0x00, 0xf0, 0xde, 0x5a, 0x0b, 0x00, 0xf0, 0x9e, 0x6b, 0xab, 0xb9, 0xf7, 0x9e, 0x6b, 0xab, 0xb9, 0xf7, 0x9e,
+    0x6b, 0xa9, 0x39, 0xe7, 0x9c, 0x6b, 0x89, 0x39, 0xe7, 0x9c, 0x6b, 0x89, 0x39, 0xe7, 0x9c, 0x6b, 0x03, 0x00, 0xa0, 0x94, 0x4a, 0x03, 0x00, 0xf0,
+    0xde, 0x52, 0x0c, 0x00, 0xf0, 0x9e, 0x63, 0x8c, 0xb1, 0xf7, 0x9e, 0x63, 0x8c, 0xb1, 0xf7, 0x9e, 0x6b, 0x6b, 0x2d, 0xe7, 0x9c, 0x6b, 0x6b, 0x2d,
+    0xe7, 0x9c, 0x6b, 0x4a, 0x29, 0xe7, 0x5c, 0x63, 0x03, 0x00, 0x00, 0x80, 0x4a, 0x03, 0x00, 0x00, 0x40, 0x53, 0x0d, 0x00, 0xe0, 0x5a, 0x6b, 0xad,
+    0xb9, 0xe6, 0x5a, 0x6b, 0xad, 0x39, 0xe7, 0x5a, 0x6b, 0xac, 0xb5, 0xd6, 0x5a, 0x6b, 0x8c, 0xb5, 0xd6, 0x5a, 0x6b, 0x8c, 0x31, 0xd6, 0x5a, 0x63,
+    0x03, 0x00, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00, 0x00, 0x60, 0x0d, 0x00, 0xf0, 0xde, 0x62, 0xad, 0xb9, 0xf7, 0x1e, 0x63, 0xad, 0xb9, 0xf7, 0xde,
+    0x62, 0xac, 0x39, 0xe7, 0x1c, 0x63, 0x8c, 0x39, 0xe7, 0xdc, 0x62, 0x8c, 0x39, 0xe7, 0x1c, 0x63, 0x03, 0x00, 0xc0, 0x00, 0x00, 0x03, 0x00, 0xe0,
+    0x00, 0x00, 0x0d, 0x00, 0xf0, 0x9e, 0x53, 0xad, 0xb9, 0xe7, 0x9e, 0x4b, 0xad, 0xb9, 0xf7, 0x9e, 0x4b, 0xac, 0x39, 0xe7, 0x9c, 0x43, 0x8c, 0x39,
+    0xe7, 0x9c, 0x4b, 0x8c, 0x39, 0xe7, 0x9c, 0x43, 0x03, 0x00, 0xa0, 0x16, 0x00, 0x03, 0x00, 0xb0, 0x18, 0x00, 0x0d, 0x00, 0xf0, 0x9e, 0x6b, 0xad,
+    0xb9, 0xe7, 0x9e, 0x6b, 0xad, 0xb9, 0xf7, 0x9e, 0x6b, 0xac, 0x39, 0xe7, 0x9c, 0x6b, 0x8c, 0x39, 0xe7, 0x9c, 0x6b, 0x8c, 0x35, 0xe7, 0x9c, 0x6b,
+    0x00, 0x00, 0x90, 0x52, 0x4a, 0x00, 0x00, 0xb0, 0xd6, 0x52, 0x00, 0x00, 0xf0, 0x5c, 0x63, 0xce, 0x3d, 0xf7, 0x9c, 0x73, 0xce, 0xbd, 0xf7, 0x9c,
+    0x73, 0xcc, 0x39, 0xe7, 0x9c, 0x73, 0xcc, 0x39, 0xe7, 0x9c, 0x73, 0xcc, 0x39, 0xd7, 0x5a, 0x6b, 0x00, 0x00, 0x90, 0x52, 0x4a, 0x08, 0x00, 0xb0,
+    0xd6, 0x52, 0x07, 0x00, 0xf0, 0x5e, 0x63, 0xe8, 0xbd, 0xf7, 0x9e, 0x73, 0xe7, 0xbd, 0xf7, 0x9e, 0x73, 0xc8, 0x39, 0xe7, 0x9c, 0x73, 0xc7, 0x39,
+    0xe7, 0x9c, 0x73, 0xc8, 0x39, 0xe7, 0x9c, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x60, 0x8c, 0x31, 0x03, 0x00, 0xf0, 0xde, 0x52, 0x0c, 0x00, 0xf0, 0x9e, 0x63, 0x8c, 0xb1, 0xf7, 0x9e, 0x6b, 0x8c, 0xb1, 0xf7, 0x9e,
+    0x6b, 0x6b, 0x2d, 0xe7, 0x9c, 0x6b, 0x6b, 0x2d, 0xe7, 0x9c, 0x6b, 0x4a, 0x29, 0xe7, 0x5c, 0x63, 0x03, 0x00, 0x00, 0x80, 0x39, 0x03, 0x00, 0x00,
+    0x40, 0x53, 0x0d, 0x00, 0x00, 0x40, 0x6b, 0xad, 0xb9, 0xe6, 0x5a, 0x6b, 0xad, 0x39, 0xe7, 0x5a, 0x6b, 0xac, 0xb5, 0xd6, 0x5a, 0x6b, 0x8c, 0xb5,
+    0xd6, 0x5a, 0x6b, 0x8c, 0x31, 0xd6, 0x5a, 0x63, 0x03, 0x00, 0x00, 0x00, 0x38, 0x03, 0x00, 0x00, 0x00, 0x60, 0x0d, 0x00, 0x00, 0x00, 0x60, 0xad,
+    0x39, 0x08, 0x21, 0x63, 0xad, 0xb9, 0xf7, 0x1e, 0x63, 0xac, 0x39, 0xe7, 0x1c, 0x63, 0x8c, 0x39, 0xe7, 0xdc, 0x62, 0x8c, 0x39, 0xe7, 0x1c, 0x63,
+    0x03, 0x00, 0x70, 0x00, 0x00, 0x03, 0x00, 0xf0, 0x00, 0x00, 0x0d, 0x00, 0xf0, 0x00, 0x00, 0xad, 0xb9, 0xf7, 0xde, 0x4b, 0xad, 0xb9, 0xf7, 0x9e,
+    0x53, 0xac, 0x39, 0xe7, 0x9c, 0x4b, 0x8c, 0x39, 0xe7, 0x9c, 0x4b, 0x8c, 0x39, 0xe7, 0x9c, 0x43, 0x03, 0x00, 0x70, 0x0e, 0x00, 0x03, 0x00, 0xb0,
+    0x1a, 0x00, 0x0d, 0x00, 0xf0, 0x1e, 0x00, 0xad, 0xb9, 0xe7, 0x9e, 0x6b, 0xad, 0xb9, 0xf7, 0x9e, 0x6b, 0xac, 0x39, 0xe7, 0x9c, 0x6b, 0x8c, 0x39,
+    0xe7, 0x9c, 0x6b, 0x8c, 0x35, 0xe7, 0x9c, 0x6b, 0x01, 0x00, 0x80, 0x10, 0x42, 0x00, 0x00, 0x80, 0x10, 0x42, 0x00, 0x00, 0xf0, 0x5c, 0x63, 0x00,
+    0x3c, 0xf7, 0x9c, 0x73, 0xab, 0xbd, 0xf7, 0x9c, 0x73, 0xab, 0x39, 0xe7, 0x9c, 0x73, 0x8a, 0x39, 0xe7, 0x9c, 0x6b, 0x8a, 0xb5, 0xd6, 0x5a, 0x6b,
+    0x03, 0x00, 0x80, 0x10, 0x42, 0x02, 0x00, 0x80, 0x10, 0x42, 0x07, 0x00, 0xf0, 0x5e, 0x63, 0xa8, 0xbd, 0xf7, 0x9e, 0x73, 0xa7, 0xbd, 0xf7, 0x9e,
+    0x73, 0xa8, 0xbd, 0xf7, 0x9c, 0x73, 0x87, 0x39, 0xe7, 0x9c, 0x6b, 0x88, 0x39, 0xe7, 0x9c, 0x6b, 0x03, 0x00, 0x80, 0x10, 0x42, 0x02, 0x00, 0x80,
+    0x10, 0x42, 0x0a, 0x00, 0xf0, 0x5e, 0x63, 0x2a, 0xbd, 0xf7, 0x9e, 0x73, 0x4a, 0xbd, 0xf7, 0x9e, 0x73, 0x29, 0xbd, 0xf7, 0x9e, 0x73, 0x29, 0x39,
+    0xe7, 0x9c, 0x6b, 0x29, 0x39, 0xe7, 0x9c, 0x6b, 0x03, 0x00, 0x90, 0x12, 0x42, 0x02, 0x00, 0x70, 0xd2, 0x41, 0x0a, 0x00, 0xf0, 0x9e, 0x63, 0x8b,
+    0xad, 0xf7, 0x9e, 0x73, 0x8b, 0xb1, 0xf7, 0x9e, 0x73, 0x6b, 0xad, 0xf7, 0x9e, 0x73, 0x6a, 0x2d, 0xe7, 0x9c, 0x6b, 0x4a, 0x29, 0xe7, 0x9c, 0x6b,
+    0x03, 0x00, 0x80, 0x10, 0x42, 0x02, 0x00, 0x00, 0x00, 0x42, 0x0a, 0x00, 0x00, 0x40, 0x6b, 0xab, 0x39, 0x00, 0x40, 0x6b, 0xab, 0x39, 0xe7, 0x5a,
+    0x6b, 0xab, 0xb5, 0xd6, 0x5a, 0x6b, 0x8a, 0xb5, 0xd6, 0x5a, 0x6b, 0x8a, 0x31, 0xd6, 0x5a, 0x6b, 0x03, 0x00, 0x80, 0x10, 0x42, 0x02, 0x00, 0x00,
+    0x00, 0x40, 0x0a, 0x00, 0x00, 0x00, 0x68, 0xab, 0x3d, 0x08, 0x00, 0x68, 0xab, 0x3d, 0x08, 0x61, 0x6b, 0xab, 0x39, 0xe7, 0x1c, 0x63, 0x8a, 0x39,
+    0xe7, 0x1c, 0x63, 0x8a, 0x39, 0xe7, 0x1c, 0x63, 0x03, 0x00, 0x90, 0x52, 0x4a, 0x02, 0x00, 0x90, 0x00, 0x00, 0x0a, 0x00, 0xf0, 0x00, 0x00, 0xab,
+    0xbd, 0xf7, 0x00, 0x00, 0xab, 0xbd, 0xf7, 0xde, 0x53, 0xab, 0x39, 0xe7, 0x9c, 0x4b, 0x8a, 0x39, 0xe7, 0x9c, 0x4b, 0x8a, 0x39, 0xe7, 0x9c, 0x43,
+    0x03, 0x00, 0x90, 0x52, 0x4a, 0x02, 0x00, 0x90, 0x12, 0x00, 0x0a, 0x00, 0xf0, 0x1e, 0x00, 0xab, 0xbd, 0xf7, 0x1e, 0x00, 0xab, 0xbd, 0xf7, 0x9e,
+    0x73, 0xab, 0x39, 0xe7, 0x9c, 0x73, 0x8a, 0x39, 0xe7, 0x9c, 0x6b, 0x8a, 0x35, 0xe7, 0x9c, 0x6b, 0x01, 0x00, 0x90, 0x52, 0x4a, 0x01, 0x00, 0xa0,
+    0x54, 0x4a, 0x00, 0x00, 0x90, 0x54, 0x4a, 0x00, 0x38, 0xe7, 0x9c, 0x6b, 0x00, 0x38, 0xe7, 0x9c, 0x6b, 0xcc, 0x39, 0xe7, 0x9c, 0x6b, 0x8a, 0x39,
+    0xe7, 0x5c, 0x6b, 0x8a, 0xb5, 0xd6, 0x5a, 0x63, 0x02, 0x00, 0x90, 0x52, 0x4a, 0x03, 0x00, 0xa0, 0x54, 0x4a, 0x00, 0x00, 0x90, 0x54, 0x4a, 0x00,
+    0x00, 0xe7, 0x9c, 0x6b, 0x00, 0x00, 0xe7, 0x9c, 0x6b, 0xc7, 0x39, 0xe7, 0x9c, 0x6b, 0x87, 0x39, 0xe7, 0x5c, 0x6b, 0x87, 0x39, 0xe7, 0x5c, 0x63,
+    0x02, 0x00, 0x90, 0x52, 0x4a, 0x03, 0x00, 0xa0, 0x54, 0x4a, 0x02, 0x00, 0x90, 0x54, 0x4a, 0x09, 0x00, 0xe0, 0x9c, 0x6b, 0x09, 0x00, 0xe0, 0x9c,
+    0x6b, 0x29, 0x39, 0xe7, 0x9c, 0x6b, 0x29, 0x39, 0xe7, 0x5c, 0x6b, 0x09, 0x39, 0xe7, 0x5c, 0x63, 0x02, 0x00, 0x90, 0x52, 0x42, 0x03, 0x00, 0xa0,
+    0x54, 0x4a, 0x02, 0x00, 0x00, 0x54, 0x4a, 0x6b, 0x01, 0x00, 0x5a, 0x6b, 0x6b, 0x01, 0x00, 0x5a, 0x6b, 0x6b, 0xad, 0xd6, 0x5a, 0x6b, 0x6a, 0xad,
+    0xd6, 0x5a, 0x6b, 0x4a, 0xa9, 0xd6, 0x5a, 0x63, 0x02, 0x00, 0x90, 0x52, 0x4a, 0x03, 0x00, 0x90, 0x52, 0x4a, 0x02, 0x00, 0x00, 0x40, 0x4a, 0xac,
+    0x35, 0x00, 0x00, 0x63, 0xac, 0x35, 0x00, 0x00, 0x63, 0xac, 0xb5, 0xd6, 0x18, 0x63, 0x8a, 0xb5, 0xd6, 0x18, 0x63, 0x8a, 0x31, 0xc6, 0x18, 0x63,
+    0x02, 0x00, 0xa0, 0x14, 0x42, 0x03, 0x00, 0xa0, 0x94, 0x52, 0x02, 0x00, 0x00, 0x00, 0x50, 0xcc, 0xb9, 0x07, 0x00, 0x60, 0xcc, 0xb9, 0x07, 0x00,
+    0x60, 0xcc, 0xb9, 0xf7, 0x1e, 0x63, 0x8a, 0x39, 0xe7, 0xdc, 0x5a, 0x8a, 0x39, 0xe7, 0xdc, 0x5a, 0x02, 0x00, 0xa0, 0x54, 0x4a, 0x03, 0x00, 0xb0,
+    0xd6, 0x4a, 0x02, 0x00, 0xb0, 0x00, 0x00, 0xcc, 0x39, 0xe7, 0x00, 0x00, 0xcc, 0x39, 0xe7, 0x00, 0x00, 0xcc, 0x39, 0xe7, 0x9c, 0x53, 0x8a, 0x39,
+    0xe7, 0x5c, 0x4b, 0x8a, 0x39, 0xe7, 0x5c, 0x43, 0x02, 0x00, 0xa0, 0x94, 0x52, 0x03, 0x00, 0xa0, 0x94, 0x52, 0x02, 0x00, 0xa0, 0x14, 0x00, 0xcc,
+    0x39, 0xe7, 0x1c, 0x00, 0xcc, 0x39, 0xe7, 0x1c, 0x00, 0xcc, 0x39, 0xe7, 0x9c, 0x6b, 0x8a, 0x39, 0xe7, 0x5c, 0x6b, 0x8a, 0x35, 0xe7, 0x5c, 0x63,
+    0x01, 0x00, 0x90, 0x52, 0x4a, 0x01, 0x00, 0xb0, 0xd6, 0x52, 0x0d, 0x00, 0xd0, 0xd8, 0x5a, 0x00, 0xb4, 0xd7, 0xd8, 0x5a, 0x00, 0xbc, 0xd7, 0x5a,
+    0x6b, 0x00, 0xb4, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xab, 0xb5, 0xd6, 0x5a, 0x6b, 0x02, 0x00, 0x90, 0x52, 0x4a, 0x05, 0x00, 0xb0,
+    0xd6, 0x52, 0x09, 0x00, 0xe0, 0xd8, 0x5a, 0x00, 0x00, 0xe7, 0xd8, 0x5a, 0x00, 0x00, 0xe7, 0x5a, 0x6b, 0x00, 0x00, 0xd7, 0x5a, 0x6b, 0xc8, 0x39,
+    0xd7, 0x5a, 0x6b, 0xa7, 0xb5, 0xd6, 0x5a, 0x6b, 0x02, 0x00, 0x90, 0x52, 0x4a, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x0a, 0x00, 0xf0, 0xd8, 0x5a, 0x0a,
+    0x00, 0xf0, 0xd8, 0x5a, 0x0a, 0x00, 0xf0, 0x5c, 0x6b, 0x0a, 0x00, 0xe0, 0x5c, 0x6b, 0x4a, 0x39, 0xe7, 0x5c, 0x6b, 0x29, 0x39, 0xe7, 0x5c, 0x6b,
+    0x02, 0x00, 0xa0, 0x94, 0x4a, 0x03, 0x00, 0xd0, 0xda, 0x52, 0x08, 0x00, 0xe0, 0xdc, 0x5a, 0x88, 0x01, 0x00, 0xdc, 0x5a, 0x8a, 0x01, 0x00, 0x5c,
+    0x6b, 0x8a, 0x01, 0x00, 0x5c, 0x6b, 0x8a, 0x31, 0xe7, 0x5c, 0x6b, 0x4a, 0xa9, 0xd6, 0x5a, 0x6b, 0x02, 0x00, 0xa0, 0x94, 0x4a, 0x03, 0x00, 0xb0,
+    0xd6, 0x52, 0x08, 0x00, 0xe0, 0x5a, 0x5b, 0xc8, 0x39, 0x00, 0x40, 0x5b, 0xcc, 0x39, 0x00, 0x40, 0x5b, 0x8c, 0x39, 0x00, 0x40, 0x5b, 0x8c, 0x39,
+    0xe7, 0x5a, 0x5b, 0x8b, 0x31, 0xc6, 0xd6, 0x5a, 0x02, 0x00, 0xb0, 0x96, 0x52, 0x03, 0x00, 0xd0, 0xda, 0x5a, 0x08, 0x00, 0xf0, 0x1c, 0x63, 0xc8,
+    0x3d, 0x07, 0x00, 0x60, 0xcd, 0xbd, 0x07, 0x00, 0x68, 0xad, 0x39, 0x07, 0x00, 0x68, 0xad, 0x39, 0xe7, 0x5c, 0x6b, 0xab, 0x39, 0xe7, 0x9c, 0x52,
+    0x02, 0x00, 0xc0, 0x18, 0x43, 0x03, 0x00, 0xc0, 0x18, 0x4b, 0x08, 0x00, 0xf0, 0x5c, 0x53, 0xc8, 0x3d, 0xf7, 0x00, 0x00, 0xcd, 0xbd, 0xf7, 0x00,
+    0x00, 0xad, 0x35, 0xe7, 0x00, 0x00, 0xad, 0x35, 0xe7, 0x9c, 0x4b, 0xab, 0x35, 0xe7, 0x9c, 0x53, 0x02, 0x00, 0xa0, 0xd6, 0x5a, 0x03, 0x00, 0xb0,
+    0x18, 0x63, 0x08, 0x00, 0xe0, 0x1a, 0x63, 0xc8, 0x39, 0xe7, 0x1a, 0x00, 0xcd, 0x39, 0xe7, 0x1c, 0x00, 0xad, 0xb5, 0xd6, 0x1c, 0x00, 0xad, 0xb5,
+    0xd6, 0x9c, 0x73, 0xab, 0xb5, 0xd6, 0x5a, 0x6b, 0x01, 0x00, 0x90, 0x52, 0x4a, 0x01, 0x00, 0xb0, 0xd6, 0x52, 0x0c, 0x00, 0xf0, 0x5c, 0x63, 0xce,
+    0x3d, 0xf7, 0x9c, 0x73, 0x00, 0xbc, 0xf7, 0x9c, 0x73, 0x00, 0x38, 0xe7, 0x9c, 0x73, 0x00, 0x34, 0xc6, 0x18, 0x63, 0xad, 0x35, 0xc6, 0x18, 0x63,
+    0x02, 0x00, 0x90, 0x52, 0x4a, 0x07, 0x00, 0xb0, 0xd6, 0x52, 0x09, 0x00, 0xf0, 0x5e, 0x63, 0xe8, 0xbd, 0xf7, 0x9e, 0x73, 0x00, 0x80, 0xf7, 0x9e,
+    0x73, 0x00, 0x80, 0xe7, 0x9c, 0x73, 0x00, 0x80, 0xd6, 0x1a, 0x63, 0xa8, 0xb5, 0xd6, 0x1a, 0x63, 0x02, 0x00, 0x90, 0x52, 0x4a, 0x03, 0x00, 0xb0,
+    0xd6, 0x52, 0x0a, 0x00, 0xf0, 0x5e, 0x63, 0x6b, 0x41, 0x08, 0xdf, 0x73, 0x0b, 0x00, 0x00, 0xdf, 0x73, 0x0b, 0x00, 0x00, 0xdf, 0x73, 0x0a, 0x00,
+    0xd0, 0x5a, 0x63, 0x4a, 0xb5, 0xd6, 0x5a, 0x63, 0x02, 0x00, 0xa0, 0x94, 0x4a, 0x03, 0x00, 0xf0, 0xde, 0x52, 0x0c, 0x00, 0xf0, 0x9e, 0x63, 0xac,
+    0x35, 0x08, 0xa1, 0x73, 0xac, 0x01, 0x00, 0xa0, 0x73, 0xab, 0x01, 0x00, 0xa0, 0x73, 0x8b, 0x01, 0x00, 0x5a, 0x63, 0x8b, 0xb1, 0xd6, 0x5a, 0x63,
+    0x02, 0x00, 0xa0, 0x94, 0x4a, 0x03, 0x00, 0xd0, 0x5a, 0x53, 0x0c, 0x00, 0xe0, 0x5a, 0x6b, 0xcd, 0xbd, 0xf7, 0x9c, 0x6b, 0xcd, 0x3d, 0x00, 0x80,
+    0x6b, 0xad, 0x3d, 0x00, 0x80, 0x6b, 0xac, 0x35, 0x00, 0x40, 0x63, 0xac, 0xb5, 0xd6, 0x5a, 0x63, 0x02, 0x00, 0xb0, 0x96, 0x52, 0x03, 0x00, 0xf0,
+    0xde, 0x5a, 0x0c, 0x00, 0x00, 0x61, 0x6b, 0xee, 0x3d, 0x08, 0x61, 0x6b, 0xee, 0x3d, 0x08, 0x00, 0x68, 0xee, 0x3d, 0x08, 0x00, 0x68, 0xac, 0xb5,
+    0x06, 0x00, 0x60, 0xac, 0xb5, 0xd6, 0x1a, 0x63, 0x02, 0x00, 0xc0, 0x18, 0x43, 0x03, 0x00, 0xe0, 0x9c, 0x4b, 0x0c, 0x00, 0xf0, 0xde, 0x4b, 0xce,
+    0xbd, 0xf7, 0xde, 0x53, 0xce, 0xbd, 0xf7, 0x00, 0x00, 0xce, 0xbd, 0xf7, 0x00, 0x00, 0x8c, 0xb5, 0xd6, 0x00, 0x00, 0x8c, 0xb5, 0xd6, 0x5a, 0x53,
+    0x02, 0x00, 0xa0, 0xd6, 0x5a, 0x03, 0x00, 0xb0, 0x5a, 0x6b, 0x0c, 0x00, 0xf0, 0x9e, 0x73, 0xce, 0xbd, 0xf7, 0xde, 0x7b, 0xce, 0xbd, 0xf7, 0x1e,
+    0x00, 0xce, 0x39, 0xe7, 0x1e, 0x00, 0x8c, 0x31, 0xd6, 0x1a, 0x00, 0x8c, 0x31, 0xd6, 0x5a, 0x6b, 0x01, 0x00, 0x90, 0x52, 0x4a, 0x01, 0x00, 0xb0,
+    0xd6, 0x52, 0x0b, 0x00, 0xf0, 0x5c, 0x63, 0xab, 0x3d, 0xf7, 0x9c, 0x73, 0xcd, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x38, 0xe7, 0x9c, 0x73, 0x00, 0x38,
+    0xe7, 0x9c, 0x73, 0x00, 0xa8, 0xa5, 0x54, 0x52, 0x02, 0x00, 0x90, 0x52, 0x4a, 0x08, 0x00, 0xb0, 0xd6, 0x52, 0x09, 0x00, 0xf0, 0x5e, 0x63, 0xa8,
+    0xbd, 0xf7, 0x9e, 0x73, 0xe9, 0xbd, 0xf7, 0x9e, 0x73, 0x00, 0x80, 0xf7, 0x9c, 0x73, 0x00, 0x80, 0xf7, 0x9c, 0x73, 0x00, 0x80, 0xa5, 0x96, 0x52,
+    0x02, 0x00, 0x90, 0x52, 0x4a, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x0a, 0x00, 0xf0, 0x5e, 0x63, 0x4a, 0xbd, 0xf7, 0x9e, 0x73, 0x4a, 0xbd, 0xf7, 0xde,
+    0x73, 0x0a, 0x00, 0xf0, 0xde, 0x73, 0x0a, 0x00, 0xf0, 0xde, 0x73, 0x09, 0x00, 0xb0, 0x96, 0x52, 0x02, 0x00, 0xa0, 0x94, 0x4a, 0x03, 0x00, 0xf0,
+    0xde, 0x52, 0x0b, 0x00, 0xf0, 0x9e, 0x63, 0x8b, 0xb1, 0xf7, 0x9e, 0x73, 0x8c, 0xb1, 0xf7, 0x9e, 0x73, 0x8c, 0x01, 0x00, 0x9c, 0x73, 0x8c, 0x01,
+    0x00, 0x9c, 0x73, 0x6a, 0x01, 0x00, 0xd6, 0x52, 0x02, 0x00, 0xa0, 0x94, 0x4a, 0x03, 0x00, 0xd0, 0x5a, 0x53, 0x0b, 0x00, 0xe0, 0x5a, 0x6b, 0xab,
+    0x39, 0xe7, 0x5a, 0x6b, 0xcd, 0x39, 0xe7, 0x5a, 0x6b, 0xcd, 0x39, 0x00, 0x40, 0x6b, 0xcd, 0x39, 0x00, 0x40, 0x6b, 0x6a, 0x2d, 0x00, 0xc0, 0x52,
+    0x02, 0x00, 0xb0, 0x96, 0x52, 0x03, 0x00, 0xf0, 0x1e, 0x63, 0x0b, 0x00, 0xf0, 0xde, 0x62, 0xab, 0xbd, 0xf7, 0x1e, 0x63, 0xed, 0xbd, 0xf7, 0x5e,
+    0x6b, 0xed, 0xbd, 0x07, 0x00, 0x68, 0xed, 0xbd, 0x07, 0x00, 0x68, 0x4a, 0xad, 0x05, 0x00, 0x50, 0x02, 0x00, 0xc0, 0x18, 0x43, 0x03, 0x00, 0xe0,
+    0x9c, 0x4b, 0x0b, 0x00, 0xf0, 0x9e, 0x4b, 0xab, 0xbd, 0xf7, 0x9e, 0x53, 0xcd, 0xbd, 0xf7, 0xde, 0x4b, 0xcd, 0xbd, 0xf7, 0x00, 0x00, 0xcd, 0xbd,
+    0xf7, 0x00, 0x00, 0x4a, 0x2d, 0xb5, 0x00, 0x00, 0x02, 0x00, 0xa0, 0xd6, 0x5a, 0x03, 0x00, 0xb0, 0x18, 0x63, 0x0b, 0x00, 0xf0, 0x9e, 0x6b, 0xab,
+    0xbd, 0xf7, 0x9e, 0x73, 0xcd, 0xbd, 0xf7, 0x9e, 0x73, 0xcd, 0x39, 0xe7, 0x1c, 0x00, 0xcd, 0x39, 0xe7, 0x1c, 0x00, 0x2a, 0x29, 0xb5, 0x14, 0x00,
+    0x01, 0x00, 0x90, 0x52, 0x4a, 0x01, 0x00, 0xb0, 0xd6, 0x52, 0x0b, 0x00, 0xe0, 0x5c, 0x63, 0xab, 0x39, 0xe7, 0x9c, 0x63, 0xab, 0x39, 0xe7, 0x9c,
+    0x6b, 0xcd, 0x39, 0xe7, 0x9c, 0x6b, 0x00, 0x38, 0xe7, 0x9c, 0x6b, 0x00, 0x38, 0xd7, 0x5a, 0x6b, 0x02, 0x00, 0x90, 0x52, 0x4a, 0x08, 0x00, 0xb0,
+    0xd6, 0x52, 0x08, 0x00, 0xf0, 0x5e, 0x63, 0xa8, 0xb9, 0xe7, 0x9e, 0x63, 0xa8, 0xb9, 0xf7, 0x9e, 0x6b, 0xe8, 0xbd, 0xe7, 0x9c, 0x6b, 0x00, 0x80,
+    0xe7, 0x9c, 0x6b, 0x00, 0x80, 0xe7, 0x9c, 0x6b, 0x02, 0x00, 0x90, 0x52, 0x4a, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x0a, 0x00, 0xf0, 0x5e, 0x63, 0x4a,
+    0xb9, 0xe7, 0x9e, 0x63, 0x4a, 0xbd, 0xf7, 0x9e, 0x6b, 0x4a, 0xbd, 0xf7, 0x9e, 0x73, 0x0a, 0x00, 0xf0, 0x9e, 0x73, 0x0a, 0x00, 0xf0, 0x9c, 0x73,
+    0x02, 0x00, 0xa0, 0x94, 0x4a, 0x03, 0x00, 0xf0, 0xde, 0x52, 0x0b, 0x00, 0xf0, 0x9e, 0x63, 0x8b, 0xad, 0xf7, 0x9e, 0x63, 0x8b, 0xb1, 0xf7, 0x9e,
+    0x6b, 0x8b, 0x31, 0xe7, 0x9c, 0x73, 0x8b, 0x01, 0x00, 0x9c, 0x73, 0x8b, 0x01, 0x00, 0x9c, 0x73, 0x02, 0x00, 0xa0, 0x94, 0x4a, 0x03, 0x00, 0xd0,
+    0x5a, 0x53, 0x0b, 0x00, 0xe0, 0x5a, 0x6b, 0xab, 0xb9, 0xe6, 0x5a, 0x6b, 0xab, 0x39, 0xe7, 0x5a, 0x6b, 0xad, 0x39, 0xe7, 0x5a, 0x6b, 0xad, 0x39,
+    0x00, 0x40, 0x6b, 0xad, 0x39, 0x00, 0x40, 0x63, 0x02, 0x00, 0xb0, 0x96, 0x52, 0x03, 0x00, 0xf0, 0x1e, 0x63, 0x0b, 0x00, 0xf0, 0xde, 0x62, 0xab,
+    0xb9, 0xf7, 0x1e, 0x63, 0xab, 0xbd, 0xf7, 0xde, 0x62, 0xcd, 0xbd, 0xf7, 0x1e, 0x63, 0xcd, 0xbd, 0x07, 0x00, 0x60, 0xcd, 0xb9, 0x07, 0x00, 0x60,
+    0x02, 0x00, 0xc0, 0x18, 0x43, 0x03, 0x00, 0xe0, 0x9c, 0x4b, 0x0b, 0x00, 0xf0, 0x9e, 0x43, 0xab, 0xb9, 0xe7, 0x9e, 0x4b, 0xab, 0xb9, 0xf7, 0x9e,
+    0x4b, 0xcd, 0xb9, 0xf7, 0xde, 0x53, 0xcd, 0xb9, 0xf7, 0x00, 0x00, 0xcd, 0x39, 0xf7, 0x00, 0x00, 0x02, 0x00, 0xa0, 0xd6, 0x5a, 0x03, 0x00, 0xb0,
+    0x18, 0x63, 0x0b, 0x00, 0xf0, 0x9e, 0x6b, 0xab, 0xb9, 0xe7, 0x9e, 0x6b, 0xab, 0xb9, 0xf7, 0x9e, 0x6b, 0xad, 0x39, 0xe7, 0x9c, 0x73, 0xad, 0x39,
+    0xe7, 0x1c, 0x00, 0xad, 0x35, 0xe7, 0x1c, 0x00, 0x00, 0x84, 0xb5, 0x96, 0x52, 0x00, 0x00, 0xb0, 0xd6, 0x52, 0x01, 0x00, 0xd0, 0x5a, 0x63, 0x0b,
+    0x00, 0xe0, 0x5c, 0x63, 0x6b, 0x35, 0xd7, 0x5c, 0x63, 0x6b, 0x35, 0xe7, 0x5c, 0x63, 0x6a, 0xb5, 0xd6, 0x5a, 0x63, 0x4a, 0x31, 0xc6, 0x18, 0x63,
+    0x00, 0x80, 0xb5, 0x96, 0x52, 0x00, 0x00, 0xb0, 0xd6, 0x52, 0x07, 0x00, 0xd0, 0x5a, 0x63, 0x06, 0x00, 0xe0, 0x5c, 0x63, 0x67, 0x35, 0xd7, 0x5c,
+    0x63, 0x66, 0x35, 0xe7, 0x5c, 0x63, 0x67, 0xb5, 0xd6, 0x5a, 0x63, 0x46, 0xb1, 0xd6, 0x1a, 0x63, 0x03, 0x00, 0xc0, 0x98, 0x52, 0x02, 0x00, 0xe0,
+    0xdc, 0x5a, 0x07, 0x00, 0xe0, 0x5c, 0x63, 0x09, 0x00, 0xe0, 0x5c, 0x63, 0x69, 0x35, 0xe7, 0x5c, 0x63, 0x69, 0x35, 0xe7, 0x5c, 0x63, 0x68, 0xb5,
+    0xd6, 0x5a, 0x63, 0x48, 0xb1, 0xd6, 0x5a, 0x63, 0x63, 0x00, 0x00, 0x52, 0x4a, 0x02, 0x00, 0x00, 0x18, 0x53, 0x03, 0x00, 0xe0, 0x5c, 0x63, 0x0a,
+    0x00, 0xe0, 0x5c, 0x63, 0x4a, 0x29, 0xe7, 0x5c, 0x63, 0x4a, 0x29, 0xe7, 0x5c, 0x63, 0x29, 0xa5, 0xd6, 0x5a, 0x63, 0x29, 0xa5, 0xd6, 0x5a, 0x63,
+    0x63, 0x04, 0x00, 0x80, 0x4a, 0x02, 0x00, 0x00, 0x00, 0x53, 0x03, 0x00, 0xd0, 0x5a, 0x63, 0x0b, 0x00, 0xd0, 0x58, 0x63, 0x6b, 0xb1, 0xd5, 0x5a,
+    0x63, 0x6b, 0x31, 0xd6, 0x58, 0x63, 0x6a, 0xad, 0xd5, 0x5a, 0x63, 0x4a, 0xad, 0xc5, 0x18, 0x63, 0x63, 0x84, 0x05, 0x00, 0x58, 0x02, 0x00, 0x00,
+    0x00, 0x58, 0x03, 0x00, 0xe0, 0xdc, 0x5a, 0x0b, 0x00, 0xe0, 0xdc, 0x5a, 0x6b, 0x35, 0xe7, 0xdc, 0x5a, 0x6b, 0x35, 0xe7, 0xdc, 0x5a, 0x6a, 0x35,
+    0xd7, 0xdc, 0x5a, 0x4a, 0x31, 0xe7, 0x9c, 0x5a, 0x63, 0x04, 0xc5, 0x00, 0x00, 0x02, 0x00, 0xc0, 0x00, 0x00, 0x03, 0x00, 0xe0, 0x5c, 0x53, 0x0b,
+    0x00, 0xe0, 0x5c, 0x4b, 0x6b, 0x35, 0xe7, 0x5c, 0x4b, 0x6b, 0x35, 0xe7, 0x5c, 0x43, 0x6a, 0xb5, 0xd6, 0x5a, 0x4b, 0x4a, 0xb1, 0xd6, 0x5a, 0x43,
+    0x63, 0x04, 0xa5, 0x16, 0x00, 0x02, 0x00, 0xb0, 0x18, 0x00, 0x03, 0x00, 0xd0, 0x5a, 0x63, 0x0b, 0x00, 0xe0, 0x5c, 0x63, 0x6b, 0x35, 0xd7, 0x5c,
+    0x63, 0x6b, 0x35, 0xe7, 0x5c, 0x63, 0x6a, 0xb5, 0xd6, 0x5a, 0x63, 0x4a, 0x31, 0xd6, 0x5a, 0x63, 0x00, 0x1c, 0x73, 0xcc, 0x31, 0x00, 0x00, 0xb0,
+    0xd6, 0x52, 0x00, 0x00, 0xd0, 0x5a, 0x63, 0x0b, 0x00, 0xe0, 0x5c, 0x6b, 0x6b, 0x35, 0xd7, 0x5c, 0x6b, 0x6b, 0x35, 0xe7, 0x5c, 0x6b, 0x6a, 0xb5,
+    0xd6, 0x5a, 0x63, 0x4a, 0x31, 0xc6, 0x18, 0x63, 0x80, 0x1c, 0x73, 0xcc, 0x31, 0x04, 0x00, 0xb0, 0xd6, 0x52, 0x07, 0x00, 0xd0, 0x5a, 0x63, 0x06,
+    0x00, 0xe0, 0x5c, 0x6b, 0x67, 0x35, 0xd7, 0x5c, 0x6b, 0x66, 0x35, 0xe7, 0x5c, 0x6b, 0x67, 0xb5, 0xd6, 0x5a, 0x63, 0x46, 0xb1, 0xd6, 0x1a, 0x63,
+    0x83, 0x1c, 0x73, 0xcc, 0x31, 0x04, 0x00, 0xe0, 0xdc, 0x5a, 0x07, 0x00, 0xe0, 0x5c, 0x6b, 0x09, 0x00, 0xe0, 0x5c, 0x6b, 0x69, 0x35, 0xe7, 0x5c,
+    0x6b, 0x69, 0x35, 0xe7, 0x5c, 0x6b, 0x68, 0xb5, 0xd6, 0x5a, 0x63, 0x48, 0xb1, 0xd6, 0x5a, 0x63, 0x84, 0x10, 0x73, 0xcc, 0x31, 0x04, 0x00, 0xc0,
+    0x18, 0x53, 0x03, 0x00, 0xe0, 0x5c, 0x63, 0x0a, 0x00, 0xe0, 0x5c, 0x6b, 0x4a, 0x29, 0xe7, 0x5c, 0x6b, 0x4a, 0x29, 0xe7, 0x5c, 0x6b, 0x29, 0xa5,
+    0xd6, 0x5a, 0x63, 0x29, 0xa5, 0xd6, 0x5a, 0x63, 0x64, 0x10, 0x00, 0x80, 0x39, 0x04, 0x00, 0x00, 0x00, 0x53, 0x03, 0x00, 0x00, 0x40, 0x63, 0x0b,
+    0x00, 0xd0, 0x58, 0x63, 0x6b, 0xb1, 0xd5, 0x5a, 0x63, 0x6b, 0x31, 0xd6, 0x58, 0x63, 0x6a, 0xad, 0xd5, 0x5a, 0x63, 0x4a, 0xad, 0xc5, 0x18, 0x63,
+    0x64, 0x18, 0x04, 0x00, 0x38, 0x04, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00, 0x00, 0x60, 0x0b, 0x00, 0xe0, 0x1c, 0x63, 0x6b, 0x35, 0xe7, 0x1c,
+    0x63, 0x6b, 0x35, 0xe7, 0xdc, 0x5a, 0x6a, 0x35, 0xd7, 0xdc, 0x5a, 0x4a, 0x31, 0xe7, 0x9c, 0x5a, 0x64, 0x1c, 0x74, 0x00, 0x00, 0x04, 0x00, 0xe0,
+    0x00, 0x00, 0x03, 0x00, 0xe0, 0x00, 0x00, 0x0b, 0x00, 0xe0, 0x9c, 0x4b, 0x6b, 0x35, 0xe7, 0x5c, 0x53, 0x6b, 0x35, 0xe7, 0x5c, 0x4b, 0x6a, 0xb5,
+    0xd6, 0x5a, 0x4b, 0x4a, 0xb1, 0xd6, 0x5a, 0x43, 0x64, 0x9c, 0x73, 0x0e, 0x00, 0x04, 0x00, 0xb0, 0x1a, 0x00, 0x03, 0x00, 0xd0, 0x1a, 0x00, 0x0b,
+    0x00, 0xe0, 0x5c, 0x6b, 0x6b, 0x35, 0xd7, 0x5c, 0x6b, 0x6b, 0x35, 0xe7, 0x5c, 0x6b, 0x6a, 0xb5, 0xd6, 0x5a, 0x63, 0x4a, 0x31, 0xd6, 0x5a, 0x63,
+    0x43, 0x9c, 0x94, 0x12, 0x42, 0x00, 0x00, 0xb0, 0xd6, 0x52, 0x00, 0x00, 0xd0, 0x5a, 0x63, 0x00, 0x00, 0xe0, 0x5c, 0x6b, 0xcc, 0x39, 0xe7, 0x5c,
+    0x6b, 0xcc, 0x39, 0xe7, 0x5c, 0x6b, 0x6a, 0xb5, 0xd6, 0x5a, 0x6b, 0x6a, 0x31, 0xc6, 0x18, 0x63, 0x83, 0x9c, 0x94, 0x12, 0x42, 0x04, 0x00, 0xb0,
+    0xd6, 0x52, 0x07, 0x00, 0xd0, 0x5a, 0x63, 0x06, 0x00, 0xe0, 0x5c, 0x6b, 0xc7, 0x39, 0xe7, 0x5c, 0x6b, 0xc6, 0x39, 0xe7, 0x5c, 0x6b, 0x67, 0xb5,
+    0xd6, 0x5a, 0x6b, 0x66, 0xb5, 0xd6, 0x1a, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x64, 0x10, 0x84, 0x10, 0x42, 0x04, 0x00, 0x80, 0x10, 0x42, 0x03, 0x00, 0xe0, 0x5c, 0x63, 0x0a, 0x00, 0xe0, 0x5c, 0x6b, 0x4a, 0x29, 0xe7, 0x5c,
+    0x6b, 0x4a, 0x29, 0xe7, 0x5c, 0x6b, 0x29, 0xa5, 0xd6, 0x5a, 0x6b, 0x29, 0xa5, 0xd6, 0x5a, 0x63, 0x64, 0x10, 0x81, 0x10, 0x42, 0x04, 0x00, 0x00,
+    0x00, 0x42, 0x03, 0x00, 0x00, 0x40, 0x63, 0x0b, 0x00, 0x00, 0x40, 0x63, 0x6b, 0xb1, 0xd5, 0x5a, 0x63, 0x6b, 0x31, 0xd6, 0x58, 0x63, 0x6a, 0xad,
+    0xd5, 0x5a, 0x63, 0x4a, 0xad, 0xc5, 0x18, 0x63, 0x64, 0x90, 0x94, 0x52, 0x4a, 0x04, 0x00, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0x00, 0x60, 0x0b,
+    0x00, 0x00, 0x00, 0x60, 0x6b, 0xb5, 0xf7, 0x1e, 0x63, 0x6b, 0x35, 0xe7, 0x1c, 0x63, 0x6a, 0x35, 0xd7, 0xdc, 0x5a, 0x4a, 0x31, 0xe7, 0x9c, 0x5a,
+    0x64, 0x90, 0x94, 0x52, 0x4a, 0x04, 0x00, 0x90, 0x00, 0x00, 0x03, 0x00, 0xf0, 0x00, 0x00, 0x0b, 0x00, 0xf0, 0x00, 0x00, 0x6b, 0x35, 0xf7, 0xde,
+    0x53, 0x6b, 0x35, 0xe7, 0x9c, 0x4b, 0x6a, 0x35, 0xe7, 0x9c, 0x4b, 0x4a, 0xb1, 0xe6, 0x9c, 0x43, 0x64, 0x90, 0x94, 0x52, 0x4a, 0x04, 0x00, 0x90,
+    0x12, 0x00, 0x03, 0x00, 0xd0, 0x1c, 0x00, 0x0b, 0x00, 0xe0, 0x1c, 0x00, 0x6b, 0x35, 0xe7, 0x9c, 0x73, 0x6b, 0x35, 0xe7, 0x9c, 0x6b, 0x6a, 0xb5,
+    0xd6, 0x5a, 0x6b, 0x4a, 0x31, 0xd6, 0x5a, 0x63, 0x43, 0x0c, 0xa5, 0x54, 0x4a, 0x03, 0x00, 0xa0, 0x54, 0x4a, 0x00, 0x00, 0xa0, 0x54, 0x4a, 0x00,
+    0x00, 0xe0, 0x5c, 0x6b, 0x00, 0x38, 0xe7, 0x5c, 0x6b, 0x89, 0x39, 0xe7, 0x5c, 0x6b, 0x89, 0xb5, 0xd6, 0x5a, 0x6b, 0x49, 0x31, 0xc6, 0x18, 0x63,
+    0x84, 0x0c, 0xa5, 0x54, 0x4a, 0x04, 0x00, 0xa0, 0x54, 0x4a, 0x04, 0x00, 0xa0, 0x54, 0x4a, 0x06, 0x00, 0xe0, 0x5c, 0x6b, 0x87, 0x39, 0xe7, 0x5c,
+    0x6b, 0x86, 0x39, 0xe7, 0x5c, 0x6b, 0x87, 0xb5, 0xd6, 0x5a, 0x6b, 0x46, 0xb1, 0xd6, 0x1a, 0x63, 0x84, 0x0c, 0xa5, 0x54, 0x4a, 0x03, 0x00, 0xa0,
+    0x54, 0x4a, 0x04, 0x00, 0xa0, 0x54, 0x4a, 0x08, 0x00, 0xe0, 0x5c, 0x6b, 0x08, 0x39, 0xe7, 0x5c, 0x6b, 0x08, 0x39, 0xe7, 0x5c, 0x6b, 0x08, 0xb5,
+    0xd6, 0x5a, 0x6b, 0x08, 0xb1, 0xd6, 0x5a, 0x63, 0x63, 0x8c, 0x94, 0x52, 0x4a, 0x03, 0x00, 0xb0, 0x56, 0x4a, 0x03, 0x00, 0x90, 0x56, 0x4a, 0x09,
+    0x00, 0xd0, 0x5a, 0x6b, 0x69, 0xa5, 0xd6, 0x5a, 0x6b, 0x69, 0xad, 0xd6, 0x5a, 0x6b, 0x29, 0xa5, 0xd6, 0x5a, 0x6b, 0x29, 0xa5, 0xd6, 0x5a, 0x63,
+    0x63, 0x0c, 0x91, 0x52, 0x4a, 0x03, 0x00, 0x90, 0x52, 0x4a, 0x03, 0x00, 0x00, 0x40, 0x4a, 0x09, 0x00, 0x00, 0x00, 0x63, 0x69, 0x31, 0x00, 0x00,
+    0x63, 0x69, 0x31, 0xc6, 0x18, 0x63, 0x69, 0xad, 0xc5, 0x18, 0x63, 0x49, 0xad, 0xc5, 0x18, 0x63, 0x63, 0x8c, 0x94, 0x12, 0x42, 0x03, 0x00, 0xa0,
+    0x94, 0x52, 0x03, 0x00, 0x00, 0x00, 0x50, 0x09, 0x00, 0x00, 0x00, 0x60, 0x69, 0x39, 0x07, 0x00, 0x60, 0x69, 0x39, 0xe7, 0x1c, 0x63, 0x69, 0xb5,
+    0xd6, 0xda, 0x5a, 0x49, 0xb1, 0xd6, 0xda, 0x5a, 0x63, 0x0c, 0xa5, 0x54, 0x4a, 0x03, 0x00, 0xb0, 0xd6, 0x4a, 0x03, 0x00, 0xb0, 0x00, 0x00, 0x09,
+    0x00, 0xe0, 0x00, 0x00, 0x69, 0x39, 0xe7, 0x00, 0x00, 0x69, 0x39, 0xe7, 0x9c, 0x53, 0x69, 0xb5, 0xd6, 0x5a, 0x4b, 0x49, 0xb1, 0xd6, 0x5a, 0x43,
+    0x63, 0x0c, 0xa5, 0x94, 0x52, 0x03, 0x00, 0xa0, 0x94, 0x52, 0x03, 0x00, 0xa0, 0x14, 0x00, 0x09, 0x00, 0xe0, 0x1c, 0x00, 0x69, 0x39, 0xe7, 0x1c,
+    0x00, 0x69, 0x39, 0xe7, 0x5c, 0x6b, 0x69, 0xb5, 0xd6, 0x5a, 0x6b, 0x49, 0x31, 0xd6, 0x5a, 0x63, 0x43, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0,
+    0xd6, 0x52, 0x01, 0x00, 0xc0, 0xd8, 0x5a, 0x00, 0x00, 0xb0, 0xd8, 0x5a, 0x00, 0xb4, 0xd6, 0x5a, 0x63, 0x00, 0x34, 0xd6, 0x58, 0x63, 0x8a, 0xb5,
+    0xd6, 0x5a, 0x63, 0x49, 0x31, 0xc6, 0x18, 0x63, 0x84, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x04, 0x00, 0xc0, 0xd8, 0x5a, 0x00,
+    0x00, 0xb0, 0xd8, 0x5a, 0x00, 0x80, 0xd6, 0x5a, 0x63, 0x00, 0x00, 0xd6, 0x58, 0x63, 0x86, 0xb5, 0xd6, 0x5a, 0x63, 0x47, 0x31, 0xc6, 0x18, 0x63,
+    0x84, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x04, 0x00, 0xc0, 0xd8, 0x5a, 0x02, 0x00, 0xb0, 0xd8, 0x5a, 0x08, 0x00, 0xd0, 0x5a,
+    0x63, 0x08, 0x00, 0xd0, 0x58, 0x63, 0x08, 0xb5, 0xd6, 0x5a, 0x63, 0x08, 0x31, 0xc6, 0x18, 0x63, 0x63, 0x8c, 0x94, 0x52, 0x4a, 0x03, 0x00, 0xb0,
+    0xd6, 0x52, 0x03, 0x00, 0xc0, 0xd8, 0x5a, 0x02, 0x00, 0x00, 0xd8, 0x5a, 0x29, 0x01, 0x00, 0x18, 0x63, 0x29, 0x01, 0x00, 0x18, 0x63, 0x29, 0x25,
+    0xc6, 0x18, 0x63, 0x29, 0x25, 0xc6, 0x18, 0x63, 0x63, 0x0c, 0xa1, 0x94, 0x4a, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x03, 0x00, 0xb0, 0xd6, 0x5a, 0x02,
+    0x00, 0x00, 0xc0, 0x5a, 0x6a, 0x2d, 0x00, 0xc0, 0x5a, 0x6a, 0x2d, 0x00, 0xc0, 0x5a, 0x6a, 0xad, 0xb5, 0xd6, 0x5a, 0x49, 0xad, 0xb5, 0xd6, 0x5a,
+    0x63, 0x8c, 0x94, 0x94, 0x52, 0x03, 0x00, 0xc0, 0xd8, 0x5a, 0x03, 0x00, 0xc0, 0x18, 0x63, 0x02, 0x00, 0x00, 0x00, 0x60, 0x8a, 0x35, 0x07, 0x00,
+    0x60, 0x8a, 0x35, 0x07, 0x00, 0x60, 0x8a, 0x35, 0xe7, 0x1c, 0x63, 0x49, 0x31, 0xc6, 0x98, 0x52, 0x63, 0x0c, 0xc5, 0x18, 0x43, 0x03, 0x00, 0xc0,
+    0x18, 0x4b, 0x03, 0x00, 0xd0, 0x5a, 0x53, 0x02, 0x00, 0xd0, 0x00, 0x00, 0x8a, 0xb5, 0xd6, 0x00, 0x00, 0x8a, 0x35, 0xd6, 0x00, 0x00, 0x8a, 0xb5,
+    0xd6, 0x5a, 0x4b, 0x49, 0x31, 0xc6, 0x18, 0x53, 0x63, 0x0c, 0xa5, 0xd6, 0x5a, 0x03, 0x00, 0xb0, 0x18, 0x63, 0x03, 0x00, 0xc0, 0x18, 0x63, 0x02,
+    0x00, 0xc0, 0x18, 0x00, 0x8a, 0xb5, 0xd6, 0x1a, 0x00, 0x8a, 0x35, 0xd6, 0x18, 0x00, 0x8a, 0xb5, 0xd6, 0x5a, 0x63, 0x49, 0x31, 0xc6, 0x18, 0x63,
+    0x43, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x01, 0x00, 0xd0, 0x5a, 0x63, 0x0b, 0x00, 0xe0, 0x9c, 0x73, 0x00, 0x38, 0xe7, 0x5c,
+    0x73, 0x00, 0x38, 0xe7, 0x9c, 0x73, 0x00, 0xac, 0xb5, 0xd6, 0x52, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x84, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0,
+    0xd6, 0x52, 0x06, 0x00, 0xd0, 0x5a, 0x63, 0x08, 0x00, 0xe0, 0x9c, 0x73, 0x00, 0x00, 0xe7, 0x5c, 0x73, 0x00, 0x00, 0xe7, 0x9c, 0x73, 0x00, 0x00,
+    0xc6, 0xd6, 0x52, 0x87, 0x31, 0xc6, 0xd6, 0x5a, 0x84, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x04, 0x00, 0xd0, 0x5a, 0x63, 0x09,
+    0x00, 0xf0, 0x9c, 0x73, 0x09, 0x00, 0xf0, 0x5c, 0x73, 0x09, 0x00, 0xf0, 0x9c, 0x73, 0x09, 0x00, 0xc0, 0xd8, 0x52, 0x29, 0x31, 0xc6, 0xd8, 0x5a,
+    0x63, 0x8c, 0x94, 0x52, 0x4a, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x03, 0x00, 0xe0, 0x5c, 0x63, 0x09, 0x00, 0xe0, 0x5c, 0x6b, 0x49, 0x01, 0x00, 0x5c,
+    0x6b, 0x49, 0x01, 0x00, 0x5c, 0x6b, 0x48, 0x01, 0x00, 0xd8, 0x5a, 0x48, 0x29, 0xc6, 0xd8, 0x5a, 0x63, 0x0c, 0xa1, 0x94, 0x4a, 0x03, 0x00, 0xc0,
+    0x18, 0x53, 0x03, 0x00, 0xd0, 0x5a, 0x63, 0x09, 0x00, 0xe0, 0x9c, 0x63, 0x89, 0x31, 0x00, 0x80, 0x63, 0x8a, 0x31, 0x00, 0x80, 0x63, 0x6a, 0x31,
+    0x00, 0x00, 0x53, 0x6a, 0x31, 0xc6, 0x18, 0x53, 0x63, 0x8c, 0x94, 0x94, 0x52, 0x03, 0x00, 0xd0, 0xda, 0x5a, 0x03, 0x00, 0xf0, 0x1e, 0x63, 0x09,
+    0x00, 0xf0, 0x1e, 0x63, 0xa9, 0xbd, 0x07, 0x00, 0x60, 0xaa, 0xbd, 0x07, 0x00, 0x60, 0x6a, 0x31, 0x06, 0x00, 0x60, 0x6a, 0x31, 0xc6, 0x18, 0x63,
+    0x63, 0x0c, 0xc5, 0x18, 0x43, 0x03, 0x00, 0xd0, 0x5a, 0x4b, 0x03, 0x00, 0xe0, 0x9c, 0x4b, 0x09, 0x00, 0xf0, 0xde, 0x53, 0xa9, 0x39, 0xf7, 0x00,
+    0x00, 0xaa, 0x39, 0xf7, 0x00, 0x00, 0x6a, 0x2d, 0xc6, 0x00, 0x00, 0x6a, 0x2d, 0xc6, 0x18, 0x53, 0x63, 0x0c, 0xa5, 0xd6, 0x5a, 0x03, 0x00, 0xb0,
+    0x5a, 0x6b, 0x03, 0x00, 0xd0, 0x5a, 0x6b, 0x09, 0x00, 0xe0, 0x9c, 0x73, 0xa9, 0x39, 0xe7, 0x1c, 0x00, 0xaa, 0x39, 0xe7, 0x1c, 0x00, 0x6a, 0xad,
+    0xb5, 0x18, 0x00, 0x6a, 0xad, 0xb5, 0x18, 0x63, 0x43, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x01, 0x00, 0xd0, 0x5a, 0x63, 0x0a,
+    0x00, 0xe0, 0x5c, 0x6b, 0x8c, 0x39, 0xe7, 0x5c, 0x6b, 0x00, 0x38, 0xe7, 0x5c, 0x6b, 0x00, 0xb4, 0xd6, 0x5a, 0x6b, 0x00, 0xa8, 0x94, 0x50, 0x42,
+    0x84, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x07, 0x00, 0xd0, 0x5a, 0x63, 0x08, 0x00, 0xe0, 0x5c, 0x6b, 0xc7, 0x39, 0xe7, 0x5c,
+    0x6b, 0x00, 0x00, 0xe7, 0x5c, 0x6b, 0x00, 0x00, 0xd7, 0x5a, 0x6b, 0x00, 0x80, 0xa4, 0x52, 0x42, 0x84, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0,
+    0xd6, 0x52, 0x04, 0x00, 0xd0, 0x5a, 0x63, 0x09, 0x00, 0xe0, 0x9c, 0x6b, 0x29, 0xbd, 0xf7, 0x9c, 0x73, 0x09, 0x00, 0xf0, 0x9c, 0x73, 0x09, 0x00,
+    0xf0, 0x9c, 0x73, 0x09, 0x00, 0xa0, 0x52, 0x42, 0x63, 0x8c, 0x94, 0x52, 0x4a, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x03, 0x00, 0xe0, 0x5c, 0x63, 0x0a,
+    0x00, 0xe0, 0x5c, 0x6b, 0x6a, 0x2d, 0xe7, 0x5c, 0x6b, 0x6a, 0x01, 0x00, 0x5c, 0x6b, 0x69, 0x01, 0x00, 0x5c, 0x6b, 0x29, 0x01, 0x00, 0x54, 0x42,
+    0x63, 0x0c, 0xa1, 0x94, 0x4a, 0x03, 0x00, 0xc0, 0x18, 0x53, 0x03, 0x00, 0xd0, 0x5a, 0x63, 0x0a, 0x00, 0xd0, 0x58, 0x63, 0x8c, 0xb5, 0xd6, 0x5a,
+    0x63, 0x8c, 0x35, 0x00, 0x40, 0x63, 0x8c, 0x35, 0x00, 0x40, 0x63, 0x28, 0x29, 0x00, 0x40, 0x52, 0x63, 0x8c, 0x94, 0x94, 0x52, 0x03, 0x00, 0xd0,
+    0xda, 0x5a, 0x03, 0x00, 0xe0, 0xdc, 0x5a, 0x0a, 0x00, 0xe0, 0x1c, 0x63, 0xac, 0xb9, 0xf7, 0x1e, 0x63, 0xac, 0xb9, 0x07, 0x00, 0x60, 0xac, 0xb9,
+    0x07, 0x00, 0x60, 0x28, 0x25, 0x05, 0x00, 0x50, 0x63, 0x0c, 0xc5, 0x18, 0x43, 0x03, 0x00, 0xc0, 0x18, 0x4b, 0x03, 0x00, 0xe0, 0x5c, 0x4b, 0x0a,
+    0x00, 0xe0, 0x9c, 0x53, 0x8c, 0x39, 0xf7, 0xde, 0x4b, 0x8c, 0x39, 0xf7, 0x00, 0x00, 0x8c, 0x35, 0xf7, 0x00, 0x00, 0x28, 0x25, 0x95, 0x00, 0x00,
+    0x63, 0x0c, 0xa5, 0xd6, 0x5a, 0x03, 0x00, 0xb0, 0x18, 0x63, 0x03, 0x00, 0xd0, 0x5a, 0x6b, 0x0a, 0x00, 0xe0, 0x9c, 0x6b, 0x8c, 0x39, 0xe7, 0x9c,
+    0x73, 0x8c, 0x39, 0xe7, 0x1c, 0x00, 0x8c, 0xb5, 0xd6, 0x1c, 0x00, 0x28, 0xa1, 0x94, 0x14, 0x00, 0x43, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0,
+    0xd6, 0x52, 0x01, 0x00, 0xd0, 0x5a, 0x63, 0x0a, 0x00, 0xe0, 0x5c, 0x63, 0x6a, 0x35, 0xd7, 0x5c, 0x6b, 0x8b, 0x35, 0xe7, 0x5c, 0x6b, 0x00, 0xb4,
+    0xd6, 0x5a, 0x6b, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x84, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x07, 0x00, 0xd0, 0x5a, 0x63, 0x07,
+    0x00, 0xe0, 0x5c, 0x63, 0x67, 0x35, 0xd7, 0x5c, 0x6b, 0xa7, 0x35, 0xe7, 0x5c, 0x6b, 0x00, 0x80, 0xd6, 0x5a, 0x6b, 0x00, 0x80, 0xd6, 0x1a, 0x63,
+    0x84, 0x8c, 0xb5, 0x96, 0x52, 0x03, 0x00, 0xb0, 0xd6, 0x52, 0x04, 0x00, 0xd0, 0x5a, 0x63, 0x09, 0x00, 0xe0, 0x5c, 0x63, 0x29, 0x35, 0xe7, 0x5c,
+    0x6b, 0x29, 0x39, 0xe7, 0x5c, 0x6b, 0x09, 0x00, 0xe0, 0x5c, 0x6b, 0x09, 0x00, 0xe0, 0x5a, 0x63, 0x63, 0x8c, 0x94, 0x52, 0x4a, 0x03, 0x00, 0xb0,
+    0xd6, 0x52, 0x03, 0x00, 0xe0, 0x5c, 0x63, 0x0a, 0x00, 0xe0, 0x5c, 0x63, 0x4a, 0x29, 0xe7, 0x5c, 0x6b, 0x4a, 0x29, 0xe7, 0x5c, 0x6b, 0x4a, 0x01,
+    0x00, 0x5a, 0x6b, 0x4a, 0x01, 0x00, 0x5a, 0x63, 0x63, 0x0c, 0xa1, 0x94, 0x4a, 0x03, 0x00, 0xc0, 0x18, 0x53, 0x03, 0x00, 0xd0, 0x5a, 0x63, 0x0a,
+    0x00, 0xd0, 0x58, 0x63, 0x6a, 0x31, 0xd6, 0x5a, 0x63, 0x8b, 0x31, 0xd6, 0x58, 0x63, 0x8b, 0x31, 0x00, 0x40, 0x63, 0x8b, 0x31, 0x00, 0x00, 0x63,
+    0x63, 0x8c, 0x94, 0x94, 0x52, 0x03, 0x00, 0xd0, 0xda, 0x5a, 0x03, 0x00, 0xe0, 0xdc, 0x5a, 0x0a, 0x00, 0xe0, 0xdc, 0x5a, 0x6a, 0x35, 0xe7, 0xdc,
+    0x5a, 0xab, 0x35, 0xe7, 0x1c, 0x63, 0xab, 0x35, 0x07, 0x00, 0x60, 0xab, 0x35, 0x07, 0x00, 0x60, 0x63, 0x0c, 0xc5, 0x18, 0x43, 0x03, 0x00, 0xc0,
+    0x18, 0x4b, 0x03, 0x00, 0xe0, 0x5c, 0x43, 0x0a, 0x00, 0xe0, 0x5c, 0x4b, 0x6a, 0x35, 0xe7, 0x5c, 0x4b, 0x8b, 0x35, 0xe7, 0x9c, 0x53, 0x8b, 0x35,
+    0xe7, 0x00, 0x00, 0x8b, 0xb5, 0xe6, 0x00, 0x00, 0x63, 0x0c, 0xa5, 0xd6, 0x5a, 0x03, 0x00, 0xb0, 0x18, 0x63, 0x03, 0x00, 0xd0, 0x5a, 0x63, 0x0a,
+    0x00, 0xe0, 0x5c, 0x63, 0x6a, 0x35, 0xd7, 0x5c, 0x6b, 0x8b, 0x35, 0xe7, 0x9c, 0x73, 0x8b, 0xb5, 0xd6, 0x1c, 0x00, 0x8b, 0x31, 0xd6, 0x1c, 0x00,
+    0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0xda, 0x4a, 0xed, 0xbd, 0xf7, 0xde, 0x73, 0xed, 0xbd, 0xf7, 0xde, 0x7b, 0xed, 0xbd, 0xf7, 0xde,
+    0x7b, 0xed, 0xbd, 0xf7, 0xde, 0x7b, 0xed, 0xbd, 0xf7, 0xde, 0x7b, 0xed, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00,
+    0xd8, 0x4a, 0xe9, 0xbd, 0xf7, 0xde, 0x73, 0xe8, 0x41, 0x08, 0xe1, 0x7b, 0xe9, 0x41, 0x08, 0xe1, 0x7b, 0xe8, 0x41, 0x08, 0xe1, 0x7b, 0xe9, 0xbd,
+    0xf7, 0xde, 0x7b, 0xe8, 0xbd, 0xf7, 0xde, 0x7b, 0x4a, 0x01, 0x00, 0xce, 0x39, 0x8c, 0x01, 0x00, 0xd8, 0x4a, 0x8c, 0x3d, 0x08, 0xe1, 0x73, 0x8c,
+    0x41, 0x08, 0xe1, 0x7b, 0x8c, 0x41, 0x08, 0xe1, 0x7b, 0x8c, 0x41, 0x08, 0xe1, 0x7b, 0x8c, 0xbd, 0xf7, 0xde, 0x7b, 0x6b, 0xbd, 0xf7, 0xde, 0x7b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x18, 0x43, 0x89, 0x01, 0x00,
+    0x9c, 0x63, 0xee, 0xbd, 0xf7, 0x9c, 0x6b, 0xee, 0xbd, 0xf7, 0x9c, 0x6b, 0xee, 0xbd, 0xf7, 0x9c, 0x6b, 0xee, 0xbd, 0xf7, 0x9c, 0x6b, 0xce, 0x39,
+    0xe7, 0x9c, 0x63, 0xcd, 0x39, 0xe7, 0x5a, 0x63, 0xc6, 0x00, 0x00, 0x00, 0x50, 0x89, 0x01, 0x00, 0x00, 0x60, 0xee, 0x41, 0x08, 0x1f, 0x63, 0xee,
+    0x41, 0x08, 0x21, 0x63, 0xee, 0x41, 0x08, 0x21, 0x63, 0xee, 0x41, 0x08, 0x21, 0x63, 0xee, 0xbd, 0xf7, 0x1e, 0x63, 0xed, 0xbd, 0xf7, 0xde, 0x5a,
+    0xc6, 0x00, 0x00, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00, 0x00, 0xee, 0xbd, 0xf7, 0xde, 0x4b, 0xee, 0x41, 0x08, 0xe1, 0x43, 0xee, 0x41, 0x08, 0xe1,
+    0x4b, 0xee, 0x41, 0x08, 0xe1, 0x43, 0xee, 0xbd, 0xf7, 0xde, 0x4b, 0xed, 0xbd, 0xf7, 0xde, 0x43, 0xc6, 0x00, 0x00, 0x16, 0x00, 0x89, 0x01, 0x00,
+    0x1a, 0x00, 0xee, 0xbd, 0xf7, 0xde, 0x6b, 0xee, 0xbd, 0xf7, 0xde, 0x6b, 0xee, 0xbd, 0xf7, 0xde, 0x6b, 0xee, 0xbd, 0xf7, 0xde, 0x6b, 0xee, 0xbd,
+    0xf7, 0xde, 0x6b, 0xcd, 0xb9, 0xf7, 0xde, 0x6b, 0x00, 0x00, 0x00, 0x8a, 0x29, 0x00, 0x00, 0x00, 0xda, 0x4a, 0x00, 0xbc, 0xf7, 0xde, 0x6b, 0xcd,
+    0xbd, 0xf7, 0xde, 0x6b, 0xcd, 0xbd, 0xf7, 0xde, 0x6b, 0xcd, 0xbd, 0xf7, 0xde, 0x6b, 0xcd, 0xbd, 0xf7, 0xde, 0x6b, 0xad, 0xbd, 0xf7, 0x9c, 0x6b,
+    0x00, 0x00, 0x00, 0x8a, 0x29, 0x00, 0x00, 0x00, 0xd8, 0x4a, 0x00, 0x80, 0xf7, 0xde, 0x6b, 0xc8, 0x3d, 0x08, 0xe1, 0x6b, 0xc9, 0x3d, 0xf8, 0xe0,
+    0x6b, 0xc8, 0x3d, 0x08, 0xe1, 0x6b, 0xc9, 0xbd, 0xf7, 0xde, 0x6b, 0xa8, 0xbd, 0xf7, 0xde, 0x6b, 0xc5, 0x00, 0x00, 0x8a, 0x29, 0x8c, 0x01, 0x00,
+    0xd8, 0x4a, 0x8c, 0x3d, 0x08, 0xe1, 0x6b, 0x8c, 0x3d, 0x08, 0xe1, 0x6b, 0x8c, 0x3d, 0x08, 0xe1, 0x6b, 0x8c, 0x3d, 0x08, 0xe1, 0x6b, 0x8c, 0xbd,
+    0xf7, 0xde, 0x6b, 0x6b, 0xbd, 0xf7, 0xde, 0x6b, 0x85, 0x00, 0x00, 0x8a, 0x29, 0xad, 0x01, 0x00, 0x5e, 0x4b, 0xad, 0xb5, 0xf7, 0xde, 0x6b, 0xad,
+    0xb5, 0xf7, 0xde, 0x6b, 0xad, 0xb5, 0xf7, 0xde, 0x6b, 0xad, 0xb5, 0xf7, 0xde, 0x6b, 0x8c, 0x31, 0xe7, 0x9c, 0x6b, 0x8c, 0x31, 0xe7, 0x9c, 0x6b,
+    0x85, 0x00, 0x00, 0x8a, 0x29, 0x89, 0x01, 0x00, 0x9c, 0x63, 0xcd, 0x3d, 0xf7, 0x9c, 0x6b, 0xcd, 0xbd, 0xf7, 0x9c, 0x6b, 0xcd, 0x3d, 0xf7, 0x9c,
+    0x6b, 0xcd, 0xbd, 0xf7, 0x9c, 0x6b, 0xcd, 0x39, 0xe7, 0x9c, 0x6b, 0xad, 0x39, 0xe7, 0x5a, 0x6b, 0x85, 0x00, 0x00, 0x00, 0x28, 0x89, 0x01, 0x00,
+    0x00, 0x60, 0xcd, 0x41, 0x08, 0x00, 0x60, 0xcd, 0x41, 0x08, 0x21, 0x63, 0xcd, 0x41, 0x08, 0x21, 0x63, 0xcd, 0x3d, 0x08, 0x21, 0x63, 0xcd, 0xbd,
+    0xf7, 0x1e, 0x63, 0xad, 0xbd, 0xf7, 0xde, 0x5a, 0x85, 0x00, 0x00, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00, 0x00, 0xcd, 0xbd, 0xf7, 0x00, 0x00, 0xcd,
+    0x3d, 0x08, 0xe1, 0x53, 0xcd, 0x3d, 0xf8, 0xe0, 0x4b, 0xcd, 0x3d, 0x08, 0xe1, 0x43, 0xcd, 0xbd, 0xf7, 0xde, 0x4b, 0xad, 0xbd, 0xf7, 0xde, 0x43,
+    0x85, 0x00, 0x00, 0x0e, 0x00, 0x89, 0x01, 0x00, 0x1e, 0x00, 0xcd, 0xb9, 0xf7, 0x1e, 0x00, 0xcd, 0xbd, 0xf7, 0xde, 0x7b, 0xcd, 0xbd, 0xf7, 0xde,
+    0x6b, 0xcd, 0xbd, 0xf7, 0xde, 0x6b, 0xcd, 0xbd, 0xf7, 0xde, 0x6b, 0xad, 0xb9, 0xf7, 0xde, 0x6b, 0xc6, 0x00, 0x00, 0xce, 0x31, 0x00, 0x00, 0x00,
+    0xcc, 0x31, 0x00, 0xbc, 0xf7, 0xde, 0x73, 0x00, 0xbc, 0xf7, 0xde, 0x73, 0xee, 0xbd, 0xf7, 0xde, 0x73, 0xcc, 0xbd, 0xf7, 0x9e, 0x6b, 0xcc, 0xbd,
+    0xf7, 0x9e, 0x6b, 0xab, 0xbd, 0xf7, 0x5c, 0x6b, 0x83, 0x00, 0x00, 0xce, 0x31, 0x00, 0x00, 0x00, 0xcc, 0x31, 0x00, 0x00, 0xf8, 0xde, 0x73, 0x00,
+    0x00, 0xf8, 0xde, 0x73, 0x09, 0x42, 0xf8, 0xde, 0x73, 0xc8, 0xbd, 0xf7, 0x9e, 0x6b, 0xc9, 0xbd, 0xf7, 0x9e, 0x6b, 0xa8, 0xbd, 0xf7, 0x5e, 0x6b,
+    0xc6, 0x00, 0x00, 0xce, 0x31, 0x06, 0x00, 0x00, 0xcc, 0x31, 0x0b, 0x00, 0xf0, 0xde, 0x73, 0x0b, 0x00, 0xf0, 0xde, 0x73, 0x6b, 0xbd, 0xf7, 0xde,
+    0x73, 0x6b, 0xbd, 0xf7, 0x9e, 0x6b, 0x4a, 0xbd, 0xf7, 0x9e, 0x6b, 0x4a, 0xbd, 0xf7, 0x5e, 0x6b, 0xa5, 0x00, 0x00, 0xce, 0x31, 0xa5, 0x00, 0x00,
+    0xcc, 0x31, 0xad, 0x01, 0x00, 0xde, 0x73, 0xad, 0x01, 0x00, 0xde, 0x73, 0xad, 0xb5, 0xf7, 0xde, 0x73, 0xac, 0xb5, 0xf7, 0x9e, 0x6b, 0x8c, 0x31,
+    0xe7, 0x9c, 0x6b, 0x8b, 0x31, 0xe7, 0x5c, 0x6b, 0xa5, 0x00, 0x00, 0xce, 0x31, 0xa5, 0x00, 0x00, 0xc0, 0x31, 0xee, 0x3d, 0x00, 0x40, 0x6b, 0xee,
+    0x3d, 0x00, 0x40, 0x6b, 0xee, 0xbd, 0xf7, 0x5a, 0x6b, 0xcc, 0xbd, 0xf7, 0x5a, 0x6b, 0xcc, 0x39, 0xe7, 0x18, 0x63, 0xab, 0x39, 0xe7, 0x18, 0x63,
+    0xa5, 0x00, 0x00, 0x8c, 0x31, 0xa5, 0x00, 0x00, 0x00, 0x30, 0xee, 0xbd, 0x07, 0x00, 0x60, 0xee, 0xbd, 0x07, 0x00, 0x60, 0xee, 0xbd, 0xf7, 0x1e,
+    0x63, 0xcc, 0xbd, 0xf7, 0xde, 0x62, 0xcc, 0xbd, 0xf7, 0x1e, 0x63, 0xab, 0xbd, 0xf7, 0xde, 0x5a, 0xa5, 0x00, 0x00, 0xce, 0x39, 0xa5, 0x00, 0x00,
+    0x00, 0x00, 0xee, 0xbd, 0x07, 0x01, 0x00, 0xee, 0xbd, 0x07, 0x01, 0x00, 0xee, 0xbd, 0x07, 0x21, 0x4c, 0xcc, 0xbd, 0xf7, 0x9e, 0x43, 0xcc, 0xbd,
+    0xf7, 0x9e, 0x4b, 0xab, 0xbd, 0xf7, 0x5e, 0x43, 0xa5, 0x00, 0x00, 0x10, 0x42, 0xa5, 0x00, 0x00, 0x10, 0x00, 0xee, 0xbd, 0xf7, 0x1e, 0x00, 0xee,
+    0xbd, 0xf7, 0x1e, 0x00, 0xee, 0xbd, 0xf7, 0xde, 0x73, 0xcc, 0xbd, 0xf7, 0x9e, 0x6b, 0xcc, 0xbd, 0xf7, 0x9e, 0x6b, 0xab, 0xb9, 0xf7, 0x5e, 0x6b,
+    0xe7, 0x00, 0x00, 0xce, 0x39, 0x49, 0x01, 0x00, 0x14, 0x3a, 0x00, 0x30, 0xc5, 0x14, 0x3a, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0xde,
+    0x7b, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xed, 0xbd, 0xf7, 0xde, 0x73, 0xab, 0xbd, 0xf7, 0x5c, 0x5b, 0x84, 0x00, 0x00, 0xce, 0x39, 0x87, 0x01, 0x00,
+    0x14, 0x3a, 0x00, 0x00, 0xb6, 0x14, 0x3a, 0x00, 0x00, 0xf8, 0xde, 0x7b, 0x00, 0x00, 0xf8, 0xde, 0x7b, 0x0a, 0x42, 0xf8, 0xde, 0x7b, 0xe8, 0xbd,
+    0xf7, 0xde, 0x73, 0xa8, 0xbd, 0xf7, 0x5e, 0x5b, 0xe7, 0x00, 0x00, 0xce, 0x39, 0x29, 0x01, 0x00, 0x14, 0x3a, 0x09, 0x00, 0xb0, 0x14, 0x3a, 0x0c,
+    0x00, 0x00, 0xdf, 0x7b, 0x0c, 0x00, 0x00, 0xdf, 0x7b, 0x8c, 0x41, 0x08, 0xdf, 0x7b, 0x4a, 0xbd, 0xf7, 0xde, 0x73, 0x4a, 0xbd, 0xf7, 0x5e, 0x5b,
+    0xc6, 0x00, 0x00, 0xce, 0x39, 0x86, 0x01, 0x00, 0x18, 0x3a, 0x86, 0x01, 0x00, 0x18, 0x3a, 0xcc, 0x01, 0x00, 0xa0, 0x73, 0xcc, 0x01, 0x00, 0xa0,
+    0x73, 0xcc, 0x39, 0x08, 0xa1, 0x73, 0x8c, 0x31, 0xe7, 0x9c, 0x73, 0x8b, 0x31, 0xe7, 0x5c, 0x5b, 0xc6, 0x00, 0x00, 0x52, 0x3a, 0x06, 0x01, 0x00,
+    0xd6, 0x3a, 0x06, 0x2d, 0x00, 0xc0, 0x3a, 0xce, 0x3d, 0x00, 0x80, 0x63, 0xce, 0x3d, 0x00, 0x80, 0x63, 0xce, 0xbd, 0xf7, 0x9c, 0x63, 0xcd, 0x39,
+    0xe7, 0x18, 0x63, 0xab, 0x39, 0xe7, 0x18, 0x5b, 0xc6, 0x00, 0x00, 0xce, 0x39, 0x06, 0x01, 0x00, 0x58, 0x4a, 0x06, 0x2d, 0x06, 0x00, 0x48, 0xef,
+    0x3d, 0x08, 0x00, 0x68, 0xef, 0x3d, 0x08, 0x00, 0x68, 0xef, 0x3d, 0x08, 0x61, 0x6b, 0xed, 0xbd, 0xf7, 0x9e, 0x52, 0xab, 0xbd, 0xf7, 0x9e, 0x52,
+    0xc6, 0x00, 0x00, 0x52, 0x32, 0x06, 0x01, 0x00, 0xd8, 0x42, 0x06, 0x2d, 0xb6, 0x00, 0x00, 0xef, 0xbd, 0x07, 0x01, 0x00, 0xef, 0xbd, 0x07, 0x01,
+    0x00, 0xef, 0xbd, 0x07, 0x21, 0x54, 0xed, 0xbd, 0xf7, 0xde, 0x4b, 0xab, 0xbd, 0xf7, 0x5e, 0x43, 0xc6, 0x00, 0x00, 0x52, 0x3a, 0x06, 0x01, 0x00,
+    0x96, 0x4a, 0x06, 0xad, 0xb5, 0x16, 0x00, 0xef, 0xbd, 0xf7, 0x1e, 0x00, 0xef, 0xbd, 0xf7, 0x1e, 0x00, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xed, 0xbd,
+    0xf7, 0xde, 0x73, 0xab, 0xb9, 0xf7, 0x5e, 0x5b, 0x4a, 0x01, 0x00, 0xce, 0x39, 0xad, 0x01, 0x00, 0xda, 0x4a, 0xce, 0x39, 0xe7, 0x5c, 0x5b, 0x00,
+    0x38, 0xd7, 0x5c, 0x5b, 0x00, 0x3c, 0xe7, 0x9c, 0x73, 0x00, 0x3c, 0xe7, 0x9c, 0x73, 0xef, 0x3d, 0xe7, 0x9c, 0x73, 0xcd, 0x39, 0xe7, 0x9c, 0x6b,
+    0xc6, 0x00, 0x00, 0xce, 0x39, 0xea, 0x01, 0x00, 0xd8, 0x4a, 0xe9, 0xbd, 0xe7, 0x5c, 0x5b, 0x00, 0x80, 0xe7, 0x5c, 0x5b, 0x00, 0x80, 0xf7, 0x9c,
+    0x73, 0x00, 0x80, 0xf7, 0x9c, 0x73, 0xe9, 0xbd, 0xf7, 0x9c, 0x73, 0xe9, 0xbd, 0xf7, 0x9c, 0x6b, 0x4a, 0x01, 0x00, 0xce, 0x39, 0x8c, 0x01, 0x00,
+    0xd8, 0x4a, 0xad, 0x3d, 0xf7, 0x5c, 0x5b, 0x0d, 0x00, 0xf0, 0x5c, 0x5b, 0x0d, 0x00, 0xf0, 0xde, 0x73, 0x0c, 0x00, 0xf0, 0xde, 0x73, 0x8c, 0xbd,
+    0xf7, 0xde, 0x73, 0x6b, 0xbd, 0xf7, 0xde, 0x6b, 0xc6, 0x00, 0x00, 0xce, 0x39, 0xcd, 0x01, 0x00, 0x5e, 0x4b, 0xcd, 0xb9, 0xe7, 0x9e, 0x5b, 0xcd,
+    0x01, 0x00, 0x9e, 0x5b, 0xcd, 0x01, 0x00, 0xde, 0x6b, 0xcd, 0x01, 0x00, 0xde, 0x6b, 0xcd, 0xb9, 0xf7, 0xde, 0x6b, 0xad, 0xb5, 0xf7, 0xde, 0x6b,
+    0xc6, 0x00, 0x00, 0x18, 0x3b, 0x89, 0x01, 0x00, 0x9c, 0x63, 0xcb, 0x3d, 0xf7, 0xde, 0x73, 0xcb, 0x3d, 0x00, 0xc0, 0x73, 0xed, 0x3d, 0x00, 0xc0,
+    0x73, 0xed, 0x3d, 0x00, 0x80, 0x6b, 0xed, 0xbd, 0xf7, 0x9c, 0x6b, 0xed, 0xbd, 0xf7, 0x5a, 0x6b, 0xc6, 0x00, 0x00, 0x94, 0x52, 0x89, 0x01, 0x00,
+    0x1e, 0x63, 0xab, 0xb9, 0xe7, 0x5e, 0x6b, 0xab, 0xb9, 0x07, 0x00, 0x68, 0xee, 0xbd, 0x07, 0x00, 0x68, 0xee, 0xbd, 0x07, 0x00, 0x60, 0xee, 0xbd,
+    0xf7, 0x1e, 0x63, 0xed, 0xbd, 0xf7, 0xde, 0x5a, 0xc6, 0x00, 0x00, 0x18, 0x33, 0x89, 0x01, 0x00, 0xde, 0x53, 0xab, 0x39, 0xf7, 0xde, 0x4b, 0xab,
+    0x39, 0xf7, 0x00, 0x00, 0xce, 0xb9, 0xf7, 0x00, 0x00, 0xce, 0xb9, 0xf7, 0x00, 0x00, 0xce, 0xb9, 0xf7, 0xde, 0x4b, 0xcd, 0xb9, 0xf7, 0xde, 0x53,
+    0xc6, 0x00, 0x00, 0x94, 0x52, 0x89, 0x01, 0x00, 0x5a, 0x6b, 0xab, 0x39, 0xe7, 0x9c, 0x73, 0xab, 0xb9, 0xe6, 0x1c, 0x00, 0xce, 0x39, 0xe7, 0x1e,
+    0x00, 0xce, 0x39, 0xe7, 0x1e, 0x00, 0xce, 0x39, 0xe7, 0xde, 0x7b, 0xcd, 0x39, 0xe7, 0x9c, 0x6b, 0x6b, 0x01, 0x00, 0xce, 0x39, 0xad, 0x01, 0x00,
+    0xda, 0x4a, 0xed, 0xbd, 0xf7, 0xde, 0x73, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0x38,
+    0xd7, 0x5a, 0x6b, 0xce, 0x39, 0xd7, 0x5a, 0x6b, 0x08, 0x01, 0x00, 0xce, 0x39, 0xea, 0x01, 0x00, 0xd8, 0x4a, 0xe9, 0x41, 0x08, 0xdf, 0x73, 0x0a,
+    0x42, 0x08, 0xe1, 0x7b, 0x00, 0x00, 0x08, 0xe1, 0x7b, 0x00, 0x00, 0x08, 0xe1, 0x7b, 0x00, 0x00, 0xe7, 0x9c, 0x6b, 0xc9, 0x39, 0xe7, 0x9c, 0x6b,
+    0x4a, 0x01, 0x00, 0xce, 0x39, 0x8c, 0x01, 0x00, 0xd8, 0x4a, 0x8c, 0x41, 0x08, 0xe1, 0x73, 0x8c, 0x41, 0x08, 0x21, 0x7c, 0x0c, 0x00, 0x00, 0x21,
+    0x7c, 0x0c, 0x00, 0x00, 0x21, 0x7c, 0x0b, 0x00, 0xe0, 0x9c, 0x73, 0x6b, 0x39, 0xe7, 0x9c, 0x73, 0xc6, 0x00, 0x00, 0xce, 0x39, 0xcd, 0x01, 0x00,
+    0x5e, 0x4b, 0xcd, 0x39, 0x08, 0xe1, 0x73, 0xce, 0x39, 0x08, 0x21, 0x7c, 0xce, 0x01, 0x00, 0x20, 0x7c, 0xce, 0x01, 0x00, 0x20, 0x7c, 0xad, 0x01,
+    0x00, 0x9c, 0x73, 0xad, 0x35, 0xe7, 0x9c, 0x73, 0xc6, 0x00, 0x00, 0x18, 0x3b, 0x89, 0x01, 0x00, 0x9c, 0x63, 0xed, 0x41, 0x08, 0x9d, 0x73, 0x0f,
+    0x42, 0x08, 0x9d, 0x73, 0x0f, 0x42, 0x00, 0x80, 0x73, 0x0f, 0x42, 0x00, 0x80, 0x73, 0xce, 0x39, 0x00, 0x40, 0x6b, 0xce, 0x39, 0xe7, 0x5a, 0x6b,
+    0xc6, 0x00, 0x00, 0x94, 0x52, 0x89, 0x01, 0x00, 0x1e, 0x63, 0xed, 0x41, 0x08, 0x21, 0x63, 0x0f, 0x42, 0x08, 0x61, 0x6b, 0x0f, 0x42, 0x08, 0x00,
+    0x68, 0x0f, 0x42, 0x08, 0x00, 0x68, 0xce, 0x39, 0x07, 0x00, 0x58, 0xce, 0x39, 0xe7, 0xdc, 0x5a, 0xc6, 0x00, 0x00, 0x5a, 0x43, 0x89, 0x01, 0x00,
+    0xde, 0x53, 0xed, 0x3d, 0x08, 0xe1, 0x4b, 0xef, 0x41, 0x08, 0x21, 0x54, 0xef, 0x41, 0x08, 0x01, 0x00, 0xef, 0x41, 0x08, 0x01, 0x00, 0xcd, 0x39,
+    0xe7, 0x00, 0x00, 0xcd, 0x39, 0xe7, 0x9c, 0x53, 0xc6, 0x00, 0x00, 0xd6, 0x5a, 0x89, 0x01, 0x00, 0x5a, 0x6b, 0xed, 0xbd, 0xf7, 0xde, 0x73, 0xef,
+    0xbd, 0xf7, 0xde, 0x7b, 0xef, 0xbd, 0xf7, 0x1e, 0x00, 0xef, 0xbd, 0xf7, 0x1e, 0x00, 0xad, 0xb5, 0xe6, 0x1c, 0x00, 0xad, 0xb5, 0xe6, 0x9c, 0x73,
+    0x6b, 0x01, 0x00, 0xce, 0x39, 0xac, 0x01, 0x00, 0xda, 0x4a, 0xed, 0xbd, 0xf7, 0xde, 0x6b, 0xed, 0xbd, 0xf7, 0xde, 0x6b, 0xef, 0xbd, 0xf7, 0xde,
+    0x7b, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0xbc, 0xf7, 0xde, 0x7b, 0x00, 0xb0, 0xc5, 0xd6, 0x52, 0x08, 0x01, 0x00, 0xce, 0x39, 0xca, 0x01, 0x00,
+    0xd8, 0x4a, 0xe9, 0x41, 0x08, 0xdf, 0x6b, 0xea, 0x41, 0x08, 0xe1, 0x6b, 0x09, 0x42, 0x08, 0xe1, 0x7b, 0x00, 0x00, 0x08, 0xe1, 0x7b, 0x00, 0x00,
+    0x08, 0xe1, 0x7b, 0x00, 0x00, 0xc6, 0x16, 0x5b, 0x4a, 0x01, 0x00, 0xce, 0x39, 0x8c, 0x01, 0x00, 0xd8, 0x4a, 0x6c, 0x41, 0x08, 0xe1, 0x6b, 0x8c,
+    0x41, 0x08, 0xe1, 0x6b, 0x8c, 0x41, 0x08, 0x21, 0x7c, 0x0c, 0x00, 0x00, 0x21, 0x7c, 0x0c, 0x00, 0x00, 0x21, 0x7c, 0x0b, 0x00, 0xc0, 0x18, 0x5b,
+    0xc6, 0x00, 0x00, 0xce, 0x39, 0xcc, 0x01, 0x00, 0x5e, 0x4b, 0xcd, 0xb5, 0xf7, 0xde, 0x6b, 0xcd, 0xb9, 0xf7, 0xde, 0x6b, 0xcd, 0x39, 0x08, 0xe1,
+    0x7b, 0xcd, 0x01, 0x00, 0xe0, 0x7b, 0xcd, 0x01, 0x00, 0xe0, 0x7b, 0x8c, 0x01, 0x00, 0x18, 0x63, 0xc6, 0x00, 0x00, 0x18, 0x3b, 0x89, 0x01, 0x00,
+    0x9c, 0x63, 0xed, 0xbd, 0xf7, 0x9a, 0x6b, 0xed, 0xbd, 0xf7, 0x9c, 0x6b, 0xef, 0x41, 0x08, 0x9d, 0x6b, 0xef, 0x41, 0x00, 0x80, 0x6b, 0xef, 0x41,
+    0x00, 0x80, 0x6b, 0x8c, 0x31, 0x00, 0x00, 0x63, 0xc6, 0x00, 0x00, 0x94, 0x52, 0x89, 0x01, 0x00, 0x1e, 0x63, 0xed, 0x41, 0x08, 0x21, 0x63, 0xed,
+    0x41, 0x08, 0x21, 0x63, 0x0f, 0x42, 0x08, 0x21, 0x63, 0x0f, 0x42, 0x08, 0x00, 0x60, 0x0f, 0x42, 0x08, 0x00, 0x60, 0x8b, 0x31, 0x06, 0x00, 0x58,
+    0xc6, 0x00, 0x00, 0x5a, 0x4b, 0x89, 0x01, 0x00, 0x9c, 0x53, 0xed, 0x3d, 0x08, 0xe1, 0x4b, 0xed, 0x41, 0x08, 0xe1, 0x53, 0xef, 0x41, 0x08, 0x21,
+    0x4c, 0xef, 0x41, 0x08, 0x01, 0x00, 0xef, 0x41, 0x08, 0x01, 0x00, 0x8b, 0x2d, 0xc6, 0x00, 0x00, 0xc6, 0x00, 0x00, 0xd6, 0x5a, 0x89, 0x01, 0x00,
+    0x5a, 0x6b, 0xed, 0xbd, 0xf7, 0xde, 0x6b, 0xed, 0xbd, 0xf7, 0xde, 0x6b, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xef, 0xbd, 0xf7, 0x1e, 0x00, 0xef, 0xbd,
+    0xf7, 0x1e, 0x00, 0x6a, 0x2d, 0xb6, 0x18, 0x00, 0x6b, 0x01, 0x00, 0xce, 0x39, 0xac, 0x01, 0x00, 0xda, 0x4a, 0xed, 0xbd, 0xf7, 0xde, 0x6b, 0xed,
+    0xbd, 0xf7, 0xde, 0x6b, 0xed, 0xbd, 0xf7, 0xde, 0x6b, 0xee, 0xbd, 0xf7, 0x9e, 0x73, 0x00, 0xbc, 0xf7, 0x9e, 0x73, 0x00, 0xbc, 0xf7, 0x9c, 0x73,
+    0x08, 0x01, 0x00, 0xce, 0x39, 0xc9, 0x01, 0x00, 0xd8, 0x4a, 0xe9, 0xbd, 0xf7, 0xde, 0x6b, 0xe9, 0xbd, 0xf7, 0xde, 0x6b, 0xe9, 0x41, 0x08, 0xdf,
+    0x6b, 0x09, 0x42, 0x08, 0xdf, 0x73, 0x00, 0x00, 0x08, 0xdf, 0x73, 0x00, 0x00, 0xf8, 0xde, 0x73, 0x4a, 0x01, 0x00, 0xce, 0x39, 0x8c, 0x01, 0x00,
+    0xd8, 0x4a, 0x6c, 0xbd, 0xf7, 0xde, 0x6b, 0x8c, 0x41, 0x08, 0xe1, 0x6b, 0x6b, 0x41, 0x08, 0xe1, 0x6b, 0x6b, 0x41, 0x08, 0xe1, 0x73, 0x0b, 0x00,
+    0x00, 0xe1, 0x73, 0x0b, 0x00, 0x00, 0xdf, 0x73, 0xc6, 0x00, 0x00, 0xce, 0x39, 0xcc, 0x01, 0x00, 0x5e, 0x4b, 0xcd, 0xb5, 0xf7, 0xde, 0x6b, 0xcd,
+    0xb9, 0xf7, 0xde, 0x6b, 0xad, 0xb5, 0xf7, 0xde, 0x6b, 0xad, 0xb5, 0xf7, 0xde, 0x73, 0xad, 0x01, 0x00, 0xde, 0x73, 0xad, 0x01, 0x00, 0xde, 0x73,
+    0xc6, 0x00, 0x00, 0x18, 0x3b, 0x89, 0x01, 0x00, 0x9c, 0x63, 0xed, 0xbd, 0xf7, 0x9a, 0x6b, 0xed, 0xbd, 0xf7, 0x9c, 0x6b, 0xed, 0xbd, 0xf7, 0x5a,
+    0x6b, 0xee, 0xbd, 0xf7, 0x5a, 0x6b, 0xee, 0x3d, 0x00, 0x40, 0x6b, 0xee, 0x3d, 0x00, 0x40, 0x6b, 0xc6, 0x00, 0x00, 0x94, 0x52, 0x89, 0x01, 0x00,
+    0x1e, 0x63, 0xed, 0xbd, 0xf7, 0x1e, 0x63, 0xed, 0x41, 0x08, 0x21, 0x63, 0xed, 0x41, 0x08, 0x21, 0x63, 0xee, 0x41, 0x08, 0x21, 0x63, 0xee, 0x41,
+    0x08, 0x00, 0x58, 0xee, 0x3d, 0x08, 0x00, 0x58, 0xc6, 0x00, 0x00, 0x5a, 0x4b, 0x89, 0x01, 0x00, 0x9c, 0x4b, 0xed, 0xbd, 0xf7, 0xde, 0x4b, 0xed,
+    0xbd, 0xf7, 0xde, 0x4b, 0xed, 0x3d, 0x08, 0xe1, 0x4b, 0xee, 0x3d, 0x08, 0x21, 0x54, 0xee, 0x3d, 0x08, 0x01, 0x00, 0xee, 0xbd, 0x07, 0x01, 0x00,
+    0xc6, 0x00, 0x00, 0xd6, 0x5a, 0x89, 0x01, 0x00, 0x5a, 0x6b, 0xed, 0xbd, 0xf7, 0xde, 0x6b, 0xed, 0xbd, 0xf7, 0xde, 0x6b, 0xed, 0xbd, 0xf7, 0xde,
+    0x6b, 0xce, 0xbd, 0xf7, 0xde, 0x73, 0xce, 0xbd, 0xf7, 0x1e, 0x00, 0xce, 0xb9, 0xf7, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00,
+    0x52, 0x4a, 0xcc, 0x01, 0x00, 0x5e, 0x5b, 0xcc, 0xb9, 0xe7, 0x9e, 0x63, 0xcc, 0xb9, 0xf7, 0x9e, 0x63, 0xcc, 0x39, 0xe7, 0x9c, 0x63, 0xcc, 0x39,
+    0xe7, 0x9c, 0x63, 0xcb, 0x39, 0xd7, 0x5a, 0x63, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0x52, 0x4a, 0xc7, 0x01, 0x00, 0x5c, 0x5b, 0xc8,
+    0x3d, 0xf7, 0x9c, 0x63, 0xc7, 0xbd, 0xf7, 0x9c, 0x63, 0xc8, 0x39, 0xe7, 0x9c, 0x63, 0xc7, 0x39, 0xe7, 0x9c, 0x63, 0xc8, 0x39, 0xe7, 0x5c, 0x63,
+    0xc6, 0x00, 0x00, 0xce, 0x39, 0x6b, 0x01, 0x00, 0x52, 0x4a, 0x6b, 0x01, 0x00, 0x5c, 0x5b, 0x6b, 0x3d, 0xf7, 0x9c, 0x63, 0x6b, 0xbd, 0xf7, 0x9c,
+    0x63, 0x6b, 0x39, 0xe7, 0x9c, 0x63, 0x4a, 0x39, 0xe7, 0x9c, 0x63, 0x4a, 0x39, 0xe7, 0x5c, 0x63, 0xe7, 0x00, 0x00, 0x94, 0x3a, 0x8c, 0x01, 0x00,
+    0x9c, 0x4b, 0xac, 0x01, 0x00, 0x9e, 0x63, 0xac, 0xbd, 0xf7, 0x9e, 0x63, 0xac, 0xbd, 0xf7, 0x9e, 0x63, 0x6b, 0xb5, 0xd6, 0x5a, 0x63, 0x6b, 0xb5,
+    0xd6, 0x5a, 0x63, 0x4a, 0xb5, 0xd6, 0x18, 0x63, 0xa5, 0x00, 0x00, 0x10, 0x42, 0xc6, 0x00, 0x00, 0x5a, 0x4b, 0xcb, 0x01, 0x00, 0x5a, 0x63, 0xcc,
+    0x39, 0xe7, 0x5a, 0x63, 0xcc, 0x39, 0xe7, 0x5a, 0x63, 0xac, 0xb5, 0xd6, 0x5a, 0x63, 0xac, 0xb5, 0xd6, 0x18, 0x63, 0x8b, 0x31, 0xc6, 0x18, 0x53,
+    0xa5, 0x00, 0x00, 0x00, 0x40, 0xc6, 0x00, 0x00, 0x00, 0x58, 0xcb, 0x01, 0x00, 0xde, 0x5a, 0xcc, 0xbd, 0xf7, 0xde, 0x5a, 0xcc, 0xbd, 0xf7, 0xde,
+    0x5a, 0xcc, 0x39, 0xe7, 0xdc, 0x5a, 0xcc, 0x39, 0xe7, 0xdc, 0x5a, 0xcb, 0x39, 0xe7, 0xdc, 0x5a, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00,
+    0x00, 0x00, 0xcb, 0x01, 0x00, 0x9c, 0x43, 0xcc, 0x3d, 0xf7, 0x9c, 0x43, 0xcc, 0xbd, 0xf7, 0x9c, 0x3b, 0xcc, 0x39, 0xe7, 0x9c, 0x43, 0xcc, 0x39,
+    0xe7, 0x9c, 0x3b, 0xcb, 0x39, 0xe7, 0x5c, 0x43, 0xa5, 0x00, 0x00, 0x14, 0x00, 0xc6, 0x00, 0x00, 0x18, 0x00, 0xcb, 0x01, 0x00, 0x9c, 0x63, 0xcc,
+    0x39, 0xe7, 0x9c, 0x63, 0xcc, 0x39, 0xe7, 0x9c, 0x63, 0xcc, 0x39, 0xe7, 0x9c, 0x63, 0xcc, 0x39, 0xe7, 0x9c, 0x63, 0xab, 0xb5, 0xd6, 0x5a, 0x63,
+    0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x5e, 0x5b, 0xcc, 0xb9, 0xe7, 0x9e, 0x73, 0xcc, 0xb9, 0xf7, 0x9e,
+    0x73, 0xcc, 0x39, 0xe7, 0x9c, 0x73, 0xcc, 0x39, 0xe7, 0x9c, 0x73, 0xcb, 0x39, 0xd7, 0x5a, 0x63, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00,
+    0x52, 0x4a, 0x00, 0x00, 0x00, 0x5c, 0x5b, 0xc8, 0x3d, 0xf7, 0x9c, 0x73, 0xc7, 0xbd, 0xf7, 0x9c, 0x73, 0xc8, 0x39, 0xe7, 0x9c, 0x73, 0xc7, 0x39,
+    0xe7, 0x9c, 0x73, 0xc8, 0x39, 0xe7, 0x9c, 0x63, 0x85, 0x00, 0x00, 0xce, 0x39, 0x6b, 0x01, 0x00, 0x52, 0x4a, 0x6b, 0x01, 0x00, 0x5c, 0x5b, 0x6b,
+    0x3d, 0xf7, 0x9c, 0x73, 0x6b, 0xbd, 0xf7, 0x9c, 0x73, 0x6b, 0x39, 0xe7, 0x9c, 0x73, 0x4a, 0x39, 0xe7, 0x9c, 0x73, 0x4a, 0x39, 0xe7, 0x9c, 0x63,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x8a, 0x29, 0xc6, 0x00, 0x00,
+    0x5a, 0x4b, 0xcb, 0x01, 0x00, 0x5a, 0x63, 0xcc, 0x39, 0xe7, 0x5a, 0x63, 0xcc, 0x39, 0xe7, 0x5a, 0x63, 0xac, 0xb5, 0xd6, 0x5a, 0x63, 0xac, 0xb5,
+    0xd6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x53, 0xa5, 0x00, 0x00, 0x00, 0x28, 0xc6, 0x00, 0x00, 0x00, 0x58, 0xcb, 0x01, 0x00, 0x00, 0x58, 0xcc,
+    0xbd, 0xf7, 0xde, 0x5a, 0xcc, 0xbd, 0xf7, 0xde, 0x5a, 0xcc, 0x39, 0xe7, 0xdc, 0x5a, 0xcc, 0x39, 0xe7, 0xdc, 0x5a, 0xcc, 0x39, 0xe7, 0xdc, 0x5a,
+    0xa5, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x3d, 0xf7, 0x9c, 0x4b, 0xcc, 0xbd, 0xf7, 0x9c,
+    0x43, 0xcc, 0x39, 0xe7, 0x9c, 0x43, 0xcc, 0x39, 0xe7, 0x9c, 0x3b, 0xcc, 0x39, 0xe7, 0x5c, 0x43, 0xa5, 0x00, 0x00, 0x0e, 0x00, 0xc6, 0x00, 0x00,
+    0x1a, 0x00, 0xcb, 0x01, 0x00, 0x1c, 0x00, 0xcc, 0x39, 0xe7, 0x9c, 0x6b, 0xcc, 0x39, 0xe7, 0x9c, 0x63, 0xcc, 0x39, 0xe7, 0x9c, 0x63, 0xcc, 0x39,
+    0xe7, 0x9c, 0x63, 0xac, 0xb5, 0xd6, 0x5a, 0x63, 0xa5, 0x00, 0x00, 0xce, 0x31, 0x00, 0x00, 0x00, 0xcc, 0x31, 0x00, 0x00, 0x00, 0x5e, 0x5b, 0x00,
+    0xb8, 0xe7, 0x9e, 0x63, 0xac, 0xb9, 0xf7, 0x9e, 0x63, 0xac, 0x39, 0xe7, 0x9c, 0x63, 0x8c, 0x39, 0xe7, 0x9c, 0x63, 0x8b, 0xb5, 0xd6, 0x5a, 0x63,
+    0x83, 0x00, 0x00, 0xce, 0x31, 0x00, 0x00, 0x00, 0xcc, 0x31, 0x00, 0x00, 0x00, 0x5c, 0x5b, 0x00, 0x00, 0xe7, 0x9c, 0x63, 0xa7, 0x39, 0xe7, 0x9c,
+    0x63, 0xa8, 0x39, 0xe7, 0x9c, 0x63, 0x87, 0x39, 0xe7, 0x9c, 0x63, 0x88, 0x39, 0xe7, 0x5c, 0x63, 0xa5, 0x00, 0x00, 0xce, 0x31, 0xa5, 0x00, 0x00,
+    0xcc, 0x31, 0x4a, 0x01, 0x00, 0x5c, 0x5b, 0x6b, 0x39, 0xe7, 0x9c, 0x63, 0x4b, 0x39, 0xe7, 0x9c, 0x63, 0x6b, 0x39, 0xe7, 0x9c, 0x63, 0x4a, 0x39,
+    0xe7, 0x9c, 0x63, 0x4a, 0x39, 0xe7, 0x5c, 0x63, 0xa5, 0x00, 0x00, 0xce, 0x31, 0x85, 0x00, 0x00, 0xcc, 0x31, 0x8c, 0x01, 0x00, 0x9c, 0x5b, 0x8c,
+    0x31, 0xe7, 0x9c, 0x63, 0x8c, 0x31, 0xe7, 0x9c, 0x63, 0x6b, 0xad, 0xd6, 0x5a, 0x63, 0x6b, 0xad, 0xd6, 0x5a, 0x63, 0x4a, 0x29, 0xc6, 0x18, 0x63,
+    0xa5, 0x00, 0x00, 0xce, 0x31, 0x85, 0x00, 0x00, 0xcc, 0x31, 0xab, 0x01, 0x00, 0x5a, 0x63, 0xab, 0xb9, 0xe6, 0x5a, 0x63, 0xac, 0x39, 0xe7, 0x5a,
+    0x63, 0xac, 0xb5, 0xd6, 0x5a, 0x63, 0x8c, 0xb5, 0xd6, 0x18, 0x63, 0x8b, 0x31, 0xc6, 0x18, 0x63, 0xa5, 0x00, 0x00, 0x8c, 0x31, 0x85, 0x00, 0x00,
+    0x00, 0x30, 0xab, 0x01, 0x00, 0x00, 0x58, 0xab, 0xb9, 0x07, 0x00, 0x58, 0xac, 0xb9, 0xf7, 0xde, 0x5a, 0xac, 0x39, 0xe7, 0xdc, 0x5a, 0x8c, 0x39,
+    0xe7, 0xdc, 0x5a, 0x8b, 0x39, 0xe7, 0xdc, 0x5a, 0xa5, 0x00, 0x00, 0xce, 0x39, 0x85, 0x00, 0x00, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0x00, 0xab,
+    0x39, 0xe7, 0x00, 0x00, 0xac, 0x39, 0xe7, 0x9c, 0x4b, 0xac, 0x39, 0xe7, 0x9c, 0x43, 0x8c, 0x39, 0xe7, 0x9c, 0x3b, 0x8b, 0x39, 0xe7, 0x5c, 0x43,
+    0xa5, 0x00, 0x00, 0x10, 0x42, 0x85, 0x00, 0x00, 0x10, 0x00, 0xab, 0x01, 0x00, 0x1c, 0x00, 0xab, 0x39, 0xe7, 0x1c, 0x00, 0xac, 0x39, 0xe7, 0x9c,
+    0x73, 0xac, 0x39, 0xe7, 0x9c, 0x63, 0x8c, 0x39, 0xe7, 0x9c, 0x63, 0x8b, 0xb5, 0xd6, 0x5a, 0x63, 0xc6, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00,
+    0x10, 0x3a, 0x00, 0x00, 0x00, 0x0e, 0x3a, 0x00, 0x38, 0xe7, 0x9c, 0x63, 0x00, 0x38, 0xe7, 0x9c, 0x63, 0xcc, 0x39, 0xe7, 0x9c, 0x63, 0x8a, 0x39,
+    0xe7, 0x1c, 0x5b, 0x8a, 0xb5, 0xd6, 0x1a, 0x5b, 0x84, 0x00, 0x00, 0xce, 0x39, 0xa5, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x0e, 0x3a, 0x00,
+    0x00, 0xe7, 0x9c, 0x63, 0x00, 0x00, 0xe7, 0x9c, 0x63, 0xc8, 0x39, 0xe7, 0x9c, 0x63, 0x87, 0x39, 0xe7, 0x1c, 0x5b, 0x88, 0x39, 0xe7, 0x1c, 0x5b,
+    0xc6, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00, 0x10, 0x3a, 0x06, 0x00, 0x00, 0x0e, 0x3a, 0x09, 0x00, 0xe0, 0x9c, 0x63, 0x09, 0x00, 0xe0, 0x9c,
+    0x63, 0x29, 0x39, 0xe7, 0x9c, 0x63, 0x29, 0x39, 0xe7, 0x1c, 0x5b, 0x29, 0x39, 0xe7, 0x1c, 0x5b, 0xa5, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00,
+    0x10, 0x3a, 0xa6, 0x00, 0x00, 0x0e, 0x3a, 0x6b, 0x01, 0x00, 0x5a, 0x63, 0x6b, 0x01, 0x00, 0x5a, 0x63, 0x6b, 0xad, 0xd6, 0x5a, 0x63, 0x6a, 0xad,
+    0xd6, 0x1a, 0x5b, 0x4a, 0x29, 0xc6, 0x18, 0x5b, 0xa5, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00, 0x10, 0x3a, 0xa6, 0x00, 0x00, 0x00, 0x3a, 0xac,
+    0x35, 0x00, 0xc0, 0x5a, 0xac, 0x35, 0x00, 0xc0, 0x5a, 0xac, 0xb5, 0xd6, 0xd6, 0x5a, 0x8a, 0xb5, 0xd6, 0xd6, 0x5a, 0x8a, 0x31, 0xc6, 0x94, 0x52,
+    0xa5, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00, 0xce, 0x39, 0xa6, 0x00, 0x00, 0x00, 0x38, 0xcc, 0x39, 0x07, 0x00, 0x50, 0xcc, 0x39, 0x07, 0x00,
+    0x50, 0xcc, 0x39, 0xe7, 0x9c, 0x52, 0x8a, 0x39, 0xe7, 0x9c, 0x52, 0x8a, 0x39, 0xe7, 0x9c, 0x52, 0xa5, 0x00, 0x00, 0x10, 0x32, 0xc6, 0x00, 0x00,
+    0x10, 0x42, 0xa6, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x39, 0xe7, 0x00, 0x00, 0xcc, 0x39, 0xe7, 0x00, 0x00, 0xcc, 0x39, 0xe7, 0x9c, 0x43, 0x8a, 0x39,
+    0xe7, 0x1c, 0x3b, 0x8a, 0x39, 0xe7, 0x1c, 0x43, 0xa5, 0x00, 0x00, 0x10, 0x3a, 0xc6, 0x00, 0x00, 0x52, 0x4a, 0xa6, 0x00, 0x00, 0x12, 0x00, 0xcc,
+    0x39, 0xe7, 0x1c, 0x00, 0xcc, 0x39, 0xe7, 0x1c, 0x00, 0xcc, 0x39, 0xe7, 0x9c, 0x63, 0x8a, 0x39, 0xe7, 0x1c, 0x5b, 0x8a, 0xb5, 0xd6, 0x1a, 0x5b,
+    0xc6, 0x00, 0x00, 0xce, 0x39, 0x29, 0x01, 0x00, 0x52, 0x4a, 0x8b, 0x01, 0x00, 0x98, 0x4a, 0x00, 0x38, 0xe6, 0x98, 0x4a, 0x00, 0x38, 0xe7, 0x5a,
+    0x6b, 0x00, 0xb4, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xab, 0xb5, 0xd6, 0x5a, 0x63, 0x84, 0x00, 0x00, 0xce, 0x39, 0xa5, 0x00, 0x00,
+    0x52, 0x4a, 0xc9, 0x01, 0x00, 0x98, 0x4a, 0x00, 0x00, 0xd7, 0x98, 0x4a, 0x00, 0x00, 0xd7, 0x5a, 0x6b, 0x00, 0x00, 0xd7, 0x5a, 0x6b, 0xc9, 0x39,
+    0xd7, 0x5a, 0x6b, 0xa7, 0xb5, 0xd6, 0x5a, 0x63, 0xc6, 0x00, 0x00, 0xce, 0x39, 0x29, 0x01, 0x00, 0x52, 0x4a, 0x6b, 0x01, 0x00, 0x98, 0x4a, 0x0b,
+    0x00, 0xd0, 0x98, 0x4a, 0x0b, 0x00, 0xe0, 0x5c, 0x6b, 0x0a, 0x00, 0xe0, 0x5c, 0x6b, 0x4a, 0x39, 0xe7, 0x5c, 0x6b, 0x29, 0x39, 0xe7, 0x5c, 0x63,
+    0xa5, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00, 0x52, 0x4a, 0xa8, 0x01, 0x00, 0x9c, 0x4a, 0xa8, 0x01, 0x00, 0x9c, 0x4a, 0xaa, 0x01, 0x00, 0x1c,
+    0x63, 0x8a, 0x01, 0x00, 0x1c, 0x63, 0x8a, 0x31, 0xe7, 0x1c, 0x63, 0x4a, 0x29, 0xc6, 0x18, 0x63, 0xa5, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00,
+    0xd6, 0x4a, 0x48, 0x01, 0x00, 0x5a, 0x4b, 0x48, 0x35, 0x00, 0x40, 0x4b, 0x8c, 0x39, 0x00, 0x40, 0x5b, 0x8c, 0x39, 0x00, 0x00, 0x5b, 0x8c, 0x39,
+    0xe7, 0x18, 0x5b, 0x8b, 0x31, 0xc6, 0xd6, 0x5a, 0xa5, 0x00, 0x00, 0x10, 0x42, 0xc6, 0x00, 0x00, 0x52, 0x4a, 0x48, 0x01, 0x00, 0xdc, 0x5a, 0x48,
+    0x35, 0x07, 0x00, 0x58, 0xad, 0x39, 0x07, 0x00, 0x58, 0xad, 0x39, 0x07, 0x00, 0x58, 0xad, 0x39, 0xe7, 0xdc, 0x5a, 0xab, 0x39, 0xe7, 0x5c, 0x4a,
+    0xa5, 0x00, 0x00, 0x52, 0x32, 0xc6, 0x00, 0x00, 0xd6, 0x3a, 0x48, 0x01, 0x00, 0x5c, 0x4b, 0x48, 0x35, 0xd7, 0x00, 0x00, 0xad, 0x35, 0xe7, 0x00,
+    0x00, 0xad, 0xb5, 0xe6, 0x00, 0x00, 0xad, 0xb5, 0xe6, 0x9c, 0x4b, 0xab, 0xb5, 0xd6, 0x5a, 0x43, 0xa5, 0x00, 0x00, 0x52, 0x42, 0xc6, 0x00, 0x00,
+    0x94, 0x4a, 0x48, 0x01, 0x00, 0x1a, 0x5b, 0x48, 0xb5, 0xd6, 0x1a, 0x00, 0xad, 0xb5, 0xd6, 0x1a, 0x00, 0xad, 0xb5, 0xd6, 0x1a, 0x00, 0xad, 0xb5,
+    0xd6, 0x5a, 0x6b, 0xab, 0xb5, 0xd6, 0x5a, 0x63, 0xe7, 0x00, 0x00, 0xce, 0x39, 0x6b, 0x01, 0x00, 0x52, 0x4a, 0xcc, 0x01, 0x00, 0x5e, 0x5b, 0xce,
+    0xb9, 0xe7, 0x9e, 0x73, 0x00, 0xb8, 0xf7, 0x9e, 0x73, 0x00, 0x38, 0xe7, 0x9c, 0x73, 0x00, 0x34, 0xc6, 0x18, 0x63, 0xad, 0x35, 0xc6, 0x18, 0x63,
+    0x84, 0x00, 0x00, 0xce, 0x39, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0xc9, 0x01, 0x00, 0x5c, 0x5b, 0xe8, 0xbd, 0xf7, 0x9c, 0x73, 0x00, 0x80, 0xf7, 0x9c,
+    0x73, 0x00, 0x80, 0xe7, 0x9c, 0x73, 0x00, 0x80, 0xd6, 0x1a, 0x63, 0xa8, 0xb5, 0xd6, 0x1a, 0x63, 0xc6, 0x00, 0x00, 0xce, 0x39, 0x6b, 0x01, 0x00,
+    0x52, 0x4a, 0x6b, 0x01, 0x00, 0x5c, 0x5b, 0x6b, 0xbd, 0xf7, 0xde, 0x73, 0x0b, 0x00, 0xf0, 0xde, 0x73, 0x0b, 0x00, 0xf0, 0xde, 0x73, 0x0a, 0x00,
+    0xd0, 0x5a, 0x63, 0x4a, 0xb5, 0xd6, 0x5a, 0x63, 0xa5, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00, 0x52, 0x4a, 0xac, 0x01, 0x00, 0x9e, 0x5b, 0xac,
+    0xb5, 0xf7, 0x9e, 0x6b, 0xac, 0x01, 0x00, 0x9e, 0x6b, 0xab, 0x01, 0x00, 0x5e, 0x6b, 0x8b, 0x01, 0x00, 0x5a, 0x63, 0x8b, 0xb1, 0xd6, 0x5a, 0x63,
+    0xa5, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00, 0x5a, 0x4b, 0xcb, 0x01, 0x00, 0x5a, 0x63, 0xcd, 0xbd, 0xf7, 0x9c, 0x63, 0xcd, 0x3d, 0x00, 0x80,
+    0x63, 0xad, 0x3d, 0x00, 0x80, 0x63, 0xac, 0x35, 0x00, 0x00, 0x5b, 0xac, 0xb5, 0xd6, 0x18, 0x5b, 0xa5, 0x00, 0x00, 0x10, 0x42, 0xc6, 0x00, 0x00,
+    0xd6, 0x5a, 0xcb, 0x01, 0x00, 0xde, 0x5a, 0xee, 0xbd, 0xf7, 0x1e, 0x63, 0xee, 0xbd, 0x07, 0x00, 0x60, 0xee, 0xbd, 0x07, 0x00, 0x60, 0xac, 0xb5,
+    0x06, 0x00, 0x58, 0xac, 0xb5, 0xd6, 0xda, 0x5a, 0xa5, 0x00, 0x00, 0x52, 0x32, 0xc6, 0x00, 0x00, 0x9c, 0x3b, 0xcb, 0x01, 0x00, 0xde, 0x4b, 0xce,
+    0x3d, 0xf7, 0xde, 0x43, 0xce, 0xbd, 0xf7, 0x00, 0x00, 0xce, 0x39, 0xf7, 0x00, 0x00, 0x8c, 0xb5, 0xd6, 0x00, 0x00, 0x8c, 0xb5, 0xd6, 0x5a, 0x43,
+    0xa5, 0x00, 0x00, 0x52, 0x42, 0xc6, 0x00, 0x00, 0xd6, 0x5a, 0xcb, 0x01, 0x00, 0x9c, 0x6b, 0xce, 0x39, 0xe7, 0xde, 0x7b, 0xce, 0x39, 0xe7, 0x1e,
+    0x00, 0xce, 0x39, 0xe7, 0x1e, 0x00, 0x8c, 0x31, 0xc6, 0x1a, 0x00, 0x8c, 0x31, 0xc6, 0x5a, 0x6b, 0xe7, 0x00, 0x00, 0xce, 0x39, 0x8c, 0x01, 0x00,
+    0x52, 0x4a, 0xac, 0x01, 0x00, 0x5e, 0x5b, 0xcc, 0xb9, 0xe7, 0x9e, 0x63, 0xcd, 0xb9, 0xf7, 0x9e, 0x6b, 0x00, 0x38, 0xe7, 0x9c, 0x6b, 0x00, 0x38,
+    0xe7, 0x9c, 0x6b, 0x00, 0xa8, 0xa5, 0x54, 0x52, 0x84, 0x00, 0x00, 0xce, 0x39, 0x08, 0x01, 0x00, 0x52, 0x4a, 0xa9, 0x01, 0x00, 0x5c, 0x5b, 0xc8,
+    0xbd, 0xf7, 0x9c, 0x63, 0xe9, 0xbd, 0xf7, 0x9c, 0x6b, 0x00, 0x80, 0xf7, 0x9c, 0x6b, 0x00, 0x80, 0xf7, 0x9c, 0x6b, 0x00, 0x80, 0xa5, 0x96, 0x52,
+    0xc6, 0x00, 0x00, 0xce, 0x39, 0x6b, 0x01, 0x00, 0x52, 0x4a, 0x6b, 0x01, 0x00, 0x5c, 0x5b, 0x6b, 0xbd, 0xf7, 0x9e, 0x63, 0x6b, 0xbd, 0xf7, 0xde,
+    0x6b, 0x0a, 0x00, 0xf0, 0xde, 0x6b, 0x0a, 0x00, 0xf0, 0xde, 0x6b, 0x0a, 0x00, 0xb0, 0x96, 0x52, 0xa5, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00,
+    0x52, 0x4a, 0xac, 0x01, 0x00, 0x9e, 0x5b, 0xac, 0xb1, 0xe7, 0x9e, 0x63, 0xac, 0xb5, 0xf7, 0x9e, 0x6b, 0x8c, 0x01, 0x00, 0x9c, 0x6b, 0x8c, 0x01,
+    0x00, 0x9c, 0x6b, 0x6a, 0x01, 0x00, 0xd6, 0x52, 0xa5, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00, 0x5a, 0x4b, 0xab, 0x01, 0x00, 0x5a, 0x63, 0xcc,
+    0x39, 0xe7, 0x5a, 0x63, 0xcd, 0x39, 0xe7, 0x5a, 0x63, 0xcd, 0x39, 0x00, 0x00, 0x63, 0xcd, 0x39, 0x00, 0x00, 0x63, 0x6a, 0x2d, 0x00, 0xc0, 0x52,
+    0xa5, 0x00, 0x00, 0x10, 0x42, 0xc6, 0x00, 0x00, 0xd6, 0x5a, 0xab, 0x01, 0x00, 0xde, 0x5a, 0xcc, 0xbd, 0xf7, 0xde, 0x5a, 0xed, 0xbd, 0xf7, 0xde,
+    0x5a, 0xed, 0xbd, 0x07, 0x00, 0x58, 0xed, 0xbd, 0x07, 0x00, 0x58, 0x4a, 0xad, 0x05, 0x00, 0x50, 0xa5, 0x00, 0x00, 0x52, 0x32, 0xc6, 0x00, 0x00,
+    0x9c, 0x43, 0xab, 0x01, 0x00, 0x9c, 0x4b, 0xcc, 0xbd, 0xf7, 0x9e, 0x43, 0xcd, 0xbd, 0xf7, 0xde, 0x4b, 0xcd, 0xb9, 0xf7, 0x00, 0x00, 0xcd, 0xb9,
+    0xf7, 0x00, 0x00, 0x4a, 0x2d, 0xb5, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x52, 0x4a, 0xc6, 0x00, 0x00, 0x18, 0x63, 0xab, 0x01, 0x00, 0x9c, 0x63, 0xcc,
+    0x39, 0xe7, 0x9c, 0x63, 0xcd, 0x39, 0xe7, 0x9c, 0x6b, 0xcd, 0x39, 0xe7, 0x1c, 0x00, 0xcd, 0x39, 0xe7, 0x1c, 0x00, 0x2a, 0x29, 0xb5, 0x14, 0x00,
+    0xe7, 0x00, 0x00, 0xce, 0x39, 0x8c, 0x01, 0x00, 0x52, 0x4a, 0xac, 0x01, 0x00, 0x5e, 0x5b, 0xac, 0xb9, 0xe7, 0x9e, 0x63, 0xac, 0xb9, 0xf7, 0x9e,
+    0x63, 0xcd, 0x39, 0xe7, 0x9c, 0x6b, 0x00, 0x38, 0xe7, 0x5c, 0x6b, 0x00, 0x38, 0xd7, 0x5a, 0x6b, 0x84, 0x00, 0x00, 0xce, 0x39, 0x08, 0x01, 0x00,
+    0x52, 0x4a, 0xa8, 0x01, 0x00, 0x5c, 0x5b, 0xa8, 0x39, 0xe7, 0x9c, 0x63, 0xa8, 0x39, 0xe7, 0x9c, 0x63, 0xe8, 0xbd, 0xe7, 0x9c, 0x6b, 0x00, 0x80,
+    0xe7, 0x9c, 0x6b, 0x00, 0x80, 0xe7, 0x9c, 0x6b, 0xc6, 0x00, 0x00, 0xce, 0x39, 0x6b, 0x01, 0x00, 0x52, 0x4a, 0x6b, 0x01, 0x00, 0x5c, 0x5b, 0x6b,
+    0x39, 0xe7, 0x9c, 0x63, 0x6b, 0xbd, 0xf7, 0x9e, 0x63, 0x4a, 0xbd, 0xf7, 0x9e, 0x6b, 0x0a, 0x00, 0xf0, 0x9e, 0x6b, 0x0a, 0x00, 0xf0, 0x9c, 0x6b,
+    0xa5, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00, 0x52, 0x4a, 0x8c, 0x01, 0x00, 0x9c, 0x5b, 0x8c, 0x31, 0xe7, 0x9c, 0x63, 0x8c, 0x31, 0xe7, 0x9c,
+    0x63, 0x8b, 0x31, 0xe7, 0x5c, 0x6b, 0x8b, 0x01, 0x00, 0x5c, 0x6b, 0x8b, 0x01, 0x00, 0x5c, 0x6b, 0xa5, 0x00, 0x00, 0xce, 0x39, 0xc6, 0x00, 0x00,
+    0x5a, 0x4b, 0xab, 0x01, 0x00, 0x5a, 0x63, 0xac, 0xb9, 0xe6, 0x5a, 0x63, 0xac, 0x39, 0xe7, 0x5a, 0x63, 0xad, 0x39, 0xe7, 0x18, 0x63, 0xad, 0x39,
+    0x00, 0x00, 0x63, 0xad, 0x39, 0x00, 0x00, 0x5b, 0xa5, 0x00, 0x00, 0x10, 0x42, 0xc6, 0x00, 0x00, 0xd6, 0x5a, 0xab, 0x01, 0x00, 0xde, 0x5a, 0xac,
+    0xb9, 0xe7, 0xde, 0x5a, 0xac, 0xbd, 0xf7, 0xde, 0x5a, 0xcd, 0xbd, 0xf7, 0xde, 0x5a, 0xcd, 0xbd, 0x07, 0x00, 0x58, 0xcd, 0xb9, 0x07, 0x00, 0x58,
+    0xa5, 0x00, 0x00, 0x52, 0x32, 0xc6, 0x00, 0x00, 0x9c, 0x43, 0xab, 0x01, 0x00, 0x9c, 0x43, 0xac, 0x39, 0xe7, 0x9c, 0x43, 0xac, 0x39, 0xe7, 0x9c,
+    0x4b, 0xcd, 0x39, 0xf7, 0xde, 0x43, 0xcd, 0x39, 0xf7, 0x00, 0x00, 0xcd, 0x39, 0xf7, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x52, 0x4a, 0xc6, 0x00, 0x00,
+    0x18, 0x63, 0xab, 0x01, 0x00, 0x9c, 0x63, 0xac, 0x39, 0xe7, 0x9c, 0x63, 0xac, 0x39, 0xe7, 0x9c, 0x63, 0xad, 0x39, 0xe7, 0x9c, 0x6b, 0xad, 0x39,
+    0xe7, 0x1c, 0x00, 0xad, 0xb5, 0xe6, 0x1c, 0x00, 0x00, 0xa0, 0x90, 0x52, 0x3a, 0x00, 0x00, 0x00, 0x52, 0x4a, 0x6b, 0x01, 0x00, 0x94, 0x52, 0xab,
+    0x01, 0x00, 0x5a, 0x63, 0xab, 0xb5, 0xd6, 0x5a, 0x63, 0xab, 0xb5, 0xd6, 0x5a, 0x63, 0x6a, 0xb5, 0xd6, 0x1a, 0x63, 0x6a, 0x31, 0xc6, 0x18, 0x63,
+    0x00, 0x80, 0x90, 0x52, 0x3a, 0x00, 0x00, 0x00, 0x52, 0x4a, 0xe7, 0x00, 0x00, 0x94, 0x52, 0xa6, 0x01, 0x00, 0x5a, 0x63, 0xa7, 0xb5, 0xd6, 0x5a,
+    0x63, 0xa6, 0xb5, 0xd6, 0x5a, 0x63, 0x67, 0xb5, 0xd6, 0x1a, 0x63, 0x66, 0xb1, 0xd6, 0x1a, 0x63, 0x06, 0x00, 0x90, 0x52, 0x3a, 0x07, 0x00, 0x00,
+    0x52, 0x4a, 0x4a, 0x01, 0x00, 0x94, 0x52, 0x4a, 0x01, 0x00, 0x5a, 0x63, 0x4a, 0xb5, 0xd6, 0x5a, 0x63, 0x4a, 0xb5, 0xd6, 0x5a, 0x63, 0x4a, 0xb5,
+    0xd6, 0x5a, 0x63, 0x29, 0xb1, 0xd6, 0x5a, 0x63, 0x08, 0x01, 0x00, 0x94, 0x3a, 0x08, 0x01, 0x00, 0xd6, 0x4a, 0x6b, 0x01, 0x00, 0x5a, 0x53, 0x6b,
+    0x01, 0x00, 0x5a, 0x63, 0x6b, 0xb5, 0xd6, 0x5a, 0x63, 0x6a, 0xb5, 0xd6, 0x5a, 0x63, 0x29, 0xb5, 0xd6, 0x18, 0x63, 0x29, 0x31, 0xc6, 0x18, 0x63,
+    0xe7, 0x1c, 0x00, 0x00, 0x42, 0xe7, 0x00, 0x00, 0x80, 0x52, 0x08, 0x01, 0x00, 0x18, 0x5b, 0x8b, 0x01, 0x00, 0x18, 0x5b, 0x8b, 0x31, 0xc6, 0x18,
+    0x5b, 0x8b, 0x31, 0xc6, 0x18, 0x5b, 0x6a, 0xad, 0xc5, 0x18, 0x5b, 0x6a, 0xad, 0xb5, 0xd6, 0x52, 0xe7, 0x9c, 0x00, 0x00, 0x40, 0xe7, 0x00, 0x00,
+    0x00, 0x48, 0x08, 0x01, 0x00, 0xd6, 0x5a, 0xab, 0x01, 0x00, 0x9a, 0x5a, 0xab, 0xb5, 0xd6, 0xda, 0x5a, 0xab, 0xb5, 0xd6, 0x9a, 0x5a, 0x6a, 0xb5,
+    0xd6, 0xda, 0x5a, 0x6a, 0xb1, 0xd6, 0x9a, 0x52, 0xe7, 0x9c, 0xa0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x5a, 0x43, 0xab,
+    0x01, 0x00, 0x5a, 0x43, 0xab, 0xb5, 0xd6, 0x5a, 0x3b, 0xab, 0xb5, 0xd6, 0x5a, 0x43, 0x6a, 0xb5, 0xd6, 0x5a, 0x3b, 0x6a, 0xb1, 0xd6, 0x5a, 0x33,
+    0xe7, 0x9c, 0x90, 0x14, 0x00, 0xe7, 0x00, 0x00, 0x16, 0x00, 0x08, 0x01, 0x00, 0x18, 0x5b, 0xab, 0x01, 0x00, 0x5a, 0x63, 0xab, 0xb5, 0xd6, 0x5a,
+    0x63, 0xab, 0xb5, 0xd6, 0x5a, 0x63, 0x6a, 0xb5, 0xd6, 0x1a, 0x63, 0x6a, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x14, 0x53, 0x4c, 0x31, 0x00, 0x00, 0x00,
+    0x52, 0x4a, 0x00, 0x00, 0x00, 0x94, 0x52, 0xab, 0x01, 0x00, 0x5a, 0x63, 0xab, 0xb5, 0xd6, 0x5a, 0x63, 0xab, 0xb5, 0xd6, 0x5a, 0x63, 0x6a, 0xb5,
+    0xd6, 0x1a, 0x63, 0x6a, 0x31, 0xc6, 0x18, 0x63, 0x00, 0x00, 0x53, 0x4c, 0x31, 0x00, 0x00, 0x00, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x94, 0x52, 0xa7,
+    0x01, 0x00, 0x5a, 0x63, 0xa7, 0xb5, 0xd6, 0x5a, 0x63, 0xa6, 0xb5, 0xd6, 0x5a, 0x63, 0x67, 0xb5, 0xd6, 0x1a, 0x63, 0x66, 0xb1, 0xd6, 0x1a, 0x63,
+    0x85, 0x14, 0x53, 0x4c, 0x31, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x4a, 0x01, 0x00, 0x94, 0x52, 0x4a, 0x01, 0x00, 0x5a, 0x63, 0x4a, 0xb5, 0xd6, 0x5a,
+    0x63, 0x4a, 0xb5, 0xd6, 0x5a, 0x63, 0x4a, 0xb5, 0xd6, 0x5a, 0x63, 0x29, 0xb1, 0xd6, 0x5a, 0x63, 0xa5, 0x14, 0x53, 0x4c, 0x31, 0x29, 0x01, 0x00,
+    0xd6, 0x4a, 0x6b, 0x01, 0x00, 0x5a, 0x53, 0x6b, 0x01, 0x00, 0x5a, 0x63, 0x6b, 0xb5, 0xd6, 0x5a, 0x63, 0x6a, 0xb5, 0xd6, 0x5a, 0x63, 0x29, 0xb5,
+    0xd6, 0x18, 0x63, 0x29, 0x31, 0xc6, 0x18, 0x63, 0xa4, 0x90, 0x62, 0x8c, 0x31, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x08, 0x01, 0x00, 0x18, 0x5b, 0x8b,
+    0x01, 0x00, 0x18, 0x5b, 0x8b, 0x31, 0xc6, 0x18, 0x5b, 0x8b, 0x31, 0xc6, 0x18, 0x5b, 0x6a, 0xad, 0xc5, 0x18, 0x5b, 0x6a, 0xad, 0xb5, 0xd6, 0x52,
+    0xa4, 0x90, 0x02, 0x00, 0x28, 0xe7, 0x00, 0x00, 0x00, 0x58, 0x08, 0x01, 0x00, 0x00, 0x58, 0xab, 0x01, 0x00, 0xda, 0x5a, 0xab, 0xb5, 0xd6, 0xda,
+    0x5a, 0xab, 0xb5, 0xd6, 0x9a, 0x5a, 0x6a, 0xb5, 0xd6, 0xda, 0x5a, 0x6a, 0xb1, 0xd6, 0x9a, 0x52, 0xa4, 0x10, 0x73, 0x00, 0x00, 0xe7, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0xab, 0x01, 0x00, 0x5a, 0x4b, 0xab, 0xb5, 0xd6, 0x5a, 0x43, 0xab, 0xb5, 0xd6, 0x5a, 0x43, 0x6a, 0xb5,
+    0xd6, 0x5a, 0x3b, 0x6a, 0xb1, 0xd6, 0x5a, 0x33, 0xa4, 0x10, 0x63, 0x0c, 0x00, 0xe7, 0x00, 0x00, 0x16, 0x00, 0x08, 0x01, 0x00, 0x18, 0x00, 0xab,
+    0x01, 0x00, 0x5a, 0x63, 0xab, 0xb5, 0xd6, 0x5a, 0x63, 0xab, 0xb5, 0xd6, 0x5a, 0x63, 0x6a, 0xb5, 0xd6, 0x1a, 0x63, 0x6a, 0x31, 0xc6, 0x18, 0x63,
+    0xc6, 0x18, 0x73, 0xce, 0x31, 0x00, 0x00, 0x00, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x94, 0x52, 0x00, 0x00, 0x00, 0x5a, 0x63, 0xab, 0xb5, 0xd6, 0x5a,
+    0x63, 0xab, 0xb5, 0xd6, 0x5a, 0x63, 0x6a, 0xb5, 0xd6, 0x1a, 0x63, 0x6a, 0x31, 0xc6, 0x18, 0x63, 0x83, 0x08, 0x73, 0xce, 0x31, 0x00, 0x00, 0x00,
+    0x52, 0x4a, 0x00, 0x00, 0x00, 0x94, 0x52, 0x00, 0x00, 0x00, 0x5a, 0x63, 0xc7, 0x35, 0xd7, 0x5a, 0x63, 0xc6, 0x39, 0xd7, 0x5a, 0x63, 0x67, 0xb5,
+    0xd6, 0x1a, 0x63, 0x66, 0xb5, 0xd6, 0x1a, 0x63, 0xc6, 0x18, 0x73, 0xce, 0x31, 0xa6, 0x00, 0x00, 0x52, 0x4a, 0x4a, 0x01, 0x00, 0x94, 0x52, 0x4a,
+    0x01, 0x00, 0x5c, 0x63, 0x4a, 0x39, 0xe7, 0x5c, 0x63, 0x4a, 0x39, 0xe7, 0x5c, 0x63, 0x4a, 0x35, 0xe7, 0x5c, 0x63, 0x29, 0xb5, 0xd6, 0x5a, 0x63,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x94, 0x72, 0xce, 0x31, 0xe7, 0x00, 0x00,
+    0xce, 0x31, 0x08, 0x01, 0x00, 0x18, 0x5b, 0x8c, 0x01, 0x00, 0x18, 0x5b, 0x8c, 0x31, 0xc6, 0x18, 0x5b, 0x8c, 0x31, 0xc6, 0x18, 0x5b, 0x6a, 0xad,
+    0xc5, 0x18, 0x5b, 0x6a, 0xad, 0xb5, 0xd6, 0x52, 0xa5, 0x94, 0x22, 0x8c, 0x31, 0xe7, 0x00, 0x00, 0x00, 0x30, 0x08, 0x01, 0x00, 0x00, 0x58, 0xac,
+    0x01, 0x00, 0x00, 0x58, 0xac, 0xb5, 0xd6, 0xda, 0x5a, 0xac, 0xb5, 0xd6, 0xda, 0x5a, 0x6a, 0xb5, 0xd6, 0xda, 0x5a, 0x6a, 0xb1, 0xd6, 0x9a, 0x52,
+    0xa5, 0x94, 0x82, 0x10, 0x3a, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0xac, 0x01, 0x00, 0x00, 0x00, 0xac, 0xb5, 0xd6, 0x5a,
+    0x43, 0xac, 0xb5, 0xd6, 0x5a, 0x43, 0x6a, 0xb5, 0xd6, 0x5a, 0x3b, 0x6a, 0xb1, 0xd6, 0x5a, 0x33, 0xa5, 0x94, 0x82, 0x10, 0x42, 0xe7, 0x00, 0x00,
+    0x10, 0x00, 0x08, 0x01, 0x00, 0x1a, 0x00, 0xac, 0x01, 0x00, 0x1a, 0x00, 0xac, 0xb5, 0xd6, 0x5a, 0x6b, 0xac, 0xb5, 0xd6, 0x5a, 0x63, 0x6a, 0xb5,
+    0xd6, 0x1a, 0x63, 0x6a, 0x31, 0xc6, 0x18, 0x63, 0xc6, 0x98, 0x81, 0x10, 0x3a, 0xe7, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x00,
+    0x00, 0x00, 0x1a, 0x63, 0x00, 0xb4, 0xd6, 0x1a, 0x63, 0x6a, 0xb5, 0xd6, 0x1a, 0x63, 0x6a, 0xb5, 0xd6, 0x1a, 0x5b, 0x4a, 0x31, 0xc6, 0x18, 0x5b,
+    0x84, 0x88, 0x81, 0x10, 0x3a, 0xa5, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x00, 0x1a, 0x63, 0x00, 0x80, 0xd6, 0x1a,
+    0x63, 0x66, 0xb5, 0xd6, 0x1a, 0x63, 0x67, 0xb5, 0xd6, 0x1a, 0x5b, 0x46, 0x31, 0xc6, 0x18, 0x5b, 0xc6, 0x98, 0x81, 0x10, 0x3a, 0xe7, 0x00, 0x00,
+    0x10, 0x3a, 0xc7, 0x00, 0x00, 0x10, 0x3a, 0x29, 0x01, 0x00, 0x1a, 0x63, 0x29, 0xb5, 0xd6, 0x1a, 0x63, 0x29, 0xb5, 0xd6, 0x1a, 0x63, 0x29, 0xb5,
+    0xd6, 0x1a, 0x5b, 0x29, 0x31, 0xc6, 0x18, 0x5b, 0xc6, 0x98, 0x81, 0x10, 0x3a, 0xc6, 0x00, 0x00, 0x10, 0x3a, 0xc6, 0x00, 0x00, 0x10, 0x3a, 0x4a,
+    0x01, 0x00, 0x18, 0x63, 0x4a, 0x29, 0xc6, 0x18, 0x63, 0x4a, 0x29, 0xc6, 0x18, 0x63, 0x29, 0x25, 0xc6, 0x18, 0x5b, 0x29, 0x25, 0xc6, 0x18, 0x5b,
+    0xc6, 0x98, 0x81, 0x10, 0x3a, 0xc6, 0x00, 0x00, 0x52, 0x3a, 0xc6, 0x00, 0x00, 0x50, 0x3a, 0x6a, 0x01, 0x00, 0xd6, 0x5a, 0x6a, 0xb5, 0xd5, 0xd6,
+    0x5a, 0x6a, 0xb5, 0xd6, 0xd6, 0x5a, 0x6a, 0xad, 0xb5, 0xd6, 0x5a, 0x4a, 0xad, 0xb5, 0x94, 0x52, 0xc6, 0x98, 0x21, 0xce, 0x39, 0xc6, 0x00, 0x00,
+    0xce, 0x39, 0xc6, 0x00, 0x00, 0x00, 0x38, 0x6a, 0x01, 0x00, 0x00, 0x50, 0x6a, 0xb5, 0x06, 0x00, 0x50, 0x6a, 0xb5, 0xd6, 0x9a, 0x52, 0x6a, 0xb5,
+    0xd6, 0x9a, 0x52, 0x4a, 0x31, 0xc6, 0x98, 0x52, 0xc6, 0x98, 0x81, 0x10, 0x32, 0xc6, 0x00, 0x00, 0x52, 0x42, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x6a,
+    0x01, 0x00, 0x00, 0x00, 0x6a, 0xb5, 0xd6, 0x00, 0x00, 0x6a, 0xb5, 0xd6, 0x1a, 0x43, 0x6a, 0xb5, 0xd6, 0x1a, 0x3b, 0x4a, 0x31, 0xc6, 0x18, 0x33,
+    0xc6, 0x98, 0x81, 0x10, 0x3a, 0xc6, 0x00, 0x00, 0x52, 0x4a, 0xc6, 0x00, 0x00, 0x12, 0x00, 0x6a, 0x01, 0x00, 0x1a, 0x00, 0x6a, 0xb5, 0xd6, 0x1a,
+    0x00, 0x6a, 0xb5, 0xd6, 0x1a, 0x63, 0x6a, 0xb5, 0xd6, 0x1a, 0x5b, 0x4a, 0x31, 0xc6, 0x18, 0x5b, 0xc6, 0x98, 0x91, 0x52, 0x3a, 0xe7, 0x00, 0x00,
+    0x52, 0x4a, 0x08, 0x01, 0x00, 0x94, 0x4a, 0x00, 0x00, 0x00, 0x92, 0x4a, 0x00, 0x30, 0xc6, 0x18, 0x5b, 0x00, 0x30, 0xc6, 0x18, 0x5b, 0x8b, 0x31,
+    0xc6, 0x18, 0x5b, 0x69, 0x31, 0xc6, 0xd8, 0x52, 0x84, 0x88, 0x91, 0x52, 0x3a, 0xa5, 0x00, 0x00, 0x52, 0x4a, 0xc6, 0x00, 0x00, 0x94, 0x4a, 0x00,
+    0x00, 0x00, 0x92, 0x4a, 0x00, 0x00, 0xc6, 0x18, 0x5b, 0x00, 0x00, 0xc6, 0x18, 0x5b, 0x87, 0x31, 0xc6, 0x18, 0x5b, 0x67, 0x31, 0xc6, 0xd8, 0x52,
+    0xc6, 0x98, 0x91, 0x52, 0x3a, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x08, 0x01, 0x00, 0x94, 0x4a, 0x08, 0x00, 0x00, 0x92, 0x4a, 0x08, 0x00, 0xd0, 0x18,
+    0x5b, 0x08, 0x00, 0xd0, 0x18, 0x5b, 0x08, 0xb5, 0xd6, 0x18, 0x5b, 0x08, 0x31, 0xc6, 0xd8, 0x52, 0xc6, 0x98, 0x91, 0x52, 0x3a, 0xe7, 0x00, 0x00,
+    0x52, 0x4a, 0x08, 0x01, 0x00, 0x94, 0x4a, 0xe8, 0x00, 0x00, 0x92, 0x4a, 0x4a, 0x01, 0x00, 0x18, 0x5b, 0x4a, 0x01, 0x00, 0x18, 0x5b, 0x4a, 0x29,
+    0xc6, 0x18, 0x5b, 0x49, 0x29, 0xc6, 0xd8, 0x52, 0xc6, 0x98, 0x81, 0x10, 0x3a, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x08, 0x01, 0x00, 0x94, 0x4a, 0xe8,
+    0x00, 0x00, 0x80, 0x4a, 0x6a, 0x2d, 0x00, 0x80, 0x52, 0x6a, 0x2d, 0x00, 0x80, 0x52, 0x6a, 0xad, 0xb5, 0x94, 0x52, 0x69, 0xad, 0xb5, 0x94, 0x52,
+    0xc6, 0x98, 0x21, 0x10, 0x42, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x08, 0x01, 0x00, 0x94, 0x52, 0xe8, 0x00, 0x00, 0x00, 0x50, 0x8a, 0xb1, 0x06, 0x00,
+    0x50, 0x8a, 0xb1, 0x06, 0x00, 0x48, 0x8a, 0xb1, 0xd6, 0x5a, 0x4a, 0x69, 0x31, 0xc6, 0x58, 0x4a, 0xc6, 0x98, 0x91, 0x52, 0x32, 0xe7, 0x00, 0x00,
+    0xd6, 0x3a, 0x08, 0x01, 0x00, 0xd4, 0x42, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x31, 0xd6, 0x00, 0x00, 0x8a, 0x31, 0xd6, 0x00, 0x00, 0x8a, 0x31,
+    0xd6, 0x5a, 0x4b, 0x69, 0x31, 0xc6, 0xd8, 0x3a, 0xc6, 0x98, 0x91, 0x52, 0x42, 0xe7, 0x00, 0x00, 0x94, 0x4a, 0x08, 0x01, 0x00, 0xd6, 0x5a, 0xe8,
+    0x00, 0x00, 0x16, 0x00, 0x8a, 0x31, 0xc6, 0x18, 0x00, 0x8a, 0x31, 0xc6, 0x18, 0x00, 0x8a, 0x31, 0xc6, 0x18, 0x5b, 0x69, 0x31, 0xc6, 0xd8, 0x52,
+    0xc6, 0x98, 0x91, 0x52, 0x3a, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x4a, 0x01, 0x00, 0x94, 0x52, 0xac, 0x01, 0x00, 0x5a, 0x53, 0x00, 0xb4, 0xd6, 0x5a,
+    0x53, 0x00, 0xb4, 0xd6, 0x5a, 0x53, 0x00, 0xac, 0xb5, 0xd6, 0x52, 0x6b, 0xad, 0xb5, 0xd6, 0x52, 0x84, 0x88, 0x91, 0x52, 0x3a, 0xa5, 0x00, 0x00,
+    0x52, 0x4a, 0xc6, 0x00, 0x00, 0x94, 0x52, 0xa8, 0x01, 0x00, 0x5a, 0x53, 0x00, 0x80, 0xd6, 0x5a, 0x53, 0x00, 0x80, 0xd6, 0x5a, 0x53, 0x00, 0x00,
+    0xc6, 0xd6, 0x52, 0x88, 0x31, 0xc6, 0xd6, 0x52, 0xc6, 0x98, 0x91, 0x52, 0x3a, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x4a, 0x01, 0x00, 0x94, 0x52, 0x4a,
+    0x01, 0x00, 0x5c, 0x53, 0x0a, 0x00, 0xe0, 0x5c, 0x53, 0x0a, 0x00, 0xe0, 0x5c, 0x53, 0x09, 0x00, 0xc0, 0xd8, 0x52, 0x29, 0x31, 0xc6, 0xd8, 0x52,
+    0xc6, 0x98, 0x91, 0x52, 0x3a, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x08, 0x01, 0x00, 0x94, 0x52, 0x69, 0x01, 0x00, 0x5a, 0x53, 0x69, 0x01, 0x00, 0x5a,
+    0x53, 0x69, 0x01, 0x00, 0x5a, 0x53, 0x48, 0x01, 0x00, 0xd8, 0x52, 0x48, 0x29, 0xc6, 0xd8, 0x52, 0xc6, 0x98, 0x81, 0x10, 0x3a, 0xe7, 0x00, 0x00,
+    0x52, 0x4a, 0x08, 0x01, 0x00, 0x18, 0x53, 0x89, 0x01, 0x00, 0x18, 0x53, 0x89, 0x31, 0x00, 0x00, 0x53, 0x8a, 0x31, 0x00, 0x00, 0x53, 0x6a, 0x31,
+    0x00, 0xc0, 0x4a, 0x6a, 0x31, 0xc6, 0xd6, 0x4a, 0xc6, 0x98, 0x21, 0x10, 0x42, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x08, 0x01, 0x00, 0x94, 0x52, 0xa9,
+    0x01, 0x00, 0x1c, 0x63, 0xa9, 0x39, 0x07, 0x00, 0x60, 0xaa, 0x39, 0x07, 0x00, 0x60, 0x6a, 0x31, 0x06, 0x00, 0x50, 0x6a, 0x31, 0xc6, 0x98, 0x52,
+    0xc6, 0x98, 0x91, 0x52, 0x32, 0xe7, 0x00, 0x00, 0xd6, 0x3a, 0x08, 0x01, 0x00, 0x5a, 0x43, 0xa9, 0x01, 0x00, 0x9c, 0x43, 0xa9, 0x35, 0xe7, 0x00,
+    0x00, 0xaa, 0x35, 0xe7, 0x00, 0x00, 0x6a, 0x2d, 0xc6, 0x00, 0x00, 0x6a, 0x2d, 0xc6, 0x18, 0x43, 0xc6, 0x98, 0x91, 0x52, 0x42, 0xe7, 0x00, 0x00,
+    0x94, 0x52, 0x08, 0x01, 0x00, 0x18, 0x53, 0xa9, 0x01, 0x00, 0x5a, 0x6b, 0xa9, 0xb5, 0xd6, 0x1a, 0x00, 0xaa, 0xb5, 0xd6, 0x1a, 0x00, 0x6a, 0xad,
+    0xb5, 0x18, 0x00, 0x6a, 0xad, 0xb5, 0x18, 0x63, 0xc6, 0x98, 0x91, 0x52, 0x3a, 0x08, 0x01, 0x00, 0x52, 0x4a, 0x6b, 0x01, 0x00, 0x94, 0x52, 0x8b,
+    0x01, 0x00, 0x5a, 0x63, 0x8c, 0xb5, 0xd6, 0x5a, 0x63, 0x00, 0xb4, 0xd6, 0x5a, 0x63, 0x00, 0xb4, 0xd6, 0x1a, 0x63, 0x00, 0xa8, 0x94, 0x50, 0x42,
+    0x84, 0x88, 0x91, 0x52, 0x3a, 0xa5, 0x00, 0x00, 0x52, 0x4a, 0xe7, 0x00, 0x00, 0x94, 0x52, 0x88, 0x01, 0x00, 0x5a, 0x63, 0xc7, 0x39, 0xd7, 0x5a,
+    0x63, 0x00, 0x00, 0xd7, 0x5a, 0x63, 0x00, 0x00, 0xd7, 0x1a, 0x63, 0x00, 0x80, 0xa4, 0x52, 0x42, 0xc6, 0x98, 0x91, 0x52, 0x3a, 0xe7, 0x00, 0x00,
+    0x52, 0x4a, 0x4a, 0x01, 0x00, 0x94, 0x52, 0x4a, 0x01, 0x00, 0x5c, 0x63, 0x4a, 0x39, 0xe7, 0x5c, 0x63, 0x0a, 0x00, 0xe0, 0x5c, 0x63, 0x0a, 0x00,
+    0xe0, 0x5c, 0x63, 0x09, 0x00, 0xa0, 0x52, 0x42, 0xc6, 0x98, 0x91, 0x52, 0x3a, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x08, 0x01, 0x00, 0x94, 0x52, 0x6b,
+    0x01, 0x00, 0x5a, 0x63, 0x6b, 0xad, 0xd6, 0x5a, 0x63, 0x6b, 0x01, 0x00, 0x5a, 0x63, 0x6a, 0x01, 0x00, 0x1a, 0x63, 0x29, 0x01, 0x00, 0x54, 0x42,
+    0xc6, 0x98, 0x81, 0x10, 0x3a, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x08, 0x01, 0x00, 0x18, 0x53, 0x8b, 0x01, 0x00, 0x18, 0x5b, 0x8c, 0xb5, 0xd6, 0x18,
+    0x5b, 0x8c, 0x35, 0x00, 0x00, 0x5b, 0x8c, 0x35, 0x00, 0x00, 0x5b, 0x28, 0x29, 0x00, 0x40, 0x4a, 0xc6, 0x98, 0x21, 0x10, 0x42, 0xe7, 0x00, 0x00,
+    0x52, 0x4a, 0x08, 0x01, 0x00, 0xd6, 0x5a, 0x8b, 0x01, 0x00, 0x9c, 0x5a, 0xac, 0x39, 0xe7, 0xdc, 0x5a, 0xac, 0x39, 0x07, 0x00, 0x58, 0xac, 0x39,
+    0x07, 0x00, 0x58, 0x28, 0x25, 0x05, 0x00, 0x50, 0xc6, 0x98, 0x91, 0x52, 0x32, 0xe7, 0x00, 0x00, 0xd6, 0x3a, 0x08, 0x01, 0x00, 0x5a, 0x43, 0x8b,
+    0x01, 0x00, 0x5c, 0x43, 0x8c, 0x35, 0xe7, 0x9c, 0x4b, 0x8c, 0x35, 0xe7, 0x00, 0x00, 0x8c, 0xb5, 0xe6, 0x00, 0x00, 0x28, 0x25, 0x95, 0x00, 0x00,
+    0xc6, 0x98, 0x91, 0x52, 0x4a, 0xe7, 0x00, 0x00, 0x94, 0x52, 0x08, 0x01, 0x00, 0x18, 0x5b, 0x8b, 0x01, 0x00, 0x5a, 0x63, 0x8c, 0xb5, 0xd6, 0x5a,
+    0x6b, 0x8c, 0xb5, 0xd6, 0x1a, 0x00, 0x8c, 0xb5, 0xd6, 0x1a, 0x00, 0x28, 0xa1, 0x94, 0x14, 0x00, 0xc6, 0x98, 0x91, 0x52, 0x3a, 0x08, 0x01, 0x00,
+    0x52, 0x4a, 0x6b, 0x01, 0x00, 0x94, 0x52, 0x8b, 0x01, 0x00, 0x5a, 0x63, 0x8b, 0xb5, 0xd6, 0x5a, 0x63, 0x8b, 0xb5, 0xd6, 0x5a, 0x63, 0x00, 0xb4,
+    0xd6, 0x1a, 0x63, 0x00, 0x30, 0xc6, 0x18, 0x63, 0x84, 0x88, 0x91, 0x52, 0x3a, 0xa5, 0x00, 0x00, 0x52, 0x4a, 0xe7, 0x00, 0x00, 0x94, 0x52, 0x87,
+    0x01, 0x00, 0x5a, 0x63, 0x87, 0xb5, 0xd6, 0x5a, 0x63, 0xa8, 0xb5, 0xd6, 0x5a, 0x63, 0x00, 0x80, 0xd6, 0x1a, 0x63, 0x00, 0x80, 0xd6, 0x1a, 0x63,
+    0xc6, 0x98, 0x91, 0x52, 0x3a, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x4a, 0x01, 0x00, 0x94, 0x52, 0x4a, 0x01, 0x00, 0x5a, 0x63, 0x4a, 0xb5, 0xd6, 0x5a,
+    0x63, 0x4a, 0x39, 0xe7, 0x5a, 0x63, 0x09, 0x00, 0xe0, 0x5a, 0x63, 0x09, 0x00, 0xe0, 0x5a, 0x63, 0xc6, 0x98, 0x91, 0x52, 0x3a, 0xe7, 0x00, 0x00,
+    0x52, 0x4a, 0x08, 0x01, 0x00, 0x94, 0x52, 0x6b, 0x01, 0x00, 0x5a, 0x63, 0x6b, 0xad, 0xd6, 0x5a, 0x63, 0x6b, 0xad, 0xd6, 0x5a, 0x63, 0x4a, 0x01,
+    0x00, 0x5a, 0x63, 0x4a, 0x01, 0x00, 0x5a, 0x63, 0xc6, 0x98, 0x81, 0x10, 0x3a, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x08, 0x01, 0x00, 0x18, 0x53, 0x8b,
+    0x01, 0x00, 0x18, 0x5b, 0x8b, 0x31, 0xc6, 0x18, 0x5b, 0x8b, 0x31, 0xc6, 0x18, 0x5b, 0x8b, 0x31, 0x00, 0xc0, 0x5a, 0x8b, 0x31, 0x00, 0xc0, 0x5a,
+    0xc6, 0x98, 0x21, 0x10, 0x42, 0xe7, 0x00, 0x00, 0x52, 0x4a, 0x08, 0x01, 0x00, 0xd6, 0x5a, 0x8b, 0x01, 0x00, 0x9a, 0x5a, 0x8b, 0xb5, 0xd6, 0xda,
+    0x5a, 0xab, 0x35, 0xe7, 0x9c, 0x5a, 0xab, 0x35, 0x07, 0x00, 0x58, 0xab, 0x35, 0x07, 0x00, 0x50, 0xc6, 0x98, 0x91, 0x52, 0x32, 0xe7, 0x00, 0x00,
+    0xd6, 0x3a, 0x08, 0x01, 0x00, 0x5a, 0x43, 0x8b, 0x01, 0x00, 0x5a, 0x3b, 0x8b, 0xb5, 0xd6, 0x5a, 0x43, 0x8b, 0xb5, 0xe6, 0x9c, 0x43, 0x8b, 0xb5,
+    0xe6, 0x00, 0x00, 0x8b, 0xb5, 0xe6, 0x00, 0x00, 0xc6, 0x98, 0x91, 0x52, 0x4a, 0xe7, 0x00, 0x00, 0x94, 0x52, 0x08, 0x01, 0x00, 0x18, 0x5b, 0x8b,
+    0x01, 0x00, 0x5a, 0x63, 0x8b, 0xb5, 0xd6, 0x5a, 0x63, 0x8b, 0xb5, 0xd6, 0x5a, 0x63, 0x8b, 0xb5, 0xd6, 0x1a, 0x00, 0x8b, 0x31, 0xc6, 0x18, 0x00,
+    0x00, 0x28, 0xa5, 0x94, 0x42, 0x00, 0x28, 0xb5, 0xd6, 0x4a, 0x4a, 0x01, 0x00, 0xd6, 0x52, 0x4a, 0x01, 0x00, 0x18, 0x53, 0x6a, 0x01, 0x00, 0x18,
+    0x53, 0x6a, 0x2d, 0xc6, 0x18, 0x53, 0x6a, 0x2d, 0xc6, 0x18, 0x53, 0x28, 0x29, 0xa5, 0x94, 0x52, 0x00, 0x00, 0xa5, 0x94, 0x42, 0x00, 0x00, 0xb5,
+    0xd6, 0x4a, 0x27, 0x01, 0x00, 0xd6, 0x52, 0xe6, 0x00, 0x00, 0x18, 0x53, 0x67, 0x01, 0x00, 0x18, 0x53, 0x66, 0x31, 0xc6, 0x18, 0x53, 0x65, 0x31,
+    0xc6, 0x18, 0x53, 0x26, 0x29, 0xa5, 0x94, 0x52, 0x08, 0x00, 0xa0, 0x94, 0x42, 0x09, 0x00, 0xb0, 0xd6, 0x4a, 0x09, 0x01, 0x00, 0xd6, 0x52, 0x4a,
+    0x01, 0x00, 0x18, 0x53, 0x2a, 0x01, 0x00, 0x18, 0x53, 0x4a, 0x31, 0xc6, 0x18, 0x53, 0x29, 0x31, 0xc6, 0x18, 0x53, 0x08, 0x29, 0xa5, 0x94, 0x52,
+    0x28, 0x01, 0x00, 0x94, 0x42, 0x29, 0x01, 0x00, 0xd6, 0x4a, 0x29, 0x01, 0x00, 0xd6, 0x52, 0x4a, 0x01, 0x00, 0x18, 0x53, 0x2a, 0x01, 0x00, 0x18,
+    0x53, 0x4a, 0x31, 0xc6, 0x18, 0x53, 0x29, 0x31, 0xc6, 0xd8, 0x52, 0xe7, 0x28, 0xa5, 0x94, 0x52, 0x28, 0x29, 0x00, 0x40, 0x4a, 0x29, 0x29, 0x00,
+    0x80, 0x52, 0x29, 0x01, 0x00, 0xd6, 0x5a, 0x29, 0x01, 0x00, 0x18, 0x5b, 0x6a, 0x01, 0x00, 0x16, 0x5b, 0x6a, 0xa9, 0xc5, 0x18, 0x53, 0x6a, 0xad,
+    0xb5, 0xd6, 0x52, 0x28, 0xa5, 0xb4, 0xd6, 0x52, 0x28, 0xa5, 0x04, 0x00, 0x48, 0x29, 0xa5, 0x04, 0x00, 0x48, 0x29, 0x01, 0x00, 0x94, 0x52, 0x29,
+    0x01, 0x00, 0x94, 0x52, 0x6a, 0x01, 0x00, 0x9a, 0x52, 0x6a, 0xb1, 0xc6, 0x9a, 0x52, 0x6a, 0xb1, 0xd6, 0x5a, 0x52, 0x28, 0x29, 0xa5, 0x94, 0x52,
+    0x28, 0x25, 0xb5, 0x00, 0x00, 0x29, 0x25, 0xb5, 0x00, 0x00, 0x29, 0x01, 0x00, 0xd6, 0x42, 0x29, 0x01, 0x00, 0x18, 0x43, 0x6a, 0x01, 0x00, 0x18,
+    0x3b, 0x6a, 0x2d, 0xc6, 0x18, 0x43, 0x6a, 0x2d, 0xc6, 0x18, 0x3b, 0x28, 0x29, 0xa5, 0x94, 0x32, 0x28, 0x25, 0xb5, 0x16, 0x00, 0x29, 0x25, 0xb5,
+    0x16, 0x00, 0x29, 0x01, 0x00, 0xd6, 0x5a, 0x29, 0x01, 0x00, 0x18, 0x5b, 0x6a, 0x01, 0x00, 0x18, 0x5b, 0x6a, 0x2d, 0xc6, 0x18, 0x5b, 0x6a, 0x2d,
+    0xc6, 0x18, 0x53, 0x28, 0x29, 0xa5, 0x94, 0x52, 0x00, 0x1c, 0x73, 0x4c, 0x31, 0x00, 0xa4, 0xb3, 0xd6, 0x4a, 0x00, 0x00, 0x00, 0x18, 0x53, 0x4a,
+    0x01, 0x00, 0x18, 0x53, 0x6a, 0x01, 0x00, 0x18, 0x53, 0x6a, 0x2d, 0xc6, 0x18, 0x53, 0x6a, 0x2d, 0xc6, 0x18, 0x53, 0x28, 0x29, 0xa5, 0x94, 0x52,
+    0x00, 0x80, 0x73, 0x4c, 0x31, 0x00, 0x80, 0xb3, 0xd6, 0x4a, 0x00, 0x00, 0x00, 0x18, 0x53, 0xe7, 0x00, 0x00, 0x18, 0x53, 0x67, 0x01, 0x00, 0x18,
+    0x53, 0x66, 0x31, 0xc6, 0x18, 0x53, 0x65, 0x31, 0xc6, 0x18, 0x53, 0x26, 0x29, 0xa5, 0x94, 0x52, 0x05, 0x00, 0x70, 0x4c, 0x31, 0x09, 0x00, 0xb0,
+    0xd6, 0x4a, 0x09, 0x00, 0x00, 0x18, 0x53, 0x4a, 0x01, 0x00, 0x18, 0x53, 0x2a, 0x01, 0x00, 0x18, 0x53, 0x4a, 0x31, 0xc6, 0x18, 0x53, 0x29, 0x31,
+    0xc6, 0x18, 0x53, 0x08, 0x29, 0xa5, 0x94, 0x52, 0xa5, 0x00, 0x00, 0x4c, 0x31, 0x29, 0x01, 0x00, 0x18, 0x4b, 0x09, 0x01, 0x00, 0x18, 0x53, 0x4a,
+    0x01, 0x00, 0x18, 0x53, 0x2a, 0x01, 0x00, 0x18, 0x53, 0x4a, 0x31, 0xc6, 0x18, 0x53, 0x29, 0x31, 0xc6, 0xd8, 0x52, 0xe7, 0x28, 0xa5, 0x94, 0x52,
+    0xa4, 0x18, 0x00, 0x80, 0x31, 0x29, 0x25, 0x00, 0x80, 0x4a, 0x09, 0x01, 0x00, 0xc0, 0x5a, 0x29, 0x01, 0x00, 0x18, 0x5b, 0x6a, 0x01, 0x00, 0x16,
+    0x5b, 0x6a, 0xa9, 0xc5, 0x18, 0x53, 0x6a, 0xad, 0xb5, 0xd6, 0x52, 0x28, 0xa5, 0xb4, 0xd6, 0x52, 0xa4, 0x98, 0x03, 0x00, 0x28, 0x29, 0xa5, 0x03,
+    0x00, 0x58, 0x09, 0x01, 0x00, 0x00, 0x58, 0x29, 0x01, 0x00, 0xd6, 0x5a, 0x6a, 0x01, 0x00, 0x9a, 0x52, 0x6a, 0xb1, 0xc6, 0x9a, 0x52, 0x6a, 0xb1,
+    0xd6, 0x5a, 0x52, 0x28, 0x29, 0xa5, 0x94, 0x52, 0xa4, 0x98, 0x73, 0x00, 0x00, 0x29, 0xa5, 0xc3, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x29,
+    0x01, 0x00, 0x18, 0x4b, 0x6a, 0x01, 0x00, 0x18, 0x43, 0x6a, 0x2d, 0xc6, 0x18, 0x43, 0x6a, 0x2d, 0xc6, 0x18, 0x3b, 0x28, 0x29, 0xa5, 0x94, 0x32,
+    0xa4, 0x98, 0x63, 0x0e, 0x00, 0x29, 0xa5, 0xb3, 0x18, 0x00, 0x09, 0x01, 0x00, 0x18, 0x00, 0x29, 0x01, 0x00, 0x18, 0x63, 0x6a, 0x01, 0x00, 0x18,
+    0x5b, 0x6a, 0x2d, 0xc6, 0x18, 0x5b, 0x6a, 0x2d, 0xc6, 0x18, 0x53, 0x28, 0x29, 0xa5, 0x94, 0x52, 0x28, 0x25, 0xa5, 0x54, 0x42, 0x00, 0x20, 0x95,
+    0x54, 0x42, 0x00, 0x00, 0x00, 0x18, 0x53, 0x00, 0x00, 0x00, 0x18, 0x53, 0x6a, 0x01, 0x00, 0x18, 0x53, 0x6a, 0x2d, 0xc6, 0x18, 0x53, 0x6a, 0x2d,
+    0xc6, 0x18, 0x53, 0x28, 0x29, 0xa5, 0x94, 0x52, 0x25, 0x25, 0xa5, 0x54, 0x42, 0x00, 0x00, 0x95, 0x54, 0x42, 0x00, 0x00, 0x00, 0x18, 0x53, 0x00,
+    0x00, 0x00, 0x18, 0x53, 0x67, 0x01, 0x00, 0x18, 0x53, 0x66, 0x31, 0xc6, 0x18, 0x53, 0x65, 0x31, 0xc6, 0x18, 0x53, 0x26, 0x29, 0xa5, 0x94, 0x52,
+    0xe7, 0x28, 0xa5, 0x54, 0x42, 0xe7, 0x28, 0xa5, 0x54, 0x42, 0x4a, 0x01, 0x00, 0x18, 0x53, 0x4a, 0x01, 0x00, 0x18, 0x53, 0x4a, 0x01, 0x00, 0x5a,
+    0x53, 0x4a, 0x31, 0xd6, 0x58, 0x53, 0x29, 0x31, 0xd6, 0x5a, 0x53, 0x08, 0x29, 0xa5, 0x94, 0x52, 0x08, 0xa1, 0x94, 0x52, 0x42, 0xe8, 0xa0, 0x94,
+    0x52, 0x42, 0x29, 0x01, 0x00, 0x5a, 0x53, 0x4a, 0x01, 0x00, 0x58, 0x53, 0x2a, 0x01, 0x00, 0x5a, 0x53, 0x4a, 0x31, 0xc6, 0x18, 0x53, 0x29, 0x31,
+    0xc6, 0xd8, 0x52, 0xe7, 0x28, 0xa5, 0x94, 0x52, 0x28, 0x29, 0xa5, 0x10, 0x42, 0x28, 0xa9, 0xa4, 0x10, 0x42, 0x29, 0x01, 0x00, 0xd6, 0x52, 0x29,
+    0x01, 0x00, 0x18, 0x53, 0x6a, 0x01, 0x00, 0x16, 0x53, 0x6a, 0xa9, 0xc5, 0x18, 0x53, 0x6a, 0xad, 0xb5, 0xd6, 0x52, 0x28, 0xa5, 0xb4, 0xd6, 0x52,
+    0x28, 0xa5, 0x94, 0xd2, 0x39, 0x28, 0xa1, 0x04, 0x00, 0x38, 0x29, 0x01, 0x00, 0x00, 0x58, 0x29, 0x01, 0x00, 0x00, 0x58, 0x6a, 0x01, 0x00, 0xda,
+    0x5a, 0x6a, 0xb1, 0xc6, 0x9a, 0x52, 0x6a, 0xb1, 0xd6, 0x5a, 0x52, 0x28, 0x29, 0xa5, 0x94, 0x52, 0x28, 0x25, 0xa5, 0x54, 0x42, 0x28, 0x21, 0x95,
+    0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x5a, 0x43, 0x6a, 0x2d, 0xd6, 0x58, 0x43, 0x6a, 0x2d,
+    0xd6, 0x5a, 0x3b, 0x28, 0x29, 0xa5, 0x94, 0x32, 0x28, 0x25, 0xa5, 0x54, 0x4a, 0x28, 0x21, 0x95, 0x14, 0x00, 0x29, 0x01, 0x00, 0x1a, 0x00, 0x29,
+    0x01, 0x00, 0x1a, 0x00, 0x6a, 0x01, 0x00, 0x5a, 0x6b, 0x6a, 0x2d, 0xc6, 0x18, 0x53, 0x6a, 0x2d, 0xc6, 0x18, 0x53, 0x28, 0x29, 0xa5, 0x94, 0x52,
+    0x28, 0x25, 0xa5, 0x54, 0x3a, 0x29, 0x25, 0x95, 0x54, 0x3a, 0x00, 0x00, 0x00, 0x18, 0x53, 0x00, 0x00, 0x00, 0x18, 0x53, 0x00, 0x00, 0x00, 0x18,
+    0x53, 0x6a, 0x2d, 0xc6, 0x18, 0x53, 0x6a, 0x2d, 0xc6, 0xd8, 0x52, 0x28, 0x29, 0xa5, 0x94, 0x52, 0x25, 0x25, 0xa5, 0x54, 0x3a, 0x25, 0x21, 0x95,
+    0x54, 0x3a, 0x00, 0x00, 0x00, 0x18, 0x53, 0x00, 0x00, 0x00, 0x18, 0x53, 0x00, 0x00, 0x00, 0x18, 0x53, 0x86, 0x31, 0xc6, 0x18, 0x53, 0x85, 0x31,
+    0xc6, 0xd8, 0x52, 0x26, 0x29, 0xa5, 0x94, 0x52, 0x08, 0x25, 0xa5, 0x54, 0x3a, 0xe8, 0x24, 0x95, 0x54, 0x3a, 0x08, 0x01, 0x00, 0x18, 0x53, 0x29,
+    0x01, 0x00, 0x18, 0x53, 0x29, 0x01, 0x00, 0x18, 0x53, 0x29, 0x35, 0xd6, 0x18, 0x53, 0x29, 0xb5, 0xd6, 0xd8, 0x52, 0x08, 0x29, 0xa5, 0x94, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xa5, 0x94, 0x52, 0x3a, 0x27, 0xa1, 0x94,
+    0x52, 0x3a, 0x4a, 0x01, 0x00, 0x52, 0x3a, 0x2a, 0x01, 0x00, 0xd6, 0x52, 0x6a, 0x01, 0x00, 0xd6, 0x52, 0x6a, 0xa9, 0xb5, 0xd6, 0x52, 0x6a, 0xad,
+    0xb5, 0xd6, 0x52, 0x28, 0xa5, 0xa4, 0x94, 0x52, 0x27, 0xa5, 0x94, 0x12, 0x42, 0x27, 0xa1, 0x84, 0x12, 0x42, 0x4a, 0x01, 0x00, 0x00, 0x40, 0x2a,
+    0x01, 0x00, 0x00, 0x50, 0x6a, 0x01, 0x00, 0x00, 0x50, 0x6a, 0x31, 0xc6, 0x98, 0x52, 0x6a, 0x31, 0xc6, 0x98, 0x52, 0x28, 0x29, 0xa5, 0x94, 0x52,
+    0x27, 0xa5, 0x94, 0x52, 0x32, 0x27, 0xa1, 0xa4, 0x94, 0x42, 0x4a, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x00,
+    0x00, 0x6a, 0x2d, 0xc6, 0x18, 0x43, 0x6a, 0x2d, 0xc6, 0x18, 0x3b, 0x28, 0x29, 0xa5, 0x94, 0x32, 0x27, 0xa5, 0xa4, 0x94, 0x42, 0x27, 0xa1, 0xa4,
+    0x94, 0x52, 0x4a, 0x01, 0x00, 0x14, 0x00, 0x2a, 0x01, 0x00, 0x18, 0x00, 0x6a, 0x01, 0x00, 0x18, 0x00, 0x6a, 0x2d, 0xc6, 0x18, 0x63, 0x6a, 0x2d,
+    0xc6, 0x18, 0x5b, 0x28, 0x29, 0xa5, 0x94, 0x52, 0x28, 0xa5, 0xa4, 0x94, 0x42, 0x29, 0xa5, 0xb4, 0xd6, 0x4a, 0x4a, 0x01, 0x00, 0xd4, 0x4a, 0x00,
+    0x00, 0x00, 0xd6, 0x4a, 0x00, 0x00, 0x00, 0xd8, 0x5a, 0x00, 0x2c, 0xb6, 0xd8, 0x5a, 0x49, 0x2d, 0xc6, 0xd8, 0x5a, 0x49, 0xad, 0xb5, 0x94, 0x52,
+    0x24, 0xa5, 0xa4, 0x94, 0x42, 0x25, 0xa1, 0xb4, 0xd6, 0x4a, 0x26, 0x01, 0x00, 0xd4, 0x4a, 0x00, 0x00, 0x00, 0xd6, 0x4a, 0x00, 0x00, 0x00, 0xd8,
+    0x5a, 0x00, 0x00, 0xb6, 0xd8, 0x5a, 0x46, 0x2d, 0xc6, 0xd8, 0x5a, 0x26, 0xad, 0xb5, 0x94, 0x52, 0x08, 0xa5, 0xa4, 0x94, 0x42, 0x29, 0xa5, 0xb4,
+    0xd6, 0x4a, 0x4a, 0x01, 0x00, 0xd4, 0x4a, 0x2a, 0x01, 0x00, 0xd6, 0x4a, 0x4a, 0x01, 0x00, 0xd8, 0x5a, 0x08, 0x2d, 0xb6, 0xd8, 0x5a, 0x08, 0x2d,
+    0xc6, 0xd8, 0x5a, 0x08, 0x29, 0xa5, 0x94, 0x52, 0xe7, 0x28, 0xa5, 0x94, 0x42, 0x29, 0xa9, 0xb4, 0xd6, 0x4a, 0x09, 0x01, 0x00, 0xd4, 0x4a, 0x29,
+    0x01, 0x00, 0xd6, 0x4a, 0x29, 0x01, 0x00, 0xd6, 0x52, 0x29, 0xa5, 0xb5, 0xd6, 0x52, 0x29, 0xa5, 0xb5, 0xd6, 0x52, 0xe7, 0x1c, 0xa5, 0x94, 0x52,
+    0x28, 0xa5, 0x94, 0x52, 0x42, 0x29, 0xa5, 0xa4, 0x94, 0x4a, 0x29, 0x01, 0x00, 0x18, 0x4b, 0x29, 0x01, 0x00, 0x14, 0x4b, 0x49, 0x01, 0x00, 0x18,
+    0x53, 0x49, 0x31, 0xc5, 0x94, 0x52, 0x49, 0x31, 0xc6, 0x94, 0x52, 0x28, 0xa5, 0xa4, 0x94, 0x52, 0x28, 0xa5, 0x94, 0x12, 0x42, 0x29, 0xa5, 0x84,
+    0x52, 0x4a, 0x29, 0x01, 0x00, 0x94, 0x52, 0x29, 0x01, 0x00, 0x00, 0x50, 0x49, 0x01, 0x00, 0x00, 0x50, 0x49, 0x2d, 0x06, 0x00, 0x48, 0x49, 0x2d,
+    0xc6, 0x58, 0x4a, 0x28, 0x29, 0xa5, 0x54, 0x4a, 0x28, 0xa5, 0x94, 0x52, 0x32, 0x29, 0xa5, 0xb4, 0xd6, 0x3a, 0x29, 0x01, 0x00, 0xd6, 0x42, 0x29,
+    0x01, 0x00, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x00, 0x49, 0x2d, 0xb6, 0x00, 0x00, 0x49, 0x2d, 0xc6, 0xd8, 0x4a, 0x28, 0xa9, 0xb5, 0x96, 0x32,
+    0x28, 0xa5, 0xa4, 0x94, 0x42, 0x29, 0xa5, 0xb4, 0xd6, 0x4a, 0x29, 0x01, 0x00, 0x18, 0x63, 0x29, 0x01, 0x00, 0x18, 0x00, 0x49, 0x01, 0x00, 0x18,
+    0x00, 0x49, 0x2d, 0xb6, 0x18, 0x00, 0x49, 0x2d, 0xc6, 0xd8, 0x5a, 0x28, 0xa9, 0xb5, 0x96, 0x52, 0x28, 0xa5, 0xa4, 0x94, 0x42, 0x29, 0xa5, 0xb4,
+    0xd6, 0x4a, 0x29, 0x01, 0x00, 0x18, 0x53, 0x29, 0x01, 0x00, 0x5a, 0x53, 0x00, 0x00, 0x00, 0x58, 0x53, 0x00, 0x28, 0xd5, 0x5a, 0x53, 0x00, 0x28,
+    0xa5, 0x54, 0x52, 0x29, 0x29, 0xa5, 0x94, 0x52, 0x24, 0xa5, 0xa4, 0x94, 0x42, 0x25, 0xa1, 0xb4, 0xd6, 0x4a, 0x26, 0x01, 0x00, 0x18, 0x53, 0xe7,
+    0x00, 0x00, 0x5a, 0x53, 0x00, 0x00, 0x00, 0x58, 0x53, 0x00, 0x80, 0xd5, 0x5a, 0x53, 0x00, 0x80, 0xa5, 0x54, 0x52, 0x65, 0xad, 0xa5, 0x94, 0x52,
+    0x08, 0xa5, 0xa4, 0x94, 0x42, 0x29, 0xa5, 0xb4, 0xd6, 0x4a, 0x09, 0x01, 0x00, 0x18, 0x53, 0x29, 0x01, 0x00, 0x5a, 0x53, 0x09, 0x00, 0x00, 0x58,
+    0x53, 0x09, 0x00, 0xd0, 0x5a, 0x53, 0x07, 0x00, 0xb0, 0x54, 0x52, 0xe7, 0xac, 0xb5, 0x94, 0x52, 0xe7, 0x28, 0xa5, 0x94, 0x42, 0x29, 0xa9, 0xb4,
+    0xd6, 0x4a, 0x09, 0x01, 0x00, 0x18, 0x53, 0x29, 0x01, 0x00, 0x18, 0x53, 0x09, 0x01, 0x00, 0x18, 0x53, 0x29, 0x01, 0x00, 0x18, 0x53, 0x08, 0x01,
+    0x00, 0x94, 0x52, 0x08, 0x21, 0xa5, 0x94, 0x52, 0x28, 0xa5, 0x94, 0x52, 0x42, 0x29, 0xa5, 0xa4, 0x94, 0x4a, 0x29, 0x01, 0x00, 0xd6, 0x52, 0x29,
+    0x01, 0x00, 0x18, 0x53, 0x09, 0x01, 0x00, 0x00, 0x53, 0x29, 0x29, 0x00, 0x00, 0x53, 0x28, 0x29, 0x00, 0x40, 0x4a, 0x28, 0x29, 0xa5, 0x52, 0x4a,
+    0x28, 0xa5, 0x94, 0x12, 0x42, 0x29, 0xa5, 0x84, 0x52, 0x4a, 0x29, 0x01, 0x00, 0x94, 0x52, 0x29, 0x01, 0x00, 0xd6, 0x5a, 0x09, 0x01, 0x00, 0x00,
+    0x58, 0x29, 0xa9, 0x05, 0x00, 0x58, 0x28, 0xa9, 0x05, 0x00, 0x40, 0x28, 0xa9, 0xb5, 0x16, 0x42, 0x28, 0xa5, 0x94, 0x52, 0x32, 0x29, 0xa5, 0xb4,
+    0xd6, 0x3a, 0x29, 0x01, 0x00, 0x18, 0x43, 0x29, 0x01, 0x00, 0x5a, 0x43, 0x09, 0x01, 0x00, 0x00, 0x00, 0x29, 0x29, 0xd5, 0x00, 0x00, 0x28, 0x29,
+    0xb5, 0x00, 0x00, 0x28, 0x29, 0xb5, 0xd6, 0x42, 0x28, 0xa5, 0xa4, 0x94, 0x42, 0x29, 0xa5, 0xb4, 0xd6, 0x52, 0x29, 0x01, 0x00, 0x18, 0x53, 0x29,
+    0x01, 0x00, 0x5a, 0x6b, 0x09, 0x01, 0x00, 0x1a, 0x00, 0x29, 0x29, 0xd5, 0x1a, 0x00, 0x28, 0x29, 0xa5, 0x14, 0x00, 0x28, 0x29, 0xa5, 0x94, 0x52,
+    0x28, 0xa5, 0xa4, 0x94, 0x42, 0x29, 0xa5, 0xb4, 0xd6, 0x4a, 0x29, 0x01, 0x00, 0xd6, 0x52, 0x4a, 0x01, 0x00, 0x18, 0x53, 0x6b, 0x01, 0x00, 0x18,
+    0x53, 0x00, 0x2c, 0xc6, 0x18, 0x53, 0x00, 0x2c, 0xc6, 0x18, 0x53, 0x00, 0x20, 0x74, 0xd0, 0x31, 0x24, 0xa5, 0xa4, 0x94, 0x42, 0x25, 0xa1, 0xb4,
+    0xd6, 0x4a, 0x26, 0x01, 0x00, 0xd6, 0x52, 0xe7, 0x00, 0x00, 0x18, 0x53, 0x87, 0x01, 0x00, 0x18, 0x53, 0x00, 0x00, 0xc6, 0x18, 0x53, 0x00, 0x00,
+    0xc6, 0x18, 0x53, 0x00, 0x80, 0x84, 0xd0, 0x31, 0x08, 0xa5, 0xa4, 0x94, 0x42, 0x29, 0xa5, 0xb4, 0xd6, 0x4a, 0x09, 0x01, 0x00, 0xd6, 0x52, 0x4a,
+    0x01, 0x00, 0x18, 0x53, 0x2a, 0x01, 0x00, 0x5a, 0x53, 0x0a, 0x00, 0xd0, 0x58, 0x53, 0x09, 0x00, 0xd0, 0x5a, 0x53, 0x08, 0x00, 0x80, 0xd0, 0x31,
+    0xe7, 0x28, 0xa5, 0x94, 0x42, 0x29, 0xa9, 0xb4, 0xd6, 0x4a, 0x09, 0x01, 0x00, 0xd6, 0x52, 0x29, 0x01, 0x00, 0x18, 0x53, 0x49, 0x01, 0x00, 0x18,
+    0x53, 0x49, 0x01, 0x00, 0x18, 0x53, 0x49, 0x01, 0x00, 0x18, 0x53, 0x06, 0x01, 0x00, 0xd0, 0x31, 0x28, 0xa5, 0x94, 0x52, 0x42, 0x29, 0xa5, 0xa4,
+    0x94, 0x4a, 0x29, 0x01, 0x00, 0xd6, 0x52, 0x29, 0x01, 0x00, 0x18, 0x5b, 0x69, 0x01, 0x00, 0x16, 0x5b, 0x69, 0x2d, 0x00, 0x00, 0x5b, 0x69, 0x2d,
+    0x00, 0xc0, 0x52, 0xe6, 0x20, 0x00, 0x40, 0x32, 0x28, 0xa5, 0x94, 0x12, 0x42, 0x29, 0xa5, 0x84, 0x52, 0x4a, 0x29, 0x01, 0x00, 0x94, 0x52, 0x29,
+    0x01, 0x00, 0x94, 0x52, 0x69, 0x01, 0x00, 0xda, 0x5a, 0x69, 0xb1, 0x06, 0x00, 0x58, 0x69, 0xb1, 0x06, 0x00, 0x58, 0xe6, 0x20, 0x04, 0x00, 0x40,
+    0x28, 0xa5, 0x94, 0x52, 0x32, 0x29, 0xa5, 0xb4, 0xd6, 0x3a, 0x29, 0x01, 0x00, 0xd6, 0x42, 0x29, 0x01, 0x00, 0x18, 0x43, 0x69, 0x01, 0x00, 0x5a,
+    0x4b, 0x69, 0x2d, 0xd6, 0x00, 0x00, 0x69, 0x2d, 0xd6, 0x00, 0x00, 0xe6, 0x20, 0x94, 0x00, 0x00, 0x28, 0xa5, 0xa4, 0x94, 0x4a, 0x29, 0xa5, 0xb4,
+    0xd6, 0x52, 0x29, 0x01, 0x00, 0xd6, 0x5a, 0x29, 0x01, 0x00, 0x18, 0x5b, 0x69, 0x01, 0x00, 0x5a, 0x6b, 0x69, 0x2d, 0xc6, 0x1a, 0x00, 0x69, 0x2d,
+    0xc6, 0x1a, 0x00, 0xe6, 0xa0, 0x83, 0x10, 0x00, 0x28, 0xa5, 0xa4, 0x94, 0x42, 0x29, 0xa5, 0xb4, 0xd6, 0x4a, 0x29, 0x01, 0x00, 0xd6, 0x52, 0x4a,
+    0x01, 0x00, 0x18, 0x53, 0x6b, 0x01, 0x00, 0x18, 0x53, 0x6b, 0x2d, 0xc6, 0x18, 0x53, 0x00, 0x2c, 0xc6, 0x18, 0x53, 0x00, 0xac, 0xb5, 0x96, 0x52,
+    0x24, 0xa5, 0xa4, 0x94, 0x42, 0x25, 0xa1, 0xb4, 0xd6, 0x4a, 0x26, 0x01, 0x00, 0xd6, 0x52, 0xe7, 0x00, 0x00, 0x18, 0x53, 0x66, 0x01, 0x00, 0x18,
+    0x53, 0x87, 0x31, 0xc6, 0x18, 0x53, 0x00, 0x00, 0xc6, 0x18, 0x53, 0x00, 0x00, 0xb6, 0x96, 0x52, 0x08, 0xa5, 0xa4, 0x94, 0x42, 0x29, 0xa5, 0xb4,
+    0xd6, 0x4a, 0x09, 0x01, 0x00, 0xd6, 0x52, 0x4a, 0x01, 0x00, 0x18, 0x53, 0x2a, 0x01, 0x00, 0x18, 0x53, 0x4a, 0xb5, 0xd6, 0x18, 0x53, 0x09, 0x00,
+    0xd0, 0x18, 0x53, 0x09, 0x00, 0xd0, 0x94, 0x52, 0xe7, 0x28, 0xa5, 0x94, 0x42, 0x29, 0xa9, 0xb4, 0xd6, 0x4a, 0x09, 0x01, 0x00, 0xd6, 0x52, 0x29,
+    0x01, 0x00, 0x18, 0x53, 0x4a, 0x01, 0x00, 0x18, 0x53, 0x4a, 0x29, 0xc6, 0x18, 0x53, 0x4a, 0x01, 0x00, 0x18, 0x53, 0x48, 0x01, 0x00, 0xd8, 0x52,
+    0x28, 0xa5, 0x94, 0x52, 0x42, 0x29, 0xa5, 0xa4, 0x94, 0x4a, 0x29, 0x01, 0x00, 0xd6, 0x52, 0x29, 0x01, 0x00, 0x18, 0x5b, 0x6a, 0x01, 0x00, 0x16,
+    0x5b, 0x6a, 0x31, 0xc6, 0x18, 0x5b, 0x6a, 0x31, 0x00, 0xc0, 0x52, 0x28, 0x31, 0x00, 0xc0, 0x52, 0x28, 0xa5, 0x94, 0x12, 0x42, 0x29, 0xa5, 0x84,
+    0x52, 0x4a, 0x29, 0x01, 0x00, 0x94, 0x52, 0x29, 0x01, 0x00, 0x94, 0x52, 0x6a, 0x01, 0x00, 0x9a, 0x52, 0x6a, 0xb1, 0xd6, 0x9a, 0x52, 0x6a, 0xb1,
+    0x06, 0x00, 0x50, 0x48, 0xa9, 0x06, 0x00, 0x50, 0x28, 0xa5, 0x94, 0x52, 0x32, 0x29, 0xa5, 0xb4, 0xd6, 0x3a, 0x29, 0x01, 0x00, 0xd6, 0x42, 0x29,
+    0x01, 0x00, 0x18, 0x3b, 0x6a, 0x01, 0x00, 0x18, 0x43, 0x6a, 0x2d, 0xd6, 0x5a, 0x43, 0x6a, 0x2d, 0xd6, 0x00, 0x00, 0x49, 0xad, 0xd5, 0x00, 0x00,
+    0x28, 0xa5, 0xa4, 0x94, 0x4a, 0x29, 0xa5, 0xb4, 0xd6, 0x52, 0x29, 0x01, 0x00, 0xd6, 0x5a, 0x29, 0x01, 0x00, 0x18, 0x5b, 0x6a, 0x01, 0x00, 0x18,
+    0x5b, 0x6a, 0x2d, 0xc6, 0x18, 0x63, 0x6a, 0x2d, 0xc6, 0x18, 0x00, 0x49, 0xad, 0xb5, 0x18, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char kqk_data[20482] = {  // KQK, 40960 entries of 4 bits
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x99, 0x99, 0x00, 0x87, 0x99, 0x99, 0x85, 0x88, 0xaa, 0xaa, 0x95, 0xaa, 0xaa, 0xaa,
+    0x96, 0xaa, 0xaa, 0xaa, 0x98, 0xaa, 0xaa, 0xaa, 0x98, 0xaa, 0xaa, 0x9a, 0x98, 0xaa, 0xaa, 0x9a, 0x00, 0x00, 0x98, 0x99, 0x00, 0x00, 0x99, 0x99,
+    0x77, 0x99, 0xa9, 0xaa, 0x77, 0xaa, 0xaa, 0xaa, 0x88, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa,
+    0x00, 0x00, 0x80, 0x88, 0x00, 0x00, 0x90, 0x99, 0x76, 0x97, 0xaa, 0x9a, 0x77, 0xa7, 0xaa, 0xaa, 0x88, 0xa8, 0xaa, 0xaa, 0x98, 0xa9, 0xaa, 0xaa,
+    0x98, 0xa8, 0xaa, 0xaa, 0x98, 0xa9, 0xaa, 0xaa, 0x00, 0x06, 0x00, 0x99, 0x00, 0x07, 0x00, 0x89, 0x76, 0x88, 0xaa, 0xaa, 0x88, 0x88, 0xaa, 0xaa,
+    0x98, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0x9a, 0x00, 0x77, 0x00, 0x90, 0x00, 0x87, 0x00, 0x90,
+    0x88, 0x98, 0x99, 0x99, 0x98, 0xa9, 0xaa, 0x99, 0x99, 0xa9, 0xa9, 0x99, 0x99, 0xa9, 0xaa, 0x99, 0x99, 0xa9, 0xa9, 0x99, 0x99, 0xa9, 0xaa, 0x99,
+    0x00, 0x88, 0x08, 0x00, 0x00, 0x88, 0x09, 0x00, 0x88, 0x88, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a,
+    0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x00, 0x86, 0x88, 0x00, 0x00, 0x88, 0x98, 0x00, 0x86, 0x99, 0xaa, 0xaa, 0x99, 0xa9, 0xaa, 0xaa,
+    0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x00, 0x55, 0x86, 0x88, 0x00, 0x98, 0x99, 0x99,
+    0x76, 0xa8, 0xaa, 0xaa, 0x88, 0xa8, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0x99,
+    0x00, 0x55, 0x86, 0x87, 0x00, 0x97, 0x99, 0x99, 0x75, 0x97, 0x99, 0x99, 0x95, 0x99, 0xbb, 0xab, 0x96, 0xb9, 0xbb, 0xab, 0x98, 0xb9, 0xbb, 0xab,
+    0x97, 0xb9, 0xbb, 0xaa, 0x98, 0xa9, 0xaa, 0x8a, 0x00, 0x00, 0x76, 0x77, 0x00, 0x00, 0x99, 0x99, 0x07, 0x00, 0xaa, 0xaa, 0x77, 0xaa, 0xaa, 0xaa,
+    0x88, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x89, 0xaa, 0xaa, 0x9a, 0x99, 0xaa, 0xaa, 0x9a, 0x00, 0x00, 0x70, 0x77, 0x00, 0x00, 0x90, 0x99,
+    0x76, 0x00, 0xa0, 0xaa, 0x77, 0xa7, 0xaa, 0xaa, 0x88, 0xa8, 0xaa, 0xaa, 0x98, 0xa9, 0xaa, 0xaa, 0x98, 0xa8, 0xaa, 0xaa, 0x98, 0xa9, 0xaa, 0xaa,
+    0x00, 0x00, 0x00, 0x77, 0x00, 0x07, 0x00, 0x99, 0x77, 0x08, 0x00, 0x9a, 0x87, 0x88, 0xaa, 0xaa, 0x98, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0xaa,
+    0x99, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0x9a, 0x00, 0x45, 0x00, 0x00, 0x00, 0x77, 0x00, 0x80, 0x88, 0x98, 0x00, 0x90, 0x99, 0xa9, 0xaa, 0x99,
+    0x99, 0xa9, 0xa9, 0x99, 0x99, 0xa9, 0xaa, 0x99, 0x99, 0xa9, 0xa9, 0x99, 0x99, 0xa9, 0xaa, 0x99, 0x00, 0x54, 0x04, 0x00, 0x00, 0x88, 0x08, 0x00,
+    0x86, 0x99, 0x0a, 0x00, 0x99, 0xa9, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x98, 0xaa, 0xaa, 0x7a,
+    0x00, 0x55, 0x55, 0x00, 0x00, 0x87, 0x99, 0x00, 0x77, 0x99, 0xa9, 0x00, 0x97, 0xaa, 0xaa, 0xaa, 0xa9, 0xaa, 0xaa, 0xaa, 0xa9, 0xaa, 0xaa, 0xaa,
+    0xa9, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x00, 0x77, 0x98, 0x99, 0x00, 0x77, 0x98, 0x99, 0x00, 0xa9, 0xaa, 0xaa, 0x00, 0xa9, 0xaa, 0xaa,
+    0x98, 0xa9, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x00, 0x77, 0x98, 0x99, 0x00, 0x70, 0x98, 0x98,
+    0x00, 0xa0, 0xaa, 0xaa, 0x00, 0xa0, 0xaa, 0xaa, 0x96, 0xaa, 0xaa, 0xaa, 0x97, 0xaa, 0xaa, 0xaa, 0x97, 0xaa, 0xaa, 0xaa, 0x97, 0xaa, 0xaa, 0x99,
+    0x00, 0x76, 0x98, 0x99, 0x00, 0x00, 0x98, 0x98, 0x06, 0x00, 0x99, 0x99, 0x07, 0x00, 0xaa, 0xaa, 0x88, 0xa9, 0xaa, 0xaa, 0x99, 0xa9, 0xaa, 0xaa,
+    0x89, 0xa9, 0xaa, 0xaa, 0x99, 0xa9, 0xaa, 0x8a, 0x00, 0x70, 0x98, 0x99, 0x00, 0x00, 0x90, 0x98, 0x66, 0x00, 0xa0, 0xaa, 0x77, 0x00, 0xa0, 0xaa,
+    0x88, 0xa8, 0xaa, 0xaa, 0x88, 0xa8, 0xaa, 0xaa, 0x88, 0xa8, 0xaa, 0x9a, 0x88, 0x98, 0xaa, 0x9a, 0x00, 0x66, 0x88, 0x88, 0x00, 0x05, 0x00, 0x88,
+    0x77, 0x07, 0x00, 0xaa, 0x88, 0x08, 0x00, 0xaa, 0x98, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0x9a,
+    0x00, 0x66, 0x86, 0x88, 0x00, 0x66, 0x00, 0x80, 0x86, 0x88, 0x00, 0x80, 0x99, 0xa9, 0x00, 0x90, 0x99, 0xa9, 0xa9, 0x99, 0x99, 0xa9, 0xaa, 0x99,
+    0x99, 0xa9, 0xa9, 0x99, 0x98, 0xa9, 0xaa, 0x99, 0x00, 0x76, 0x77, 0x08, 0x00, 0x76, 0x06, 0x00, 0x77, 0x99, 0x09, 0x00, 0x97, 0xaa, 0x0a, 0x00,
+    0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x00, 0x77, 0x88, 0x78, 0x00, 0x77, 0x78, 0x00,
+    0x88, 0x98, 0xaa, 0x00, 0x88, 0xaa, 0xaa, 0x00, 0x98, 0xaa, 0xaa, 0xaa, 0x98, 0xaa, 0xaa, 0xaa, 0x98, 0xaa, 0xaa, 0xaa, 0x98, 0xa9, 0xaa, 0x9a,
+    0x00, 0x76, 0x88, 0x88, 0x00, 0x77, 0x98, 0x99, 0x00, 0x77, 0x98, 0x98, 0x00, 0xa9, 0xaa, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0x98, 0xaa, 0xaa, 0xaa,
+    0x98, 0xaa, 0xaa, 0xaa, 0x98, 0xa9, 0xaa, 0xaa, 0x00, 0x76, 0x88, 0x88, 0x00, 0x77, 0x98, 0x99, 0x00, 0x70, 0x98, 0x98, 0x00, 0xa0, 0xaa, 0xaa,
+    0x00, 0xa0, 0xaa, 0xaa, 0x97, 0xaa, 0xaa, 0xaa, 0x97, 0xaa, 0xaa, 0xaa, 0x97, 0xaa, 0xaa, 0xaa, 0x00, 0x76, 0x88, 0x88, 0x00, 0x76, 0x88, 0x88,
+    0x00, 0x00, 0x88, 0x88, 0x07, 0x00, 0xaa, 0x9a, 0x08, 0x00, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x89, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0x99,
+    0x00, 0x74, 0x87, 0x88, 0x00, 0x75, 0x88, 0x88, 0x54, 0x00, 0x80, 0x88, 0x77, 0x00, 0xa0, 0xaa, 0x87, 0x00, 0xa0, 0xaa, 0x88, 0xa8, 0xaa, 0xaa,
+    0x88, 0xa8, 0xaa, 0xaa, 0x88, 0xa8, 0xaa, 0x8a, 0x00, 0x55, 0x88, 0x88, 0x00, 0x56, 0x88, 0x88, 0x56, 0x06, 0x00, 0x88, 0x88, 0x08, 0x00, 0xaa,
+    0x88, 0x09, 0x00, 0xa9, 0x98, 0x99, 0xaa, 0xaa, 0x98, 0x99, 0x9a, 0x9a, 0x98, 0x99, 0xaa, 0x9a, 0x00, 0x66, 0x86, 0x88, 0x00, 0x66, 0x86, 0x88,
+    0x66, 0x66, 0x00, 0x80, 0x97, 0x99, 0x00, 0x80, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x00, 0x66, 0x67, 0x77, 0x00, 0x77, 0x77, 0x77, 0x76, 0x76, 0x06, 0x00, 0x88, 0xaa, 0x0a, 0x00, 0x98, 0xaa, 0x0a, 0x00, 0x98, 0xaa, 0xaa, 0x7a,
+    0x98, 0xaa, 0xaa, 0x7a, 0x98, 0x99, 0xaa, 0x7a, 0x00, 0x76, 0x87, 0x88, 0x00, 0x77, 0x87, 0x87, 0x76, 0x77, 0x87, 0x00, 0x88, 0xa8, 0xaa, 0x00,
+    0x98, 0xa9, 0xaa, 0x00, 0x98, 0xa9, 0xaa, 0xaa, 0x98, 0xa9, 0xaa, 0xaa, 0x98, 0x99, 0xaa, 0xaa, 0x00, 0x86, 0x98, 0x99, 0x00, 0x87, 0x99, 0x99,
+    0x76, 0x88, 0x99, 0x99, 0x00, 0x88, 0x99, 0x99, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x89, 0xaa, 0xaa, 0x9a,
+    0x00, 0x77, 0x98, 0x99, 0x00, 0x87, 0x99, 0x99, 0x70, 0x88, 0x99, 0x99, 0x00, 0x80, 0x99, 0x99, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0xa0, 0xaa, 0xaa,
+    0x97, 0xaa, 0xaa, 0xaa, 0x97, 0xa9, 0xaa, 0x9a, 0x00, 0x87, 0x98, 0x99, 0x00, 0x87, 0x99, 0x99, 0x56, 0x87, 0x99, 0x99, 0x06, 0x00, 0x99, 0x99,
+    0x08, 0x00, 0xaa, 0xaa, 0x08, 0x00, 0xaa, 0xaa, 0x88, 0xaa, 0xaa, 0xaa, 0x88, 0xaa, 0xaa, 0x9a, 0x00, 0x86, 0x88, 0x88, 0x00, 0x85, 0x98, 0x99,
+    0x65, 0x86, 0x99, 0x99, 0x55, 0x00, 0x90, 0x99, 0x88, 0x00, 0xa0, 0xaa, 0x88, 0x00, 0xa0, 0xa9, 0x88, 0xa8, 0xa9, 0xaa, 0x88, 0xa8, 0xaa, 0x99,
+    0x00, 0x66, 0x98, 0x99, 0x00, 0x66, 0x99, 0x99, 0x66, 0x66, 0x99, 0x99, 0x66, 0x06, 0x00, 0x89, 0x98, 0x09, 0x00, 0x99, 0x99, 0x09, 0x00, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x99, 0x89, 0x00, 0x76, 0x86, 0x88, 0x00, 0x77, 0x87, 0x88, 0x76, 0x77, 0x87, 0x88, 0x76, 0x77, 0x00, 0x80,
+    0x98, 0x99, 0x00, 0x80, 0x98, 0x99, 0x00, 0x80, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x00, 0x76, 0x88, 0x78, 0x00, 0x77, 0x78, 0x78,
+    0x76, 0x87, 0x88, 0x78, 0x76, 0x87, 0x07, 0x00, 0x99, 0x99, 0x09, 0x00, 0x98, 0x99, 0x09, 0x00, 0x99, 0x99, 0x99, 0x79, 0x98, 0x99, 0x99, 0x79,
+    0x00, 0x77, 0x88, 0x88, 0x00, 0x77, 0x98, 0x99, 0x76, 0x88, 0x98, 0x98, 0x76, 0x88, 0x98, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x88, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99, 0x77, 0x98, 0x99, 0x99, 0x87, 0xa9, 0xaa, 0xaa,
+    0x00, 0xa9, 0xa9, 0xa9, 0x00, 0xa9, 0xaa, 0xaa, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99,
+    0x75, 0x98, 0x99, 0x99, 0x74, 0xa9, 0xaa, 0xaa, 0x00, 0xa0, 0xa9, 0xa9, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x90, 0x99, 0x99, 0x80, 0x99, 0x99, 0x99,
+    0x00, 0x96, 0x99, 0x89, 0x00, 0x98, 0x99, 0x99, 0x66, 0x98, 0x99, 0x99, 0x66, 0xa8, 0xaa, 0xaa, 0x06, 0x00, 0xa9, 0xa9, 0x08, 0x00, 0xaa, 0xaa,
+    0x08, 0x00, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x00, 0x76, 0x99, 0x99, 0x00, 0x96, 0x99, 0x99, 0x66, 0x96, 0x99, 0x99, 0x66, 0x96, 0x99, 0x99,
+    0x66, 0x00, 0x90, 0x99, 0x88, 0x00, 0x90, 0x99, 0x88, 0x00, 0x90, 0x99, 0x88, 0x88, 0x99, 0x99, 0x00, 0x66, 0x88, 0x88, 0x00, 0x77, 0x99, 0x99,
+    0x76, 0x77, 0x99, 0x99, 0x77, 0x77, 0x99, 0x99, 0x76, 0x07, 0x00, 0x99, 0x88, 0x08, 0x00, 0x99, 0x88, 0x08, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x00, 0x77, 0x87, 0x88, 0x00, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80,
+    0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x88, 0x88, 0x00, 0x76, 0x88, 0x78, 0x00, 0x77, 0x99, 0x79, 0x77, 0x88, 0x99, 0x79, 0x87, 0x99, 0x99, 0x79,
+    0x87, 0x99, 0x09, 0x00, 0x99, 0x99, 0x09, 0x00, 0x98, 0x98, 0x08, 0x00, 0x99, 0x99, 0x99, 0x08, 0x00, 0x76, 0x88, 0x88, 0x00, 0x77, 0x99, 0x99,
+    0x77, 0x88, 0x99, 0x99, 0x87, 0xa9, 0xaa, 0x99, 0x87, 0xa9, 0xa9, 0x00, 0x99, 0xa9, 0xaa, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99,
+    0x00, 0x98, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99, 0x88, 0xa8, 0xaa, 0xaa, 0x88, 0xa8, 0xaa, 0xaa, 0x98, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0xaa, 0xaa,
+    0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x77, 0x77, 0x77, 0x00, 0x96, 0x99, 0x89, 0x00, 0x98, 0x99, 0x99, 0x84, 0x99, 0xaa, 0xaa, 0x85, 0xa9, 0xaa, 0xaa,
+    0x84, 0xaa, 0xaa, 0xaa, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x70, 0x77, 0x77, 0x00, 0x77, 0x99, 0x99, 0x00, 0x97, 0x99, 0x99,
+    0x66, 0xa9, 0xaa, 0xaa, 0x77, 0xa9, 0xaa, 0xaa, 0x67, 0xa9, 0xaa, 0xaa, 0x07, 0x00, 0xaa, 0xaa, 0x08, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x77, 0x77,
+    0x00, 0x86, 0x88, 0x88, 0x00, 0x87, 0x99, 0x99, 0x76, 0xa6, 0xaa, 0x9a, 0x76, 0xa7, 0xaa, 0x9a, 0x77, 0xa6, 0xaa, 0xaa, 0x76, 0x00, 0xa0, 0xaa,
+    0x77, 0x00, 0xa0, 0xaa, 0x77, 0x00, 0x70, 0x77, 0x00, 0x66, 0x89, 0x89, 0x00, 0x77, 0x99, 0x99, 0x76, 0x77, 0x99, 0x99, 0x77, 0x88, 0x99, 0x99,
+    0x88, 0x78, 0x99, 0x99, 0x78, 0x08, 0x00, 0x99, 0x88, 0x08, 0x00, 0x99, 0x77, 0x07, 0x00, 0x77, 0x00, 0x77, 0x97, 0x98, 0x00, 0x87, 0x98, 0x99,
+    0x76, 0x98, 0x99, 0x98, 0x77, 0x98, 0x99, 0x99, 0x98, 0x99, 0x99, 0x98, 0x98, 0x99, 0x00, 0x90, 0x98, 0x99, 0x00, 0x80, 0x77, 0x77, 0x00, 0x00,
+    0x00, 0x77, 0x88, 0x78, 0x00, 0x77, 0x99, 0x79, 0x77, 0x87, 0x99, 0x79, 0x77, 0x88, 0xaa, 0x7a, 0x98, 0xa9, 0xaa, 0x7a, 0x98, 0xa9, 0x0a, 0x00,
+    0x98, 0xa9, 0x0a, 0x00, 0x77, 0x77, 0x07, 0x00, 0x00, 0x86, 0x88, 0x88, 0x00, 0x87, 0x99, 0x99, 0x88, 0x88, 0xaa, 0xaa, 0x88, 0xa8, 0xaa, 0xaa,
+    0x98, 0xaa, 0xaa, 0xaa, 0x98, 0xaa, 0xaa, 0x00, 0x98, 0xaa, 0xaa, 0x00, 0x77, 0x77, 0x77, 0x00, 0x00, 0x96, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99,
+    0x86, 0x99, 0xaa, 0xaa, 0x88, 0xa9, 0xaa, 0xaa, 0x88, 0xaa, 0xaa, 0xaa, 0x98, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0xaa, 0xaa,
+    0x00, 0x77, 0x99, 0x99, 0x00, 0x97, 0xaa, 0x9a, 0x75, 0xa9, 0xaa, 0xaa, 0x85, 0xa9, 0xaa, 0xaa, 0x95, 0xa9, 0xaa, 0xaa, 0x95, 0xaa, 0xaa, 0xaa,
+    0x00, 0xa0, 0xaa, 0xaa, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x99, 0x99, 0x77, 0xa8, 0xaa, 0x9a, 0x77, 0xa9, 0xaa, 0xaa,
+    0x88, 0xaa, 0xaa, 0xaa, 0x78, 0xaa, 0xaa, 0xaa, 0x08, 0x00, 0xaa, 0xaa, 0x07, 0x00, 0xaa, 0x9a, 0x00, 0x86, 0x88, 0x88, 0x00, 0x87, 0x99, 0x99,
+    0x76, 0x87, 0x99, 0x99, 0x77, 0xa7, 0xaa, 0x9a, 0x77, 0xa7, 0xaa, 0xaa, 0x88, 0xa8, 0xaa, 0xaa, 0x78, 0x00, 0xa0, 0xaa, 0x88, 0x00, 0xa0, 0xaa,
+    0x00, 0x66, 0x99, 0x99, 0x00, 0x77, 0x99, 0x99, 0x77, 0x88, 0x99, 0x99, 0x77, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99,
+    0x98, 0x08, 0x00, 0x99, 0x98, 0x09, 0x00, 0x99, 0x00, 0x77, 0x97, 0x99, 0x00, 0x87, 0x98, 0x99, 0x76, 0x98, 0x99, 0x99, 0x77, 0xa8, 0xaa, 0x99,
+    0x98, 0xa9, 0xa9, 0x99, 0x98, 0xa9, 0xaa, 0x99, 0x98, 0x99, 0x00, 0x90, 0x98, 0x99, 0x00, 0x90, 0x00, 0x88, 0x88, 0x78, 0x00, 0x88, 0x99, 0x79,
+    0x76, 0x88, 0xaa, 0x7a, 0x88, 0xa8, 0xaa, 0x7a, 0x98, 0xaa, 0xaa, 0x7a, 0x98, 0xaa, 0xaa, 0x7a, 0x98, 0xaa, 0x0a, 0x00, 0x98, 0xaa, 0x0a, 0x00,
+    0x00, 0x87, 0x88, 0x88, 0x00, 0x87, 0x99, 0x99, 0x77, 0x97, 0x99, 0x99, 0x88, 0x99, 0xaa, 0xaa, 0x98, 0xa9, 0xaa, 0xaa, 0x98, 0xa9, 0xaa, 0xaa,
+    0x98, 0xa9, 0xaa, 0x00, 0x98, 0xa9, 0xaa, 0x00, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x76, 0x97, 0x99, 0x89, 0x98, 0x99, 0xaa, 0x9a,
+    0x99, 0xa9, 0xaa, 0x9a, 0x99, 0xa9, 0xaa, 0x9a, 0x99, 0xa9, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x88, 0x88, 0x00, 0x60, 0x88, 0x88, 0x77, 0x88, 0x98, 0x99, 0x77, 0xaa, 0xaa, 0x9a, 0x88, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa,
+    0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0x9a, 0x99, 0x00, 0x00, 0x70, 0x77, 0x00, 0x00, 0x80, 0x88, 0x76, 0x97, 0x99, 0x88, 0x77, 0xa7, 0xaa, 0x99,
+    0x88, 0xa8, 0xaa, 0x99, 0x98, 0xa9, 0xaa, 0x99, 0x98, 0xa8, 0xaa, 0x99, 0x98, 0xa9, 0xaa, 0x99, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88,
+    0x77, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x00, 0x60, 0x00, 0x80, 0x00, 0x70, 0x00, 0x80, 0x88, 0x98, 0x99, 0x88, 0x98, 0xa9, 0xaa, 0x99, 0x99, 0xa9, 0xa9, 0x99, 0x99, 0xa9, 0xaa, 0x99,
+    0x99, 0xa9, 0xa9, 0x99, 0x99, 0xa9, 0xaa, 0x99, 0x00, 0x70, 0x07, 0x00, 0x00, 0x70, 0x08, 0x00, 0x88, 0x88, 0x99, 0x79, 0x88, 0xaa, 0xaa, 0x7a,
+    0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x99, 0x99, 0x99, 0x79, 0x00, 0x70, 0x88, 0x00, 0x00, 0x80, 0x88, 0x00,
+    0x86, 0x88, 0x98, 0x99, 0x98, 0xa9, 0xaa, 0x9a, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xaa, 0x9a, 0x99,
+    0x00, 0x50, 0x75, 0x77, 0x00, 0x80, 0x88, 0x88, 0x66, 0x98, 0x99, 0x89, 0x88, 0xa8, 0xaa, 0x9a, 0x99, 0xaa, 0xaa, 0x9a, 0x99, 0xaa, 0xaa, 0x9a,
+    0x99, 0xaa, 0xaa, 0x9a, 0x99, 0xaa, 0xaa, 0x99, 0x00, 0x50, 0x65, 0x67, 0x00, 0x80, 0x88, 0x88, 0x75, 0x97, 0x99, 0x89, 0x95, 0x99, 0xaa, 0x9a,
+    0x96, 0xa9, 0xaa, 0x9a, 0x97, 0xa9, 0xaa, 0x9a, 0x97, 0xa9, 0xaa, 0x99, 0x97, 0x99, 0x99, 0x89, 0x00, 0x50, 0x65, 0x67, 0x00, 0x70, 0x88, 0x88,
+    0x77, 0x88, 0x99, 0x99, 0x77, 0xaa, 0xaa, 0x99, 0x88, 0xaa, 0xaa, 0x9a, 0x99, 0xaa, 0xaa, 0x9a, 0x89, 0xaa, 0xaa, 0x9a, 0x99, 0xaa, 0x9a, 0x99,
+    0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x80, 0x88, 0x76, 0x00, 0x90, 0x99, 0x76, 0xa7, 0xaa, 0x99, 0x88, 0xa8, 0xaa, 0x99, 0x98, 0xa9, 0xaa, 0x99,
+    0x98, 0xa8, 0xaa, 0x99, 0x98, 0xa9, 0xaa, 0x99, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x88, 0x66, 0x08, 0x00, 0x88, 0x77, 0x88, 0x99, 0x99,
+    0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80,
+    0x88, 0x98, 0x00, 0x80, 0x88, 0xa9, 0xaa, 0x99, 0x98, 0xa9, 0xa9, 0x98, 0x99, 0xa9, 0xaa, 0x99, 0x99, 0xa9, 0xa9, 0x98, 0x99, 0xa9, 0xaa, 0x99,
+    0x00, 0x50, 0x04, 0x00, 0x00, 0x70, 0x07, 0x00, 0x86, 0x88, 0x09, 0x00, 0x98, 0xa9, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a,
+    0x99, 0xaa, 0xaa, 0x7a, 0x98, 0xaa, 0x9a, 0x79, 0x00, 0x40, 0x45, 0x00, 0x00, 0x80, 0x88, 0x00, 0x76, 0x98, 0x99, 0x00, 0x96, 0xaa, 0x9a, 0x99,
+    0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x00, 0x70, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88,
+    0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x99, 0x9a, 0x9a, 0x99, 0x99, 0xaa, 0x9a, 0x99,
+    0x00, 0x70, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x00, 0x90, 0x99, 0x89, 0x00, 0xa0, 0xaa, 0x9a, 0x96, 0xaa, 0xaa, 0x9a, 0x97, 0xaa, 0xaa, 0x9a,
+    0x97, 0xaa, 0xaa, 0x9a, 0x97, 0xa9, 0xaa, 0x99, 0x00, 0x70, 0x88, 0x78, 0x00, 0x00, 0x78, 0x78, 0x05, 0x00, 0x99, 0x89, 0x07, 0x00, 0xaa, 0x9a,
+    0x88, 0xa9, 0xaa, 0x9a, 0x99, 0xa9, 0xaa, 0x9a, 0x89, 0xa9, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x89, 0x00, 0x60, 0x88, 0x78, 0x00, 0x00, 0x70, 0x78,
+    0x66, 0x00, 0x90, 0x99, 0x77, 0x00, 0xa0, 0x99, 0x88, 0xa8, 0xaa, 0x99, 0x88, 0xa8, 0xaa, 0x99, 0x88, 0xa8, 0xaa, 0x99, 0x88, 0x98, 0x99, 0x99,
+    0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00, 0x77, 0x76, 0x07, 0x00, 0x99, 0x88, 0x08, 0x00, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x60, 0x76, 0x77, 0x00, 0x50, 0x00, 0x70, 0x76, 0x88, 0x00, 0x80, 0x98, 0xa9, 0x00, 0x90,
+    0x99, 0xa9, 0xa9, 0x98, 0x99, 0xa9, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x00, 0x60, 0x66, 0x07, 0x00, 0x60, 0x06, 0x00,
+    0x76, 0x88, 0x08, 0x00, 0x96, 0xaa, 0x0a, 0x00, 0x99, 0xaa, 0xaa, 0x79, 0x99, 0xaa, 0xaa, 0x79, 0x99, 0xaa, 0xaa, 0x79, 0x99, 0xaa, 0x9a, 0x79,
+    0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x77, 0x00, 0x88, 0x98, 0x99, 0x00, 0x88, 0xaa, 0xaa, 0x00, 0x98, 0xaa, 0xaa, 0x99, 0x98, 0xaa, 0xaa, 0x9a,
+    0x98, 0xaa, 0xaa, 0x9a, 0x98, 0xa9, 0xaa, 0x9a, 0x00, 0x60, 0x77, 0x77, 0x00, 0x70, 0x77, 0x88, 0x00, 0x76, 0x77, 0x78, 0x00, 0x99, 0x99, 0x99,
+    0x00, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x00, 0x60, 0x77, 0x77, 0x00, 0x70, 0x77, 0x88,
+    0x00, 0x70, 0x77, 0x78, 0x00, 0x90, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99, 0x97, 0x99, 0x99, 0x99, 0x97, 0x99, 0x99, 0x99, 0x97, 0x99, 0x99, 0x99,
+    0x00, 0x60, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x06, 0x00, 0xaa, 0x9a, 0x08, 0x00, 0xaa, 0x9a, 0x99, 0xaa, 0xaa, 0x9a,
+    0x89, 0xaa, 0xaa, 0x9a, 0x99, 0xaa, 0x9a, 0x99, 0x00, 0x60, 0x77, 0x77, 0x00, 0x60, 0x77, 0x77, 0x34, 0x00, 0x70, 0x77, 0x77, 0x00, 0x90, 0x99,
+    0x87, 0x00, 0x90, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x89, 0x00, 0x40, 0x77, 0x77, 0x00, 0x50, 0x77, 0x77,
+    0x54, 0x04, 0x00, 0x77, 0x88, 0x08, 0x00, 0x99, 0x88, 0x09, 0x00, 0x99, 0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99,
+    0x00, 0x50, 0x75, 0x77, 0x00, 0x50, 0x75, 0x77, 0x54, 0x55, 0x00, 0x70, 0x96, 0x99, 0x00, 0x80, 0x99, 0x99, 0x00, 0x80, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0x00, 0x60, 0x66, 0x66, 0x00, 0x60, 0x66, 0x66, 0x54, 0x66, 0x06, 0x00, 0x88, 0xaa, 0x0a, 0x00,
+    0x98, 0xaa, 0x0a, 0x00, 0x98, 0xaa, 0xaa, 0x7a, 0x98, 0xaa, 0x9a, 0x7a, 0x98, 0x99, 0xaa, 0x7a, 0x00, 0x60, 0x76, 0x76, 0x00, 0x60, 0x77, 0x77,
+    0x54, 0x66, 0x67, 0x00, 0x88, 0x98, 0x99, 0x00, 0x98, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99,
+    0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x00, 0x70, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x50, 0x88, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x00, 0x90, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99, 0x97, 0x99, 0x99, 0x99, 0x97, 0x99, 0x99, 0x99, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x55, 0x87, 0x88, 0x88, 0x04, 0x00, 0x88, 0x88, 0x07, 0x00, 0x99, 0x99, 0x08, 0x00, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99,
+    0x00, 0x80, 0x88, 0x78, 0x00, 0x80, 0x88, 0x88, 0x55, 0x84, 0x88, 0x88, 0x55, 0x00, 0x80, 0x88, 0x88, 0x00, 0x90, 0x99, 0x88, 0x00, 0x90, 0x99,
+    0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x00, 0x60, 0x88, 0x88, 0x00, 0x60, 0x88, 0x88, 0x66, 0x66, 0x88, 0x88, 0x56, 0x06, 0x00, 0x88,
+    0x98, 0x09, 0x00, 0x88, 0x99, 0x09, 0x00, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x89, 0x88, 0x88, 0x00, 0x60, 0x76, 0x77, 0x00, 0x70, 0x77, 0x77,
+    0x76, 0x77, 0x76, 0x77, 0x76, 0x76, 0x00, 0x70, 0x98, 0x99, 0x00, 0x80, 0x98, 0x99, 0x00, 0x80, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88,
+    0x00, 0x60, 0x67, 0x67, 0x00, 0x60, 0x77, 0x67, 0x76, 0x77, 0x77, 0x67, 0x76, 0x77, 0x07, 0x00, 0x99, 0x99, 0x09, 0x00, 0x98, 0x99, 0x09, 0x00,
+    0x99, 0x99, 0x99, 0x79, 0x98, 0x99, 0x99, 0x79, 0x00, 0x60, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x76, 0x88, 0x88, 0x78, 0x76, 0x78, 0x78, 0x00,
+    0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x70, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x77, 0x98, 0x99, 0x89, 0x77, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x73, 0x97, 0x99, 0x89, 0x74, 0x99, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99,
+    0x00, 0x80, 0x89, 0x89, 0x80, 0x99, 0x99, 0x89, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x56, 0x88, 0x99, 0x89, 0x66, 0x98, 0x99, 0x99,
+    0x05, 0x00, 0x99, 0x99, 0x08, 0x00, 0x99, 0x99, 0x08, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x60, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x55, 0x85, 0x88, 0x88, 0x66, 0x86, 0x88, 0x88, 0x56, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x00, 0x60, 0x77, 0x77, 0x00, 0x70, 0x88, 0x88, 0x66, 0x67, 0x88, 0x88, 0x76, 0x77, 0x88, 0x88, 0x76, 0x06, 0x00, 0x88, 0x88, 0x08, 0x00, 0x88,
+    0x88, 0x08, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x60, 0x76, 0x77, 0x00, 0x70, 0x77, 0x77, 0x76, 0x87, 0x88, 0x77, 0x76, 0x88, 0x88, 0x77,
+    0x76, 0x88, 0x00, 0x70, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x88, 0x88, 0x00, 0x70, 0x77, 0x67, 0x00, 0x70, 0x88, 0x68,
+    0x77, 0x88, 0x88, 0x68, 0x77, 0x99, 0x99, 0x68, 0x77, 0x99, 0x09, 0x00, 0x99, 0x99, 0x09, 0x00, 0x98, 0x98, 0x08, 0x00, 0x99, 0x99, 0x99, 0x08,
+    0x00, 0x60, 0x88, 0x88, 0x00, 0x60, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x99, 0x99, 0x89, 0x77, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00,
+    0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x87, 0x98, 0x99, 0x89, 0x87, 0x98, 0x99, 0x99,
+    0x97, 0xaa, 0xaa, 0x9a, 0x00, 0xaa, 0xaa, 0x9a, 0x00, 0xaa, 0xaa, 0x9a, 0x00, 0x77, 0x77, 0x77, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x84, 0x99, 0x99, 0x89, 0x84, 0x99, 0x99, 0x99, 0x84, 0xaa, 0xaa, 0x9a, 0x00, 0xa0, 0xaa, 0x9a, 0x00, 0xa0, 0xaa, 0x9a, 0x00, 0x70, 0x77, 0x77,
+    0x00, 0x60, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x66, 0x99, 0x99, 0x88, 0x66, 0x99, 0x99, 0x99, 0x66, 0x99, 0x99, 0x99, 0x06, 0x00, 0x99, 0x99,
+    0x08, 0x00, 0x99, 0x99, 0x00, 0x00, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x88, 0x88, 0x66, 0x96, 0x99, 0x89, 0x76, 0x97, 0x99, 0x89,
+    0x77, 0x96, 0x99, 0x89, 0x76, 0x00, 0x90, 0x89, 0x77, 0x00, 0x90, 0x89, 0x77, 0x00, 0x70, 0x77, 0x00, 0x60, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88,
+    0x76, 0x77, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x78, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00, 0x88, 0x77, 0x07, 0x00, 0x77,
+    0x00, 0x60, 0x86, 0x88, 0x00, 0x70, 0x87, 0x87, 0x66, 0x98, 0x99, 0x88, 0x77, 0x98, 0x99, 0x87, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x00, 0x70,
+    0x98, 0x99, 0x00, 0x80, 0x77, 0x77, 0x00, 0x00, 0x00, 0x70, 0x77, 0x67, 0x00, 0x70, 0x88, 0x68, 0x76, 0x87, 0x99, 0x69, 0x77, 0x88, 0x99, 0x69,
+    0x98, 0x99, 0x99, 0x69, 0x98, 0x99, 0x09, 0x00, 0x98, 0x99, 0x09, 0x00, 0x77, 0x77, 0x07, 0x00, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x77, 0x88, 0x88, 0x88, 0x77, 0x98, 0x99, 0x99, 0x98, 0xaa, 0xaa, 0x9a, 0x98, 0xaa, 0xaa, 0x00, 0x98, 0xaa, 0xaa, 0x00, 0x77, 0x77, 0x77, 0x00,
+    0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x86, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0xaa, 0x9a, 0x99, 0x98, 0xaa, 0x9a, 0x99,
+    0x00, 0xaa, 0x9a, 0x99, 0x00, 0xaa, 0x9a, 0x99, 0x00, 0x60, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x75, 0x99, 0x99, 0x99, 0x85, 0x99, 0x99, 0x99,
+    0x95, 0x99, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x88, 0x88,
+    0x77, 0x98, 0x99, 0x89, 0x77, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x78, 0x99, 0x99, 0x99, 0x08, 0x00, 0x99, 0x99, 0x07, 0x00, 0x99, 0x99,
+    0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x76, 0x87, 0x99, 0x89, 0x76, 0x97, 0x99, 0x89, 0x76, 0x97, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99,
+    0x78, 0x00, 0x90, 0x99, 0x88, 0x00, 0x90, 0x99, 0x00, 0x60, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x08, 0x00, 0x88, 0x98, 0x09, 0x00, 0x88, 0x00, 0x60, 0x86, 0x88, 0x00, 0x70, 0x87, 0x88,
+    0x76, 0x98, 0x99, 0x88, 0x76, 0x98, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x00, 0x80, 0x98, 0x99, 0x00, 0x80,
+    0x00, 0x70, 0x77, 0x67, 0x00, 0x70, 0x88, 0x68, 0x66, 0x88, 0x99, 0x69, 0x88, 0x98, 0x99, 0x69, 0x98, 0x99, 0x99, 0x69, 0x98, 0x99, 0x99, 0x69,
+    0x98, 0x99, 0x09, 0x00, 0x98, 0x99, 0x09, 0x00, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x76, 0x97, 0x99, 0x88, 0x88, 0x99, 0x99, 0x99,
+    0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99, 0x00, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x98, 0x99,
+    0x00, 0x90, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99,
+    0x00, 0x60, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x00, 0x70, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99,
+    0x88, 0x99, 0x99, 0x89, 0x88, 0x98, 0x99, 0x89, 0x00, 0x60, 0x88, 0x88, 0x00, 0x60, 0x88, 0x88, 0x00, 0x80, 0x98, 0x99, 0x77, 0x99, 0x99, 0x99,
+    0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x00, 0x00, 0x70, 0x77, 0x00, 0x00, 0x80, 0x88,
+    0x00, 0x90, 0x99, 0x88, 0x76, 0x97, 0x99, 0x99, 0x77, 0x97, 0x99, 0x99, 0x77, 0x97, 0x99, 0x99, 0x87, 0x98, 0x99, 0x99, 0x87, 0x97, 0x99, 0x99,
+    0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x87, 0x00, 0x70, 0x99, 0x89, 0x76, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x99,
+    0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x89, 0x00, 0x60, 0x00, 0x80, 0x00, 0x70, 0x00, 0x80, 0x00, 0x80, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88,
+    0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x98, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x70, 0x07, 0x00, 0x00, 0x70, 0x07, 0x00,
+    0x00, 0x80, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69, 0x88, 0x98, 0x99, 0x69,
+    0x00, 0x70, 0x88, 0x00, 0x00, 0x80, 0x88, 0x00, 0x00, 0x80, 0x98, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99,
+    0x88, 0x99, 0x99, 0x99, 0x87, 0x99, 0x99, 0x99, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x90, 0x99, 0x89, 0x76, 0x97, 0x99, 0x99,
+    0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x65, 0x66, 0x00, 0x70, 0x88, 0x88, 0x00, 0x70, 0x99, 0x99, 0x77, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99,
+    0x88, 0x99, 0x99, 0x89, 0x88, 0x98, 0x99, 0x89, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x80, 0x88, 0x00, 0x00, 0x90, 0x99, 0x76, 0x97, 0x99, 0x99,
+    0x77, 0x97, 0x99, 0x99, 0x77, 0x97, 0x99, 0x99, 0x87, 0x98, 0x99, 0x99, 0x87, 0x97, 0x99, 0x99, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x88,
+    0x00, 0x00, 0x00, 0x88, 0x77, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x89,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x70, 0x00, 0x80, 0x00, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x98, 0x88,
+    0x88, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x30, 0x04, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00, 0x80, 0x09, 0x00, 0x88, 0x98, 0x99, 0x69,
+    0x88, 0x99, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69, 0x87, 0x98, 0x99, 0x69, 0x00, 0x40, 0x44, 0x00, 0x00, 0x80, 0x88, 0x00,
+    0x00, 0x90, 0x99, 0x00, 0x86, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99,
+    0x00, 0x70, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x00, 0x90, 0x99, 0x99, 0x66, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99,
+    0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x00, 0x70, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x00, 0x90, 0x99, 0x89, 0x75, 0x97, 0x99, 0x99,
+    0x85, 0x99, 0x99, 0x99, 0x86, 0x99, 0x99, 0x99, 0x86, 0x99, 0x99, 0x99, 0x86, 0x99, 0x99, 0x88, 0x00, 0x70, 0x88, 0x78, 0x00, 0x70, 0x78, 0x78,
+    0x00, 0x80, 0x88, 0x88, 0x77, 0x88, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x78, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x77, 0x98, 0x99, 0x79,
+    0x00, 0x50, 0x88, 0x78, 0x00, 0x00, 0x70, 0x78, 0x00, 0x00, 0x90, 0x99, 0x76, 0x00, 0x90, 0x99, 0x76, 0x97, 0x99, 0x99, 0x77, 0x97, 0x99, 0x99,
+    0x77, 0x97, 0x99, 0x89, 0x77, 0x97, 0x99, 0x89, 0x00, 0x00, 0x76, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x88, 0x66, 0x08, 0x00, 0x89,
+    0x77, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x89, 0x00, 0x50, 0x74, 0x77, 0x00, 0x50, 0x00, 0x70,
+    0x00, 0x70, 0x00, 0x70, 0x88, 0x88, 0x00, 0x80, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x98, 0x88, 0x88, 0x98, 0x99, 0x88, 0x87, 0x88, 0x88, 0x88,
+    0x00, 0x60, 0x56, 0x07, 0x00, 0x50, 0x06, 0x00, 0x00, 0x80, 0x08, 0x00, 0x86, 0x99, 0x09, 0x00, 0x88, 0x99, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69,
+    0x88, 0x98, 0x99, 0x69, 0x88, 0x98, 0x99, 0x69, 0x00, 0x60, 0x76, 0x76, 0x00, 0x60, 0x76, 0x00, 0x00, 0x90, 0x99, 0x00, 0x76, 0x99, 0x99, 0x00,
+    0x87, 0x99, 0x99, 0x99, 0x87, 0x99, 0x99, 0x99, 0x87, 0x99, 0x99, 0x99, 0x87, 0x98, 0x99, 0x89, 0x00, 0x60, 0x77, 0x77, 0x00, 0x70, 0x77, 0x88,
+    0x00, 0x70, 0x77, 0x78, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x87, 0x99, 0x99, 0x99, 0x87, 0x98, 0x99, 0x99, 0x87, 0x98, 0x99, 0x99,
+    0x00, 0x60, 0x77, 0x77, 0x00, 0x70, 0x77, 0x88, 0x00, 0x70, 0x77, 0x78, 0x00, 0x90, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99, 0x86, 0x99, 0x99, 0x99,
+    0x86, 0x99, 0x99, 0x99, 0x86, 0x99, 0x99, 0x99, 0x00, 0x60, 0x76, 0x77, 0x00, 0x70, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x05, 0x00, 0x99, 0x99,
+    0x08, 0x00, 0x99, 0x99, 0x78, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x77, 0x99, 0x99, 0x88, 0x00, 0x60, 0x77, 0x77, 0x00, 0x60, 0x77, 0x77,
+    0x00, 0x00, 0x70, 0x77, 0x66, 0x00, 0x90, 0x99, 0x77, 0x00, 0x90, 0x99, 0x77, 0x97, 0x99, 0x99, 0x77, 0x97, 0x99, 0x99, 0x77, 0x97, 0x99, 0x79,
+    0x00, 0x40, 0x77, 0x77, 0x00, 0x30, 0x77, 0x77, 0x00, 0x00, 0x00, 0x77, 0x76, 0x07, 0x00, 0x88, 0x88, 0x08, 0x00, 0x89, 0x88, 0x88, 0x89, 0x89,
+    0x88, 0x88, 0x99, 0x89, 0x87, 0x88, 0x88, 0x88, 0x00, 0x50, 0x75, 0x77, 0x00, 0x50, 0x75, 0x77, 0x00, 0x40, 0x00, 0x70, 0x86, 0x88, 0x00, 0x70,
+    0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x50, 0x66, 0x66, 0x00, 0x50, 0x56, 0x66,
+    0x00, 0x50, 0x06, 0x00, 0x77, 0x99, 0x09, 0x00, 0x87, 0x99, 0x09, 0x00, 0x87, 0x99, 0x99, 0x69, 0x87, 0x99, 0x99, 0x69, 0x87, 0x88, 0x88, 0x68,
+    0x00, 0x60, 0x76, 0x76, 0x00, 0x60, 0x77, 0x77, 0x00, 0x60, 0x67, 0x00, 0x88, 0x98, 0x99, 0x00, 0x88, 0x98, 0x99, 0x00, 0x88, 0x98, 0x99, 0x99,
+    0x88, 0x98, 0x99, 0x99, 0x88, 0x88, 0x98, 0x99, 0x00, 0x60, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x87, 0x88, 0x88,
+    0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x78, 0x99, 0x99, 0x99, 0x88, 0x98, 0x99, 0x89, 0x00, 0x70, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88,
+    0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x90, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99, 0x86, 0x98, 0x99, 0x99, 0x86, 0x98, 0x99, 0x89,
+    0x00, 0x60, 0x87, 0x88, 0x00, 0x60, 0x87, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x00, 0x88, 0x88, 0x06, 0x00, 0x99, 0x99, 0x07, 0x00, 0x99, 0x99,
+    0x77, 0x98, 0x99, 0x99, 0x77, 0x88, 0x99, 0x89, 0x00, 0x60, 0x88, 0x78, 0x00, 0x70, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x34, 0x00, 0x80, 0x88,
+    0x77, 0x00, 0x90, 0x89, 0x77, 0x00, 0x80, 0x89, 0x77, 0x87, 0x99, 0x89, 0x77, 0x87, 0x88, 0x88, 0x00, 0x40, 0x88, 0x88, 0x00, 0x50, 0x88, 0x88,
+    0x00, 0x50, 0x88, 0x88, 0x54, 0x05, 0x00, 0x87, 0x88, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78,
+    0x00, 0x60, 0x76, 0x77, 0x00, 0x60, 0x75, 0x77, 0x00, 0x60, 0x76, 0x77, 0x64, 0x66, 0x00, 0x70, 0x87, 0x88, 0x00, 0x70, 0x87, 0x88, 0x00, 0x70,
+    0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x77, 0x00, 0x60, 0x66, 0x66, 0x00, 0x60, 0x77, 0x67, 0x00, 0x70, 0x67, 0x67, 0x64, 0x67, 0x07, 0x00,
+    0x88, 0x88, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x00, 0x60, 0x76, 0x77, 0x00, 0x70, 0x77, 0x77,
+    0x00, 0x70, 0x88, 0x78, 0x64, 0x77, 0x78, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x00, 0x70, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x76, 0x88, 0x99, 0x89, 0x00, 0x88, 0x89, 0x89, 0x00, 0x88, 0x99, 0x89,
+    0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x50, 0x88, 0x99, 0x89,
+    0x00, 0x80, 0x89, 0x89, 0x00, 0x80, 0x99, 0x89, 0x00, 0x80, 0x88, 0x88, 0x70, 0x88, 0x88, 0x88, 0x00, 0x80, 0x88, 0x78, 0x00, 0x80, 0x88, 0x88,
+    0x00, 0x80, 0x88, 0x88, 0x55, 0x87, 0x99, 0x89, 0x04, 0x00, 0x89, 0x89, 0x07, 0x00, 0x99, 0x89, 0x07, 0x00, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88,
+    0x00, 0x60, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x55, 0x84, 0x88, 0x88, 0x55, 0x00, 0x80, 0x88, 0x77, 0x00, 0x80, 0x88,
+    0x77, 0x00, 0x80, 0x88, 0x77, 0x77, 0x88, 0x88, 0x00, 0x40, 0x77, 0x77, 0x00, 0x60, 0x88, 0x88, 0x00, 0x60, 0x88, 0x88, 0x66, 0x66, 0x88, 0x88,
+    0x56, 0x06, 0x00, 0x88, 0x77, 0x07, 0x00, 0x88, 0x77, 0x07, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x00, 0x60, 0x76, 0x77, 0x00, 0x70, 0x77, 0x77,
+    0x00, 0x70, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x76, 0x77, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x77, 0x77,
+    0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x77, 0x67, 0x00, 0x70, 0x88, 0x68, 0x76, 0x88, 0x88, 0x68, 0x76, 0x88, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00,
+    0x78, 0x78, 0x08, 0x00, 0x88, 0x88, 0x78, 0x07, 0x00, 0x60, 0x88, 0x88, 0x00, 0x60, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x76, 0x88, 0x99, 0x89,
+    0x76, 0x88, 0x89, 0x00, 0x88, 0x88, 0x99, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x00, 0x90, 0x99, 0x89, 0x77, 0x98, 0x99, 0x99, 0x77, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x66, 0x66, 0x66,
+    0x00, 0x80, 0x88, 0x78, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x99, 0x89, 0x73, 0x98, 0x99, 0x99, 0x74, 0x99, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99,
+    0x00, 0x90, 0x99, 0x99, 0x00, 0x60, 0x66, 0x66, 0x00, 0x60, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x90, 0x99, 0x88, 0x56, 0x98, 0x99, 0x99,
+    0x66, 0x98, 0x99, 0x99, 0x05, 0x00, 0x99, 0x99, 0x07, 0x00, 0x99, 0x99, 0x00, 0x00, 0x66, 0x66, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x88, 0x88,
+    0x00, 0x90, 0x99, 0x89, 0x55, 0x95, 0x99, 0x89, 0x66, 0x96, 0x99, 0x89, 0x56, 0x00, 0x90, 0x89, 0x66, 0x00, 0x90, 0x89, 0x66, 0x00, 0x60, 0x66,
+    0x00, 0x40, 0x88, 0x88, 0x00, 0x60, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x66, 0x67, 0x88, 0x88, 0x76, 0x77, 0x88, 0x88, 0x76, 0x06, 0x00, 0x88,
+    0x76, 0x07, 0x00, 0x88, 0x66, 0x06, 0x00, 0x66, 0x00, 0x60, 0x86, 0x88, 0x00, 0x70, 0x87, 0x87, 0x00, 0x80, 0x88, 0x88, 0x76, 0x87, 0x88, 0x87,
+    0x76, 0x88, 0x88, 0x88, 0x76, 0x88, 0x00, 0x70, 0x76, 0x88, 0x00, 0x70, 0x66, 0x66, 0x00, 0x00, 0x00, 0x70, 0x77, 0x66, 0x00, 0x70, 0x77, 0x67,
+    0x00, 0x80, 0x88, 0x68, 0x77, 0x88, 0x99, 0x69, 0x77, 0x98, 0x99, 0x69, 0x77, 0x98, 0x09, 0x00, 0x76, 0x98, 0x09, 0x00, 0x66, 0x66, 0x06, 0x00,
+    0x00, 0x60, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x77, 0x98, 0x99, 0x99, 0x77, 0x99, 0x99, 0x99, 0x77, 0x99, 0x99, 0x00,
+    0x76, 0x99, 0x99, 0x00, 0x66, 0x66, 0x66, 0x00, 0x00, 0x80, 0x88, 0x78, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x99, 0x99, 0x87, 0x98, 0x99, 0x99,
+    0x88, 0x98, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x60, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x00, 0x90, 0x99, 0x88, 0x84, 0x99, 0x99, 0x99, 0x84, 0x99, 0x99, 0x99, 0x84, 0x99, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99,
+    0x00, 0x60, 0x77, 0x77, 0x00, 0x70, 0x88, 0x88, 0x00, 0x90, 0x99, 0x89, 0x66, 0x99, 0x99, 0x99, 0x66, 0x99, 0x99, 0x99, 0x77, 0x99, 0x99, 0x99,
+    0x06, 0x00, 0x99, 0x99, 0x07, 0x00, 0x99, 0x89, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x66, 0x96, 0x99, 0x89,
+    0x76, 0x97, 0x99, 0x89, 0x77, 0x96, 0x99, 0x99, 0x76, 0x00, 0x90, 0x99, 0x77, 0x00, 0x90, 0x99, 0x00, 0x40, 0x88, 0x88, 0x00, 0x60, 0x88, 0x88,
+    0x00, 0x70, 0x88, 0x88, 0x76, 0x77, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x77, 0x08, 0x00, 0x88, 0x77, 0x07, 0x00, 0x88,
+    0x00, 0x60, 0x86, 0x88, 0x00, 0x70, 0x87, 0x88, 0x00, 0x80, 0x88, 0x88, 0x66, 0x88, 0x88, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x98, 0x88,
+    0x88, 0x98, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x00, 0x70, 0x77, 0x66, 0x00, 0x70, 0x77, 0x67, 0x00, 0x80, 0x99, 0x69, 0x76, 0x97, 0x99, 0x69,
+    0x88, 0x98, 0x99, 0x69, 0x88, 0x98, 0x99, 0x69, 0x88, 0x98, 0x09, 0x00, 0x88, 0x98, 0x09, 0x00, 0x00, 0x70, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x00, 0x80, 0x88, 0x88, 0x87, 0x88, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x00, 0x88, 0x98, 0x99, 0x00,
+    0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x76, 0x97, 0x99, 0x79, 0x98, 0x99, 0xaa, 0x9a, 0x99, 0xa9, 0xaa, 0x9a, 0x99, 0xa9, 0xaa, 0x9a,
+    0x99, 0xa9, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x01, 0x00, 0x77, 0x77, 0x03, 0x00, 0x88, 0x78, 0x74, 0x88, 0x99, 0x99, 0x95, 0xaa, 0xaa, 0x99,
+    0x96, 0xaa, 0xaa, 0x99, 0x97, 0xaa, 0xaa, 0x99, 0x97, 0xaa, 0xaa, 0x99, 0x97, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x66, 0x66, 0x05, 0x00, 0x77, 0x77, 0x76, 0x87, 0x88, 0x78, 0x77, 0x97, 0x99, 0x88, 0x88, 0x98, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99,
+    0x98, 0x98, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x03, 0x00, 0x00, 0x77, 0x06, 0x00, 0x00, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x98, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x03, 0x00, 0x00, 0x70, 0x06, 0x00, 0x00, 0x70,
+    0x88, 0x98, 0x99, 0x77, 0x98, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0xa9, 0xaa, 0x99, 0x99, 0xa9, 0xa9, 0x99, 0x99, 0xa9, 0xaa, 0x99,
+    0x03, 0x00, 0x06, 0x00, 0x04, 0x00, 0x07, 0x00, 0x88, 0x88, 0x99, 0x69, 0x88, 0xaa, 0xaa, 0x6a, 0x99, 0xaa, 0xaa, 0x7a, 0x99, 0xaa, 0xaa, 0x7a,
+    0x99, 0xaa, 0xaa, 0x7a, 0x99, 0x99, 0x99, 0x79, 0x03, 0x00, 0x77, 0x00, 0x06, 0x00, 0x77, 0x00, 0x86, 0x88, 0x88, 0x88, 0x98, 0x99, 0x99, 0x99,
+    0x99, 0xaa, 0x9a, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x00, 0x00, 0x65, 0x66, 0x00, 0x00, 0x88, 0x78,
+    0x00, 0x88, 0x88, 0x88, 0x88, 0x98, 0xaa, 0x8a, 0x99, 0xaa, 0x9a, 0x9a, 0x99, 0xaa, 0xaa, 0x9a, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xa9, 0xaa, 0x99,
+    0x01, 0x00, 0x65, 0x65, 0x01, 0x00, 0x77, 0x77, 0x74, 0x97, 0x99, 0x79, 0x95, 0x99, 0xaa, 0x9a, 0x96, 0xa9, 0xaa, 0x9a, 0x97, 0xa9, 0xaa, 0x9a,
+    0x97, 0xa9, 0xaa, 0x99, 0x97, 0x99, 0x99, 0x89, 0x00, 0x00, 0x65, 0x65, 0x05, 0x00, 0x88, 0x78, 0x66, 0x88, 0x99, 0x99, 0x77, 0xaa, 0x9a, 0x99,
+    0x88, 0x9a, 0x9a, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x89, 0x9a, 0x9a, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x00, 0x00, 0x65, 0x65, 0x05, 0x00, 0x77, 0x77,
+    0x75, 0x87, 0x88, 0x88, 0x76, 0x97, 0x99, 0x88, 0x88, 0xa8, 0xaa, 0x99, 0x98, 0xa9, 0xaa, 0x99, 0x98, 0xa8, 0xaa, 0x99, 0x98, 0xa9, 0xaa, 0x99,
+    0x00, 0x00, 0x00, 0x55, 0x06, 0x00, 0x00, 0x77, 0x66, 0x08, 0x00, 0x78, 0x77, 0x88, 0x88, 0x88, 0x98, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89,
+    0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x70, 0x88, 0x98, 0x00, 0x70, 0x88, 0x99, 0x99, 0x88,
+    0x98, 0x99, 0x99, 0x88, 0x99, 0xa9, 0xaa, 0x99, 0x99, 0xa9, 0xa9, 0x98, 0x99, 0xa9, 0xaa, 0x99, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00,
+    0x86, 0x88, 0x08, 0x00, 0x98, 0x99, 0x99, 0x69, 0x99, 0xaa, 0x9a, 0x79, 0x99, 0xaa, 0x9a, 0x79, 0x99, 0xaa, 0x9a, 0x79, 0x98, 0xaa, 0x9a, 0x79,
+    0x00, 0x00, 0x45, 0x00, 0x06, 0x00, 0x77, 0x00, 0x76, 0x88, 0x88, 0x00, 0x96, 0xaa, 0x8a, 0x88, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0xaa, 0x99,
+    0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x01, 0x00, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x00, 0x88, 0x88, 0x88, 0x00, 0x98, 0x99, 0x88,
+    0x98, 0x99, 0x99, 0x89, 0x99, 0xaa, 0x9a, 0x89, 0x99, 0x9a, 0x9a, 0x89, 0x99, 0xaa, 0x9a, 0x89, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77,
+    0x00, 0x80, 0x88, 0x88, 0x00, 0x90, 0xaa, 0x8a, 0x96, 0xaa, 0x9a, 0x9a, 0x97, 0xaa, 0xaa, 0x9a, 0x97, 0xaa, 0xaa, 0x99, 0x97, 0xa9, 0xaa, 0x99,
+    0x02, 0x00, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x05, 0x00, 0x99, 0x79, 0x07, 0x00, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x03, 0x00, 0x76, 0x77, 0x02, 0x00, 0x70, 0x76, 0x66, 0x00, 0x80, 0x88, 0x77, 0x00, 0x90, 0x88,
+    0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x03, 0x00, 0x65, 0x66, 0x02, 0x00, 0x00, 0x66,
+    0x76, 0x07, 0x00, 0x88, 0x88, 0x08, 0x00, 0x88, 0x98, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89,
+    0x03, 0x00, 0x60, 0x66, 0x02, 0x00, 0x00, 0x60, 0x76, 0x88, 0x00, 0x70, 0x98, 0x99, 0x00, 0x80, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x03, 0x00, 0x66, 0x06, 0x02, 0x00, 0x05, 0x00, 0x76, 0x88, 0x08, 0x00, 0x96, 0xaa, 0x0a, 0x00,
+    0x99, 0xaa, 0xaa, 0x79, 0x99, 0xaa, 0xaa, 0x79, 0x99, 0xaa, 0xaa, 0x79, 0x99, 0xaa, 0x9a, 0x79, 0x03, 0x00, 0x66, 0x56, 0x02, 0x00, 0x66, 0x00,
+    0x88, 0x88, 0x88, 0x00, 0x88, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99, 0x99, 0x98, 0xa9, 0xaa, 0x99, 0x98, 0xa9, 0xa9, 0x99, 0x98, 0xa9, 0xaa, 0x99,
+    0x01, 0x00, 0x66, 0x66, 0x01, 0x00, 0x77, 0x77, 0x00, 0x76, 0x76, 0x76, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99,
+    0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x02, 0x00, 0x66, 0x66, 0x02, 0x00, 0x77, 0x77, 0x00, 0x70, 0x76, 0x76, 0x00, 0x90, 0x99, 0x88,
+    0x00, 0x90, 0x99, 0x89, 0x97, 0x99, 0x99, 0x89, 0x97, 0x99, 0x99, 0x89, 0x97, 0x99, 0x99, 0x89, 0x00, 0x00, 0x66, 0x66, 0x03, 0x00, 0x77, 0x66,
+    0x00, 0x00, 0x76, 0x66, 0x06, 0x00, 0x99, 0x89, 0x08, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x02, 0x00, 0x66, 0x66, 0x04, 0x00, 0x66, 0x66, 0x34, 0x00, 0x60, 0x66, 0x77, 0x00, 0x80, 0x88, 0x87, 0x00, 0x90, 0x99, 0x88, 0x98, 0x99, 0x99,
+    0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x89, 0x02, 0x00, 0x66, 0x66, 0x04, 0x00, 0x66, 0x66, 0x54, 0x04, 0x00, 0x66, 0x88, 0x08, 0x00, 0x88,
+    0x88, 0x09, 0x00, 0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x89, 0x88, 0x02, 0x00, 0x64, 0x66, 0x04, 0x00, 0x65, 0x66,
+    0x54, 0x55, 0x00, 0x60, 0x96, 0x99, 0x00, 0x70, 0x99, 0x99, 0x00, 0x80, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99,
+    0x02, 0x00, 0x55, 0x55, 0x04, 0x00, 0x56, 0x55, 0x54, 0x56, 0x06, 0x00, 0x88, 0x99, 0x09, 0x00, 0x98, 0x99, 0x09, 0x00, 0x98, 0x99, 0x99, 0x79,
+    0x98, 0x99, 0x99, 0x79, 0x98, 0x99, 0x99, 0x79, 0x02, 0x00, 0x66, 0x66, 0x04, 0x00, 0x66, 0x66, 0x54, 0x66, 0x66, 0x00, 0x88, 0x98, 0x99, 0x00,
+    0x98, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99, 0x89, 0x98, 0x99, 0x99, 0x89, 0x98, 0x99, 0x99, 0x89, 0x01, 0x00, 0x88, 0x77, 0x05, 0x00, 0x88, 0x78,
+    0x75, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99,
+    0x02, 0x00, 0x77, 0x77, 0x03, 0x00, 0x88, 0x78, 0x52, 0x88, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x90, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99,
+    0x97, 0x99, 0x99, 0x99, 0x97, 0x99, 0x99, 0x99, 0x03, 0x00, 0x77, 0x77, 0x04, 0x00, 0x77, 0x77, 0x44, 0x86, 0x88, 0x88, 0x04, 0x00, 0x88, 0x88,
+    0x07, 0x00, 0x99, 0x89, 0x08, 0x00, 0x99, 0x89, 0x88, 0x99, 0x99, 0x89, 0x88, 0x99, 0x99, 0x89, 0x00, 0x00, 0x77, 0x67, 0x03, 0x00, 0x77, 0x77,
+    0x55, 0x74, 0x77, 0x77, 0x54, 0x00, 0x70, 0x77, 0x88, 0x00, 0x90, 0x99, 0x88, 0x00, 0x90, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99,
+    0x02, 0x00, 0x76, 0x77, 0x04, 0x00, 0x77, 0x77, 0x66, 0x56, 0x77, 0x77, 0x56, 0x06, 0x00, 0x67, 0x98, 0x09, 0x00, 0x88, 0x99, 0x09, 0x00, 0x88,
+    0x99, 0x99, 0x88, 0x88, 0x99, 0x89, 0x88, 0x88, 0x03, 0x00, 0x66, 0x66, 0x05, 0x00, 0x77, 0x66, 0x76, 0x77, 0x76, 0x66, 0x76, 0x76, 0x00, 0x60,
+    0x98, 0x99, 0x00, 0x80, 0x98, 0x99, 0x00, 0x80, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x03, 0x00, 0x66, 0x56, 0x05, 0x00, 0x77, 0x57,
+    0x76, 0x77, 0x77, 0x57, 0x76, 0x77, 0x07, 0x00, 0x99, 0x99, 0x09, 0x00, 0x98, 0x99, 0x09, 0x00, 0x99, 0x99, 0x99, 0x79, 0x98, 0x99, 0x99, 0x79,
+    0x03, 0x00, 0x66, 0x66, 0x05, 0x00, 0x77, 0x77, 0x76, 0x88, 0x88, 0x78, 0x76, 0x78, 0x78, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x01, 0x00, 0x77, 0x77, 0x06, 0x00, 0x88, 0x78, 0x66, 0x88, 0x88, 0x78, 0x76, 0x99, 0x99, 0x88,
+    0x00, 0x99, 0x99, 0x88, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x02, 0x00, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77,
+    0x73, 0x87, 0x88, 0x78, 0x73, 0x99, 0x99, 0x88, 0x00, 0x90, 0x99, 0x88, 0x00, 0x90, 0x99, 0x89, 0x00, 0x80, 0x89, 0x89, 0x80, 0x99, 0x99, 0x89,
+    0x02, 0x00, 0x77, 0x67, 0x05, 0x00, 0x77, 0x77, 0x55, 0x88, 0x88, 0x78, 0x55, 0x88, 0x88, 0x88, 0x05, 0x00, 0x88, 0x88, 0x08, 0x00, 0x88, 0x88,
+    0x08, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x03, 0x00, 0x77, 0x77, 0x04, 0x00, 0x77, 0x77, 0x54, 0x75, 0x77, 0x77, 0x66, 0x76, 0x77, 0x77,
+    0x56, 0x00, 0x70, 0x77, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x66, 0x66, 0x04, 0x00, 0x77, 0x77,
+    0x66, 0x66, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x76, 0x06, 0x00, 0x77, 0x88, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x02, 0x00, 0x66, 0x66, 0x04, 0x00, 0x77, 0x66, 0x76, 0x87, 0x88, 0x66, 0x76, 0x88, 0x88, 0x66, 0x76, 0x88, 0x00, 0x60, 0x88, 0x88, 0x00, 0x80,
+    0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x88, 0x88, 0x03, 0x00, 0x66, 0x56, 0x06, 0x00, 0x88, 0x58, 0x76, 0x88, 0x88, 0x58, 0x76, 0x99, 0x99, 0x58,
+    0x76, 0x99, 0x09, 0x00, 0x98, 0x99, 0x09, 0x00, 0x98, 0x98, 0x08, 0x00, 0x98, 0x99, 0x99, 0x08, 0x03, 0x00, 0x76, 0x77, 0x06, 0x00, 0x77, 0x77,
+    0x76, 0x88, 0x88, 0x77, 0x76, 0x99, 0x99, 0x78, 0x76, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99,
+    0x01, 0x00, 0x77, 0x77, 0x04, 0x00, 0x78, 0x77, 0x87, 0x98, 0x99, 0x88, 0x87, 0x98, 0x99, 0x88, 0x97, 0xaa, 0x9a, 0x89, 0x00, 0x9a, 0x9a, 0x89,
+    0x00, 0xaa, 0x9a, 0x89, 0x00, 0x77, 0x77, 0x77, 0x02, 0x00, 0x77, 0x67, 0x03, 0x00, 0x78, 0x77, 0x84, 0x88, 0x88, 0x88, 0x84, 0x98, 0x99, 0x88,
+    0x84, 0x99, 0x99, 0x89, 0x00, 0x90, 0x99, 0x89, 0x00, 0x90, 0x99, 0x89, 0x00, 0x70, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x05, 0x00, 0x88, 0x78,
+    0x66, 0x88, 0x88, 0x88, 0x66, 0x88, 0x88, 0x88, 0x66, 0x98, 0x99, 0x89, 0x06, 0x00, 0x99, 0x89, 0x08, 0x00, 0x99, 0x89, 0x00, 0x00, 0x77, 0x77,
+    0x02, 0x00, 0x77, 0x66, 0x04, 0x00, 0x77, 0x77, 0x66, 0x86, 0x88, 0x78, 0x76, 0x87, 0x88, 0x88, 0x77, 0x86, 0x88, 0x88, 0x76, 0x00, 0x80, 0x88,
+    0x77, 0x00, 0x80, 0x88, 0x77, 0x00, 0x70, 0x77, 0x03, 0x00, 0x77, 0x77, 0x05, 0x00, 0x77, 0x77, 0x75, 0x77, 0x77, 0x77, 0x76, 0x88, 0x78, 0x77,
+    0x88, 0x78, 0x78, 0x77, 0x78, 0x08, 0x00, 0x77, 0x88, 0x08, 0x00, 0x77, 0x77, 0x07, 0x00, 0x77, 0x00, 0x00, 0x66, 0x66, 0x05, 0x00, 0x77, 0x77,
+    0x66, 0x88, 0x88, 0x77, 0x77, 0x98, 0x99, 0x77, 0x98, 0x99, 0x98, 0x77, 0x98, 0x98, 0x00, 0x70, 0x98, 0x99, 0x00, 0x80, 0x77, 0x77, 0x00, 0x00,
+    0x02, 0x00, 0x66, 0x56, 0x05, 0x00, 0x77, 0x57, 0x76, 0x87, 0x88, 0x58, 0x77, 0x88, 0x88, 0x58, 0x98, 0x99, 0x99, 0x58, 0x98, 0x99, 0x09, 0x00,
+    0x98, 0x99, 0x09, 0x00, 0x77, 0x77, 0x07, 0x00, 0x03, 0x00, 0x77, 0x77, 0x06, 0x00, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x77, 0x98, 0x99, 0x88,
+    0x98, 0xaa, 0x9a, 0x89, 0x98, 0x9a, 0x9a, 0x00, 0x98, 0xaa, 0x9a, 0x00, 0x77, 0x77, 0x77, 0x00, 0x01, 0x00, 0x77, 0x77, 0x06, 0x00, 0x78, 0x77,
+    0x86, 0x99, 0x89, 0x88, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99,
+    0x02, 0x00, 0x77, 0x77, 0x03, 0x00, 0x88, 0x78, 0x74, 0x88, 0x88, 0x88, 0x85, 0x99, 0x89, 0x88, 0x95, 0x99, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99,
+    0x00, 0x90, 0x99, 0x99, 0x00, 0x90, 0x99, 0x99, 0x03, 0x00, 0x77, 0x66, 0x05, 0x00, 0x88, 0x78, 0x66, 0x88, 0x88, 0x78, 0x77, 0x99, 0x99, 0x88,
+    0x88, 0x99, 0x99, 0x99, 0x78, 0x99, 0x99, 0x99, 0x08, 0x00, 0x99, 0x99, 0x07, 0x00, 0x99, 0x99, 0x03, 0x00, 0x77, 0x77, 0x04, 0x00, 0x77, 0x77,
+    0x76, 0x87, 0x88, 0x78, 0x76, 0x97, 0x99, 0x78, 0x76, 0x97, 0x98, 0x88, 0x88, 0x98, 0x99, 0x89, 0x78, 0x00, 0x80, 0x89, 0x88, 0x00, 0x90, 0x89,
+    0x02, 0x00, 0x77, 0x77, 0x06, 0x00, 0x88, 0x78, 0x76, 0x88, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88,
+    0x98, 0x08, 0x00, 0x88, 0x98, 0x09, 0x00, 0x88, 0x03, 0x00, 0x76, 0x77, 0x05, 0x00, 0x77, 0x77, 0x75, 0x88, 0x88, 0x77, 0x76, 0x98, 0x99, 0x88,
+    0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x00, 0x80, 0x98, 0x99, 0x00, 0x80, 0x00, 0x00, 0x66, 0x56, 0x05, 0x00, 0x88, 0x68,
+    0x66, 0x88, 0x88, 0x58, 0x88, 0x98, 0x99, 0x69, 0x98, 0x99, 0x99, 0x59, 0x98, 0x99, 0x99, 0x69, 0x98, 0x99, 0x09, 0x00, 0x98, 0x99, 0x09, 0x00,
+    0x02, 0x00, 0x77, 0x77, 0x05, 0x00, 0x77, 0x77, 0x76, 0x97, 0x99, 0x78, 0x88, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99,
+    0x98, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99, 0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x06, 0x00, 0x88, 0x78, 0x88, 0x88, 0x99, 0x89,
+    0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x99, 0x78, 0x01, 0x00, 0x77, 0x77, 0x02, 0x00, 0x88, 0x78,
+    0x03, 0x00, 0x88, 0x88, 0x84, 0x99, 0x99, 0x99, 0x85, 0x99, 0x99, 0x99, 0x96, 0x99, 0x99, 0x99, 0x96, 0x99, 0x99, 0x99, 0x96, 0x99, 0x99, 0x89,
+    0x02, 0x00, 0x76, 0x77, 0x00, 0x00, 0x77, 0x77, 0x06, 0x00, 0x87, 0x88, 0x87, 0x99, 0x99, 0x89, 0x88, 0x99, 0x99, 0x89, 0x98, 0x99, 0x99, 0x89,
+    0x98, 0x99, 0x99, 0x89, 0x98, 0x99, 0x99, 0x89, 0x03, 0x00, 0x66, 0x66, 0x03, 0x00, 0x76, 0x77, 0x05, 0x00, 0x88, 0x78, 0x76, 0x97, 0x99, 0x88,
+    0x77, 0x97, 0x99, 0x88, 0x77, 0x97, 0x99, 0x88, 0x87, 0x98, 0x99, 0x88, 0x87, 0x97, 0x99, 0x88, 0x02, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00, 0x77,
+    0x05, 0x00, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x02, 0x00, 0x00, 0x70, 0x03, 0x00, 0x00, 0x70, 0x06, 0x00, 0x88, 0x77, 0x86, 0x88, 0x88, 0x77, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x98, 0x88,
+    0x88, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x02, 0x00, 0x06, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x88, 0x68, 0x88, 0x99, 0x99, 0x69,
+    0x88, 0x99, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69, 0x88, 0x88, 0x99, 0x69, 0x02, 0x00, 0x66, 0x00, 0x03, 0x00, 0x76, 0x00,
+    0x04, 0x00, 0x88, 0x88, 0x88, 0x98, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x89, 0x87, 0x99, 0x89, 0x88,
+    0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x88, 0x88, 0x76, 0x97, 0x99, 0x89, 0x88, 0x99, 0x99, 0x89, 0x88, 0x99, 0x99, 0x89,
+    0x88, 0x99, 0x99, 0x89, 0x88, 0x99, 0x89, 0x88, 0x01, 0x00, 0x77, 0x77, 0x01, 0x00, 0x77, 0x77, 0x03, 0x00, 0x88, 0x78, 0x84, 0x88, 0x99, 0x89,
+    0x85, 0x98, 0x99, 0x89, 0x86, 0x98, 0x99, 0x89, 0x86, 0x98, 0x99, 0x88, 0x86, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x55, 0x55, 0x02, 0x00, 0x77, 0x77, 0x05, 0x00, 0x87, 0x88, 0x76, 0x97, 0x99, 0x88, 0x77, 0x97, 0x99, 0x88, 0x77, 0x97, 0x99, 0x88,
+    0x87, 0x98, 0x99, 0x88, 0x87, 0x97, 0x99, 0x88, 0x02, 0x00, 0x00, 0x55, 0x03, 0x00, 0x00, 0x77, 0x06, 0x00, 0x00, 0x78, 0x77, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x70,
+    0x06, 0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x77, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x98, 0x87, 0x88, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x77,
+    0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x04, 0x00, 0x08, 0x00, 0x88, 0x98, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69,
+    0x88, 0x99, 0x99, 0x69, 0x87, 0x88, 0x88, 0x68, 0x03, 0x00, 0x43, 0x00, 0x03, 0x00, 0x77, 0x00, 0x06, 0x00, 0x88, 0x00, 0x86, 0x88, 0x88, 0x88,
+    0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x99, 0x88, 0x01, 0x00, 0x76, 0x77, 0x00, 0x00, 0x76, 0x77,
+    0x00, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x98, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x00, 0x00, 0x76, 0x77, 0x02, 0x00, 0x76, 0x77, 0x01, 0x00, 0x88, 0x88, 0x74, 0x97, 0x99, 0x89, 0x85, 0x99, 0x99, 0x89, 0x86, 0x99, 0x99, 0x89,
+    0x86, 0x99, 0x99, 0x89, 0x86, 0x99, 0x89, 0x88, 0x02, 0x00, 0x76, 0x77, 0x00, 0x00, 0x76, 0x76, 0x05, 0x00, 0x88, 0x78, 0x66, 0x88, 0x99, 0x89,
+    0x88, 0x98, 0x99, 0x89, 0x78, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x88, 0x77, 0x88, 0x88, 0x78, 0x02, 0x00, 0x76, 0x77, 0x02, 0x00, 0x76, 0x76,
+    0x05, 0x00, 0x88, 0x88, 0x75, 0x97, 0x99, 0x88, 0x76, 0x97, 0x99, 0x88, 0x77, 0x97, 0x99, 0x88, 0x77, 0x97, 0x99, 0x88, 0x77, 0x97, 0x99, 0x88,
+    0x02, 0x00, 0x65, 0x66, 0x02, 0x00, 0x00, 0x66, 0x06, 0x00, 0x00, 0x88, 0x66, 0x08, 0x00, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x02, 0x00, 0x60, 0x66, 0x02, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0x70, 0x88, 0x88, 0x00, 0x70,
+    0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x98, 0x87, 0x88, 0x98, 0x99, 0x88, 0x87, 0x88, 0x88, 0x77, 0x03, 0x00, 0x45, 0x06, 0x02, 0x00, 0x05, 0x00,
+    0x06, 0x00, 0x07, 0x00, 0x86, 0x88, 0x08, 0x00, 0x88, 0x98, 0x99, 0x68, 0x88, 0x98, 0x99, 0x68, 0x88, 0x98, 0x99, 0x68, 0x88, 0x98, 0x99, 0x68,
+    0x03, 0x00, 0x66, 0x56, 0x02, 0x00, 0x66, 0x00, 0x06, 0x00, 0x88, 0x00, 0x76, 0x99, 0x89, 0x00, 0x87, 0x99, 0x99, 0x89, 0x87, 0x99, 0x89, 0x89,
+    0x87, 0x99, 0x99, 0x89, 0x87, 0x88, 0x88, 0x88, 0x01, 0x00, 0x66, 0x66, 0x01, 0x00, 0x76, 0x77, 0x00, 0x00, 0x76, 0x76, 0x00, 0x88, 0x88, 0x88,
+    0x00, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x02, 0x00, 0x66, 0x66, 0x02, 0x00, 0x76, 0x77,
+    0x00, 0x00, 0x76, 0x76, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x86, 0x88, 0x88, 0x88, 0x86, 0x88, 0x88, 0x88, 0x86, 0x88, 0x88, 0x88,
+    0x00, 0x00, 0x66, 0x66, 0x02, 0x00, 0x66, 0x66, 0x00, 0x00, 0x66, 0x66, 0x05, 0x00, 0x99, 0x79, 0x08, 0x00, 0x99, 0x89, 0x78, 0x99, 0x99, 0x89,
+    0x88, 0x99, 0x99, 0x89, 0x77, 0x88, 0x88, 0x88, 0x02, 0x00, 0x66, 0x66, 0x03, 0x00, 0x66, 0x66, 0x02, 0x00, 0x60, 0x66, 0x66, 0x00, 0x80, 0x88,
+    0x77, 0x00, 0x80, 0x88, 0x77, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x78, 0x02, 0x00, 0x66, 0x66, 0x03, 0x00, 0x66, 0x66,
+    0x02, 0x00, 0x00, 0x66, 0x76, 0x07, 0x00, 0x88, 0x88, 0x08, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88,
+    0x02, 0x00, 0x64, 0x66, 0x03, 0x00, 0x63, 0x66, 0x02, 0x00, 0x00, 0x60, 0x86, 0x88, 0x00, 0x70, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x88, 0x87,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x02, 0x00, 0x55, 0x55, 0x03, 0x00, 0x55, 0x55, 0x02, 0x00, 0x04, 0x00, 0x77, 0x99, 0x09, 0x00,
+    0x87, 0x99, 0x09, 0x00, 0x87, 0x99, 0x89, 0x69, 0x87, 0x99, 0x99, 0x69, 0x87, 0x88, 0x88, 0x68, 0x02, 0x00, 0x65, 0x66, 0x03, 0x00, 0x65, 0x65,
+    0x02, 0x00, 0x65, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x01, 0x00, 0x76, 0x77, 0x01, 0x00, 0x77, 0x77, 0x01, 0x00, 0x77, 0x77, 0x00, 0x76, 0x77, 0x77, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88,
+    0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x02, 0x00, 0x76, 0x77, 0x02, 0x00, 0x77, 0x77, 0x02, 0x00, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77,
+    0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x86, 0x88, 0x88, 0x88, 0x86, 0x88, 0x88, 0x88, 0x02, 0x00, 0x76, 0x77, 0x02, 0x00, 0x77, 0x77,
+    0x03, 0x00, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x06, 0x00, 0x88, 0x88, 0x07, 0x00, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88,
+    0x00, 0x00, 0x66, 0x66, 0x02, 0x00, 0x77, 0x77, 0x04, 0x00, 0x77, 0x77, 0x34, 0x00, 0x70, 0x77, 0x77, 0x00, 0x80, 0x88, 0x77, 0x00, 0x80, 0x88,
+    0x77, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x02, 0x00, 0x76, 0x77, 0x02, 0x00, 0x77, 0x77, 0x04, 0x00, 0x77, 0x77, 0x54, 0x04, 0x00, 0x67,
+    0x88, 0x08, 0x00, 0x77, 0x88, 0x08, 0x00, 0x77, 0x88, 0x78, 0x78, 0x77, 0x88, 0x88, 0x78, 0x77, 0x02, 0x00, 0x64, 0x66, 0x02, 0x00, 0x65, 0x66,
+    0x04, 0x00, 0x66, 0x66, 0x54, 0x56, 0x00, 0x60, 0x87, 0x88, 0x00, 0x70, 0x87, 0x88, 0x00, 0x70, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x77,
+    0x02, 0x00, 0x66, 0x56, 0x02, 0x00, 0x56, 0x56, 0x04, 0x00, 0x66, 0x56, 0x54, 0x66, 0x06, 0x00, 0x88, 0x88, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00,
+    0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x02, 0x00, 0x66, 0x66, 0x02, 0x00, 0x76, 0x77, 0x04, 0x00, 0x77, 0x76, 0x54, 0x76, 0x76, 0x00,
+    0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x01, 0x00, 0x77, 0x77, 0x01, 0x00, 0x77, 0x77,
+    0x05, 0x00, 0x88, 0x78, 0x75, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x02, 0x00, 0x77, 0x77, 0x02, 0x00, 0x77, 0x77, 0x03, 0x00, 0x88, 0x78, 0x52, 0x88, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x00, 0x80, 0x87, 0x87, 0x70, 0x87, 0x88, 0x88, 0x02, 0x00, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x04, 0x00, 0x88, 0x78, 0x44, 0x86, 0x88, 0x88,
+    0x04, 0x00, 0x88, 0x88, 0x07, 0x00, 0x88, 0x88, 0x07, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x02, 0x00, 0x77, 0x77, 0x02, 0x00, 0x77, 0x77,
+    0x03, 0x00, 0x77, 0x77, 0x55, 0x74, 0x77, 0x77, 0x54, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x00, 0x00, 0x66, 0x66, 0x02, 0x00, 0x77, 0x77, 0x04, 0x00, 0x77, 0x77, 0x66, 0x56, 0x77, 0x77, 0x56, 0x06, 0x00, 0x77, 0x77, 0x07, 0x00, 0x77,
+    0x77, 0x07, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x02, 0x00, 0x64, 0x66, 0x03, 0x00, 0x66, 0x66, 0x05, 0x00, 0x77, 0x66, 0x76, 0x77, 0x77, 0x66,
+    0x76, 0x77, 0x00, 0x60, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x77, 0x77, 0x02, 0x00, 0x66, 0x56, 0x03, 0x00, 0x77, 0x57,
+    0x05, 0x00, 0x88, 0x58, 0x76, 0x88, 0x88, 0x58, 0x76, 0x88, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00, 0x78, 0x78, 0x08, 0x00, 0x88, 0x88, 0x78, 0x07,
+    0x02, 0x00, 0x66, 0x66, 0x03, 0x00, 0x77, 0x77, 0x05, 0x00, 0x77, 0x77, 0x76, 0x88, 0x88, 0x78, 0x76, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00,
+    0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x01, 0x00, 0x77, 0x77, 0x01, 0x00, 0x77, 0x77, 0x06, 0x00, 0x88, 0x88, 0x66, 0x88, 0x88, 0x88,
+    0x76, 0x99, 0x99, 0x89, 0x00, 0x99, 0x99, 0x89, 0x00, 0x99, 0x99, 0x89, 0x00, 0x66, 0x66, 0x66, 0x02, 0x00, 0x77, 0x77, 0x02, 0x00, 0x77, 0x77,
+    0x03, 0x00, 0x88, 0x88, 0x73, 0x87, 0x88, 0x88, 0x73, 0x99, 0x99, 0x89, 0x00, 0x90, 0x99, 0x89, 0x00, 0x90, 0x99, 0x89, 0x00, 0x60, 0x66, 0x66,
+    0x02, 0x00, 0x77, 0x77, 0x02, 0x00, 0x77, 0x77, 0x05, 0x00, 0x88, 0x88, 0x55, 0x88, 0x88, 0x88, 0x55, 0x88, 0x88, 0x88, 0x05, 0x00, 0x88, 0x88,
+    0x07, 0x00, 0x88, 0x88, 0x00, 0x00, 0x66, 0x66, 0x02, 0x00, 0x66, 0x66, 0x03, 0x00, 0x77, 0x77, 0x04, 0x00, 0x88, 0x77, 0x54, 0x85, 0x88, 0x77,
+    0x66, 0x86, 0x88, 0x77, 0x56, 0x00, 0x80, 0x77, 0x66, 0x00, 0x70, 0x77, 0x66, 0x00, 0x60, 0x66, 0x02, 0x00, 0x67, 0x67, 0x02, 0x00, 0x77, 0x77,
+    0x04, 0x00, 0x77, 0x77, 0x66, 0x66, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x76, 0x06, 0x00, 0x77, 0x76, 0x07, 0x00, 0x77, 0x66, 0x06, 0x00, 0x66,
+    0x00, 0x00, 0x64, 0x66, 0x02, 0x00, 0x77, 0x77, 0x04, 0x00, 0x77, 0x76, 0x76, 0x87, 0x88, 0x77, 0x76, 0x88, 0x88, 0x76, 0x76, 0x88, 0x00, 0x70,
+    0x76, 0x88, 0x00, 0x70, 0x66, 0x66, 0x00, 0x00, 0x02, 0x00, 0x66, 0x56, 0x03, 0x00, 0x77, 0x57, 0x06, 0x00, 0x88, 0x58, 0x76, 0x88, 0x88, 0x58,
+    0x76, 0x88, 0x88, 0x58, 0x76, 0x88, 0x08, 0x00, 0x76, 0x88, 0x08, 0x00, 0x66, 0x66, 0x06, 0x00, 0x02, 0x00, 0x76, 0x76, 0x03, 0x00, 0x77, 0x77,
+    0x06, 0x00, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x76, 0x99, 0x99, 0x89, 0x76, 0x99, 0x99, 0x00, 0x76, 0x99, 0x99, 0x00, 0x66, 0x66, 0x66, 0x00,
+    0x01, 0x00, 0x77, 0x77, 0x01, 0x00, 0x77, 0x77, 0x04, 0x00, 0x88, 0x88, 0x87, 0x98, 0x99, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88, 0x99, 0x99, 0x88,
+    0x00, 0x99, 0x99, 0x88, 0x00, 0x99, 0x89, 0x88, 0x02, 0x00, 0x77, 0x77, 0x02, 0x00, 0x77, 0x77, 0x03, 0x00, 0x88, 0x88, 0x84, 0x88, 0x88, 0x88,
+    0x84, 0x88, 0x88, 0x88, 0x84, 0x88, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x02, 0x00, 0x66, 0x66, 0x03, 0x00, 0x77, 0x77,
+    0x05, 0x00, 0x88, 0x78, 0x66, 0x88, 0x88, 0x88, 0x66, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x06, 0x00, 0x88, 0x88, 0x07, 0x00, 0x88, 0x88,
+    0x02, 0x00, 0x66, 0x66, 0x02, 0x00, 0x77, 0x77, 0x04, 0x00, 0x88, 0x78, 0x66, 0x86, 0x88, 0x78, 0x76, 0x87, 0x88, 0x88, 0x77, 0x86, 0x88, 0x88,
+    0x76, 0x00, 0x80, 0x88, 0x77, 0x00, 0x80, 0x88, 0x02, 0x00, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x05, 0x00, 0x77, 0x77, 0x75, 0x77, 0x77, 0x77,
+    0x76, 0x88, 0x78, 0x77, 0x77, 0x78, 0x78, 0x77, 0x77, 0x08, 0x00, 0x77, 0x77, 0x07, 0x00, 0x77, 0x02, 0x00, 0x74, 0x77, 0x02, 0x00, 0x77, 0x77,
+    0x05, 0x00, 0x88, 0x77, 0x66, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x00, 0x70,
+    0x00, 0x00, 0x66, 0x56, 0x02, 0x00, 0x77, 0x57, 0x05, 0x00, 0x88, 0x58, 0x76, 0x87, 0x88, 0x58, 0x88, 0x88, 0x88, 0x58, 0x88, 0x88, 0x88, 0x58,
+    0x88, 0x88, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00, 0x02, 0x00, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x06, 0x00, 0x88, 0x78, 0x87, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0x71, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77,
+    0x01, 0x00, 0x88, 0x88, 0x07, 0x00, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88,
+    0x00, 0x60, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x02, 0x00, 0x77, 0x77, 0x03, 0x00, 0x88, 0x88, 0x74, 0x88, 0x88, 0x88, 0x75, 0x88, 0x88, 0x88,
+    0x75, 0x88, 0x88, 0x78, 0x75, 0x88, 0x88, 0x78, 0x02, 0x00, 0x76, 0x77, 0x00, 0x00, 0x77, 0x77, 0x03, 0x00, 0x87, 0x88, 0x06, 0x00, 0x88, 0x88,
+    0x86, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x33, 0x00, 0x60, 0x66, 0x02, 0x00, 0x70, 0x77,
+    0x03, 0x00, 0x88, 0x78, 0x05, 0x00, 0x88, 0x88, 0x66, 0x86, 0x88, 0x88, 0x76, 0x87, 0x88, 0x88, 0x76, 0x86, 0x88, 0x88, 0x76, 0x87, 0x88, 0x88,
+    0x33, 0x01, 0x00, 0x66, 0x02, 0x00, 0x00, 0x67, 0x03, 0x00, 0x88, 0x88, 0x06, 0x00, 0x88, 0x88, 0x76, 0x77, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88,
+    0x77, 0x77, 0x88, 0x88, 0x77, 0x77, 0x88, 0x78, 0x33, 0x11, 0x00, 0x70, 0x02, 0x00, 0x00, 0x70, 0x03, 0x00, 0x77, 0x77, 0x05, 0x00, 0x88, 0x77,
+    0x77, 0x87, 0x87, 0x77, 0x77, 0x87, 0x88, 0x77, 0x77, 0x87, 0x87, 0x77, 0x77, 0x87, 0x88, 0x77, 0x33, 0x51, 0x05, 0x00, 0x02, 0x00, 0x07, 0x00,
+    0x03, 0x00, 0x88, 0x58, 0x06, 0x00, 0x88, 0x58, 0x76, 0x88, 0x99, 0x59, 0x77, 0x88, 0x89, 0x59, 0x77, 0x88, 0x99, 0x59, 0x77, 0x88, 0x88, 0x58,
+    0x33, 0x61, 0x66, 0x00, 0x02, 0x00, 0x76, 0x00, 0x03, 0x00, 0x88, 0x88, 0x06, 0x00, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88,
+    0x77, 0x88, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x00, 0x32, 0x54, 0x55, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x88, 0x88, 0x06, 0x00, 0x88, 0x88,
+    0x77, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x77, 0x11, 0x32, 0x54, 0x55, 0x01, 0x00, 0x77, 0x77,
+    0x02, 0x00, 0x88, 0x88, 0x03, 0x00, 0x88, 0x88, 0x74, 0x88, 0x88, 0x88, 0x75, 0x88, 0x88, 0x88, 0x75, 0x88, 0x88, 0x88, 0x75, 0x88, 0x88, 0x88,
+    0x20, 0x31, 0x54, 0x55, 0x02, 0x00, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x06, 0x00, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88,
+    0x77, 0x88, 0x88, 0x78, 0x77, 0x88, 0x88, 0x78, 0x22, 0x12, 0x54, 0x55, 0x03, 0x00, 0x77, 0x77, 0x03, 0x00, 0x87, 0x88, 0x05, 0x00, 0x88, 0x88,
+    0x66, 0x86, 0x88, 0x88, 0x76, 0x87, 0x88, 0x88, 0x76, 0x86, 0x88, 0x88, 0x76, 0x87, 0x88, 0x88, 0x22, 0x02, 0x00, 0x55, 0x02, 0x00, 0x00, 0x77,
+    0x02, 0x00, 0x00, 0x78, 0x05, 0x00, 0x88, 0x88, 0x76, 0x77, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x77, 0x77, 0x88, 0x78,
+    0x22, 0x22, 0x00, 0x00, 0x02, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00, 0x70, 0x06, 0x00, 0x88, 0x77, 0x76, 0x87, 0x87, 0x77, 0x77, 0x87, 0x88, 0x77,
+    0x77, 0x87, 0x87, 0x77, 0x77, 0x87, 0x88, 0x77, 0x22, 0x32, 0x02, 0x00, 0x02, 0x00, 0x05, 0x00, 0x03, 0x00, 0x08, 0x00, 0x06, 0x00, 0x88, 0x58,
+    0x77, 0x88, 0x88, 0x58, 0x77, 0x88, 0x88, 0x58, 0x77, 0x88, 0x88, 0x58, 0x76, 0x88, 0x88, 0x58, 0x22, 0x32, 0x33, 0x00, 0x03, 0x00, 0x77, 0x00,
+    0x03, 0x00, 0x87, 0x00, 0x04, 0x00, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88,
+    0x02, 0x63, 0x76, 0x77, 0x00, 0x00, 0x88, 0x78, 0x00, 0x00, 0x88, 0x88, 0x00, 0x00, 0x88, 0x88, 0x76, 0x87, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88,
+    0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x20, 0x60, 0x76, 0x77, 0x02, 0x00, 0x77, 0x77, 0x01, 0x00, 0x88, 0x88, 0x03, 0x00, 0x88, 0x88,
+    0x74, 0x87, 0x88, 0x88, 0x75, 0x87, 0x88, 0x88, 0x75, 0x87, 0x88, 0x88, 0x75, 0x87, 0x88, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x33, 0x50, 0x76, 0x77, 0x03, 0x00, 0x76, 0x76, 0x03, 0x00, 0x77, 0x77, 0x05, 0x00, 0x88, 0x88, 0x66, 0x86, 0x88, 0x88, 0x66, 0x86, 0x88, 0x88,
+    0x66, 0x86, 0x88, 0x78, 0x66, 0x76, 0x88, 0x78, 0x33, 0x03, 0x65, 0x66, 0x03, 0x00, 0x00, 0x66, 0x03, 0x00, 0x00, 0x88, 0x06, 0x00, 0x00, 0x88,
+    0x76, 0x77, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x77, 0x77, 0x88, 0x78, 0x33, 0x33, 0x60, 0x66, 0x03, 0x00, 0x00, 0x60,
+    0x03, 0x00, 0x00, 0x60, 0x06, 0x00, 0x00, 0x70, 0x77, 0x87, 0x87, 0x77, 0x77, 0x87, 0x88, 0x77, 0x77, 0x87, 0x87, 0x77, 0x77, 0x87, 0x88, 0x77,
+    0x33, 0x43, 0x44, 0x06, 0x03, 0x00, 0x04, 0x00, 0x03, 0x00, 0x06, 0x00, 0x04, 0x00, 0x08, 0x00, 0x77, 0x88, 0x88, 0x58, 0x77, 0x88, 0x88, 0x58,
+    0x77, 0x88, 0x88, 0x58, 0x77, 0x88, 0x88, 0x58, 0x33, 0x53, 0x66, 0x56, 0x03, 0x00, 0x56, 0x00, 0x03, 0x00, 0x77, 0x00, 0x06, 0x00, 0x88, 0x00,
+    0x76, 0x88, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x76, 0x87, 0x88, 0x88, 0x76, 0x87, 0x88, 0x78, 0x23, 0x53, 0x66, 0x66, 0x03, 0x00, 0x76, 0x77,
+    0x00, 0x00, 0x76, 0x76, 0x00, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x76, 0x87, 0x88, 0x88,
+    0x32, 0x53, 0x66, 0x66, 0x02, 0x00, 0x76, 0x77, 0x02, 0x00, 0x76, 0x76, 0x01, 0x00, 0x88, 0x88, 0x74, 0x87, 0x88, 0x88, 0x75, 0x88, 0x88, 0x88,
+    0x75, 0x88, 0x88, 0x88, 0x75, 0x88, 0x88, 0x88, 0x33, 0x53, 0x66, 0x66, 0x03, 0x00, 0x66, 0x66, 0x00, 0x00, 0x66, 0x66, 0x05, 0x00, 0x88, 0x78,
+    0x66, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x67, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x77, 0x33, 0x53, 0x65, 0x66, 0x03, 0x00, 0x66, 0x66,
+    0x03, 0x00, 0x66, 0x66, 0x05, 0x00, 0x88, 0x88, 0x65, 0x86, 0x88, 0x88, 0x66, 0x86, 0x88, 0x88, 0x66, 0x86, 0x88, 0x88, 0x66, 0x86, 0x88, 0x68,
+    0x33, 0x23, 0x66, 0x66, 0x03, 0x00, 0x66, 0x66, 0x03, 0x00, 0x00, 0x66, 0x06, 0x00, 0x00, 0x88, 0x66, 0x07, 0x00, 0x87, 0x76, 0x77, 0x88, 0x88,
+    0x76, 0x77, 0x78, 0x78, 0x76, 0x77, 0x88, 0x78, 0x33, 0x43, 0x64, 0x66, 0x03, 0x00, 0x63, 0x66, 0x03, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0x60,
+    0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x33, 0x33, 0x45, 0x55, 0x03, 0x00, 0x55, 0x55,
+    0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x76, 0x88, 0x08, 0x00, 0x76, 0x88, 0x88, 0x57, 0x76, 0x77, 0x77, 0x57, 0x76, 0x77, 0x77, 0x57,
+    0x33, 0x43, 0x64, 0x66, 0x03, 0x00, 0x65, 0x65, 0x03, 0x00, 0x65, 0x00, 0x06, 0x00, 0x88, 0x00, 0x76, 0x87, 0x88, 0x00, 0x76, 0x87, 0x88, 0x78,
+    0x76, 0x77, 0x78, 0x78, 0x76, 0x77, 0x88, 0x78, 0x23, 0x63, 0x76, 0x77, 0x03, 0x00, 0x77, 0x77, 0x01, 0x00, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77,
+    0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x66, 0x88, 0x88, 0x78, 0x22, 0x52, 0x76, 0x77, 0x02, 0x00, 0x77, 0x77,
+    0x02, 0x00, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x75, 0x88, 0x88, 0x88, 0x75, 0x87, 0x88, 0x78,
+    0x33, 0x63, 0x76, 0x77, 0x03, 0x00, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x00, 0x00, 0x77, 0x77, 0x05, 0x00, 0x88, 0x88, 0x06, 0x00, 0x88, 0x88,
+    0x66, 0x88, 0x88, 0x88, 0x66, 0x88, 0x88, 0x78, 0x33, 0x63, 0x66, 0x66, 0x03, 0x00, 0x76, 0x77, 0x03, 0x00, 0x77, 0x77, 0x02, 0x00, 0x70, 0x77,
+    0x66, 0x00, 0x80, 0x88, 0x66, 0x00, 0x80, 0x87, 0x66, 0x86, 0x87, 0x88, 0x66, 0x86, 0x88, 0x77, 0x33, 0x23, 0x76, 0x77, 0x03, 0x00, 0x77, 0x77,
+    0x03, 0x00, 0x77, 0x77, 0x02, 0x00, 0x00, 0x67, 0x76, 0x07, 0x00, 0x77, 0x77, 0x07, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x77, 0x67,
+    0x33, 0x42, 0x64, 0x66, 0x03, 0x00, 0x65, 0x66, 0x03, 0x00, 0x64, 0x66, 0x02, 0x00, 0x00, 0x60, 0x76, 0x77, 0x00, 0x60, 0x76, 0x77, 0x00, 0x60,
+    0x76, 0x77, 0x77, 0x66, 0x76, 0x77, 0x77, 0x66, 0x33, 0x43, 0x66, 0x56, 0x03, 0x00, 0x56, 0x56, 0x03, 0x00, 0x66, 0x56, 0x02, 0x00, 0x05, 0x00,
+    0x77, 0x77, 0x07, 0x00, 0x76, 0x77, 0x07, 0x00, 0x77, 0x77, 0x77, 0x57, 0x76, 0x77, 0x77, 0x57, 0x33, 0x43, 0x66, 0x66, 0x03, 0x00, 0x76, 0x77,
+    0x03, 0x00, 0x76, 0x76, 0x02, 0x00, 0x76, 0x00, 0x77, 0x77, 0x77, 0x00, 0x77, 0x77, 0x77, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x23, 0x53, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x01, 0x00, 0x77, 0x77, 0x01, 0x00, 0x88, 0x88, 0x00, 0x87, 0x87, 0x87, 0x00, 0x87, 0x88, 0x88,
+    0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x22, 0x63, 0x76, 0x77, 0x02, 0x00, 0x77, 0x77, 0x02, 0x00, 0x77, 0x77, 0x02, 0x00, 0x88, 0x88,
+    0x00, 0x80, 0x87, 0x87, 0x00, 0x80, 0x88, 0x88, 0x00, 0x70, 0x77, 0x77, 0x60, 0x77, 0x77, 0x77, 0x33, 0x63, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77,
+    0x03, 0x00, 0x77, 0x77, 0x03, 0x00, 0x88, 0x88, 0x00, 0x00, 0x87, 0x87, 0x06, 0x00, 0x88, 0x88, 0x06, 0x00, 0x77, 0x77, 0x66, 0x76, 0x77, 0x77,
+    0x33, 0x43, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x04, 0x00, 0x77, 0x77, 0x34, 0x00, 0x70, 0x77, 0x66, 0x00, 0x70, 0x77,
+    0x66, 0x00, 0x70, 0x77, 0x66, 0x66, 0x77, 0x77, 0x33, 0x23, 0x66, 0x66, 0x03, 0x00, 0x77, 0x77, 0x02, 0x00, 0x77, 0x77, 0x04, 0x00, 0x77, 0x77,
+    0x54, 0x04, 0x00, 0x77, 0x66, 0x06, 0x00, 0x77, 0x66, 0x06, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x33, 0x43, 0x64, 0x66, 0x03, 0x00, 0x65, 0x66,
+    0x03, 0x00, 0x66, 0x66, 0x04, 0x00, 0x66, 0x66, 0x54, 0x66, 0x00, 0x60, 0x66, 0x66, 0x00, 0x60, 0x66, 0x66, 0x00, 0x60, 0x66, 0x66, 0x66, 0x66,
+    0x33, 0x53, 0x66, 0x56, 0x03, 0x00, 0x77, 0x57, 0x03, 0x00, 0x77, 0x57, 0x04, 0x00, 0x88, 0x57, 0x54, 0x87, 0x07, 0x00, 0x76, 0x87, 0x08, 0x00,
+    0x76, 0x76, 0x06, 0x00, 0x76, 0x77, 0x77, 0x06, 0x33, 0x43, 0x66, 0x66, 0x03, 0x00, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x04, 0x00, 0x88, 0x77,
+    0x54, 0x87, 0x87, 0x00, 0x77, 0x87, 0x88, 0x00, 0x77, 0x77, 0x77, 0x00, 0x77, 0x77, 0x77, 0x77, 0x23, 0x63, 0x76, 0x77, 0x03, 0x00, 0x77, 0x77,
+    0x01, 0x00, 0x88, 0x88, 0x05, 0x00, 0x88, 0x88, 0x75, 0x88, 0x99, 0x89, 0x00, 0x88, 0x89, 0x89, 0x00, 0x88, 0x99, 0x89, 0x00, 0x55, 0x55, 0x55,
+    0x22, 0x63, 0x77, 0x67, 0x02, 0x00, 0x77, 0x77, 0x02, 0x00, 0x88, 0x88, 0x03, 0x00, 0x88, 0x88, 0x52, 0x88, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x00, 0x80, 0x88, 0x88, 0x00, 0x50, 0x55, 0x55, 0x33, 0x43, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x03, 0x00, 0x88, 0x88, 0x04, 0x00, 0x88, 0x88,
+    0x44, 0x86, 0x88, 0x88, 0x04, 0x00, 0x88, 0x88, 0x06, 0x00, 0x88, 0x88, 0x00, 0x00, 0x55, 0x55, 0x33, 0x63, 0x66, 0x66, 0x03, 0x00, 0x77, 0x77,
+    0x03, 0x00, 0x88, 0x77, 0x03, 0x00, 0x88, 0x77, 0x55, 0x84, 0x88, 0x77, 0x54, 0x00, 0x80, 0x77, 0x55, 0x00, 0x70, 0x77, 0x55, 0x00, 0x50, 0x55,
+    0x33, 0x23, 0x67, 0x67, 0x03, 0x00, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x04, 0x00, 0x77, 0x77, 0x66, 0x56, 0x77, 0x77, 0x56, 0x06, 0x00, 0x77,
+    0x66, 0x06, 0x00, 0x77, 0x55, 0x05, 0x00, 0x55, 0x33, 0x43, 0x64, 0x66, 0x03, 0x00, 0x75, 0x77, 0x03, 0x00, 0x77, 0x76, 0x05, 0x00, 0x88, 0x77,
+    0x76, 0x87, 0x87, 0x76, 0x76, 0x87, 0x00, 0x70, 0x76, 0x77, 0x00, 0x60, 0x55, 0x55, 0x00, 0x00, 0x33, 0x53, 0x66, 0x56, 0x03, 0x00, 0x77, 0x57,
+    0x03, 0x00, 0x77, 0x57, 0x05, 0x00, 0x88, 0x58, 0x76, 0x87, 0x88, 0x58, 0x76, 0x87, 0x08, 0x00, 0x76, 0x87, 0x08, 0x00, 0x55, 0x55, 0x05, 0x00,
+    0x33, 0x63, 0x66, 0x66, 0x03, 0x00, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x05, 0x00, 0x88, 0x77, 0x76, 0x88, 0x88, 0x78, 0x76, 0x88, 0x88, 0x00,
+    0x76, 0x88, 0x88, 0x00, 0x55, 0x55, 0x55, 0x00, 0x23, 0x63, 0x77, 0x67, 0x03, 0x00, 0x77, 0x77, 0x01, 0x00, 0x88, 0x88, 0x06, 0x00, 0x88, 0x88,
+    0x66, 0x88, 0x88, 0x88, 0x76, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x32, 0x43, 0x77, 0x77, 0x02, 0x00, 0x77, 0x77,
+    0x02, 0x00, 0x88, 0x88, 0x03, 0x00, 0x88, 0x88, 0x73, 0x87, 0x88, 0x88, 0x73, 0x88, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88,
+    0x33, 0x63, 0x66, 0x66, 0x03, 0x00, 0x77, 0x77, 0x03, 0x00, 0x88, 0x77, 0x05, 0x00, 0x88, 0x88, 0x66, 0x87, 0x88, 0x88, 0x56, 0x87, 0x88, 0x88,
+    0x06, 0x00, 0x88, 0x88, 0x05, 0x00, 0x88, 0x78, 0x33, 0x63, 0x66, 0x66, 0x03, 0x00, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77, 0x04, 0x00, 0x88, 0x77,
+    0x54, 0x85, 0x88, 0x88, 0x66, 0x86, 0x88, 0x87, 0x56, 0x00, 0x80, 0x88, 0x66, 0x00, 0x70, 0x77, 0x33, 0x23, 0x77, 0x77, 0x03, 0x00, 0x77, 0x77,
+    0x03, 0x00, 0x77, 0x77, 0x04, 0x00, 0x77, 0x77, 0x66, 0x66, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x76, 0x06, 0x00, 0x77, 0x76, 0x07, 0x00, 0x77,
+    0x33, 0x43, 0x74, 0x77, 0x03, 0x00, 0x75, 0x77, 0x03, 0x00, 0x77, 0x77, 0x04, 0x00, 0x88, 0x77, 0x76, 0x87, 0x87, 0x77, 0x76, 0x87, 0x88, 0x77,
+    0x76, 0x77, 0x00, 0x70, 0x76, 0x77, 0x00, 0x70, 0x33, 0x53, 0x66, 0x56, 0x03, 0x00, 0x77, 0x57, 0x03, 0x00, 0x88, 0x58, 0x06, 0x00, 0x88, 0x58,
+    0x76, 0x87, 0x88, 0x58, 0x76, 0x87, 0x88, 0x58, 0x76, 0x77, 0x08, 0x00, 0x76, 0x77, 0x07, 0x00, 0x33, 0x63, 0x76, 0x76, 0x03, 0x00, 0x77, 0x77,
+    0x03, 0x00, 0x77, 0x77, 0x06, 0x00, 0x88, 0x88, 0x76, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x76, 0x87, 0x88, 0x00, 0x77, 0x87, 0x88, 0x00,
+    0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x70, 0x77, 0x76, 0x97, 0x99, 0x78, 0x98, 0x99, 0xaa, 0x8a, 0x99, 0xa9, 0xaa, 0x9a, 0x99, 0xa9, 0xaa, 0x9a,
+    0x99, 0xa9, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x80, 0x68, 0x75, 0x88, 0x88, 0x88, 0x95, 0xaa, 0x9a, 0x88,
+    0x96, 0xaa, 0xaa, 0x99, 0x97, 0xaa, 0xaa, 0x99, 0x97, 0xaa, 0xaa, 0x99, 0x97, 0x99, 0x99, 0x99, 0x55, 0x00, 0x60, 0x56, 0x66, 0x00, 0x80, 0x78,
+    0x77, 0x88, 0x88, 0x88, 0x77, 0x99, 0x99, 0x89, 0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x99, 0x9a, 0x9a, 0x99, 0x99, 0xaa, 0x9a, 0x99,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x50, 0x55, 0x66, 0x00, 0x70, 0x67, 0x77, 0x88, 0x78, 0x67, 0x88, 0x88, 0x78, 0x77,
+    0x98, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x44, 0x00, 0x00, 0x60, 0x76, 0x00, 0x00, 0x60,
+    0x88, 0x98, 0x99, 0x77, 0x98, 0x99, 0x99, 0x77, 0x99, 0x99, 0x99, 0x88, 0x99, 0xa9, 0xaa, 0x99, 0x99, 0xa9, 0xa9, 0x99, 0x99, 0xa9, 0xaa, 0x99,
+    0x55, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x58, 0x88, 0xaa, 0x9a, 0x59, 0x99, 0xaa, 0xaa, 0x69, 0x99, 0xaa, 0xaa, 0x79,
+    0x99, 0xaa, 0xaa, 0x79, 0x99, 0x99, 0x99, 0x79, 0x55, 0x00, 0x60, 0x00, 0x66, 0x00, 0x70, 0x00, 0x96, 0x99, 0x78, 0x77, 0x98, 0x99, 0x99, 0x89,
+    0x99, 0xaa, 0x9a, 0x99, 0x99, 0x9a, 0x9a, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x50, 0x55, 0x00, 0x00, 0x70, 0x77,
+    0x00, 0x88, 0x78, 0x77, 0x88, 0x98, 0x99, 0x79, 0x99, 0xaa, 0x9a, 0x99, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0xaa, 0x99, 0x99, 0xa9, 0xaa, 0x99,
+    0x00, 0x00, 0x40, 0x45, 0x00, 0x00, 0x70, 0x77, 0x00, 0x90, 0x99, 0x78, 0x95, 0x99, 0xaa, 0x8a, 0x96, 0xa9, 0xaa, 0x9a, 0x97, 0xa9, 0xaa, 0x9a,
+    0x97, 0xa9, 0xaa, 0x99, 0x97, 0x99, 0x99, 0x89, 0x50, 0x00, 0x40, 0x45, 0x55, 0x00, 0x80, 0x68, 0x77, 0x88, 0x88, 0x88, 0x77, 0x99, 0x99, 0x88,
+    0x88, 0x99, 0x99, 0x89, 0x99, 0xaa, 0x9a, 0x99, 0x89, 0x9a, 0x9a, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x34, 0x00, 0x40, 0x45, 0x55, 0x00, 0x70, 0x77,
+    0x75, 0x87, 0x88, 0x77, 0x76, 0x87, 0x88, 0x77, 0x88, 0x98, 0x99, 0x89, 0x98, 0x99, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99,
+    0x34, 0x00, 0x40, 0x45, 0x66, 0x00, 0x70, 0x77, 0x66, 0x88, 0x78, 0x77, 0x77, 0x88, 0x78, 0x77, 0x98, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89,
+    0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x34, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x60, 0x88, 0x88, 0x00, 0x70, 0x88, 0x98, 0x99, 0x77,
+    0x98, 0x99, 0x99, 0x88, 0x99, 0xa9, 0xaa, 0x99, 0x99, 0xa9, 0xa9, 0x98, 0x99, 0xa9, 0xaa, 0x99, 0x34, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+    0x86, 0x88, 0x08, 0x00, 0x98, 0x99, 0x99, 0x59, 0x99, 0xaa, 0x9a, 0x69, 0x99, 0x9a, 0x9a, 0x79, 0x99, 0xaa, 0x9a, 0x79, 0x98, 0x99, 0x99, 0x79,
+    0x44, 0x00, 0x00, 0x00, 0x66, 0x00, 0x70, 0x00, 0x76, 0x88, 0x88, 0x00, 0x96, 0x99, 0x89, 0x88, 0x99, 0xa9, 0xaa, 0x99, 0x99, 0xaa, 0xaa, 0x99,
+    0x99, 0xaa, 0xaa, 0x99, 0x99, 0xaa, 0x9a, 0x99, 0x04, 0x00, 0x60, 0x56, 0x00, 0x00, 0x50, 0x56, 0x00, 0x88, 0x88, 0x88, 0x00, 0x98, 0x99, 0x88,
+    0x98, 0x99, 0x99, 0x89, 0x99, 0xaa, 0x9a, 0x89, 0x99, 0x9a, 0x9a, 0x89, 0x99, 0xaa, 0x9a, 0x89, 0x40, 0x00, 0x60, 0x56, 0x00, 0x00, 0x50, 0x56,
+    0x00, 0x80, 0x78, 0x77, 0x00, 0x90, 0x99, 0x79, 0x96, 0xaa, 0x9a, 0x99, 0x97, 0xaa, 0xaa, 0x99, 0x97, 0xaa, 0xaa, 0x99, 0x97, 0xa9, 0xaa, 0x99,
+    0x44, 0x00, 0x60, 0x56, 0x04, 0x00, 0x50, 0x56, 0x06, 0x00, 0x88, 0x68, 0x07, 0x00, 0x99, 0x89, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x44, 0x00, 0x60, 0x56, 0x34, 0x00, 0x50, 0x56, 0x66, 0x00, 0x70, 0x77, 0x77, 0x00, 0x80, 0x88,
+    0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x44, 0x00, 0x40, 0x55, 0x44, 0x00, 0x00, 0x55,
+    0x76, 0x07, 0x00, 0x66, 0x88, 0x08, 0x00, 0x77, 0x98, 0x99, 0x89, 0x88, 0x99, 0x99, 0x89, 0x88, 0x99, 0x99, 0x89, 0x88, 0x99, 0x99, 0x89, 0x88,
+    0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x00, 0x50, 0x76, 0x88, 0x00, 0x60, 0x98, 0x99, 0x00, 0x70, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x44, 0x00, 0x00, 0x05, 0x44, 0x00, 0x00, 0x00, 0x76, 0x88, 0x08, 0x00, 0x96, 0x99, 0x09, 0x00,
+    0x99, 0xa9, 0xaa, 0x69, 0x99, 0xaa, 0xaa, 0x79, 0x99, 0xaa, 0xaa, 0x79, 0x99, 0xaa, 0x9a, 0x79, 0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x50, 0x00,
+    0x88, 0x88, 0x78, 0x00, 0x88, 0x99, 0x89, 0x00, 0x98, 0x99, 0x99, 0x89, 0x98, 0xa9, 0xaa, 0x99, 0x98, 0xa9, 0xa9, 0x99, 0x98, 0xa9, 0xaa, 0x99,
+    0x44, 0x00, 0x60, 0x66, 0x54, 0x00, 0x70, 0x66, 0x00, 0x77, 0x77, 0x66, 0x00, 0x99, 0x89, 0x88, 0x00, 0x99, 0x99, 0x89, 0x98, 0x99, 0x99, 0x89,
+    0x98, 0x99, 0x99, 0x89, 0x98, 0x99, 0x99, 0x89, 0x33, 0x00, 0x60, 0x66, 0x33, 0x00, 0x70, 0x66, 0x00, 0x70, 0x77, 0x66, 0x00, 0x90, 0x99, 0x88,
+    0x00, 0x90, 0x99, 0x89, 0x97, 0x99, 0x99, 0x89, 0x97, 0x99, 0x99, 0x89, 0x97, 0x99, 0x99, 0x89, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x70, 0x66,
+    0x04, 0x00, 0x76, 0x66, 0x06, 0x00, 0x99, 0x79, 0x08, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x77, 0x00, 0x80, 0x88, 0x87, 0x00, 0x90, 0x88, 0x88, 0x98, 0x99, 0x89,
+    0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x89, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x50, 0x56, 0x55, 0x05, 0x00, 0x56, 0x88, 0x08, 0x00, 0x77,
+    0x88, 0x09, 0x00, 0x78, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x89, 0x88, 0x44, 0x00, 0x50, 0x55, 0x65, 0x00, 0x50, 0x55,
+    0x65, 0x66, 0x00, 0x50, 0x96, 0x99, 0x00, 0x70, 0x99, 0x99, 0x00, 0x80, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99,
+    0x44, 0x00, 0x40, 0x45, 0x65, 0x00, 0x50, 0x45, 0x65, 0x66, 0x06, 0x00, 0x88, 0x99, 0x09, 0x00, 0x98, 0x99, 0x09, 0x00, 0x98, 0x99, 0x99, 0x79,
+    0x98, 0x99, 0x99, 0x79, 0x98, 0x99, 0x99, 0x79, 0x44, 0x00, 0x50, 0x55, 0x65, 0x00, 0x60, 0x55, 0x65, 0x67, 0x67, 0x00, 0x88, 0x98, 0x99, 0x00,
+    0x98, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99, 0x89, 0x98, 0x99, 0x99, 0x89, 0x98, 0x99, 0x99, 0x89, 0x44, 0x00, 0x60, 0x56, 0x66, 0x00, 0x70, 0x67,
+    0x76, 0x88, 0x88, 0x67, 0x00, 0x88, 0x88, 0x67, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99,
+    0x33, 0x00, 0x60, 0x56, 0x53, 0x00, 0x70, 0x67, 0x53, 0x88, 0x78, 0x67, 0x00, 0x70, 0x78, 0x67, 0x00, 0x90, 0x99, 0x99, 0x00, 0x90, 0x99, 0x89,
+    0x97, 0x99, 0x99, 0x99, 0x97, 0x99, 0x99, 0x89, 0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x70, 0x67, 0x55, 0x76, 0x77, 0x67, 0x05, 0x00, 0x77, 0x67,
+    0x07, 0x00, 0x99, 0x89, 0x08, 0x00, 0x99, 0x89, 0x88, 0x99, 0x99, 0x89, 0x88, 0x99, 0x99, 0x89, 0x44, 0x00, 0x60, 0x56, 0x54, 0x00, 0x60, 0x66,
+    0x55, 0x64, 0x66, 0x66, 0x54, 0x00, 0x60, 0x66, 0x88, 0x00, 0x90, 0x89, 0x88, 0x00, 0x90, 0x99, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x98, 0x99,
+    0x34, 0x00, 0x60, 0x56, 0x55, 0x00, 0x50, 0x56, 0x66, 0x56, 0x66, 0x56, 0x56, 0x06, 0x00, 0x55, 0x98, 0x09, 0x00, 0x88, 0x99, 0x09, 0x00, 0x88,
+    0x99, 0x99, 0x88, 0x88, 0x99, 0x89, 0x88, 0x88, 0x44, 0x00, 0x50, 0x55, 0x66, 0x00, 0x70, 0x55, 0x76, 0x77, 0x76, 0x55, 0x76, 0x76, 0x00, 0x50,
+    0x98, 0x99, 0x00, 0x80, 0x98, 0x99, 0x00, 0x80, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x55, 0x00, 0x60, 0x46, 0x66, 0x00, 0x70, 0x47,
+    0x76, 0x77, 0x77, 0x47, 0x76, 0x77, 0x07, 0x00, 0x99, 0x99, 0x09, 0x00, 0x98, 0x99, 0x09, 0x00, 0x99, 0x99, 0x99, 0x79, 0x98, 0x99, 0x99, 0x79,
+    0x55, 0x00, 0x60, 0x56, 0x66, 0x00, 0x70, 0x66, 0x76, 0x88, 0x78, 0x67, 0x76, 0x78, 0x78, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x44, 0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x77, 0x77, 0x88, 0x78, 0x77, 0x77, 0x98, 0x99, 0x77,
+    0x00, 0x98, 0x98, 0x77, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x33, 0x00, 0x60, 0x66, 0x64, 0x00, 0x70, 0x77,
+    0x73, 0x77, 0x77, 0x77, 0x74, 0x98, 0x99, 0x77, 0x00, 0x90, 0x98, 0x77, 0x00, 0x90, 0x99, 0x89, 0x00, 0x80, 0x89, 0x89, 0x80, 0x99, 0x99, 0x89,
+    0x55, 0x00, 0x60, 0x56, 0x66, 0x00, 0x70, 0x77, 0x56, 0x88, 0x78, 0x77, 0x66, 0x88, 0x88, 0x77, 0x05, 0x00, 0x88, 0x77, 0x08, 0x00, 0x88, 0x88,
+    0x08, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x70, 0x57, 0x55, 0x75, 0x77, 0x67, 0x66, 0x76, 0x77, 0x77,
+    0x56, 0x00, 0x60, 0x67, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x76, 0x77, 0x66, 0x66, 0x76, 0x06, 0x00, 0x66, 0x88, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x70, 0x66, 0x76, 0x77, 0x77, 0x66, 0x76, 0x88, 0x78, 0x66, 0x76, 0x78, 0x00, 0x60, 0x88, 0x88, 0x00, 0x80,
+    0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x88, 0x88, 0x44, 0x00, 0x60, 0x46, 0x66, 0x00, 0x70, 0x47, 0x77, 0x88, 0x78, 0x47, 0x77, 0x98, 0x99, 0x47,
+    0x77, 0x98, 0x08, 0x00, 0x98, 0x99, 0x09, 0x00, 0x98, 0x98, 0x08, 0x00, 0x98, 0x99, 0x99, 0x08, 0x55, 0x00, 0x60, 0x56, 0x66, 0x00, 0x70, 0x77,
+    0x77, 0x88, 0x78, 0x77, 0x77, 0x98, 0x99, 0x77, 0x77, 0x98, 0x98, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99,
+    0x55, 0x00, 0x60, 0x66, 0x75, 0x00, 0x70, 0x77, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x97, 0x99, 0x99, 0x89, 0x00, 0x99, 0x99, 0x89,
+    0x00, 0x99, 0x99, 0x89, 0x00, 0x77, 0x77, 0x77, 0x33, 0x00, 0x60, 0x66, 0x54, 0x00, 0x70, 0x77, 0x84, 0x88, 0x78, 0x77, 0x84, 0x88, 0x88, 0x77,
+    0x84, 0x99, 0x99, 0x89, 0x00, 0x90, 0x99, 0x89, 0x00, 0x90, 0x99, 0x89, 0x00, 0x70, 0x77, 0x77, 0x55, 0x00, 0x60, 0x56, 0x66, 0x00, 0x70, 0x57,
+    0x66, 0x88, 0x88, 0x67, 0x66, 0x88, 0x88, 0x77, 0x66, 0x88, 0x99, 0x89, 0x06, 0x00, 0x89, 0x89, 0x08, 0x00, 0x99, 0x89, 0x00, 0x00, 0x77, 0x77,
+    0x44, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67, 0x66, 0x76, 0x77, 0x67, 0x76, 0x87, 0x88, 0x77, 0x77, 0x86, 0x87, 0x88, 0x76, 0x00, 0x80, 0x87,
+    0x77, 0x00, 0x80, 0x88, 0x77, 0x00, 0x70, 0x77, 0x44, 0x00, 0x60, 0x56, 0x66, 0x00, 0x70, 0x77, 0x76, 0x77, 0x77, 0x77, 0x76, 0x88, 0x78, 0x77,
+    0x88, 0x78, 0x68, 0x77, 0x78, 0x08, 0x00, 0x67, 0x88, 0x08, 0x00, 0x77, 0x77, 0x07, 0x00, 0x77, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x66,
+    0x66, 0x88, 0x78, 0x66, 0x77, 0x88, 0x88, 0x77, 0x98, 0x99, 0x88, 0x76, 0x98, 0x98, 0x00, 0x70, 0x98, 0x99, 0x00, 0x80, 0x77, 0x77, 0x00, 0x00,
+    0x44, 0x00, 0x60, 0x46, 0x55, 0x00, 0x70, 0x57, 0x76, 0x87, 0x88, 0x48, 0x77, 0x88, 0x88, 0x58, 0x98, 0x99, 0x99, 0x48, 0x98, 0x99, 0x09, 0x00,
+    0x98, 0x99, 0x09, 0x00, 0x77, 0x77, 0x07, 0x00, 0x44, 0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x67, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88,
+    0x98, 0x99, 0x99, 0x89, 0x98, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99, 0x00, 0x77, 0x77, 0x77, 0x00, 0x55, 0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x77,
+    0x86, 0x99, 0x79, 0x77, 0x88, 0x99, 0x99, 0x88, 0x88, 0x99, 0x99, 0x89, 0x98, 0x99, 0x99, 0x89, 0x00, 0x99, 0x99, 0x89, 0x00, 0x99, 0x99, 0x89,
+    0x33, 0x00, 0x60, 0x56, 0x64, 0x00, 0x70, 0x67, 0x75, 0x88, 0x88, 0x67, 0x85, 0x99, 0x89, 0x88, 0x95, 0x99, 0x99, 0x89, 0x95, 0x99, 0x99, 0x89,
+    0x00, 0x90, 0x99, 0x89, 0x00, 0x90, 0x99, 0x89, 0x55, 0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x67, 0x77, 0x88, 0x78, 0x67, 0x77, 0x99, 0x89, 0x77,
+    0x88, 0x99, 0x99, 0x89, 0x78, 0x99, 0x99, 0x89, 0x08, 0x00, 0x99, 0x89, 0x07, 0x00, 0x99, 0x89, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x70, 0x77,
+    0x76, 0x87, 0x88, 0x77, 0x76, 0x87, 0x88, 0x77, 0x76, 0x87, 0x88, 0x88, 0x88, 0x88, 0x99, 0x89, 0x78, 0x00, 0x80, 0x89, 0x88, 0x00, 0x90, 0x89,
+    0x55, 0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x77, 0x76, 0x88, 0x78, 0x77, 0x76, 0x88, 0x78, 0x77, 0x88, 0x88, 0x78, 0x77, 0x98, 0x99, 0x88, 0x88,
+    0x98, 0x08, 0x00, 0x87, 0x98, 0x09, 0x00, 0x88, 0x44, 0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x66, 0x76, 0x88, 0x88, 0x77, 0x76, 0x98, 0x99, 0x77,
+    0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x87, 0x98, 0x99, 0x00, 0x80, 0x98, 0x99, 0x00, 0x70, 0x55, 0x00, 0x60, 0x46, 0x55, 0x00, 0x70, 0x57,
+    0x66, 0x88, 0x78, 0x57, 0x88, 0x98, 0x99, 0x58, 0x98, 0x99, 0x99, 0x59, 0x98, 0x99, 0x99, 0x59, 0x98, 0x99, 0x09, 0x00, 0x98, 0x99, 0x09, 0x00,
+    0x44, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x77, 0x76, 0x97, 0x99, 0x78, 0x88, 0x98, 0x98, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x89,
+    0x98, 0x99, 0x99, 0x00, 0x98, 0x99, 0x99, 0x00, 0x00, 0x00, 0x60, 0x56, 0x00, 0x00, 0x60, 0x66, 0x66, 0x00, 0x80, 0x68, 0x88, 0x88, 0x99, 0x89,
+    0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x99, 0x78, 0x00, 0x00, 0x60, 0x56, 0x00, 0x00, 0x60, 0x56,
+    0x74, 0x00, 0x80, 0x88, 0x85, 0x99, 0x99, 0x88, 0x85, 0x99, 0x99, 0x88, 0x86, 0x99, 0x99, 0x88, 0x86, 0x99, 0x99, 0x88, 0x86, 0x88, 0x88, 0x88,
+    0x55, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x66, 0x66, 0x00, 0x80, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x99, 0x89, 0x88, 0x88, 0x89, 0x89, 0x88,
+    0x88, 0x99, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55, 0x87, 0x00, 0x80, 0x68, 0x87, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x55, 0x00, 0x50, 0x55, 0x55, 0x00, 0x50, 0x66,
+    0x66, 0x00, 0x70, 0x67, 0x76, 0x88, 0x78, 0x77, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x78,
+    0x44, 0x00, 0x00, 0x50, 0x44, 0x00, 0x00, 0x60, 0x77, 0x00, 0x80, 0x66, 0x87, 0x88, 0x88, 0x77, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x98, 0x88,
+    0x88, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x87, 0x00, 0x80, 0x58, 0x88, 0x99, 0x99, 0x59,
+    0x88, 0x99, 0x99, 0x59, 0x88, 0x99, 0x99, 0x69, 0x88, 0x99, 0x99, 0x69, 0x88, 0x88, 0x99, 0x69, 0x44, 0x00, 0x60, 0x00, 0x55, 0x00, 0x60, 0x00,
+    0x75, 0x00, 0x70, 0x77, 0x98, 0x99, 0x88, 0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99, 0x89, 0x88, 0x88, 0x99, 0x89, 0x88, 0x87, 0x99, 0x89, 0x88,
+    0x00, 0x00, 0x60, 0x56, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x70, 0x77, 0x76, 0x87, 0x88, 0x78, 0x88, 0x88, 0x99, 0x89, 0x88, 0x99, 0x89, 0x89,
+    0x88, 0x89, 0x99, 0x89, 0x88, 0x99, 0x89, 0x88, 0x00, 0x00, 0x60, 0x56, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x80, 0x68, 0x85, 0x88, 0x99, 0x89,
+    0x85, 0x98, 0x99, 0x89, 0x86, 0x98, 0x99, 0x89, 0x86, 0x98, 0x99, 0x88, 0x86, 0x88, 0x88, 0x88, 0x50, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x56,
+    0x66, 0x00, 0x80, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x99, 0x89, 0x88, 0x78, 0x89, 0x89, 0x88, 0x88, 0x99, 0x89, 0x88, 0x77, 0x88, 0x88, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x40, 0x44, 0x44, 0x00, 0x50, 0x66, 0x66, 0x00, 0x70, 0x67, 0x77, 0x88, 0x78, 0x77,
+    0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x78, 0x44, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x60,
+    0x77, 0x00, 0x00, 0x60, 0x88, 0x88, 0x88, 0x77, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x98, 0x87, 0x88, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x77,
+    0x44, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x98, 0x99, 0x88, 0x58, 0x98, 0x99, 0x89, 0x58, 0x98, 0x99, 0x89, 0x68,
+    0x88, 0x99, 0x89, 0x68, 0x87, 0x88, 0x88, 0x68, 0x44, 0x00, 0x00, 0x00, 0x55, 0x00, 0x50, 0x00, 0x66, 0x00, 0x70, 0x00, 0x96, 0x99, 0x78, 0x77,
+    0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x98, 0x99, 0x99, 0x88, 0x88, 0x98, 0x99, 0x88, 0x04, 0x00, 0x60, 0x56, 0x00, 0x00, 0x50, 0x56,
+    0x00, 0x00, 0x70, 0x77, 0x00, 0x88, 0x78, 0x77, 0x88, 0x98, 0x99, 0x78, 0x88, 0x98, 0x98, 0x78, 0x88, 0x98, 0x99, 0x78, 0x88, 0x88, 0x88, 0x78,
+    0x40, 0x00, 0x60, 0x56, 0x00, 0x00, 0x50, 0x56, 0x00, 0x00, 0x70, 0x77, 0x00, 0x80, 0x88, 0x78, 0x85, 0x88, 0x99, 0x89, 0x86, 0x99, 0x89, 0x89,
+    0x86, 0x89, 0x99, 0x89, 0x86, 0x99, 0x89, 0x88, 0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x50, 0x56, 0x55, 0x00, 0x80, 0x68, 0x77, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x78, 0x44, 0x00, 0x60, 0x56, 0x34, 0x00, 0x50, 0x56,
+    0x55, 0x00, 0x70, 0x77, 0x75, 0x87, 0x88, 0x77, 0x76, 0x87, 0x88, 0x78, 0x77, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88,
+    0x44, 0x00, 0x40, 0x55, 0x44, 0x00, 0x50, 0x55, 0x66, 0x00, 0x60, 0x66, 0x66, 0x88, 0x78, 0x67, 0x77, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x78,
+    0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x78, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x00, 0x50, 0x75, 0x00, 0x00, 0x60, 0x88, 0x88, 0x00, 0x70,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x77, 0x44, 0x00, 0x00, 0x05, 0x44, 0x00, 0x00, 0x00,
+    0x66, 0x00, 0x00, 0x00, 0x86, 0x88, 0x08, 0x00, 0x88, 0x98, 0x99, 0x58, 0x88, 0x98, 0x99, 0x68, 0x88, 0x98, 0x99, 0x68, 0x88, 0x98, 0x99, 0x68,
+    0x44, 0x00, 0x50, 0x54, 0x44, 0x00, 0x50, 0x00, 0x77, 0x00, 0x70, 0x00, 0x77, 0x88, 0x88, 0x00, 0x87, 0x99, 0x89, 0x88, 0x87, 0x89, 0x89, 0x88,
+    0x87, 0x99, 0x89, 0x88, 0x87, 0x88, 0x88, 0x88, 0x44, 0x00, 0x50, 0x55, 0x34, 0x00, 0x50, 0x66, 0x00, 0x00, 0x50, 0x56, 0x00, 0x88, 0x88, 0x88,
+    0x00, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x33, 0x00, 0x50, 0x55, 0x33, 0x00, 0x50, 0x66,
+    0x00, 0x00, 0x50, 0x56, 0x00, 0x80, 0x78, 0x77, 0x00, 0x80, 0x88, 0x78, 0x86, 0x88, 0x88, 0x78, 0x86, 0x88, 0x88, 0x78, 0x86, 0x88, 0x88, 0x78,
+    0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55, 0x04, 0x00, 0x50, 0x55, 0x06, 0x00, 0x88, 0x78, 0x08, 0x00, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55, 0x66, 0x00, 0x70, 0x77,
+    0x77, 0x00, 0x80, 0x88, 0x77, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x78, 0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x50, 0x55,
+    0x45, 0x00, 0x00, 0x55, 0x76, 0x07, 0x00, 0x77, 0x88, 0x08, 0x00, 0x77, 0x88, 0x88, 0x78, 0x77, 0x88, 0x88, 0x78, 0x77, 0x87, 0x88, 0x78, 0x77,
+    0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x50, 0x55, 0x45, 0x00, 0x00, 0x50, 0x86, 0x88, 0x00, 0x60, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x88, 0x87,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x44, 0x00, 0x40, 0x44, 0x55, 0x00, 0x30, 0x44, 0x45, 0x00, 0x00, 0x00, 0x77, 0x88, 0x08, 0x00,
+    0x87, 0x88, 0x08, 0x00, 0x87, 0x88, 0x88, 0x68, 0x87, 0x88, 0x88, 0x68, 0x87, 0x88, 0x88, 0x68, 0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x50, 0x55,
+    0x45, 0x00, 0x40, 0x00, 0x88, 0x88, 0x78, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x78,
+    0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x60, 0x66, 0x64, 0x00, 0x80, 0x67, 0x00, 0x87, 0x87, 0x67, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88,
+    0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x33, 0x00, 0x60, 0x56, 0x33, 0x00, 0x60, 0x66, 0x33, 0x00, 0x70, 0x67, 0x00, 0x70, 0x77, 0x67,
+    0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x86, 0x88, 0x88, 0x88, 0x86, 0x88, 0x88, 0x88, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x60, 0x66,
+    0x44, 0x00, 0x70, 0x67, 0x04, 0x00, 0x77, 0x67, 0x06, 0x00, 0x88, 0x78, 0x07, 0x00, 0x88, 0x78, 0x77, 0x88, 0x88, 0x78, 0x77, 0x88, 0x88, 0x78,
+    0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x77, 0x00, 0x80, 0x88, 0x77, 0x00, 0x80, 0x88,
+    0x77, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x34, 0x00, 0x60, 0x56, 0x44, 0x00, 0x50, 0x56, 0x55, 0x00, 0x60, 0x56, 0x55, 0x05, 0x00, 0x55,
+    0x88, 0x08, 0x00, 0x77, 0x88, 0x08, 0x00, 0x77, 0x88, 0x78, 0x78, 0x77, 0x88, 0x88, 0x78, 0x77, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55,
+    0x65, 0x00, 0x50, 0x55, 0x65, 0x66, 0x00, 0x50, 0x87, 0x88, 0x00, 0x70, 0x87, 0x88, 0x00, 0x70, 0x87, 0x88, 0x88, 0x77, 0x87, 0x88, 0x88, 0x77,
+    0x44, 0x00, 0x40, 0x44, 0x44, 0x00, 0x50, 0x45, 0x65, 0x00, 0x60, 0x45, 0x65, 0x67, 0x07, 0x00, 0x88, 0x88, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00,
+    0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55, 0x65, 0x00, 0x70, 0x56, 0x65, 0x77, 0x77, 0x00,
+    0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x60, 0x56,
+    0x66, 0x00, 0x70, 0x67, 0x76, 0x88, 0x88, 0x77, 0x00, 0x88, 0x88, 0x77, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x33, 0x00, 0x50, 0x55, 0x33, 0x00, 0x60, 0x56, 0x63, 0x00, 0x70, 0x67, 0x63, 0x88, 0x88, 0x77, 0x00, 0x80, 0x88, 0x77, 0x00, 0x80, 0x88, 0x88,
+    0x00, 0x80, 0x87, 0x87, 0x70, 0x87, 0x88, 0x88, 0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x50, 0x56, 0x55, 0x00, 0x70, 0x67, 0x55, 0x76, 0x77, 0x77,
+    0x05, 0x00, 0x77, 0x77, 0x07, 0x00, 0x77, 0x77, 0x07, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x56,
+    0x55, 0x00, 0x60, 0x66, 0x55, 0x65, 0x66, 0x66, 0x54, 0x00, 0x60, 0x66, 0x77, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x56, 0x66, 0x56, 0x66, 0x56, 0x56, 0x06, 0x00, 0x56, 0x77, 0x07, 0x00, 0x77,
+    0x77, 0x07, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x50, 0x55, 0x66, 0x00, 0x70, 0x55, 0x76, 0x77, 0x77, 0x55,
+    0x76, 0x77, 0x00, 0x50, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x77, 0x77, 0x44, 0x00, 0x40, 0x44, 0x55, 0x00, 0x60, 0x46,
+    0x66, 0x00, 0x70, 0x47, 0x76, 0x88, 0x88, 0x47, 0x76, 0x88, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00, 0x78, 0x78, 0x08, 0x00, 0x88, 0x88, 0x78, 0x07,
+    0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x50, 0x56, 0x66, 0x00, 0x70, 0x66, 0x76, 0x88, 0x88, 0x67, 0x76, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00,
+    0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x77, 0x77, 0x88, 0x78, 0x77,
+    0x77, 0x98, 0x99, 0x78, 0x00, 0x98, 0x98, 0x78, 0x00, 0x98, 0x99, 0x78, 0x00, 0x66, 0x66, 0x66, 0x33, 0x00, 0x60, 0x56, 0x33, 0x00, 0x60, 0x66,
+    0x64, 0x00, 0x70, 0x77, 0x73, 0x77, 0x77, 0x77, 0x74, 0x88, 0x88, 0x78, 0x00, 0x80, 0x88, 0x78, 0x00, 0x80, 0x88, 0x78, 0x00, 0x60, 0x66, 0x66,
+    0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x56, 0x66, 0x00, 0x70, 0x66, 0x56, 0x88, 0x78, 0x77, 0x66, 0x88, 0x88, 0x78, 0x05, 0x00, 0x88, 0x78,
+    0x07, 0x00, 0x88, 0x78, 0x00, 0x00, 0x66, 0x66, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x60, 0x56, 0x65, 0x00, 0x70, 0x57, 0x65, 0x75, 0x77, 0x77,
+    0x66, 0x76, 0x77, 0x77, 0x56, 0x00, 0x70, 0x77, 0x66, 0x00, 0x70, 0x77, 0x66, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x66,
+    0x65, 0x00, 0x60, 0x66, 0x66, 0x66, 0x66, 0x66, 0x76, 0x77, 0x66, 0x66, 0x76, 0x06, 0x00, 0x66, 0x76, 0x07, 0x00, 0x66, 0x66, 0x06, 0x00, 0x66,
+    0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x70, 0x66, 0x76, 0x77, 0x77, 0x66, 0x76, 0x88, 0x78, 0x66, 0x76, 0x78, 0x00, 0x60,
+    0x76, 0x88, 0x00, 0x70, 0x66, 0x66, 0x00, 0x00, 0x44, 0x00, 0x40, 0x44, 0x55, 0x00, 0x60, 0x46, 0x66, 0x00, 0x70, 0x47, 0x77, 0x88, 0x78, 0x47,
+    0x77, 0x88, 0x88, 0x47, 0x77, 0x88, 0x08, 0x00, 0x76, 0x88, 0x08, 0x00, 0x66, 0x66, 0x06, 0x00, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x50, 0x56,
+    0x66, 0x00, 0x70, 0x77, 0x77, 0x88, 0x78, 0x77, 0x77, 0x98, 0x99, 0x78, 0x77, 0x98, 0x98, 0x00, 0x76, 0x98, 0x99, 0x00, 0x66, 0x66, 0x66, 0x00,
+    0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x66, 0x75, 0x00, 0x70, 0x77, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x33, 0x00, 0x60, 0x56, 0x33, 0x00, 0x60, 0x66, 0x64, 0x00, 0x70, 0x66, 0x84, 0x88, 0x78, 0x77,
+    0x84, 0x88, 0x88, 0x88, 0x84, 0x88, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x00, 0x80, 0x88, 0x88, 0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x60, 0x56,
+    0x66, 0x00, 0x70, 0x57, 0x66, 0x88, 0x88, 0x77, 0x66, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x06, 0x00, 0x88, 0x88, 0x07, 0x00, 0x88, 0x88,
+    0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x66, 0x65, 0x00, 0x70, 0x67, 0x66, 0x76, 0x77, 0x67, 0x76, 0x87, 0x88, 0x77, 0x77, 0x86, 0x87, 0x77,
+    0x76, 0x00, 0x80, 0x77, 0x77, 0x00, 0x70, 0x77, 0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x60, 0x56, 0x66, 0x00, 0x70, 0x67, 0x76, 0x77, 0x77, 0x77,
+    0x76, 0x88, 0x78, 0x77, 0x77, 0x78, 0x78, 0x77, 0x77, 0x08, 0x00, 0x67, 0x77, 0x07, 0x00, 0x77, 0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x60, 0x66,
+    0x65, 0x00, 0x70, 0x66, 0x66, 0x88, 0x78, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x00, 0x70, 0x88, 0x88, 0x00, 0x70,
+    0x44, 0x00, 0x40, 0x44, 0x44, 0x00, 0x60, 0x46, 0x55, 0x00, 0x70, 0x57, 0x76, 0x87, 0x88, 0x48, 0x88, 0x88, 0x88, 0x58, 0x88, 0x88, 0x88, 0x48,
+    0x88, 0x88, 0x08, 0x00, 0x88, 0x88, 0x08, 0x00, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x66, 0x66, 0x00, 0x80, 0x68, 0x87, 0x88, 0x88, 0x78,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0x11, 0x66, 0x56, 0x00, 0x00, 0x60, 0x66,
+    0x55, 0x00, 0x60, 0x66, 0x77, 0x00, 0x80, 0x78, 0x77, 0x87, 0x88, 0x78, 0x77, 0x87, 0x88, 0x78, 0x77, 0x87, 0x88, 0x77, 0x77, 0x77, 0x77, 0x67,
+    0x00, 0x10, 0x66, 0x56, 0x00, 0x00, 0x60, 0x56, 0x33, 0x00, 0x70, 0x67, 0x84, 0x00, 0x80, 0x88, 0x85, 0x88, 0x88, 0x88, 0x85, 0x88, 0x88, 0x88,
+    0x85, 0x88, 0x88, 0x88, 0x85, 0x88, 0x88, 0x88, 0x05, 0x00, 0x66, 0x56, 0x04, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66, 0x66, 0x00, 0x80, 0x68,
+    0x77, 0x88, 0x88, 0x78, 0x77, 0x88, 0x88, 0x78, 0x77, 0x88, 0x88, 0x77, 0x77, 0x88, 0x78, 0x77, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55,
+    0x55, 0x00, 0x60, 0x66, 0x77, 0x00, 0x80, 0x78, 0x77, 0x88, 0x88, 0x78, 0x77, 0x88, 0x88, 0x78, 0x77, 0x88, 0x78, 0x77, 0x77, 0x88, 0x78, 0x77,
+    0x44, 0x04, 0x00, 0x55, 0x44, 0x00, 0x00, 0x55, 0x44, 0x00, 0x70, 0x67, 0x66, 0x00, 0x70, 0x77, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x55, 0x15, 0x00, 0x50, 0x45, 0x00, 0x00, 0x60, 0x55, 0x00, 0x60, 0x66, 0x77, 0x00, 0x80, 0x77,
+    0x77, 0x87, 0x87, 0x77, 0x77, 0x87, 0x88, 0x77, 0x77, 0x87, 0x87, 0x77, 0x77, 0x87, 0x88, 0x77, 0x44, 0x14, 0x01, 0x00, 0x44, 0x00, 0x00, 0x00,
+    0x44, 0x00, 0x70, 0x47, 0x77, 0x00, 0x80, 0x58, 0x77, 0x88, 0x88, 0x58, 0x77, 0x88, 0x88, 0x58, 0x77, 0x88, 0x88, 0x58, 0x77, 0x77, 0x77, 0x57,
+    0x44, 0x14, 0x55, 0x00, 0x44, 0x00, 0x50, 0x00, 0x55, 0x00, 0x70, 0x77, 0x87, 0x00, 0x80, 0x78, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88,
+    0x77, 0x88, 0x88, 0x88, 0x76, 0x88, 0x78, 0x77, 0x00, 0x22, 0x43, 0x44, 0x00, 0x00, 0x60, 0x56, 0x00, 0x00, 0x70, 0x67, 0x66, 0x00, 0x80, 0x78,
+    0x77, 0x87, 0x88, 0x78, 0x77, 0x87, 0x88, 0x78, 0x77, 0x87, 0x87, 0x77, 0x77, 0x87, 0x88, 0x77, 0x00, 0x20, 0x43, 0x44, 0x00, 0x00, 0x60, 0x56,
+    0x00, 0x00, 0x60, 0x66, 0x74, 0x00, 0x80, 0x78, 0x75, 0x87, 0x88, 0x78, 0x75, 0x87, 0x88, 0x78, 0x75, 0x87, 0x88, 0x77, 0x75, 0x77, 0x77, 0x67,
+    0x40, 0x21, 0x43, 0x44, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x70, 0x67, 0x66, 0x00, 0x80, 0x78, 0x66, 0x88, 0x88, 0x78, 0x77, 0x88, 0x88, 0x78,
+    0x67, 0x88, 0x88, 0x77, 0x77, 0x88, 0x78, 0x77, 0x33, 0x13, 0x43, 0x44, 0x55, 0x00, 0x50, 0x55, 0x45, 0x00, 0x60, 0x66, 0x77, 0x00, 0x80, 0x68,
+    0x77, 0x88, 0x88, 0x78, 0x77, 0x88, 0x88, 0x78, 0x77, 0x88, 0x78, 0x77, 0x77, 0x88, 0x78, 0x77, 0x33, 0x23, 0x41, 0x44, 0x55, 0x00, 0x50, 0x55,
+    0x55, 0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x77, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67,
+    0x33, 0x23, 0x00, 0x00, 0x44, 0x00, 0x00, 0x50, 0x44, 0x00, 0x00, 0x60, 0x77, 0x00, 0x80, 0x77, 0x77, 0x87, 0x87, 0x76, 0x77, 0x87, 0x88, 0x77,
+    0x77, 0x87, 0x87, 0x76, 0x77, 0x87, 0x88, 0x77, 0x33, 0x23, 0x02, 0x00, 0x44, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x87, 0x00, 0x80, 0x58,
+    0x87, 0x88, 0x88, 0x58, 0x87, 0x88, 0x88, 0x58, 0x77, 0x88, 0x88, 0x58, 0x76, 0x88, 0x78, 0x57, 0x33, 0x23, 0x23, 0x00, 0x44, 0x00, 0x50, 0x00,
+    0x55, 0x00, 0x60, 0x00, 0x75, 0x00, 0x70, 0x77, 0x77, 0x78, 0x78, 0x77, 0x77, 0x88, 0x78, 0x77, 0x77, 0x78, 0x78, 0x77, 0x77, 0x88, 0x78, 0x77,
+    0x04, 0x34, 0x66, 0x56, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x70, 0x67, 0x00, 0x00, 0x70, 0x77, 0x76, 0x77, 0x77, 0x77, 0x77, 0x88, 0x78, 0x77,
+    0x77, 0x78, 0x78, 0x77, 0x77, 0x88, 0x78, 0x67, 0x40, 0x30, 0x66, 0x56, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x70, 0x67, 0x00, 0x00, 0x80, 0x78,
+    0x75, 0x87, 0x88, 0x78, 0x75, 0x87, 0x88, 0x78, 0x75, 0x87, 0x87, 0x77, 0x75, 0x87, 0x88, 0x77, 0x44, 0x04, 0x66, 0x56, 0x44, 0x00, 0x60, 0x66,
+    0x55, 0x00, 0x60, 0x66, 0x66, 0x00, 0x80, 0x78, 0x66, 0x87, 0x88, 0x78, 0x77, 0x87, 0x88, 0x78, 0x67, 0x87, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x45, 0x55, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55, 0x66, 0x00, 0x70, 0x67,
+    0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x44, 0x34, 0x50, 0x55, 0x44, 0x00, 0x00, 0x50,
+    0x55, 0x00, 0x00, 0x60, 0x77, 0x00, 0x00, 0x70, 0x77, 0x87, 0x87, 0x76, 0x77, 0x87, 0x88, 0x77, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x77,
+    0x44, 0x34, 0x03, 0x05, 0x44, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x77, 0x78, 0x78, 0x57, 0x77, 0x88, 0x78, 0x57,
+    0x77, 0x78, 0x78, 0x57, 0x77, 0x88, 0x78, 0x57, 0x55, 0x45, 0x54, 0x54, 0x55, 0x00, 0x50, 0x00, 0x55, 0x00, 0x60, 0x00, 0x66, 0x00, 0x80, 0x00,
+    0x76, 0x87, 0x87, 0x77, 0x76, 0x87, 0x88, 0x77, 0x76, 0x87, 0x87, 0x77, 0x76, 0x87, 0x88, 0x77, 0x44, 0x34, 0x55, 0x55, 0x34, 0x00, 0x50, 0x66,
+    0x00, 0x00, 0x50, 0x56, 0x00, 0x00, 0x70, 0x77, 0x00, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77,
+    0x33, 0x32, 0x55, 0x55, 0x33, 0x00, 0x50, 0x66, 0x00, 0x00, 0x50, 0x56, 0x00, 0x00, 0x70, 0x77, 0x00, 0x70, 0x77, 0x77, 0x75, 0x77, 0x77, 0x77,
+    0x75, 0x77, 0x77, 0x77, 0x75, 0x77, 0x77, 0x67, 0x44, 0x34, 0x55, 0x55, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x80, 0x78,
+    0x66, 0x87, 0x88, 0x78, 0x77, 0x87, 0x88, 0x78, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x44, 0x24, 0x55, 0x55, 0x44, 0x00, 0x50, 0x55,
+    0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x70, 0x77, 0x65, 0x76, 0x77, 0x77, 0x66, 0x76, 0x77, 0x77, 0x66, 0x76, 0x77, 0x77, 0x66, 0x76, 0x77, 0x67,
+    0x44, 0x34, 0x55, 0x55, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55, 0x66, 0x00, 0x70, 0x77, 0x66, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77,
+    0x76, 0x77, 0x77, 0x67, 0x76, 0x77, 0x77, 0x67, 0x44, 0x34, 0x52, 0x55, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x00, 0x50, 0x75, 0x00, 0x00, 0x60,
+    0x77, 0x77, 0x00, 0x60, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x77, 0x44, 0x34, 0x44, 0x44, 0x55, 0x00, 0x30, 0x44,
+    0x45, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x76, 0x87, 0x07, 0x00, 0x76, 0x87, 0x88, 0x57, 0x76, 0x77, 0x77, 0x57, 0x76, 0x77, 0x77, 0x57,
+    0x44, 0x34, 0x53, 0x54, 0x55, 0x00, 0x50, 0x55, 0x45, 0x00, 0x40, 0x00, 0x77, 0x00, 0x70, 0x00, 0x77, 0x77, 0x77, 0x00, 0x77, 0x77, 0x77, 0x67,
+    0x76, 0x77, 0x77, 0x67, 0x76, 0x77, 0x77, 0x67, 0x44, 0x24, 0x66, 0x56, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x00, 0x00, 0x60, 0x66,
+    0x00, 0x77, 0x77, 0x77, 0x00, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x66, 0x77, 0x77, 0x77, 0x33, 0x32, 0x66, 0x56, 0x33, 0x00, 0x60, 0x66,
+    0x33, 0x00, 0x60, 0x66, 0x00, 0x00, 0x60, 0x66, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x75, 0x77, 0x77, 0x77, 0x75, 0x77, 0x77, 0x77,
+    0x44, 0x24, 0x55, 0x55, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x04, 0x00, 0x60, 0x66, 0x05, 0x00, 0x77, 0x77, 0x06, 0x00, 0x77, 0x77,
+    0x66, 0x77, 0x77, 0x77, 0x66, 0x77, 0x77, 0x67, 0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66,
+    0x66, 0x00, 0x70, 0x77, 0x66, 0x00, 0x70, 0x77, 0x66, 0x76, 0x77, 0x77, 0x66, 0x76, 0x77, 0x77, 0x34, 0x24, 0x66, 0x56, 0x44, 0x00, 0x50, 0x56,
+    0x55, 0x00, 0x60, 0x56, 0x45, 0x00, 0x00, 0x55, 0x76, 0x07, 0x00, 0x66, 0x77, 0x07, 0x00, 0x66, 0x77, 0x77, 0x66, 0x66, 0x77, 0x67, 0x66, 0x66,
+    0x44, 0x34, 0x52, 0x55, 0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x50, 0x55, 0x45, 0x00, 0x00, 0x50, 0x76, 0x77, 0x00, 0x60, 0x76, 0x77, 0x00, 0x60,
+    0x76, 0x77, 0x77, 0x66, 0x76, 0x77, 0x77, 0x66, 0x44, 0x24, 0x44, 0x44, 0x44, 0x00, 0x50, 0x45, 0x55, 0x00, 0x40, 0x45, 0x45, 0x00, 0x00, 0x00,
+    0x77, 0x77, 0x07, 0x00, 0x76, 0x77, 0x07, 0x00, 0x77, 0x77, 0x77, 0x57, 0x76, 0x77, 0x77, 0x57, 0x44, 0x34, 0x54, 0x55, 0x44, 0x00, 0x50, 0x55,
+    0x55, 0x00, 0x60, 0x56, 0x45, 0x00, 0x50, 0x00, 0x77, 0x77, 0x77, 0x00, 0x77, 0x77, 0x77, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x60, 0x66, 0x64, 0x00, 0x80, 0x67, 0x00, 0x87, 0x87, 0x67, 0x00, 0x87, 0x88, 0x77,
+    0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x33, 0x32, 0x55, 0x55, 0x33, 0x00, 0x60, 0x56, 0x33, 0x00, 0x60, 0x66, 0x33, 0x00, 0x80, 0x67,
+    0x00, 0x80, 0x87, 0x67, 0x00, 0x80, 0x88, 0x67, 0x00, 0x60, 0x67, 0x67, 0x60, 0x77, 0x77, 0x67, 0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x50, 0x56,
+    0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x70, 0x67, 0x04, 0x00, 0x77, 0x67, 0x06, 0x00, 0x77, 0x67, 0x06, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x66, 0x00, 0x60, 0x66,
+    0x66, 0x00, 0x60, 0x66, 0x66, 0x66, 0x66, 0x66, 0x44, 0x34, 0x55, 0x55, 0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x56,
+    0x55, 0x05, 0x00, 0x56, 0x66, 0x06, 0x00, 0x66, 0x66, 0x06, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x44, 0x34, 0x52, 0x55, 0x44, 0x00, 0x50, 0x55,
+    0x44, 0x00, 0x50, 0x55, 0x65, 0x00, 0x50, 0x55, 0x65, 0x66, 0x00, 0x50, 0x66, 0x66, 0x00, 0x60, 0x66, 0x66, 0x00, 0x60, 0x66, 0x66, 0x66, 0x66,
+    0x44, 0x34, 0x44, 0x44, 0x44, 0x00, 0x50, 0x45, 0x44, 0x00, 0x60, 0x46, 0x65, 0x00, 0x70, 0x46, 0x65, 0x77, 0x07, 0x00, 0x76, 0x77, 0x07, 0x00,
+    0x76, 0x76, 0x06, 0x00, 0x76, 0x77, 0x77, 0x06, 0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x50, 0x56, 0x44, 0x00, 0x60, 0x66, 0x65, 0x00, 0x80, 0x67,
+    0x65, 0x87, 0x87, 0x00, 0x77, 0x87, 0x88, 0x00, 0x77, 0x77, 0x77, 0x00, 0x77, 0x77, 0x77, 0x77, 0x44, 0x24, 0x55, 0x55, 0x44, 0x00, 0x60, 0x66,
+    0x44, 0x00, 0x70, 0x67, 0x66, 0x00, 0x70, 0x77, 0x76, 0x88, 0x88, 0x77, 0x00, 0x88, 0x88, 0x77, 0x00, 0x88, 0x88, 0x77, 0x00, 0x55, 0x55, 0x55,
+    0x33, 0x32, 0x66, 0x56, 0x33, 0x00, 0x60, 0x66, 0x33, 0x00, 0x70, 0x67, 0x63, 0x00, 0x70, 0x77, 0x63, 0x88, 0x88, 0x77, 0x00, 0x80, 0x88, 0x77,
+    0x00, 0x80, 0x88, 0x77, 0x00, 0x50, 0x55, 0x55, 0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x70, 0x77,
+    0x55, 0x76, 0x77, 0x77, 0x05, 0x00, 0x77, 0x77, 0x06, 0x00, 0x77, 0x77, 0x00, 0x00, 0x55, 0x55, 0x44, 0x34, 0x55, 0x55, 0x44, 0x00, 0x60, 0x56,
+    0x55, 0x00, 0x70, 0x57, 0x55, 0x00, 0x60, 0x67, 0x55, 0x65, 0x77, 0x67, 0x54, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x50, 0x55,
+    0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66, 0x66, 0x56, 0x66, 0x66, 0x56, 0x06, 0x00, 0x56,
+    0x66, 0x06, 0x00, 0x55, 0x55, 0x05, 0x00, 0x55, 0x44, 0x34, 0x52, 0x55, 0x44, 0x00, 0x50, 0x55, 0x55, 0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x65,
+    0x76, 0x77, 0x77, 0x66, 0x76, 0x77, 0x00, 0x50, 0x76, 0x77, 0x00, 0x60, 0x55, 0x55, 0x00, 0x00, 0x44, 0x24, 0x44, 0x44, 0x44, 0x00, 0x50, 0x45,
+    0x55, 0x00, 0x60, 0x46, 0x66, 0x00, 0x70, 0x47, 0x76, 0x87, 0x88, 0x47, 0x76, 0x87, 0x07, 0x00, 0x76, 0x87, 0x08, 0x00, 0x55, 0x55, 0x05, 0x00,
+    0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x50, 0x56, 0x55, 0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x77, 0x76, 0x88, 0x88, 0x77, 0x76, 0x88, 0x88, 0x00,
+    0x76, 0x88, 0x88, 0x00, 0x55, 0x55, 0x55, 0x00, 0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67, 0x66, 0x00, 0x70, 0x77,
+    0x66, 0x88, 0x78, 0x77, 0x76, 0x88, 0x78, 0x77, 0x00, 0x88, 0x78, 0x77, 0x00, 0x88, 0x78, 0x77, 0x33, 0x32, 0x66, 0x56, 0x33, 0x00, 0x60, 0x56,
+    0x33, 0x00, 0x60, 0x66, 0x64, 0x00, 0x70, 0x77, 0x73, 0x77, 0x77, 0x77, 0x74, 0x77, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77, 0x00, 0x70, 0x77, 0x77,
+    0x44, 0x34, 0x55, 0x55, 0x44, 0x00, 0x60, 0x56, 0x55, 0x00, 0x70, 0x57, 0x66, 0x00, 0x70, 0x77, 0x66, 0x77, 0x77, 0x77, 0x66, 0x77, 0x77, 0x77,
+    0x06, 0x00, 0x77, 0x77, 0x05, 0x00, 0x77, 0x77, 0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x65, 0x00, 0x70, 0x67,
+    0x65, 0x75, 0x77, 0x67, 0x66, 0x76, 0x77, 0x67, 0x56, 0x00, 0x60, 0x67, 0x66, 0x00, 0x70, 0x67, 0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x60, 0x56,
+    0x55, 0x00, 0x60, 0x66, 0x65, 0x00, 0x60, 0x66, 0x66, 0x66, 0x66, 0x66, 0x76, 0x77, 0x66, 0x66, 0x76, 0x06, 0x00, 0x66, 0x76, 0x07, 0x00, 0x66,
+    0x44, 0x34, 0x52, 0x55, 0x44, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x66, 0x76, 0x77, 0x77, 0x66, 0x76, 0x77, 0x77, 0x66,
+    0x76, 0x77, 0x00, 0x60, 0x76, 0x77, 0x00, 0x60, 0x44, 0x34, 0x44, 0x44, 0x44, 0x00, 0x50, 0x45, 0x55, 0x00, 0x70, 0x47, 0x66, 0x00, 0x70, 0x47,
+    0x76, 0x77, 0x77, 0x47, 0x76, 0x77, 0x77, 0x47, 0x76, 0x77, 0x07, 0x00, 0x76, 0x77, 0x07, 0x00, 0x44, 0x34, 0x66, 0x56, 0x44, 0x00, 0x60, 0x66,
+    0x55, 0x00, 0x60, 0x66, 0x77, 0x00, 0x70, 0x67, 0x77, 0x77, 0x77, 0x67, 0x77, 0x77, 0x77, 0x67, 0x77, 0x77, 0x77, 0x00, 0x76, 0x77, 0x77, 0x00,
+    0x00, 0x64, 0x66, 0x56, 0x00, 0x64, 0x77, 0x67, 0x44, 0x00, 0x70, 0x67, 0x66, 0x00, 0x70, 0x67, 0x76, 0x00, 0x70, 0x67, 0x76, 0x77, 0x77, 0x67,
+    0x76, 0x77, 0x77, 0x67, 0x65, 0x66, 0x66, 0x66, 0x00, 0x50, 0x66, 0x56, 0x00, 0x50, 0x66, 0x56, 0x33, 0x00, 0x60, 0x66, 0x33, 0x00, 0x60, 0x66,
+    0x74, 0x00, 0x70, 0x67, 0x74, 0x77, 0x77, 0x67, 0x74, 0x77, 0x77, 0x57, 0x54, 0x66, 0x66, 0x56, 0x05, 0x00, 0x66, 0x56, 0x04, 0x00, 0x66, 0x66,
+    0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67, 0x66, 0x00, 0x70, 0x67, 0x66, 0x77, 0x77, 0x67, 0x66, 0x77, 0x77, 0x67, 0x66, 0x66, 0x66, 0x66,
+    0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55, 0x44, 0x00, 0x60, 0x56, 0x66, 0x00, 0x70, 0x67, 0x66, 0x00, 0x70, 0x67, 0x66, 0x77, 0x77, 0x67,
+    0x66, 0x77, 0x77, 0x67, 0x66, 0x66, 0x66, 0x66, 0x55, 0x05, 0x00, 0x55, 0x55, 0x05, 0x00, 0x56, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67,
+    0x66, 0x00, 0x70, 0x67, 0x66, 0x66, 0x77, 0x67, 0x66, 0x66, 0x77, 0x67, 0x65, 0x66, 0x66, 0x66, 0x55, 0x55, 0x00, 0x50, 0x55, 0x55, 0x00, 0x60,
+    0x55, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x66, 0x00, 0x70, 0x66, 0x66, 0x76, 0x76, 0x66, 0x66, 0x76, 0x77, 0x66, 0x55, 0x66, 0x66, 0x66,
+    0x55, 0x55, 0x04, 0x00, 0x55, 0x55, 0x06, 0x00, 0x55, 0x00, 0x70, 0x47, 0x55, 0x00, 0x80, 0x48, 0x76, 0x00, 0x70, 0x48, 0x76, 0x77, 0x88, 0x48,
+    0x76, 0x77, 0x77, 0x47, 0x65, 0x66, 0x66, 0x46, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x00, 0x55, 0x00, 0x60, 0x66, 0x44, 0x00, 0x70, 0x67,
+    0x66, 0x00, 0x70, 0x67, 0x66, 0x76, 0x77, 0x67, 0x66, 0x76, 0x77, 0x67, 0x65, 0x66, 0x66, 0x66, 0x00, 0x33, 0x44, 0x44, 0x00, 0x33, 0x77, 0x57,
+    0x00, 0x00, 0x70, 0x67, 0x55, 0x00, 0x70, 0x67, 0x66, 0x00, 0x70, 0x67, 0x66, 0x66, 0x77, 0x67, 0x66, 0x66, 0x77, 0x67, 0x55, 0x66, 0x66, 0x55,
+    0x00, 0x30, 0x44, 0x44, 0x00, 0x30, 0x77, 0x67, 0x00, 0x00, 0x70, 0x67, 0x33, 0x00, 0x70, 0x67, 0x74, 0x00, 0x70, 0x67, 0x74, 0x77, 0x77, 0x67,
+    0x74, 0x77, 0x77, 0x67, 0x64, 0x66, 0x66, 0x66, 0x00, 0x00, 0x44, 0x44, 0x04, 0x00, 0x66, 0x56, 0x04, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66,
+    0x66, 0x00, 0x70, 0x67, 0x56, 0x77, 0x77, 0x57, 0x66, 0x77, 0x77, 0x57, 0x55, 0x65, 0x66, 0x56, 0x33, 0x00, 0x40, 0x44, 0x44, 0x00, 0x60, 0x56,
+    0x44, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67, 0x66, 0x00, 0x70, 0x67, 0x66, 0x77, 0x77, 0x67, 0x66, 0x77, 0x77, 0x67, 0x66, 0x66, 0x66, 0x66,
+    0x33, 0x03, 0x00, 0x44, 0x55, 0x05, 0x00, 0x55, 0x45, 0x00, 0x00, 0x56, 0x55, 0x00, 0x70, 0x77, 0x66, 0x00, 0x70, 0x77, 0x66, 0x66, 0x77, 0x77,
+    0x66, 0x66, 0x77, 0x67, 0x65, 0x66, 0x77, 0x67, 0x33, 0x33, 0x00, 0x00, 0x55, 0x35, 0x00, 0x50, 0x45, 0x00, 0x00, 0x50, 0x55, 0x00, 0x60, 0x66,
+    0x66, 0x00, 0x70, 0x66, 0x66, 0x76, 0x76, 0x66, 0x66, 0x76, 0x77, 0x66, 0x55, 0x66, 0x66, 0x66, 0x33, 0x33, 0x03, 0x00, 0x55, 0x35, 0x03, 0x00,
+    0x45, 0x00, 0x00, 0x00, 0x55, 0x00, 0x70, 0x47, 0x66, 0x00, 0x70, 0x47, 0x66, 0x76, 0x77, 0x47, 0x66, 0x76, 0x77, 0x47, 0x65, 0x66, 0x66, 0x45,
+    0x33, 0x33, 0x33, 0x00, 0x55, 0x35, 0x66, 0x00, 0x45, 0x00, 0x60, 0x00, 0x55, 0x00, 0x70, 0x67, 0x76, 0x00, 0x70, 0x67, 0x76, 0x76, 0x77, 0x67,
+    0x76, 0x77, 0x77, 0x67, 0x55, 0x66, 0x66, 0x66, 0x45, 0x55, 0x66, 0x66, 0x00, 0x55, 0x66, 0x66, 0x00, 0x00, 0x70, 0x67, 0x00, 0x00, 0x70, 0x67,
+    0x66, 0x00, 0x70, 0x67, 0x66, 0x76, 0x77, 0x67, 0x66, 0x76, 0x77, 0x67, 0x65, 0x66, 0x66, 0x66, 0x40, 0x54, 0x66, 0x56, 0x00, 0x50, 0x56, 0x56,
+    0x00, 0x00, 0x70, 0x57, 0x00, 0x00, 0x70, 0x67, 0x64, 0x00, 0x70, 0x67, 0x64, 0x66, 0x77, 0x67, 0x64, 0x66, 0x77, 0x67, 0x54, 0x66, 0x56, 0x55,
+    0x44, 0x54, 0x66, 0x56, 0x44, 0x54, 0x56, 0x56, 0x44, 0x00, 0x70, 0x57, 0x55, 0x00, 0x70, 0x67, 0x66, 0x00, 0x70, 0x67, 0x56, 0x77, 0x77, 0x67,
+    0x66, 0x77, 0x77, 0x67, 0x55, 0x65, 0x66, 0x66, 0x55, 0x55, 0x66, 0x56, 0x45, 0x55, 0x56, 0x56, 0x55, 0x00, 0x60, 0x56, 0x44, 0x00, 0x60, 0x66,
+    0x66, 0x00, 0x70, 0x67, 0x66, 0x77, 0x77, 0x67, 0x66, 0x77, 0x77, 0x67, 0x55, 0x66, 0x66, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x00, 0x50, 0x55, 0x55, 0x00, 0x70, 0x57, 0x66, 0x00, 0x70, 0x67, 0x66, 0x66, 0x77, 0x67, 0x66, 0x66, 0x77, 0x67, 0x65, 0x66, 0x66, 0x66,
+    0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x00, 0x50, 0x55, 0x00, 0x00, 0x50, 0x44, 0x00, 0x00, 0x60, 0x66, 0x00, 0x70, 0x66, 0x56, 0x76, 0x76, 0x66,
+    0x66, 0x76, 0x77, 0x66, 0x55, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x05, 0x55, 0x55, 0x04, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+    0x76, 0x00, 0x70, 0x47, 0x76, 0x76, 0x77, 0x47, 0x76, 0x77, 0x77, 0x47, 0x55, 0x65, 0x66, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00,
+    0x55, 0x00, 0x60, 0x00, 0x55, 0x00, 0x60, 0x00, 0x65, 0x00, 0x70, 0x67, 0x65, 0x67, 0x67, 0x67, 0x65, 0x77, 0x77, 0x67, 0x55, 0x55, 0x66, 0x66,
+    0x44, 0x64, 0x66, 0x66, 0x44, 0x64, 0x66, 0x66, 0x00, 0x00, 0x70, 0x67, 0x00, 0x00, 0x70, 0x67, 0x00, 0x00, 0x70, 0x67, 0x55, 0x76, 0x77, 0x67,
+    0x55, 0x76, 0x77, 0x67, 0x55, 0x65, 0x66, 0x66, 0x43, 0x54, 0x66, 0x66, 0x43, 0x54, 0x66, 0x66, 0x00, 0x00, 0x70, 0x67, 0x00, 0x00, 0x70, 0x67,
+    0x00, 0x00, 0x70, 0x67, 0x64, 0x76, 0x77, 0x67, 0x64, 0x76, 0x77, 0x67, 0x54, 0x66, 0x66, 0x66, 0x55, 0x45, 0x66, 0x56, 0x45, 0x45, 0x66, 0x56,
+    0x55, 0x00, 0x70, 0x67, 0x55, 0x00, 0x70, 0x67, 0x66, 0x00, 0x70, 0x67, 0x56, 0x66, 0x77, 0x67, 0x66, 0x66, 0x77, 0x67, 0x55, 0x65, 0x66, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x45, 0x55, 0x55, 0x45, 0x45, 0x55, 0x55, 0x55, 0x00, 0x50, 0x55, 0x44, 0x00, 0x50, 0x55,
+    0x66, 0x00, 0x70, 0x57, 0x66, 0x66, 0x67, 0x57, 0x66, 0x66, 0x77, 0x57, 0x65, 0x66, 0x66, 0x56, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x54, 0x55,
+    0x55, 0x00, 0x00, 0x50, 0x55, 0x00, 0x00, 0x50, 0x66, 0x00, 0x00, 0x60, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x66, 0x66, 0x66,
+    0x65, 0x66, 0x44, 0x44, 0x65, 0x65, 0x44, 0x44, 0x65, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x65, 0x67, 0x67, 0x46,
+    0x65, 0x77, 0x67, 0x46, 0x55, 0x65, 0x66, 0x45, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x50, 0x00, 0x55, 0x00, 0x60, 0x00,
+    0x66, 0x00, 0x70, 0x00, 0x66, 0x76, 0x76, 0x66, 0x66, 0x76, 0x77, 0x66, 0x65, 0x66, 0x66, 0x66, 0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x66, 0x66,
+    0x55, 0x00, 0x60, 0x66, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x70, 0x67, 0x00, 0x76, 0x77, 0x67, 0x65, 0x76, 0x77, 0x67, 0x55, 0x66, 0x66, 0x66,
+    0x53, 0x55, 0x66, 0x56, 0x53, 0x54, 0x66, 0x66, 0x53, 0x00, 0x60, 0x66, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x70, 0x77, 0x00, 0x70, 0x77, 0x77,
+    0x54, 0x76, 0x77, 0x77, 0x54, 0x75, 0x77, 0x66, 0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x66, 0x66, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66,
+    0x55, 0x00, 0x70, 0x67, 0x55, 0x75, 0x77, 0x67, 0x55, 0x75, 0x77, 0x67, 0x55, 0x55, 0x66, 0x66, 0x55, 0x45, 0x66, 0x56, 0x45, 0x45, 0x66, 0x66,
+    0x55, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67, 0x55, 0x55, 0x67, 0x67, 0x55, 0x55, 0x77, 0x67, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x66, 0x56, 0x55, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x56, 0x66, 0x00, 0x60, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x54, 0x55, 0x55, 0x00, 0x50, 0x55, 0x44, 0x00, 0x00, 0x50,
+    0x65, 0x00, 0x00, 0x50, 0x65, 0x66, 0x00, 0x50, 0x65, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x45,
+    0x55, 0x00, 0x50, 0x45, 0x55, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x66, 0x66, 0x06, 0x00, 0x66, 0x66, 0x66, 0x45, 0x65, 0x66, 0x56, 0x45,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x60, 0x56, 0x55, 0x00, 0x50, 0x00, 0x66, 0x00, 0x60, 0x00, 0x66, 0x66, 0x66, 0x00,
+    0x66, 0x66, 0x66, 0x56, 0x55, 0x66, 0x66, 0x55, 0x55, 0x45, 0x66, 0x56, 0x55, 0x45, 0x66, 0x56, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67,
+    0x00, 0x00, 0x60, 0x67, 0x00, 0x66, 0x77, 0x67, 0x00, 0x66, 0x66, 0x66, 0x65, 0x66, 0x66, 0x66, 0x53, 0x55, 0x66, 0x56, 0x53, 0x54, 0x66, 0x56,
+    0x53, 0x00, 0x60, 0x66, 0x33, 0x00, 0x70, 0x67, 0x00, 0x00, 0x60, 0x67, 0x00, 0x60, 0x77, 0x67, 0x00, 0x60, 0x66, 0x66, 0x50, 0x65, 0x66, 0x66,
+    0x55, 0x45, 0x66, 0x56, 0x55, 0x45, 0x56, 0x56, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67, 0x04, 0x00, 0x60, 0x67, 0x05, 0x00, 0x77, 0x67,
+    0x05, 0x00, 0x66, 0x66, 0x55, 0x65, 0x66, 0x66, 0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x66, 0x56, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66,
+    0x44, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66, 0x55, 0x55, 0x66, 0x66, 0x55, 0x45, 0x55, 0x55, 0x45, 0x45, 0x66, 0x56,
+    0x55, 0x00, 0x60, 0x56, 0x55, 0x00, 0x60, 0x56, 0x45, 0x00, 0x00, 0x56, 0x55, 0x05, 0x00, 0x55, 0x55, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x00, 0x50, 0x55, 0x55, 0x00, 0x50, 0x55, 0x45, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x50,
+    0x55, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x45, 0x45, 0x45, 0x66, 0x46, 0x55, 0x00, 0x60, 0x46, 0x55, 0x00, 0x60, 0x46,
+    0x45, 0x00, 0x00, 0x00, 0x55, 0x66, 0x06, 0x00, 0x55, 0x56, 0x06, 0x00, 0x55, 0x66, 0x56, 0x05, 0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x66, 0x56,
+    0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67, 0x45, 0x00, 0x60, 0x00, 0x65, 0x66, 0x77, 0x00, 0x65, 0x66, 0x66, 0x00, 0x65, 0x66, 0x66, 0x56,
+    0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x77, 0x67, 0x55, 0x00, 0x70, 0x67, 0x55, 0x00, 0x70, 0x67, 0x64, 0x00, 0x80, 0x67, 0x00, 0x87, 0x87, 0x67,
+    0x00, 0x87, 0x88, 0x67, 0x00, 0x44, 0x44, 0x44, 0x53, 0x55, 0x66, 0x56, 0x53, 0x54, 0x66, 0x66, 0x53, 0x00, 0x60, 0x66, 0x33, 0x00, 0x70, 0x67,
+    0x33, 0x00, 0x70, 0x67, 0x00, 0x70, 0x77, 0x67, 0x00, 0x70, 0x77, 0x57, 0x00, 0x40, 0x44, 0x44, 0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x77, 0x57,
+    0x55, 0x00, 0x60, 0x57, 0x55, 0x00, 0x70, 0x67, 0x44, 0x00, 0x70, 0x67, 0x04, 0x00, 0x77, 0x67, 0x05, 0x00, 0x77, 0x57, 0x00, 0x00, 0x44, 0x44,
+    0x55, 0x55, 0x55, 0x55, 0x66, 0x56, 0x66, 0x56, 0x56, 0x00, 0x70, 0x57, 0x66, 0x00, 0x60, 0x67, 0x44, 0x00, 0x70, 0x67, 0x44, 0x00, 0x60, 0x66,
+    0x44, 0x00, 0x60, 0x56, 0x44, 0x00, 0x40, 0x44, 0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x66, 0x66, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66,
+    0x55, 0x00, 0x60, 0x66, 0x55, 0x05, 0x00, 0x56, 0x55, 0x05, 0x00, 0x55, 0x44, 0x04, 0x00, 0x44, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x54, 0x55,
+    0x55, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x65, 0x65, 0x00, 0x60, 0x66, 0x65, 0x66, 0x00, 0x50, 0x65, 0x66, 0x00, 0x50, 0x44, 0x44, 0x00, 0x00,
+    0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x66, 0x46, 0x55, 0x00, 0x60, 0x46, 0x55, 0x00, 0x70, 0x47, 0x65, 0x00, 0x70, 0x47, 0x65, 0x76, 0x07, 0x00,
+    0x65, 0x76, 0x07, 0x00, 0x44, 0x44, 0x04, 0x00, 0x55, 0x55, 0x66, 0x56, 0x45, 0x55, 0x66, 0x56, 0x55, 0x00, 0x60, 0x66, 0x44, 0x00, 0x60, 0x66,
+    0x65, 0x00, 0x70, 0x67, 0x65, 0x77, 0x77, 0x00, 0x65, 0x77, 0x77, 0x00, 0x44, 0x44, 0x44, 0x00, 0x55, 0x45, 0x66, 0x56, 0x55, 0x45, 0x66, 0x66,
+    0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67, 0x55, 0x00, 0x70, 0x67, 0x55, 0x76, 0x77, 0x67, 0x00, 0x76, 0x77, 0x67, 0x00, 0x66, 0x66, 0x66,
+    0x53, 0x55, 0x66, 0x56, 0x53, 0x54, 0x77, 0x57, 0x53, 0x00, 0x60, 0x67, 0x33, 0x00, 0x70, 0x67, 0x63, 0x00, 0x70, 0x67, 0x63, 0x76, 0x77, 0x67,
+    0x00, 0x70, 0x77, 0x67, 0x00, 0x60, 0x66, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x56, 0x55, 0x00, 0x70, 0x57, 0x55, 0x00, 0x60, 0x57,
+    0x55, 0x00, 0x70, 0x67, 0x55, 0x66, 0x67, 0x67, 0x05, 0x00, 0x77, 0x67, 0x05, 0x00, 0x66, 0x66, 0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x66, 0x66,
+    0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67, 0x55, 0x00, 0x60, 0x67, 0x55, 0x65, 0x77, 0x67, 0x54, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66,
+    0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x66, 0x56, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66, 0x55, 0x56, 0x66, 0x66,
+    0x55, 0x06, 0x00, 0x56, 0x55, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x64, 0x66, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x60, 0x66,
+    0x66, 0x00, 0x70, 0x66, 0x66, 0x76, 0x76, 0x66, 0x66, 0x76, 0x00, 0x60, 0x55, 0x66, 0x00, 0x50, 0x55, 0x45, 0x55, 0x45, 0x45, 0x45, 0x66, 0x46,
+    0x55, 0x00, 0x70, 0x47, 0x55, 0x00, 0x70, 0x47, 0x66, 0x00, 0x70, 0x47, 0x66, 0x66, 0x77, 0x47, 0x66, 0x66, 0x07, 0x00, 0x55, 0x66, 0x06, 0x00,
+    0x55, 0x55, 0x66, 0x56, 0x55, 0x55, 0x66, 0x66, 0x55, 0x00, 0x60, 0x66, 0x55, 0x00, 0x70, 0x67, 0x66, 0x00, 0x70, 0x67, 0x66, 0x76, 0x77, 0x67,
+    0x66, 0x76, 0x77, 0x00, 0x65, 0x66, 0x66, 0x00, 0x00, 0x00,
+};
+
+const Bitbase_Table_Structure bitbase_tables[3] = { { kpk_data, 5, 24 * 4096 }, { krk_data, 5, 10 * 4096 }, { kqk_data, 4, 10 * 4096 } };
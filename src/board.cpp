@@ -0,0 +1,271 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                 BOARD BACKENDS                                  ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <string.h>
+
+#include "board.h"
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                      0x88                                       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+int board_load(Board_0x88_Structure *board, const char *fen)
+{
+    Position_Structure position;
+
+    if (!load_fen(&position, fen)) return 0;
+    set_position(&board->engine, &position); board->ply = 0;
+
+    return 1;
+}
+
+int board_generate(Board_0x88_Structure *board, Move *moves) { return generate_legal_moves(&board->engine, moves); }
+
+void board_make(Board_0x88_Structure *board, Move move)
+{
+    board->en_passant[board->ply++] = board->engine.position.en_passant;
+    play_move(&board->engine, move);
+}
+
+void board_unmake(Board_0x88_Structure *board, Move move)
+{
+    Position_Structure *position = &board->engine.position;
+
+    position->side = 24 - position->side; position->en_passant = board->en_passant[--board->ply];
+    unmake_move(&board->engine, position->side, move);
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    BITBOARD                                     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+// rays N, E, NE, NW towards higher squares, S, W, SW, SE towards lower ones
+static const int ray_files[8] = { 0, 1, 1, -1, 0, -1, -1, 1 }, ray_ranks[8] = { 1, 0, 1, 1, -1, 0, -1, -1 };
+
+typedef struct { Bitboard knight[64], king[64], pawn[2][64], rays[8][64]; unsigned char castling[64]; } Bitboard_Tables_Structure;
+
+static constexpr Bitboard square_set(int file, int rank) { return (file < 0 || file > 7 || rank < 0 || rank > 7) ? 0 : 1ULL << (rank * 8 + file); }
+
+static constexpr Bitboard_Tables_Structure generate_bitboard_tables()  // attack sets and the castling rights each square keeps, at compile time
+{
+    Bitboard_Tables_Structure tables = {};
+    const int knight_files[8] = { 1, 2, 2, 1, -1, -2, -2, -1 }, knight_ranks[8] = { 2, 1, -1, -2, -2, -1, 1, 2 };
+
+    for(int square = 0; square < 64; square++) {
+        int file = square & 7, rank = square >> 3;
+
+        for(int i = 0; i < 8; i++) {
+            tables.knight[square] |= square_set(file + knight_files[i], rank + knight_ranks[i]);
+            tables.king[square] |= square_set(file + ray_files[i], rank + ray_ranks[i]);
+
+            for(int distance = 1; distance < 8; distance++) tables.rays[i][square] |= square_set(file + ray_files[i] * distance, rank + ray_ranks[i] * distance);
+        }
+
+        tables.pawn[0][square] = square_set(file - 1, rank + 1) | square_set(file + 1, rank + 1);  // white pawns capture up the board
+        tables.pawn[1][square] = square_set(file - 1, rank - 1) | square_set(file + 1, rank - 1);
+        tables.castling[square] = 15;
+    }
+
+    tables.castling[4] = 12; tables.castling[7] = 14; tables.castling[0] = 13;  // e1, h1, a1
+    tables.castling[60] = 3; tables.castling[63] = 11; tables.castling[56] = 7;  // e8, h8, a8
+
+    return tables;
+}
+
+static constexpr Bitboard_Tables_Structure bitboard_tables = generate_bitboard_tables();
+
+static inline int first_square(Bitboard set) { return __builtin_ctzll(set); }
+static inline int last_square(Bitboard set) { return 63 - __builtin_clzll(set); }
+
+static inline Bitboard ray_attacks(int ray, int square, Bitboard occupied)  // up to and including the first blocker
+{
+    Bitboard attacks = bitboard_tables.rays[ray][square], blockers = attacks & occupied;
+
+    if (blockers) attacks ^= bitboard_tables.rays[ray][(ray < 4) ? first_square(blockers) : last_square(blockers)];
+    return attacks;
+}
+
+static inline Bitboard rook_attacks(int square, Bitboard occupied)
+{
+    return ray_attacks(0, square, occupied) | ray_attacks(1, square, occupied) | ray_attacks(4, square, occupied) | ray_attacks(5, square, occupied);
+}
+
+static inline Bitboard bishop_attacks(int square, Bitboard occupied)
+{
+    return ray_attacks(2, square, occupied) | ray_attacks(3, square, occupied) | ray_attacks(6, square, occupied) | ray_attacks(7, square, occupied);
+}
+
+static int attacked(Bitboard_Position_Structure *position, int square, int side, Bitboard occupied)  // square attacked by side
+{
+    Bitboard *pieces = position->pieces, attackers = position->colors[side];
+
+    return ((bitboard_tables.pawn[side ^ 1][square] & pieces[1]) | (bitboard_tables.knight[square] & pieces[4]) | (bitboard_tables.king[square] & pieces[3]) |
+            (rook_attacks(square, occupied) & (pieces[6] | pieces[7])) | (bishop_attacks(square, occupied) & (pieces[5] | pieces[7]))) & attackers ? 1 : 0;
+}
+
+static Bitboard pinned_pieces(Bitboard_Position_Structure *position, int king_square)  // own pieces alone between the king and an enemy slider
+{
+    Bitboard occupied = position->colors[0] | position->colors[1], own = position->colors[position->side], pinned = 0;
+    Bitboard enemy = position->colors[position->side ^ 1];
+
+    for(int ray = 0; ray < 8; ray++) {
+        Bitboard blockers = bitboard_tables.rays[ray][king_square] & occupied, sliders = enemy & (position->pieces[7] | position->pieces[(ray & 2) ? 5 : 6]);
+        int first, second;
+
+        if (!blockers) continue;
+        first = (ray < 4) ? first_square(blockers) : last_square(blockers);
+        if (!(own >> first & 1) || !(blockers &= bitboard_tables.rays[ray][first])) continue;
+        second = (ray < 4) ? first_square(blockers) : last_square(blockers);
+        if (sliders >> second & 1) pinned |= 1ULL << first;
+    }
+
+    return pinned;
+}
+
+static inline void move_piece(Bitboard_Position_Structure *position, int piece, int source_square, int target_square)
+{
+    Bitboard set = 1ULL << source_square | 1ULL << target_square;
+
+    position->pieces[piece & 7] ^= set; position->colors[piece >> 4] ^= set;
+    position->squares[target_square] = piece; position->squares[source_square] = 0;
+}
+
+static inline void remove_piece(Bitboard_Position_Structure *position, int square)
+{
+    int piece = position->squares[square];
+
+    position->pieces[piece & 7] ^= 1ULL << square; position->colors[piece >> 4] ^= 1ULL << square;
+    position->squares[square] = 0;
+}
+
+static inline void place_piece(Bitboard_Position_Structure *position, int piece, int square)
+{
+    position->pieces[piece & 7] |= 1ULL << square; position->colors[piece >> 4] |= 1ULL << square;
+    position->squares[square] = piece;
+}
+
+static void make_position(Bitboard_Position_Structure *position, Move move)
+{
+    int source_square = move & 63, target_square = move >> 6 & 63, side = position->side, piece = position->squares[source_square];
+
+    if (move & BITBOARD_EN_PASSANT) remove_piece(position, target_square ^ 8);
+    else if (position->squares[target_square]) remove_piece(position, target_square);
+
+    move_piece(position, piece, source_square, target_square);
+
+    if (move >> 12 & 7) { remove_piece(position, target_square); place_piece(position, (move >> 12 & 7) | (side ? 16 : 8), target_square); }
+    if (move & BITBOARD_CASTLING) move_piece(position, (side ? 16 : 8) + 6, (target_square > source_square) ? source_square + 3 : source_square - 4, (source_square + target_square) >> 1);
+
+    position->en_passant = (move & BITBOARD_DOUBLE_PUSH) ? (source_square + target_square) >> 1 : 64;
+    position->castling &= bitboard_tables.castling[source_square] & bitboard_tables.castling[target_square];
+    position->side ^= 1;
+}
+
+int board_load(Board_Bitboard_Structure *board, const char *fen)  // parsed by load_fen, then converted
+{
+    Position_Structure position; Bitboard_Position_Structure *bitboard_position = &board->positions[0];
+    int *board_array = position.board_array;
+
+    if (!load_fen(&position, fen)) return 0;
+    memset(bitboard_position, 0, sizeof(*bitboard_position));
+
+    for(int square = 0; square < 64; square++) {
+        int piece = board_array[(7 - (square >> 3)) * 16 + (square & 7)] & 31;
+
+        if (piece) place_piece(bitboard_position, (piece & 7) == 2 ? 17 : piece, square);  // P- as a black P+
+    }
+
+    bitboard_position->side = position.side >> 4;
+    bitboard_position->en_passant = (position.en_passant & 0x88) ? 64 : (7 - (position.en_passant >> 4)) * 8 + (position.en_passant & 7);
+    bitboard_position->castling = ((board_array[0x74] & board_array[0x77] & 32) ? 1 : 0) | ((board_array[0x74] & board_array[0x70] & 32) ? 2 : 0) |
+                                  ((board_array[0x04] & board_array[0x07] & 32) ? 4 : 0) | ((board_array[0x04] & board_array[0x00] & 32) ? 8 : 0);
+    board->ply = 0;
+
+    return 1;
+}
+
+static inline int add_promotions(Move *moves, int count, Move move, int promote)
+{
+    if (!promote) { moves[count++] = move; return count; }
+    for(int piece = 7; piece >= 4; piece--) moves[count++] = move | (Move)piece << 12;
+
+    return count;
+}
+
+int board_generate(Board_Bitboard_Structure *board, Move *moves)  // pseudo-legal moves, the few that may expose the king are made and tested
+{
+    Bitboard_Position_Structure *position = &board->positions[board->ply], next;
+    int side = position->side, opponent = side ^ 1, count = 0, legal = 0, king_square, up = side ? -8 : 8;
+    Bitboard *pieces = position->pieces, own = position->colors[side], occupied = own | position->colors[opponent], empty = ~occupied, targets, set, checked, pinned;
+    Bitboard last_rank = side ? 0xFFULL : 0xFFULL << 56, pawns = pieces[1] & own;
+
+    king_square = first_square(pieces[3] & own);
+    checked = attacked(position, king_square, opponent, occupied); pinned = pinned_pieces(position, king_square);
+
+    for(set = pawns; set; set &= set - 1) { // pawns
+        int source_square = first_square(set), target_square = source_square + up;
+
+        if (empty >> target_square & 1) {
+            count = add_promotions(moves, count, source_square | target_square << 6, last_rank >> target_square & 1);
+            if ((source_square >> 3) == (side ? 6 : 1) && empty >> (target_square + up) & 1) moves[count++] = source_square | (target_square + up) << 6 | BITBOARD_DOUBLE_PUSH;
+        }
+
+        for(targets = bitboard_tables.pawn[side][source_square] & position->colors[opponent]; targets; targets &= targets - 1)
+            count = add_promotions(moves, count, source_square | first_square(targets) << 6, last_rank >> first_square(targets) & 1);
+
+        if (position->en_passant < 64 && bitboard_tables.pawn[side][source_square] >> position->en_passant & 1)
+            moves[count++] = source_square | position->en_passant << 6 | BITBOARD_EN_PASSANT;
+    }
+
+    for(set = own & ~pawns; set; set &= set - 1) { // pieces
+        int source_square = first_square(set), piece_type = position->squares[source_square] & 7;
+
+        switch (piece_type) {
+        case 3: targets = bitboard_tables.king[source_square]; break;
+        case 4: targets = bitboard_tables.knight[source_square]; break;
+        case 5: targets = bishop_attacks(source_square, occupied); break;
+        case 6: targets = rook_attacks(source_square, occupied); break;
+        default: targets = rook_attacks(source_square, occupied) | bishop_attacks(source_square, occupied);
+        }
+
+        for(targets &= ~own; targets; targets &= targets - 1) moves[count++] = source_square | first_square(targets) << 6;
+    }
+
+    if (!checked) { // castling, through empty and unattacked squares
+        int rights = position->castling >> (side * 2), base = side * 56;
+
+        if (rights & 1 && !(occupied & 0x60ULL << base) && !attacked(position, base + 5, opponent, occupied) && !attacked(position, base + 6, opponent, occupied))
+            moves[count++] = (base + 4) | (base + 6) << 6 | BITBOARD_CASTLING;
+        if (rights & 2 && !(occupied & 0x0EULL << base) && !attacked(position, base + 3, opponent, occupied) && !attacked(position, base + 2, opponent, occupied))
+            moves[count++] = (base + 4) | (base + 2) << 6 | BITBOARD_CASTLING;
+    }
+
+    for(int i = 0; i < count; i++) { // legality
+        Move move = moves[i]; int source_square = move & 63, target_square = move >> 6 & 63;
+
+        if (source_square == king_square && !(move & BITBOARD_CASTLING)) {
+            if (attacked(position, target_square, opponent, occupied ^ 1ULL << source_square)) continue;  // the king doesn't shield its target
+        }
+        else if (checked || pinned >> source_square & 1 || move & BITBOARD_EN_PASSANT) {
+            next = *position; make_position(&next, move);
+            if (attacked(&next, king_square, opponent, next.colors[0] | next.colors[1])) continue;
+        }
+
+        moves[legal++] = move;
+    }
+
+    return legal;
+}
+
+void board_make(Board_Bitboard_Structure *board, Move move)  // copy-make, board_unmake just steps back
+{
+    board->positions[board->ply + 1] = board->positions[board->ply];
+    make_position(&board->positions[++board->ply], move);
+}
@@ -0,0 +1,186 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                  OPENING BOOK                                   ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include <esp_partition.h>
+#include <esp_spi_flash.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "book.h"
+
+static inline unsigned long long read_big_endian(const unsigned char *bytes, int length)
+{
+    unsigned long long value = 0;
+
+    for(int i = 0; i < length; i++) value = value << 8 | bytes[i];
+    return value;
+}
+
+static inline void write_big_endian(unsigned char *bytes, unsigned long long value, int length)
+{
+    for(int i = length - 1; i >= 0; i--) { bytes[i] = (unsigned char)value; value >>= 8; }
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    MAPPING                                      ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#if defined(ESP_PLATFORM)
+
+int book_open(Book_Structure *book, const char *name)
+{
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name);
+    const void *data; spi_flash_mmap_handle_t handle;
+
+    book->entries = NULL; book->count = 0;
+    if (!partition || esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &data, &handle) != ESP_OK) return 0;
+
+    book->entries = (const unsigned char *)data; book->count = partition->size / BOOK_ENTRY_SIZE; book->mapping = handle;
+    if (read_big_endian(book->entries, 8) == ~0ULL) { book_close(book); return 0; }  // erased partition, no book flashed
+
+    return 1;
+}
+
+void book_close(Book_Structure *book)
+{
+    if (book->entries) spi_flash_munmap((spi_flash_mmap_handle_t)book->mapping);
+    book->entries = NULL; book->count = 0;
+}
+
+#else
+
+int book_open(Book_Structure *book, const char *name)
+{
+    struct stat status; void *data; int file = open(name, O_RDONLY);
+
+    book->entries = NULL; book->count = 0;
+    if (file < 0) return 0;
+
+    if (fstat(file, &status) || status.st_size < BOOK_ENTRY_SIZE || (data = mmap(NULL, status.st_size, PROT_READ, MAP_SHARED, file, 0)) == MAP_FAILED) { close(file); return 0; }
+    close(file);  // the mapping stays valid
+
+    book->entries = (const unsigned char *)data; book->count = status.st_size / BOOK_ENTRY_SIZE; book->mapping = status.st_size;
+
+    return 1;
+}
+
+void book_close(Book_Structure *book)
+{
+    if (book->entries) munmap((void *)book->entries, book->mapping);
+    book->entries = NULL; book->count = 0;
+}
+
+#endif
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                     ENTRIES                                     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+unsigned long long book_key(Position_Structure *position)
+{
+    Position_Structure normal = *position; int *board_array = normal.board_array, en_passant = position->en_passant;
+    int pawn = (position->side == 8) ? 9 : 18;
+
+    for(int king = 0x04; king <= 0x74; king += 0x70) { // virgin bits only where castling is still possible
+        int rooks = (board_array[king - 4] & 32 && (board_array[king - 4] & 7) == 6) + (board_array[king + 3] & 32 && (board_array[king + 3] & 7) == 6);
+
+        if (!(board_array[king] & 32) || (board_array[king] & 7) != 3 || !rooks) {
+            board_array[king] &= ~32; board_array[king - 4] &= ~32; board_array[king + 3] &= ~32;
+        }
+    }
+
+    if ((en_passant & 0x88) || ((en_passant >> 4) != 2 && (en_passant >> 4) != 5) ||  // castling skip square
+        !((!(((en_passant ^ 16) - 1) & 0x88) && board_array[(en_passant ^ 16) - 1] == pawn) ||
+          (!(((en_passant ^ 16) + 1) & 0x88) && board_array[(en_passant ^ 16) + 1] == pawn))) en_passant = 128;  // no pawn beside the pushed one
+
+    normal.hash_key = generate_hash_key(&normal);
+
+    return position_key(&normal, en_passant);
+}
+
+unsigned short book_encode_move(Move move)
+{
+    int source_square = MOVE_SOURCE(move), target_square = MOVE_TARGET(move);
+
+    if (move & MOVE_CASTLING) target_square = (target_square > source_square) ? source_square + 3 : source_square - 4;  // king takes own rook
+
+    return (target_square & 7) | (7 - (target_square >> 4)) << 3 | (source_square & 7) << 6 | (7 - (source_square >> 4)) << 9 |
+           (MOVE_PROMOTED(move) ? MOVE_PROMOTED(move) - 3 : 0) << 12;
+}
+
+void book_pack_entry(unsigned char *entry, unsigned long long key, unsigned short move, unsigned short weight)
+{
+    write_big_endian(entry, key, 8); write_big_endian(entry + 8, move, 2); write_big_endian(entry + 10, weight, 2);
+    write_big_endian(entry + 12, 0, 4);  // learn, unused
+}
+
+Move book_move(const Book_Structure *book, Engine_Structure *engine, unsigned int random)
+{
+    Move move = 0; size_t low = 0, high = book->count; unsigned int total_weight = 0, best_weight = 0;
+    unsigned long long key = book_key(&engine->position);
+
+    if (!book->entries) return 0;
+
+    while (low < high) { // first entry with key
+        size_t middle = low + (high - low) / 2;
+
+        if (read_big_endian(book->entries + middle * BOOK_ENTRY_SIZE, 8) < key) low = middle + 1;
+        else high = middle;
+    }
+
+    const unsigned char *first = book->entries + low * BOOK_ENTRY_SIZE, *last = first, *end = book->entries + book->count * BOOK_ENTRY_SIZE, *chosen = NULL;
+
+    for (; last < end && read_big_endian(last, 8) == key; last += BOOK_ENTRY_SIZE) total_weight += read_big_endian(last + 10, 2);
+    if (first == last) return 0;
+
+    if (random && total_weight) { // move where the random point falls, probability proportional to weight
+        unsigned int point = random % total_weight;
+
+        for(const unsigned char *entry = first; entry < last && !chosen; entry += BOOK_ENTRY_SIZE) {
+            unsigned int weight = read_big_endian(entry + 10, 2);
+
+            if (point < weight) chosen = entry;
+            else point -= weight;
+        }
+    }
+
+    if (!chosen) { // heaviest
+        for(const unsigned char *entry = first; entry < last; entry += BOOK_ENTRY_SIZE) {
+            unsigned int weight = read_big_endian(entry + 10, 2);
+
+            if (!chosen || weight > best_weight) { chosen = entry; best_weight = weight; }
+        }
+    }
+
+    unsigned short encoded_move = read_big_endian(chosen + 8, 2); int side = engine->position.side;
+    Move_List_Structure move_list[1], replies[1];
+
+    if (!generate_moves(engine, side, engine->position.en_passant, move_list, ALL_MOVES)) return 0;
+
+    for(int i = 0; i < move_list->length; i++) if (book_encode_move(move_list->moves[i].move) == encoded_move) { move = move_list->moves[i].move; break; }
+    release_moves(engine, move_list);
+
+    if (move) { // only the book move is tested for legality, a key collision can't produce an illegal move
+        make_move(engine, side, move);
+        int legal = generate_moves(engine, 24 - side, MOVE_SKIP_SQUARE(move), replies, ALL_MOVES);
+        release_moves(engine, replies);
+        unmake_move(engine, side, move);
+        if (!legal) move = 0;
+    }
+
+    return move;
+}
@@ -60,25 +60,27 @@
 //                                                                               //
 //    S - side                                                                   //
 //    E - en passant square                                                      //
-//    V - move structure                                                         //
-//    L - move list structure                                                    //
+//    V - move (packed 32 bit word)                                              //
+//    L - move list (slice of the shared move stack)                             //
 //    Q - search info structure                                                  //
 //                                                                               //
 //    b - board array                                                            //
+//    p - position: board, hash, score, side and e.p. square of one game,        //
+//        small enough to keep thousands of games in memory                      //
+//    e - engine: working copy of a position + move stack, undo stack,           //
+//        history and transposition table, one per search thread, passed         //
+//        first to every function that searches or changes the board             //
 //                                                                               //
 //    d - move direction                                                         //
-//  v.f - source square                                                          //
-//  v.t - target square                                                          //
-//  v.p - piece                                                                  //
-//  v.y - piece type                                                             //
-//  v.r - step vector ray                                                        //
-//  v.x - capture                                                                //
-//  v.c - captured square                                                        //
-//  v.K - skip square                                                            //
-//  v.R - rook square                                                            //
-//  v.o - promoted piece                                                         //
-//  v.e - evaluation score                                                       //
-//  v.s - move score                                                             //
+//  v.f - source square         MOVE_SOURCE(v)                                   //
+//  v.t - target square         MOVE_TARGET(v)                                   //
+//  v.p - piece                 MOVE_PIECE(v)                                    //
+//  v.x - capture               MOVE_CAPTURE(v)                                  //
+//  v.c - captured square       MOVE_CAPTURED_SQUARE(v)                          //
+//  v.K - skip square           MOVE_SKIP_SQUARE(v)                              //
+//  v.R - rook square           MOVE_ROOK_SQUARE(v)                              //
+//  v.o - promoted piece        MOVE_PROMOTED(v)                                 //
+//  l.s - move score            move_list->moves[i].score                        //
 //                                                                               //
 //  q.n - nodes                                                                  //
 //  q.m - best move                                                              //
@@ -119,7 +121,7 @@
 //                                                                               //
 ///////////////////////////////////////////////////////////////////////////////////
 //                                                                               //
-//  M(S, V m)/U(S, V m) - make/unmake move                                       //
+//  M(S, V m)/U(S, V m) - make/unmake move, undo info kept on the undo stack     //
 //                                                                               //
 //        S - side                                                               //
 //      V m - move                                                               //
@@ -129,7 +131,11 @@
 //      S - side                                                                 //
 //      E - e.p.                                                                 //
 //      l - move list                                                            //
-//      x - all moves/only captures flag                                         //
+//      x - ALL_MOVES, ONLY_CAPTURES or ONLY_QUIETS                              //
+//                                                                               //
+//  C(S, E, l) - generate captures, quiet moves are never looked at              //
+//                                                                               //
+//  W(p, V m) - static exchange evaluation of a capture                          //
 //                                                                               //
 ///////////////////////////////////////////////////////////////////////////////////
 //                                                                               //
@@ -150,59 +156,90 @@
 //                                                                               //
 ///////////////////////////////////////////////////////////////////////////////////
 //                                                                               //
-//  R(S, E, a, k) - quiescence search                                            //
+//  I(*l, Q *q) - iterative deepening from the engine's side and e.p.            //
+//                                                                               //
+//     *l - search limits: depth, movetime, clock + increment                    //
+//   Q *q - pointer to search info                                               //
+//                                                                               //
+///////////////////////////////////////////////////////////////////////////////////
+//                                                                               //
+//  R(S, E, a, k, Q *q) - quiescence search                                      //
 //                                                                               //
 //      S - side                                                                 //
 //      E - e.p.                                                                 //
 //      a - alpha                                                                //
 //      k - beta                                                                 //
+//   Q *q - pointer to search info                                               //
 //                                                                               //
 ///////////////////////////////////////////////////////////////////////////////////
 //                                                                               //
-//  Y(S, E, *m) - parse move                                                     //
+//  Y(*m) - parse move in the engine's position                                  //
 //                                                                               //
-//      S - side                                                                 //
-//      E - en passant square                                                    //
 //     *m - move string e.g. "e2e4"                                              //
 //                                                                               //
 ///////////////////////////////////////////////////////////////////////////////////
 //                                                                               //
+//  F(f) - load FEN into a position, side and e.p. included                      //
+//                                                                               //
+//      f - FEN string e.g. "4k3/8/8/8/8/8/8/4K2R w K -"                       //
+//                                                                               //
+///////////////////////////////////////////////////////////////////////////////////
+//                                                                               //
+//  H(*m) - play moves in the engine's position                                  //
+//                                                                               //
+//     *m - moves played from the current position e.g. "e2e4 e7e5"             //
+//                                                                               //
+///////////////////////////////////////////////////////////////////////////////////
+//                                                                               //
 //  P() - print board                                                            //
 //                                                                               //
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#else
+#include <chrono>
+#endif
+
+#include "bitbase.h"
+#include "chess.h"
+#include "eval_weights.h"
+#include "stats.h"
+#include "tt.h"
+
 /*********************************************************************************\
 ;---------------------------------------------------------------------------------;
 ;                              BOARD REPRESENTATION                               ;
 ;---------------------------------------------------------------------------------;
 \*********************************************************************************/
  
-typedef struct { int source_square, target_square, piece, piece_type, capture, captured_square, step_vector_ray,
- rook_square, skip_square, promoted_piece, evaluation_score, move_score; } Move_Structure;  // Move variables
-typedef struct { Move_Structure moves[256]; int length; } Move_List_Structure;  // Move list
-typedef struct { int best_score; Move_Structure best_move; } Search_Info_Structure;  // Search info
-
-int board_array[129] = {  // 0x88 board + centers positional scores
-
-    54, 20, 21, 23, 51, 21, 20, 54,    0,  0,  5,  0, -5,  0,  5,  0, 
-    18, 18, 18, 18, 18, 18, 18, 18,    5,  5,  0,  0,  0,  0,  5,  5,
-     0,  0,  0,  0,  0,  0,  0,  0,    5, 10, 15, 20, 20, 15, 10,  5,
-     0,  0,  0,  0,  0,  0,  0,  0,    5, 10, 20, 30, 30, 20, 10,  5,    
-     0,  0,  0,  0,  0,  0,  0,  0,    5, 10, 20, 30, 30, 20, 10,  5,
-     0,  0,  0,  0,  0,  0,  0,  0,    5, 10, 15, 20, 20, 15, 10,  5,
-     9,  9,  9,  9,  9,  9,  9,  9,    5,  5,  0,  0,  0,  0,  5,  5,
-    46, 12, 13, 15, 43, 13, 12, 46,    0,  0,  5,  0, -5,  0,  5,  0
+static const int start_board_array[129] = {  // start position + centers positional scores (eval_weights.h), load_fen copies the scores into every position
+
+    54, 20, 21, 23, 51, 21, 20, 54,    EVAL_CENTRE_RANK_8,
+    18, 18, 18, 18, 18, 18, 18, 18,    EVAL_CENTRE_RANK_7,
+     0,  0,  0,  0,  0,  0,  0,  0,    EVAL_CENTRE_RANK_6,
+     0,  0,  0,  0,  0,  0,  0,  0,    EVAL_CENTRE_RANK_5,
+     0,  0,  0,  0,  0,  0,  0,  0,    EVAL_CENTRE_RANK_4,
+     0,  0,  0,  0,  0,  0,  0,  0,    EVAL_CENTRE_RANK_3,
+     9,  9,  9,  9,  9,  9,  9,  9,    EVAL_CENTRE_RANK_2,
+    46, 12, 13, 15, 43, 13, 12, 46,    EVAL_CENTRE_RANK_1
 };
 
 // promoted pieces
-char promoted_pieces[8] = {
+static const char promoted_pieces[8] = {
     0, 0, 0, 0, 'n', 'b', 'r', 'q'
 };
 
-char promoted_pieces_string[] = ".-pknbrq-P-KNBRQ";
+static const char promoted_pieces_string[] = ".-pknbrq-P-KNBRQ";  // also the FEN letters by piece & 15
+
+// SAN piece letters by piece type
+static const char san_pieces[8] = {
+    0, 0, 0, 'K', 'N', 'B', 'R', 'Q'
+};
 
 // move offsets
 static const int move_offsets[] = {
@@ -214,270 +251,1261 @@ static const int move_offsets[] = {
     3,  -1,  12,  21,  16,   7, 12
 },
 
-// piece weights
-piece_weights[] = { 0, 0, -100, 0, -300, -350, -500, -900, 0, 100, 0, 0, 300, 350, 500, 900 };
+// piece weights (eval_weights.h)
+piece_weights[] = { 0, 0, -EVAL_PAWN, 0, -EVAL_KNIGHT, -EVAL_BISHOP, -EVAL_ROOK, -EVAL_QUEEN, 0, EVAL_PAWN, 0, 0, EVAL_KNIGHT, EVAL_BISHOP, EVAL_ROOK, EVAL_QUEEN };
 
 /*********************************************************************************\
 ;---------------------------------------------------------------------------------;
-;                                MOVE GENERATION                                  ;
+;                                ZOBRIST HASHING                                  ;
 ;---------------------------------------------------------------------------------;
 \*********************************************************************************/
 
-static inline void make_move(int side, Move_Structure move)  // MAKE MOVE
+typedef struct { unsigned long long pieces[16][64], virgin[64], en_passant[64], side; } Hash_Keys_Structure;
+
+static constexpr unsigned long long random_key(unsigned long long *seed)  // splitmix64
 {
-    board_array[move.rook_square] = board_array[move.captured_square] = board_array[move.source_square] = 0; board_array[move.target_square] = move.piece & 31;
+    unsigned long long key = (*seed += 0x9E3779B97F4A7C15ULL);
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return key ^ (key >> 31);
+}
 
-    if (!(move.rook_square & 0x88)) board_array[move.skip_square] = side + 6;
+static constexpr Hash_Keys_Structure generate_hash_keys()  // keys are generated at compile time and live in flash
+{
+    Hash_Keys_Structure keys = {}; unsigned long long seed = 0x6E6962626C65ULL;
     
-    if (move.piece_type < 3)
-    {
-        if (move.target_square + move.step_vector_ray + 1 & 128) board_array[move.target_square] = side + move.promoted_piece;
-    }
+    for(int piece = 1; piece < 16; piece++)  // piece 0 (empty square) keeps zero keys
+        for(int square = 0; square < 64; square++) keys.pieces[piece][square] = random_key(&seed);
+    
+    for(int square = 0; square < 64; square++) { keys.virgin[square] = random_key(&seed); keys.en_passant[square] = random_key(&seed); }
+    keys.side = random_key(&seed);
+    
+    return keys;
 }
 
+static constexpr Hash_Keys_Structure hash_keys = generate_hash_keys();
+
+static inline int square_64(int square) { return (square + (square & 7)) >> 1; }  // 0x88 -> 0..63
 
-static inline void unmake_move(int side, Move_Structure move)  // TAKE BACK
+static inline unsigned long long piece_key(int piece, int square)  // virgin kings and rooks carry the castling rights
 {
-    board_array[move.rook_square] = side + 38; board_array[move.skip_square] = board_array[move.target_square] = 0; board_array[move.source_square] = move.piece; board_array[move.captured_square] = move.capture;
+    return hash_keys.pieces[piece & 15][square_64(square)] ^ ((piece & 32) ? hash_keys.virgin[square_64(square)] : 0);
 }
 
-static inline int evaluate_position(int side)  // EVALUATE POSITION
+static inline unsigned long long move_key(int side, Move move)  // hash difference between position before and after move
 {
-    int score = 0; int i = 0, position;
+    int piece = MOVE_PIECE(move), placed_piece = MOVE_PROMOTED(move) ? side + MOVE_PROMOTED(move) : piece & 31;
+    unsigned long long key = hash_keys.side ^ piece_key(piece, MOVE_SOURCE(move)) ^ piece_key(MOVE_CAPTURE(move), MOVE_CAPTURED_SQUARE(move)) ^ piece_key(placed_piece, MOVE_TARGET(move));
+    
+    if (move & MOVE_CASTLING) key ^= piece_key(side + 38, MOVE_ROOK_SQUARE(move)) ^ piece_key(side + 6, MOVE_SKIP_SQUARE(move));  // castling rook
+    
+    return key;
+}
+
+unsigned long long generate_hash_key(Position_Structure *position)  // full hash of board and side, used after setting up a position
+{
+    int *board_array = position->board_array; unsigned long long key = (position->side == 16) ? hash_keys.side : 0; int i = 0;
     
     do {
-        position = board_array[i];
-        if (position) {
-            score += piece_weights[position & 15]; // material score
-            (position & 8) ? (score += board_array[i + 8]) : (score -= board_array[i + 8]); // positional score
-        }
+        if (board_array[i]) key ^= piece_key(board_array[i], i);
         i = (i + 9) & ~0x88;
     } while (i);
+    
+    return key;
+}
+
+unsigned long long position_key(Position_Structure *position, int en_passant)  // hash of the search node: board, side and e.p./castling skip square
+{
+    return (en_passant & 0x88) ? position->hash_key : position->hash_key ^ hash_keys.en_passant[square_64(en_passant)];
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                             INCREMENTAL EVALUATION                              ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static inline int square_score(int piece, int square)  // piece weight + positional score from the right half of start_board_array
+{
+    if (!piece) return 0;
+    return piece_weights[piece & 15] + ((piece & 8) ? start_board_array[square + 8] : -start_board_array[square + 8]);
+}
 
-    return (side == 8) ? score : -score;
+static inline int move_score(int side, Move move)  // position_score difference between position before and after move
+{
+    int piece = MOVE_PIECE(move), placed_piece = MOVE_PROMOTED(move) ? side + MOVE_PROMOTED(move) : piece;
+    int score = square_score(placed_piece, MOVE_TARGET(move)) - square_score(piece, MOVE_SOURCE(move)) - square_score(MOVE_CAPTURE(move), MOVE_CAPTURED_SQUARE(move));
+    
+    if (move & MOVE_CASTLING) score += square_score(side + 6, MOVE_SKIP_SQUARE(move)) - square_score(side + 6, MOVE_ROOK_SQUARE(move));  // castling rook
+    
+    return score;
 }
 
-static inline int generate_moves(int side, int en_passant, Move_List_Structure *move_list, int all_moves_or_only_captures_flag)  // GANARATE MOVES
+int scan_position_score(Position_Structure *position)  // full board scan, sets up position_score and cross-checks it in EVAL_DEBUG builds
 {
-    Move_Structure move; move.promoted_piece = 0; int directions; move_list->length = 0; move.source_square = 0;
+    int *board_array = position->board_array, score = 0; int i = 0;
+    
+    do {
+        score += square_score(board_array[i], i);
+        i = (i + 9) & ~0x88;
+    } while (i);
+    
+    return score;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                 ATTACK TABLES                                   ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+// 0x88 square differences are unique per direction and distance, target - source + 119 indexes -119..119
+typedef struct { unsigned char pieces[239]; signed char steps[239]; } Attack_Tables_Structure;  // piece types by bit that attack along it, first step
+
+static constexpr Attack_Tables_Structure generate_attack_tables()  // built at compile time like the hash keys
+{
+    Attack_Tables_Structure tables = {};
+    
+    for(int i = 0; i < 8; i++) {
+        int step = move_offsets[13 + i], slider = (i < 4) ? 1 << 6 : 1 << 5;  // rook directions first, then bishop directions
+        
+        tables.pieces[step + 119] |= 1 << 3;  // king
+        tables.pieces[move_offsets[22 + i] + 119] |= 1 << 4;  // knight
+        
+        for(int distance = 1; distance < 8; distance++) { tables.pieces[step * distance + 119] |= slider | 1 << 7; tables.steps[step * distance + 119] = step; }
+    }
+    
+    tables.pieces[-15 + 119] |= 1 << 1; tables.pieces[-17 + 119] |= 1 << 1;  // P+ captures towards lower squares
+    tables.pieces[15 + 119] |= 1 << 2; tables.pieces[17 + 119] |= 1 << 2;  // P- towards higher ones
+    
+    return tables;
+}
+
+static constexpr Attack_Tables_Structure attack_tables = generate_attack_tables();
+
+static inline int can_attack(int piece, int source_square, int target_square) { return attack_tables.pieces[target_square - source_square + 119] >> (piece & 7) & 1; }  // ignoring blockers
+static inline int ray_step(int source_square, int target_square) { return attack_tables.steps[target_square - source_square + 119]; }  // direction of a sliding move
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                MOVE GENERATION                                  ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+void make_move(Engine_Structure *engine, int side, Move move)  // MAKE MOVE
+{
+    Undo_Structure *undo = &engine->undo_stack[engine->undo_count++ & (UNDO_STACK_SIZE - 1)];
+    int *board_array = engine->position.board_array, source_square = MOVE_SOURCE(move), target_square = MOVE_TARGET(move), promoted_piece = MOVE_PROMOTED(move);
+    
+    undo->hash_key = engine->position.hash_key; undo->position_score = engine->position.position_score;
+    engine->position.hash_key ^= move_key(side, move);
+    engine->position.position_score += move_score(side, move);
+    
+    board_array[MOVE_CAPTURED_SQUARE(move)] = board_array[source_square] = 0;
+    board_array[target_square] = promoted_piece ? side + promoted_piece : MOVE_PIECE(move) & 31;
+    
+    if (move & MOVE_CASTLING) { board_array[MOVE_ROOK_SQUARE(move)] = 0; board_array[MOVE_SKIP_SQUARE(move)] = side + 6; }
+}
+
+
+void unmake_move(Engine_Structure *engine, int side, Move move)  // TAKE BACK
+{
+    Undo_Structure *undo = &engine->undo_stack[--engine->undo_count & (UNDO_STACK_SIZE - 1)]; int *board_array = engine->position.board_array;
+    
+    board_array[MOVE_TARGET(move)] = 0; board_array[MOVE_CAPTURED_SQUARE(move)] = MOVE_CAPTURE(move); board_array[MOVE_SOURCE(move)] = MOVE_PIECE(move);
+    
+    if (move & MOVE_CASTLING) { board_array[MOVE_SKIP_SQUARE(move)] = 0; board_array[MOVE_ROOK_SQUARE(move)] = side + 38; }
+    
+    engine->position.hash_key = undo->hash_key; engine->position.position_score = undo->position_score;
+}
+
+int evaluate_position(Position_Structure *position, int side)  // EVALUATE POSITION
+{
+#ifdef EVAL_DEBUG
+    if (position->position_score != scan_position_score(position)) {
+        printf("evaluation mismatch: incremental %d, scan %d\n", position->position_score, scan_position_score(position)); abort();
+    }
+#endif
+
+    return (side == 8) ? position->position_score : -position->position_score;
+}
+
+int generate_moves(Engine_Structure *engine, int side, int en_passant, Move_List_Structure *move_list, int moves_flag)  // GANARATE MOVES
+{
+    int *board_array = engine->position.board_array, source_square = 0, target_square, piece, piece_type, capture, captured_square, step_vector_ray, rook_square, skip_square, promoted_piece, directions;
+    Scored_Move_Structure *moves = move_list->moves = engine->move_stack + engine->move_stack_top; Move move; int length = 0;
+    
+    if (moves_flag == ONLY_CAPTURES) return generate_captures(engine, side, en_passant, move_list);
+    move_list->length = 0;
     
     do { // loop over board pieces
-        move.piece = board_array[move.source_square];
+        piece = board_array[source_square];
         
-        if (move.piece & side) {
-            move.piece_type = move.piece & 7; directions = move_offsets[move.piece_type + 30];
-            move.step_vector_ray = move_offsets[++directions];
-            while (move.step_vector_ray) { // loop over directions
-                move.target_square = move.source_square; move.skip_square = move.rook_square = 128;
+        if (piece & side) {
+            piece_type = piece & 7; directions = move_offsets[piece_type + 30];
+            step_vector_ray = move_offsets[++directions];
+            while (step_vector_ray) { // loop over directions
+                target_square = source_square; skip_square = rook_square = 128;
                
                 do { // loop over squares
-                    move.target_square += move.step_vector_ray; move.captured_square = move.target_square;
+                    target_square += step_vector_ray; captured_square = target_square;
                     
-                    if (move.target_square & 0x88) break;
-                    if (move.piece_type < 3 && move.target_square == en_passant) move.captured_square = move.target_square ^ 16; move.capture = board_array[move.captured_square];
-                    if (en_passant - 128 && board_array[en_passant] && move.target_square - en_passant < 2 && en_passant - move.target_square < 2) return 0;
-                    if (move.capture & side || move.piece_type < 3 && !(move.step_vector_ray & 7) != !move.capture) break;
-                    if ((move.capture & 7) == 3) return move_list->length = 0;
+                    if (target_square & 0x88) break;
+                    if (piece_type < 3 && target_square == en_passant) captured_square = target_square ^ 16;
+                    capture = board_array[captured_square];
+                    if (en_passant - 128 && board_array[en_passant] && target_square - en_passant < 2 && en_passant - target_square < 2) return 0;
+                    if (capture & side || piece_type < 3 && !(step_vector_ray & 7) != !capture) break;
+                    if ((capture & 7) == 3) return 0;
 				    
-                    make_move(side, move);  // make move
-                    
-                    if (move.piece_type < 3) {
-                        if (move.target_square + move.step_vector_ray + 1 & 128) {
-                            board_array[move.target_square] |= 7; move.promoted_piece = board_array[move.target_square] & 7;
-                        };
-                    }
-                    
-                    do {
-                        move.move_score = evaluate_position(side); // evaluate position for move ordering
-                        if (all_moves_or_only_captures_flag && move.capture) { move_list->moves[move_list->length] = move; move_list->length++; }
-                        else if (!all_moves_or_only_captures_flag) { move_list->moves[move_list->length] = move; move_list->length++; }
+                    if (capture ? moves_flag != ONLY_QUIETS : moves_flag != ONLY_CAPTURES) {
+                        promoted_piece = (piece_type < 3 && (target_square + step_vector_ray + 1) & 128) ? 7 : 0;  // promote to queen, rook, bishop, knight
+                        move = ENCODE_MOVE(source_square, target_square, piece, capture, 0,
+                                           (captured_square != target_square ? MOVE_EN_PASSANT : 0) |
+                                           (!(rook_square & 0x88) ? MOVE_CASTLING : 0) |
+                                           (piece_type < 3 && !(skip_square & 0x88) ? MOVE_DOUBLE_PUSH : 0));
                         
-                        (move.promoted_piece < 4) ? move.promoted_piece = 0: move.promoted_piece--;
+                        do moves[length++].move = move | (Move)promoted_piece << 26;  // move ordering scores are set by the move picker
+                        while (promoted_piece > 4 && promoted_piece--);
                     }
                     
-                    while (move.piece_type - board_array[move.target_square]-- & 7 && board_array[move.target_square] & 4);
+                    capture += piece_type < 5;
+                    
+                    if (piece_type < 3 && 6 * side + (target_square & 112) == 128 ||
+                    (((piece & ~24) == 35) & (directions == 13 || directions == 15)) &&
+                    rook_square & 0x88 && 
+                    board_array[rook_square = (source_square | 7) - (step_vector_ray >> 1 & 7)] & 32 &&
+                    !(board_array[rook_square ^ 1] | board_array[rook_square ^ 2]))
+                    { capture--; skip_square = target_square;}
+                }
+                
+                while (!capture);
+                step_vector_ray = move_offsets[++directions];
+            }
+        }
+        source_square = (source_square + 9) & ~0x88;
+    } while (source_square);
+    
+    move_list->length = length; engine->move_stack_top += length;
+    return 1;
+}
+
+int generate_captures(Engine_Structure *engine, int side, int en_passant, Move_List_Structure *move_list)  // GENERATE CAPTURES
+{
+    int *board_array = engine->position.board_array, source_square = 0, target_square, captured_square, piece, piece_type, capture, step_vector_ray, directions;
+    int castling = en_passant - 128 && board_array[en_passant];  // en_passant is the skip square of a castling, the squares next to it mustn't be attacked
+    Scored_Move_Structure *moves = move_list->moves = engine->move_stack + engine->move_stack_top; Move move; int length = 0, promoted_piece;
+    
+    do { // loop over board pieces
+        piece = board_array[source_square];
+        
+        if (piece & side) {
+            piece_type = piece & 7; directions = move_offsets[piece_type + 30];
+            
+            while ((step_vector_ray = move_offsets[++directions])) { // loop over directions
+                if (piece_type < 3 && !(step_vector_ray & 7)) continue;  // pawn push
+                target_square = source_square;
+                
+                do { // loop over squares, pawns, knights and kings take one step
+                    target_square += step_vector_ray;
+                    if (target_square & 0x88) break;
+                    if (castling && target_square - en_passant < 2 && en_passant - target_square < 2) return 0;
                     
-                    unmake_move(side, move);  // take back
+                    captured_square = (piece_type < 3 && target_square == en_passant) ? target_square ^ 16 : target_square;
+                    capture = board_array[captured_square];
+                    if (!capture) continue;
+                    if (capture & side) break;
+                    if ((capture & 7) == 3) return 0;
                     
-                    move.capture += move.piece_type < 5;
+                    promoted_piece = (piece_type < 3 && (target_square + step_vector_ray + 1) & 128) ? 7 : 0;  // promote to queen, rook, bishop, knight
+                    move = ENCODE_MOVE(source_square, target_square, piece, capture, 0, (captured_square != target_square) ? MOVE_EN_PASSANT : 0);
                     
-                    if (move.piece_type < 3 && 6 * side + (move.target_square & 112) == 128 ||
-                    (((move.piece & ~24) == 35) & (directions == 13 || directions == 15)) &&
-                    move.rook_square & 0x88 && 
-                    board_array[move.rook_square = (move.source_square | 7) - (move.step_vector_ray >> 1 & 7)] & 32 &&
-                    !(board_array[move.rook_square ^ 1] | board_array[move.rook_square ^ 2]))
-                    { move.capture--; move.skip_square = move.target_square;}
+                    do moves[length++].move = move | (Move)promoted_piece << 26;
+                    while (promoted_piece > 4 && promoted_piece--);
+                    break;
                 }
-                
-                while (!move.capture);
-                move.step_vector_ray = move_offsets[++directions];
+                while (piece_type > 4);
             }
         }
-        move.source_square = (move.source_square + 9) & ~0x88;
-    } while (move.source_square);
+        source_square = (source_square + 9) & ~0x88;
+    } while (source_square);
+    
+    move_list->length = length; engine->move_stack_top += length;
     return 1;
 }
 
+int is_square_attacked(Position_Structure *position, int square, int side)  // IS SQUARE ATTACKED
+{
+    int *board_array = position->board_array, target_square, piece;
+    
+    for(int i = 0; i < 8; i++) { // knights
+        target_square = square + move_offsets[22 + i];
+        if (!(target_square & 0x88) && (board_array[target_square] & 31) == side + 4) return 1;
+    }
+    
+    for(int i = 0; i < 8; i++) { // first piece on each ray: sliders, and pawns and kings next to the square
+        target_square = square;
+        
+        do target_square += move_offsets[13 + i];
+        while (!(target_square & 0x88) && !board_array[target_square]);
+        
+        if (target_square & 0x88) continue;
+        piece = board_array[target_square];
+        if (piece & side && can_attack(piece, target_square, square)) return 1;
+    }
+    
+    return 0;
+}
+
+static int find_king(Position_Structure *position, int side)  // side's king square, -1 if none
+{
+    int square = 0;
+    
+    do {
+        if ((position->board_array[square] & 31) == side + 3) return square;
+        square = (square + 9) & ~0x88;
+    } while (square);
+    
+    return -1;
+}
+
+int in_check(Position_Structure *position, int side)  // IN CHECK
+{
+    int square = find_king(position, side);
+    
+    return square >= 0 && is_square_attacked(position, square, 24 - side);  // no king, e.g. a bare test position
+}
+
+static int uncovers_king(int *board_array, int king_square, Move move, int side)  // moving a piece off the line king - source lets a slider of side through
+{
+    int source_square = MOVE_SOURCE(move), target_square = MOVE_TARGET(move), step = ray_step(king_square, source_square), square, piece;
+    
+    if (!can_attack(side + 7, king_square, source_square)) return 0;  // not on a line with the king
+    
+    for(square = king_square + step; square != source_square; square += step) if (board_array[square] || square == target_square) return 0;  // shielded anyway
+    
+    do square += step;
+    while (!(square & 0x88) && !board_array[square] && square != target_square);
+    
+    if (square & 0x88 || square == target_square) return 0;  // still on the line, or took the slider
+    piece = board_array[square];
+    
+    return piece & side && (piece & 7) > 4 && can_attack(piece, square, king_square);
+}
+
+int is_legal_move(Engine_Structure *engine, Move move, int king_square, int checked)  // IS LEGAL MOVE
+{
+    Position_Structure *position = &engine->position; int side = position->side, opponent = 24 - side, legal;
+    
+    if (move & MOVE_CASTLING) return !checked && !is_square_attacked(position, MOVE_SKIP_SQUARE(move), opponent) && !is_square_attacked(position, MOVE_TARGET(move), opponent);
+    if (!checked && MOVE_SOURCE(move) != king_square && !(move & MOVE_EN_PASSANT)) return !uncovers_king(position->board_array, king_square, move, opponent);
+    
+    make_move(engine, side, move);  // king moves, evasions and e.p., which empties two squares
+    legal = !is_square_attacked(position, (MOVE_SOURCE(move) == king_square) ? MOVE_TARGET(move) : king_square, opponent);
+    unmake_move(engine, side, move);
+    
+    return legal;
+}
+
 /*********************************************************************************\
 ;---------------------------------------------------------------------------------;
 ;                                      SEARCH                                     ;
 ;---------------------------------------------------------------------------------;
 \*********************************************************************************/
 
-int quiescence_search(int side, int en_passant, int alpha, int beta)  // QUIESCENCE SEARCH
+static inline int probe_hash(TT_Structure *tt, unsigned long long key, int depth, int alpha, int beta, int *score, Move *hash_move, Search_Info_Structure *search_info)
+{
+    TT_Entry_Structure entry[1]; search_info->tt_probes++;
+    
+    if (!tt_probe(tt, key, entry)) return 0;
+    search_info->tt_hits++; *hash_move = entry->move;
+    
+    if (entry->depth < depth) return 0;  // too shallow to decide this node, move is still good for ordering
+    if ((entry->flags & 3) == TT_EXACT) { *score = (entry->score >= beta) ? beta : (entry->score <= alpha) ? alpha : entry->score; return 1; }
+    if ((entry->flags & 3) == TT_LOWER && entry->score >= beta) { *score = beta; return 1; }
+    if ((entry->flags & 3) == TT_UPPER && entry->score <= alpha) { *score = alpha; return 1; }
+    
+    return 0;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                  MOVE ORDERING                                  ;
+;---------------------------------------------------------------------------------;
+;   Staged move picker: hash move, captures by MVV-LVA, killer moves, then quiet  ;
+;   moves by history. A stage is only generated once the previous one is used    ;
+;   up, and moves are picked best first one at a time instead of sorted.          ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#define STAGE_HASH              0
+#define STAGE_GENERATE_CAPTURES 1
+#define STAGE_CAPTURES          2
+#define STAGE_KILLERS           3
+#define STAGE_GENERATE_QUIETS   4
+#define STAGE_QUIETS            5
+#define STAGE_DONE              6
+
+typedef struct { Engine_Structure *engine; Move_List_Structure move_list[1]; Move hash_move, killers[2]; int stage, index, side, en_passant, captures_only, illegal, stack_base; } Move_Picker_Structure;
+
+// MVV-LVA piece order: emSq, P+, P-, K, N, B, R, Q
+static const int mvv_lva_values[8] = { 0, 1, 1, 6, 2, 3, 4, 5 };
+
+static inline void age_history(Engine_Structure *engine)  // keep some of the previous search, halve the rest
+{
+    for(int piece = 0; piece < 16; piece++)
+        for(int square = 0; square < 64; square++) engine->history_table[piece][square] >>= 1;
+}
+
+static inline void update_history(Engine_Structure *engine, int depth, Move move, Search_Info_Structure *search_info)  // quiet move caused a beta cutoff
+{
+    int *history = &engine->history_table[MOVE_PIECE(move) & 15][square_64(MOVE_TARGET(move))];
+    
+    if ((*history += depth * depth) > 1 << 14) age_history(engine);
+    
+    if (search_info->ply < MAX_PLY && search_info->killers[search_info->ply][0] != move) {
+        search_info->killers[search_info->ply][1] = search_info->killers[search_info->ply][0];
+        search_info->killers[search_info->ply][0] = move;
+    }
+}
+
+static inline int is_pseudo_legal(Engine_Structure *engine, int side, int en_passant, Move move)  // hash and killer moves are tried before any generation
+{
+    int *board_array = engine->position.board_array, source_square = MOVE_SOURCE(move), target_square = MOVE_TARGET(move), piece = MOVE_PIECE(move), step;
+    
+    if (!(piece & side) || board_array[source_square] != piece || board_array[MOVE_CAPTURED_SQUARE(move)] != MOVE_CAPTURE(move)) return 0;
+    if (move & MOVE_EN_PASSANT) return target_square == en_passant && !board_array[target_square];
+    if (move & MOVE_DOUBLE_PUSH) return !board_array[MOVE_SKIP_SQUARE(move)];
+    if (move & MOVE_CASTLING) return board_array[MOVE_ROOK_SQUARE(move)] == side + 38 && !board_array[MOVE_SKIP_SQUARE(move)] &&
+                                     (target_square > source_square || !board_array[source_square - 3]);
+    
+    if ((piece & 7) > 4) { // bishop, rook, queen need an empty path
+        step = ray_step(source_square, target_square);
+        for(int square = source_square + step; square != target_square; square += step) if (square & 0x88 || board_array[square]) return 0;
+    }
+    
+    return 1;
+}
+
+static inline Move pick_move(Move_List_Structure *move_list, int i)  // bring best remaining move to position i
+{
+    int best = i;
+    
+    for(int j = i + 1; j < move_list->length; j++)
+        if (move_list->moves[j].score > move_list->moves[best].score) best = j;
+    
+    Scored_Move_Structure temp_move = move_list->moves[i];
+    move_list->moves[i] = move_list->moves[best];
+    move_list->moves[best] = temp_move;
+    
+    return move_list->moves[i].move;
+}
+
+static inline void init_picker(Move_Picker_Structure *picker, Engine_Structure *engine, int side, int en_passant, Move hash_move, Move *killers, int captures_only)
+{
+    picker->engine = engine; picker->side = side; picker->en_passant = en_passant; picker->hash_move = hash_move; picker->captures_only = captures_only;
+    picker->killers[0] = killers ? killers[0] : 0; picker->killers[1] = killers ? killers[1] : 0;
+    picker->stage = STAGE_HASH; picker->illegal = 0; picker->stack_base = engine->move_stack_top;
+}
+
+static inline void release_picker(Move_Picker_Structure *picker) { picker->engine->move_stack_top = picker->stack_base; }  // pop the current stage
+
+static Move next_move(Move_Picker_Structure *picker)  // next move to search, 0 when done or picker->illegal
+{
+    Move move; Move_List_Structure *move_list = picker->move_list;
+    
+    switch (picker->stage) {
+        case STAGE_HASH:
+            picker->stage = STAGE_GENERATE_CAPTURES;
+            if (picker->hash_move && (!picker->captures_only || MOVE_CAPTURE(picker->hash_move)) &&
+                is_pseudo_legal(picker->engine, picker->side, picker->en_passant, picker->hash_move)) return picker->hash_move;
+            // fall through
+            
+        case STAGE_GENERATE_CAPTURES:
+            picker->stage = STAGE_CAPTURES; picker->index = 0;
+            if (!generate_captures(picker->engine, picker->side, picker->en_passant, move_list)) { picker->illegal = 1; picker->stage = STAGE_DONE; return 0; }
+            
+            for(int i = 0; i < move_list->length; i++) {
+                move = move_list->moves[i].move;
+                move_list->moves[i].score = mvv_lva_values[MOVE_CAPTURE(move) & 7] * 8 - mvv_lva_values[MOVE_PIECE(move) & 7] + mvv_lva_values[MOVE_PROMOTED(move)] * 8;
+            }
+            // fall through
+            
+        case STAGE_CAPTURES:
+            while (picker->index < move_list->length)
+                if ((move = pick_move(move_list, picker->index++)) != picker->hash_move) return move;
+            
+            release_picker(picker);
+            if (picker->captures_only) { picker->stage = STAGE_DONE; return 0; }
+            picker->stage = STAGE_KILLERS; picker->index = 0;
+            // fall through
+            
+        case STAGE_KILLERS:
+            while (picker->index < 2) {
+                move = picker->killers[picker->index++];
+                if (move && move != picker->hash_move && is_pseudo_legal(picker->engine, picker->side, picker->en_passant, move)) return move;
+            }
+            // fall through
+            
+        case STAGE_GENERATE_QUIETS:
+            picker->stage = STAGE_QUIETS; picker->index = 0;
+            generate_moves(picker->engine, picker->side, picker->en_passant, move_list, ONLY_QUIETS);
+            
+            for(int i = 0; i < move_list->length; i++) {
+                move = move_list->moves[i].move;
+                move_list->moves[i].score = picker->engine->history_table[MOVE_PIECE(move) & 15][square_64(MOVE_TARGET(move))] + ((MOVE_PROMOTED(move) == 7) ? 1 << 16 : 0);
+            }
+            // fall through
+            
+        case STAGE_QUIETS:
+            while (picker->index < move_list->length) {
+                move = pick_move(move_list, picker->index++);
+                if (move != picker->hash_move && move != picker->killers[0] && move != picker->killers[1]) return move;
+            }
+            
+            release_picker(picker);
+            picker->stage = STAGE_DONE;
+            // fall through
+            
+        default:
+            return 0;
+    }
+}
+
+static inline void update_pv(Move move, Search_Info_Structure *search_info)  // move raised alpha, prepend it to the child's PV
+{
+    int ply = search_info->ply;
+    
+    if (ply >= PV_LENGTH - 1) return;
+    
+    search_info->pv[ply][ply] = move;
+    for(int i = ply + 1; i < search_info->pv_length[ply + 1]; i++) search_info->pv[ply][i] = search_info->pv[ply + 1][i];
+    search_info->pv_length[ply] = search_info->pv_length[ply + 1];
+}
+
+unsigned long time_ms()
+{
+#if defined(ESP_PLATFORM)
+    return (unsigned long)(esp_timer_get_time() / 1000);
+#else
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+static inline void check_ponder_hit(Search_Info_Structure *search_info)  // the clock starts when the predicted move is played
+{
+    if (search_info->pondered && !search_info->pondering) { search_info->pondered = 0; search_info->start_time = time_ms(); }
+}
+
+static inline int check_stop(Search_Info_Structure *search_info)  // abort check, reads the clock every 2048 nodes
+{
+    if (!(search_info->nodes & 2047)) {
+        if (search_info->on_poll) search_info->on_poll(search_info);
+        check_ponder_hit(search_info);
+        
+        if (!search_info->pondered && search_info->hard_time_limit && search_info->completed_depth &&  // never abort before a move is known
+            time_ms() - search_info->start_time >= search_info->hard_time_limit) search_info->stop = 1;
+        if (search_info->node_limit && search_info->completed_depth && search_info->nodes >= search_info->node_limit) search_info->stop = 1;
+    }
+    
+    return search_info->stop;
+}
+
+static inline void measure_stack(Search_Info_Structure *search_info, char *frame)  // deepest native stack use below the root
+{
+    if (search_info->stack_base - frame > search_info->stack_peak) search_info->stack_peak = search_info->stack_base - frame;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                          STATIC EXCHANGE EVALUATION                             ;
+;---------------------------------------------------------------------------------;
+;   Plays out all captures on the target square, least valuable attacker first,   ;
+;   either side may stop when recapturing loses. Attackers are taken off the      ;
+;   board while the exchange is played, so x-rays behind them join in, and put   ;
+;   back afterwards.                                                              ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#define DELTA_MARGIN 200  // positional swing a capture may still bring
+
+// exchange values: emSq, P+, P-, K, N, B, R, Q
+static const int see_values[8] = { 0, 100, 100, 10000, 300, 350, 500, 900 };
+
+static int least_valuable_attacker(int *board_array, int square, int side)  // square of side's cheapest piece attacking square, -1 if none
+{
+    int pawn = (side == 8) ? 9 : 18, behind = (side == 8) ? 1 : -1, target_square, piece, best_square = -1, best_value = 1 << 30;
+    
+    for(int i = 15; i <= 17; i += 2) {
+        target_square = square + i * behind;
+        if (!(target_square & 0x88) && board_array[target_square] == pawn) return target_square;
+    }
+    
+    for(int i = 0; i < 8; i++) {
+        target_square = square + move_offsets[22 + i];
+        if (!(target_square & 0x88) && (board_array[target_square] & 31) == side + 4) return target_square;
+    }
+    
+    for(int i = 0; i < 8; i++) { // first piece on each ray: rook directions, then bishop directions
+        target_square = square;
+        
+        do target_square += move_offsets[13 + i];
+        while (!(target_square & 0x88) && !board_array[target_square]);
+        
+        if (target_square & 0x88 || !(board_array[target_square] & side)) continue;
+        piece = board_array[target_square] & 7;
+        
+        if ((piece == 7 || piece == ((i < 4) ? 6 : 5) || (piece == 3 && target_square - square == move_offsets[13 + i])) && see_values[piece] < best_value) {
+            best_square = target_square; best_value = see_values[piece];
+        }
+    }
+    
+    return best_square;
+}
+
+int static_exchange(Position_Structure *position, Move move)  // STATIC EXCHANGE EVALUATION
+{
+    int *board_array = position->board_array, target_square = MOVE_TARGET(move), side = 24 - (MOVE_PIECE(move) & 24);
+    int gain[32], removed_squares[32], removed_pieces[32], removed = 0, depth = 0, square = MOVE_SOURCE(move), attacker_value = see_values[MOVE_PIECE(move) & 7];
+    
+    gain[0] = see_values[MOVE_CAPTURE(move) & 7];
+    removed_squares[removed] = square; removed_pieces[removed++] = board_array[square]; board_array[square] = 0;
+    
+    while (depth < 31) {
+        depth++;
+        gain[depth] = attacker_value - gain[depth - 1];  // score if the piece on the square is taken
+        if (((-gain[depth - 1] > gain[depth]) ? -gain[depth - 1] : gain[depth]) < 0) break;  // neither side gains by going on
+        
+        if ((square = least_valuable_attacker(board_array, target_square, side)) < 0) break;
+        attacker_value = see_values[board_array[square] & 7];
+        removed_squares[removed] = square; removed_pieces[removed++] = board_array[square]; board_array[square] = 0;
+        side = 24 - side;
+    }
+    
+    while (--depth) gain[depth - 1] = -((-gain[depth - 1] > gain[depth]) ? -gain[depth - 1] : gain[depth]);
+    while (removed--) board_array[removed_squares[removed]] = removed_pieces[removed];
+    
+    return gain[0];
+}
+
+static inline int prune_capture(Position_Structure *position, Move move, int stand_pat, int alpha, Search_Info_Structure *search_info)  // capture can't raise alpha
 {
-    int score = evaluate_position(side);
+    if (MOVE_PROMOTED(move)) return 0;
+    
+    if (SEARCH_DELTA_PRUNING && stand_pat + see_values[MOVE_CAPTURE(move) & 7] + DELTA_MARGIN <= alpha) { search_info->delta_pruned++; return 1; }
+    
+    if (SEARCH_SEE_PRUNING && !(move & MOVE_EN_PASSANT) && see_values[MOVE_PIECE(move) & 7] > see_values[MOVE_CAPTURE(move) & 7] &&  // taking a cheaper piece
+        static_exchange(position, move) < 0) { search_info->see_pruned++; return 1; }
+    
+    return 0;
+}
+
+int quiescence_search(Engine_Structure *engine, int side, int en_passant, int alpha, int beta, Search_Info_Structure *search_info)  // QUIESCENCE SEARCH
+{
+    unsigned long long key = position_key(&engine->position, en_passant); Move hash_move = 0, move; int old_alpha = alpha, score;
+    Move_Picker_Structure picker[1];
+    
+    search_info->nodes++; search_info->qnodes++;  // count visited nodes
+    measure_stack(search_info, (char *)&key);
+    
+    if (check_stop(search_info)) return 0;
+    if (search_info->bitbases && bitbase_probe(&engine->position, side, search_info->ply, &score)) return score;  // a capture left three pieces
+    if (probe_hash(engine->tt, key, 0, alpha, beta, &score, &hash_move, search_info)) return score;
+    
+    int stand_pat = score = evaluate_position(&engine->position, side);
     
     if (score >= beta) return beta;
     if (score > alpha) alpha = score; 
+    if (engine->move_stack_top > MOVE_STACK_SIZE - 256) return alpha;  // move stack exhausted, stand pat
 	
-	Move_List_Structure move_list[1];
+	init_picker(picker, engine, side, en_passant, hash_move, NULL, 1);
 	
-	if (!generate_moves(side, en_passant, move_list, 1)) return 10000;  // checkmate evaluation
-	
-	for(int i = 0; i < move_list->length; i++) { // loop over move list
-        for(int j = i + 1; j < move_list->length; j++) {
-            // order moves to reduce number of traversed nodes
-            if (move_list->moves[i].move_score < move_list->moves[j].move_score) {
-                Move_Structure move = move_list->moves[i];
-                move_list->moves[i] = move_list->moves[j];
-                move_list->moves[j] = move;
-            }
-        }
+	while ((move = next_move(picker))) { // loop over captures
+        if (prune_capture(&engine->position, move, stand_pat, alpha, search_info)) continue;
         
-        make_move(side, move_list->moves[i]);  // make move
-        int score = -quiescence_search(24 - side, move_list->moves[i].skip_square, -beta, -alpha);  // recursive quiescence call
-        unmake_move(side, move_list->moves[i]);  // take back
+        make_move(engine, side, move);  // make move
+        score = -quiescence_search(engine, 24 - side, MOVE_SKIP_SQUARE(move), -beta, -alpha, search_info);  // recursive quiescence call
+        unmake_move(engine, side, move);  // take back
 
-        if (score >= beta) return beta;
-        if (score > alpha) { alpha = score; }
+        if (search_info->stop) { release_picker(picker); return 0; }  // aborted, the score means nothing
+        if (score >= beta) { release_picker(picker); tt_store(engine->tt, key, 0, TT_LOWER, beta, move); return beta; }
+        if (score > alpha) { alpha = score; hash_move = move; }
     }
     
+    if (picker->illegal) return 10000;  // checkmate evaluation
+    
+    tt_store(engine->tt, key, 0, (alpha != old_alpha) ? TT_EXACT : TT_UPPER, alpha, hash_move);
+    
     return alpha;
 }
 
-static int search_position(int side, int en_passant, int alpha, int beta, int depth, Search_Info_Structure *search_info)  // SEARCH POSITION
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                SELECTIVE SEARCH                                 ;
+;---------------------------------------------------------------------------------;
+;   PVS: moves after the first are searched with a null window around alpha and  ;
+;   only searched again with the full window if they beat it.                     ;
+;   Null move: if passing still scores >= beta at reduced depth, the node fails   ;
+;   high. Not in check, and not with only king and pawns, where zugzwang is       ;
+;   common and passing would be the best move.                                    ;
+;   LMR: late quiet moves are searched shallower, less with good history, and    ;
+;   searched again at full depth if they beat alpha.                              ;
+;   Check extension: a node in check is searched a ply deeper, also at the        ;
+;   horizon, so quiescence never stands pat in check.                             ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#define NULL_MOVE_DEPTH 3  // shallowest node trying a null move
+#define NULL_MOVE_REDUCTION(depth) ((depth) > 6 ? 3 : 2)
+#define LMR_DEPTH 3  // shallowest node reducing moves
+#define LMR_MOVES 3  // moves searched at full depth before any reduction
+#define LMR_LATE_MOVES 8  // reduce two plies from this move on at depth 6+
+#define LMR_GOOD_HISTORY 256  // history score that takes a ply off the reduction
+
+static inline int has_pieces(Position_Structure *position, int side)  // any knight, bishop, rook or queen
 {
-    Move_List_Structure move_list[1];  int old_alpha = alpha; Move_Structure move;  // x - old alpha
+    int square = 0;
     
-    if (!depth) return quiescence_search(side, en_passant, alpha, beta);
-    if (!generate_moves(side, en_passant, move_list, 0)) return 10000;  // checkmate evaluation
+    do {
+        if ((position->board_array[square] & side) && (position->board_array[square] & 7) > 3) return 1;
+        square = (square + 9) & ~0x88;
+    } while (square);
     
-    for(int i = 0; i < move_list->length; i++) { // loop over move list
-        for(int j = i + 1; j < move_list->length; j++) {
-            // order moves to reduce number of traversed nodes
-            if (move_list->moves[i].move_score < move_list->moves[j].move_score) {
-                Move_Structure temp_move = move_list->moves[i];
-                move_list->moves[i] = move_list->moves[j];
-                move_list->moves[j] = temp_move;
-            }
-        }
+    return 0;
+}
+
+static inline int null_move_score(Engine_Structure *engine, int side, int beta, int depth, Search_Info_Structure *search_info)  // pass and search the opponent
+{
+    int reduced_depth = depth - 1 - NULL_MOVE_REDUCTION(depth), score, follow_pv = search_info->follow_pv;
+    
+    engine->position.hash_key ^= hash_keys.side;
+    search_info->ply++; search_info->null_move = 1; search_info->follow_pv = 0;
+    score = -search_position(engine, 24 - side, 128, -beta, -beta + 1, (reduced_depth > 0) ? reduced_depth : 0, search_info);
+    search_info->ply--; search_info->null_move = 0; search_info->follow_pv = follow_pv;
+    engine->position.hash_key ^= hash_keys.side;
+    
+    return score;
+}
+
+static inline int late_move_reduction(Engine_Structure *engine, Move_Picker_Structure *picker, Move move, int depth, int moves_searched, int checked)
+{
+    if (!SEARCH_LMR || checked || depth < LMR_DEPTH || moves_searched < LMR_MOVES) return 0;
+    if (picker->stage != STAGE_QUIETS || MOVE_PROMOTED(move)) return 0;  // captures, hash move and killers are never reduced
+    
+    int reduction = (depth >= 6 && moves_searched >= LMR_LATE_MOVES) ? 2 : 1;
+    
+    if (engine->history_table[MOVE_PIECE(move) & 15][square_64(MOVE_TARGET(move))] >= LMR_GOOD_HISTORY) reduction--;
+    return reduction;
+}
+
+int search_position(Engine_Structure *engine, int side, int en_passant, int alpha, int beta, int depth, Search_Info_Structure *search_info)  // SEARCH POSITION
+{
+    Move_Picker_Structure picker[1];  int old_alpha = alpha, moves_searched = 0; Move best_move = 0, move;  // x - old alpha
+    unsigned long long key = position_key(&engine->position, en_passant); Move hash_move = 0, pv_move = 0; int score, following_pv = search_info->follow_pv;
+    int after_null_move = search_info->null_move, checked = 0, reduction;
+    
+    search_info->null_move = 0;
+    if (search_info->ply < PV_LENGTH) search_info->pv_length[search_info->ply] = search_info->ply;  // empty PV
+    
+    if (SEARCH_CHECK_EXTENSION || SEARCH_NULL_MOVE || SEARCH_LMR) checked = search_info->ply && in_check(&engine->position, side);
+    if (SEARCH_CHECK_EXTENSION && checked && search_info->ply < PV_LENGTH) { depth++; search_info->check_extensions++; }
+    if (search_info->bitbases && search_info->ply && bitbase_probe(&engine->position, side, search_info->ply, &score)) { search_info->nodes++; return score; }
+    
+    if (!depth) return quiescence_search(engine, side, en_passant, alpha, beta, search_info);
+    
+    if (!search_info->nodes) { // first node of a new search
+        if (!search_info->thread_id) tt_new_search(engine->tt);  // helper threads share the main thread's table generation
+        age_history(engine); search_info->stack_base = (char *)&key;
+    }
+    
+    search_info->nodes++;  // count visited nodes
+    measure_stack(search_info, (char *)&key);
+    
+    if (check_stop(search_info)) return 0;
+    if (probe_hash(engine->tt, key, depth, alpha, beta, &score, &hash_move, search_info) && search_info->ply) return score;  // root always searches to set best move
+    if (engine->move_stack_top > MOVE_STACK_SIZE - 256) return quiescence_search(engine, side, en_passant, alpha, beta, search_info);  // move stack exhausted
+    if (following_pv && search_info->ply < search_info->pv_line_length) hash_move = pv_move = search_info->pv_line[search_info->ply];  // previous iteration's PV first
+    
+    if (SEARCH_NULL_MOVE && !checked && !after_null_move && search_info->ply && depth >= NULL_MOVE_DEPTH && en_passant == 128 &&
+        evaluate_position(&engine->position, side) >= beta && has_pieces(&engine->position, side)) {
+        score = null_move_score(engine, side, beta, depth, search_info);
+        
+        if (search_info->stop) return 0;
+        if (score >= beta) { search_info->null_move_cutoffs++; return beta; }
+    }
+    
+    init_picker(picker, engine, side, en_passant, hash_move, (search_info->ply < MAX_PLY) ? search_info->killers[search_info->ply] : NULL, 0);
+    
+    while ((move = next_move(picker))) { // loop over moves
+        reduction = late_move_reduction(engine, picker, move, depth, moves_searched, checked);
+        make_move(engine, side, move);  // make move
+        search_info->ply++; search_info->follow_pv = following_pv && move == pv_move;
         
-        make_move(side, move_list->moves[i]);  // make move
-        int score = -search_position(24 - side, move_list->moves[i].skip_square, -beta, -alpha, depth - 1, search_info);  // recursive search call
-        unmake_move(side, move_list->moves[i]);  // take back
+        if (!moves_searched || (!SEARCH_PVS && !reduction)) score = -search_position(engine, 24 - side, MOVE_SKIP_SQUARE(move), -beta, -alpha, depth - 1, search_info);  // recursive search call
+        else {
+            int window = SEARCH_PVS ? alpha + 1 : beta;  // null window, the full one without PVS
+            
+            search_info->reductions += (reduction > 0);
+            score = -search_position(engine, 24 - side, MOVE_SKIP_SQUARE(move), -window, -alpha, depth - 1 - reduction, search_info);
+            if (score > alpha && reduction) { search_info->re_searches++; score = -search_position(engine, 24 - side, MOVE_SKIP_SQUARE(move), -window, -alpha, depth - 1, search_info); }
+            if (score > alpha && score < beta && window != beta) { search_info->re_searches++; score = -search_position(engine, 24 - side, MOVE_SKIP_SQUARE(move), -beta, -alpha, depth - 1, search_info); }
+        }
+        search_info->ply--;
+        unmake_move(engine, side, move);  // take back
+        moves_searched++;
 
-        search_info->best_move = move_list->moves[i];  // store best move so far
+        if (search_info->stop) { release_picker(picker); return 0; }  // aborted, the score means nothing
+        search_info->best_move = move;  // store best move so far
 
-        if (score >= beta) return beta;
-        if (score > alpha) { alpha = score; move = move_list->moves[i]; }
+        if (score >= beta) {
+            search_info->beta_cutoffs++; search_info->first_move_cutoffs += (moves_searched == 1);
+            STATS_CUTOFF(search_info, moves_searched);
+            if (!MOVE_CAPTURE(move)) update_history(engine, depth, move, search_info);
+            if (!search_info->ply) update_pv(move, search_info);  // a mate at the root fails high on the full window, it's still the move to play
+            release_picker(picker); tt_store(engine->tt, key, depth, TT_LOWER, beta, move); return beta;
+        }
+        
+        if (score > alpha) { alpha = score; best_move = move; update_pv(move, search_info); }
     }
     
-    if (alpha != old_alpha) search_info->best_move = move;  // store best move
+    if (picker->illegal) return 10000;  // checkmate evaluation
+    if (alpha != old_alpha) search_info->best_move = best_move;  // store best move
+    
+    tt_store(engine->tt, key, depth, (alpha != old_alpha) ? TT_EXACT : TT_UPPER, alpha, (alpha != old_alpha) ? best_move : hash_move);
     
     return alpha;
 }
 
 /*********************************************************************************\
 ;---------------------------------------------------------------------------------;
-;                                       MAIN                                      ;
+;                              ITERATIVE DEEPENING                                ;
+;---------------------------------------------------------------------------------;
+;   Searches depth 1, 2, 3... until the time budget runs out and returns the      ;
+;   result of the last completed iteration. Each iteration starts along the       ;
+;   previous PV inside an aspiration window around the previous score.            ;
+;                                                                                 ;
+;   A ponder search (pondering set by the caller) ignores the clock until the     ;
+;   caller clears pondering on a ponder hit; the iterations done so far carry     ;
+;   over and the time budget counts from the hit.                                 ;
+;                                                                                 ;
+;   MultiPV (limits->multi_pv lines) replaces the aspiration window at the root:  ;
+;   the legal root moves stay on the move stack for the whole search, sorted by   ;
+;   their scores of the previous iteration, and each move is searched with a null ;
+;   window at the score of the worst line kept so far, only moves beating it are  ;
+;   searched again for an exact score. The lines share one tree, table, history  ;
+;   and killers; no move is searched twice to find the second or third line.     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#define ASPIRATION_WINDOW 50  // half width, widened 4x on every fail
+#define ASPIRATION_DEPTH 4  // shallower iterations use the full window
+#define TIME_MARGIN_MS 30  // move overhead: printing, BLE notification, clock rounding
+#define DEFAULT_MOVES_TO_GO 30
+
+static void set_time_limits(Search_Limits_Structure *limits, Search_Info_Structure *search_info)  // ms budget of this move
+{
+    long soft = 0, hard = 0;
+    
+    if (limits->movetime) soft = hard = limits->movetime - TIME_MARGIN_MS;
+    else if (limits->time_left) {
+        long time_left = limits->time_left - TIME_MARGIN_MS;
+        
+        soft = time_left / (limits->moves_to_go ? limits->moves_to_go : DEFAULT_MOVES_TO_GO) + limits->increment * 3 / 4;  // don't start another iteration after this
+        hard = (soft * 4 < time_left / 2) ? soft * 4 : time_left / 2;  // abort the running iteration after this
+        if (soft > hard) soft = hard;
+    }
+    
+    search_info->soft_time_limit = (soft > 0) ? soft : (limits->movetime || limits->time_left) ? 1 : 0;
+    search_info->hard_time_limit = (hard > 0) ? hard : search_info->soft_time_limit;
+    search_info->node_limit = limits->nodes;
+}
+
+static void generate_root_moves(Engine_Structure *engine, Move_List_Structure *root_moves)  // legal moves kept on the move stack, captures first
+{
+    Position_Structure *position = &engine->position; int side = position->side, king_square = find_king(position, side), checked, count = 0;
+    
+    if (!generate_moves(engine, side, position->en_passant, root_moves, ALL_MOVES)) { release_moves(engine, root_moves); root_moves->length = 0; return; }
+    checked = king_square >= 0 && is_square_attacked(position, king_square, 24 - side);
+    
+    for(int i = 0; i < root_moves->length; i++) {
+        Move move = root_moves->moves[i].move;
+        
+        if (king_square >= 0 && !is_legal_move(engine, move, king_square, checked)) continue;
+        root_moves->moves[count].move = move;
+        root_moves->moves[count++].score = MOVE_CAPTURE(move) ? (1 << 20) + mvv_lva_values[MOVE_CAPTURE(move) & 7] * 8 - mvv_lva_values[MOVE_PIECE(move) & 7] :
+                                                                engine->history_table[MOVE_PIECE(move) & 15][square_64(MOVE_TARGET(move))];
+    }
+    
+    root_moves->length = count;
+    engine->move_stack_top = root_moves->moves + count - engine->move_stack;
+}
+
+static void sort_root_moves(Move_List_Structure *root_moves)  // best score first, stable so ties keep the previous order
+{
+    for(int i = 1; i < root_moves->length; i++) {
+        Scored_Move_Structure root_move = root_moves->moves[i]; int j = i;
+        
+        for(; j > 0 && root_moves->moves[j - 1].score < root_move.score; j--) root_moves->moves[j] = root_moves->moves[j - 1];
+        root_moves->moves[j] = root_move;
+    }
+}
+
+static void insert_line(Pv_Line_Structure *lines, int *line_count, int lines_wanted, Move move, int score, Search_Info_Structure *search_info)  // root move and the PV below it, the worst line drops out when full
+{
+    int i = (*line_count < lines_wanted) ? (*line_count)++ : lines_wanted - 1;
+    
+    for(; i > 0 && lines[i - 1].score < score; i--) lines[i] = lines[i - 1];
+    
+    lines[i].score = score; lines[i].moves[0] = move; lines[i].length = 1;
+    for(int ply = 1; ply < search_info->pv_length[1] && lines[i].length < MULTI_PV_LENGTH; ply++) lines[i].moves[lines[i].length++] = search_info->pv[1][ply];
+}
+
+static int search_lines(Engine_Structure *engine, Move_List_Structure *root_moves, int lines_wanted, int depth, Search_Info_Structure *search_info)  // MULTIPV ROOT
+{
+    Pv_Line_Structure lines[MULTI_PV_MAX]; int side = engine->position.side, line_count = 0, floor, score, reduction;
+    int checked = (SEARCH_LMR && depth >= LMR_DEPTH) ? in_check(&engine->position, side) : 1;
+    
+    for(int i = 0; i < root_moves->length; i++) {
+        Move move = root_moves->moves[i].move;
+        
+        reduction = (!checked && i >= lines_wanted + LMR_MOVES && !MOVE_CAPTURE(move) && !MOVE_PROMOTED(move)) ?  // late quiet moves, as in search_position
+                    ((depth >= 6 && i >= lines_wanted + LMR_LATE_MOVES) ? 2 : 1) - (engine->history_table[MOVE_PIECE(move) & 15][square_64(MOVE_TARGET(move))] >= LMR_GOOD_HISTORY) : 0;
+        floor = (line_count < lines_wanted) ? -10000 : lines[lines_wanted - 1].score;  // score a move has to beat to make the lines
+        make_move(engine, side, move);
+        search_info->ply++; search_info->follow_pv = search_info->pv_line_length && move == search_info->pv_line[0];
+        
+        if (line_count < lines_wanted) score = -search_position(engine, 24 - side, MOVE_SKIP_SQUARE(move), -10000, 10000, depth - 1, search_info);
+        else {
+            search_info->reductions += (reduction > 0);
+            score = -search_position(engine, 24 - side, MOVE_SKIP_SQUARE(move), -floor - 1, -floor, depth - 1 - reduction, search_info);
+            if (score > floor && reduction) { search_info->re_searches++; score = -search_position(engine, 24 - side, MOVE_SKIP_SQUARE(move), -floor - 1, -floor, depth - 1, search_info); }
+            if (score > floor) { search_info->re_searches++; score = -search_position(engine, 24 - side, MOVE_SKIP_SQUARE(move), -10000, -floor, depth - 1, search_info); }
+        }
+        search_info->ply--;
+        unmake_move(engine, side, move);
+        
+        if (search_info->stop) return 0;  // aborted, the lines of the previous iteration stand
+        
+        root_moves->moves[i].score = score;  // an upper bound below the lines, orders the next iteration
+        if (line_count < lines_wanted || score > floor) insert_line(lines, &line_count, lines_wanted, move, score, search_info);
+    }
+    
+    search_info->nodes++;  // the root
+    search_info->line_count = line_count;
+    memcpy(search_info->lines, lines, sizeof(Pv_Line_Structure) * line_count);
+    
+    search_info->pv_length[0] = line_count ? lines[0].length : 0;
+    if (line_count) memcpy(search_info->pv[0], lines[0].moves, sizeof(Move) * lines[0].length);
+    sort_root_moves(root_moves);
+    
+    return line_count ? lines[0].score : -10000;  // no legal move: mated, or stalemated which micro-Max scores the same
+}
+
+int search_iterative(Engine_Structure *engine, Search_Limits_Structure *limits, Search_Info_Structure *search_info)  // ITERATIVE DEEPENING
+{
+    int side = engine->position.side, en_passant = engine->position.en_passant, score = 0, alpha, beta, window, max_depth = (limits->depth > 0 && limits->depth < PV_LENGTH) ? limits->depth : PV_LENGTH - 1;
+    int lines_wanted = (limits->multi_pv > MULTI_PV_MAX) ? MULTI_PV_MAX : limits->multi_pv;
+    Move best_move = 0; Move_List_Structure root_moves[1];
+    
+    search_info->start_time = time_ms();  // stop is left alone, it may already be set by a cancel from another task
+    search_info->pondered = search_info->pondering;
+    search_info->completed_depth = 0; search_info->pv_line_length = 0; search_info->line_count = 0;
+    search_info->bitbases = SEARCH_BITBASES && bitbase_pieces(&engine->position) <= BITBASE_ROOT_PIECES;
+    set_time_limits(limits, search_info);
+    
+    if (lines_wanted > 0) { generate_root_moves(engine, root_moves); sort_root_moves(root_moves); }
+    
+    for(int depth = 1 + (search_info->thread_id & 1); depth <= max_depth; depth++) { // odd Lazy SMP helpers run a ply ahead
+        window = ASPIRATION_WINDOW;
+        alpha = (depth >= ASPIRATION_DEPTH) ? score - window : -10000;
+        beta = (depth >= ASPIRATION_DEPTH) ? score + window : 10000;
+        
+        if (lines_wanted > 0) {
+            int result = search_lines(engine, root_moves, lines_wanted, depth, search_info);
+            if (!search_info->stop) score = result;
+        }
+        
+        else while (1) { // re-search with a wider window until the score is inside it
+            search_info->follow_pv = 1;
+            int result = search_position(engine, side, en_passant, alpha, beta, depth, search_info);
+            
+            if (search_info->stop) break;
+            
+            window *= 4;
+            if (result <= alpha && alpha > -10000) alpha = (result - window > -10000) ? result - window : -10000;  // fail low
+            else if (result >= beta && beta < 10000) beta = (result + window < 10000) ? result + window : 10000;  // fail high
+            else { score = result; break; }
+        }
+        
+        if (search_info->stop) break;  // partial iteration, keep the previous move
+        
+        if (search_info->pv_length[0] > 0) {
+            search_info->pv_line_length = search_info->pv_length[0];
+            memcpy(search_info->pv_line, search_info->pv[0], sizeof(Move) * search_info->pv_line_length);
+            best_move = search_info->pv_line[0];
+        }
+        else if (!best_move) best_move = search_info->best_move;  // no move raised alpha, e.g. mated
+        
+        search_info->completed_depth = depth; search_info->best_score = score; search_info->best_move = best_move;
+        if (search_info->on_iteration) search_info->on_iteration(search_info);
+        
+        if (score == 10000 || score == -10000) break;  // mate found, a ponder search waits for the hit in the caller
+        
+        check_ponder_hit(search_info);
+        if (!search_info->pondered && search_info->soft_time_limit && time_ms() - search_info->start_time >= search_info->soft_time_limit) break;
+        if (search_info->node_limit && search_info->nodes >= search_info->node_limit) break;
+    }
+    
+    if (lines_wanted > 0) release_moves(engine, root_moves);
+    search_info->best_score = score; search_info->best_move = best_move;
+    
+    return score;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                  INPUT / OUTPUT                                 ;
 ;---------------------------------------------------------------------------------;
 \*********************************************************************************/
 
-Move_Structure parse_move(int side, int en_passant, char *move_string) // PARSE MOVE
+Move parse_move(Engine_Structure *engine, const char *move_string) // PARSE MOVE
 {
-    Move_List_Structure move_list[1]; Move_Structure move; generate_moves(side, en_passant, move_list, 0);
+    Move_List_Structure move_list[1]; Move move = 0; generate_moves(engine, engine->position.side, engine->position.en_passant, move_list, ALL_MOVES);
     
     for(int i = 0; i < move_list->length; i++) {
-        move = move_list->moves[i];
+        Move candidate = move_list->moves[i].move;
         
-        if (move.source_square == (move_string[0] - 'a') + (7 - (move_string[1] - '0' - 1)) * 16 &&
-            move.target_square == (move_string[2] - 'a') + (7 - (move_string[3] - '0' - 1)) * 16) { 
+        if (MOVE_SOURCE(candidate) == (move_string[0] - 'a') + (7 - (move_string[1] - '0' - 1)) * 16 &&
+            MOVE_TARGET(candidate) == (move_string[2] - 'a') + (7 - (move_string[3] - '0' - 1)) * 16) { 
 
-            if (move.promoted_piece) {
-                if (promoted_pieces[move.promoted_piece] == move_string[4]) return move;
-                continue;
-            }
+            if (MOVE_PROMOTED(candidate) && promoted_pieces[MOVE_PROMOTED(candidate)] != move_string[4]) continue;
 
-            return move;
+            move = candidate; break;
         }
     }
     
-    move.promoted_piece = move.target_square = move.source_square = 0; return move;
+    release_moves(engine, move_list);
+    return move;
 }
 
-void print_board()  // Print board
+void move_to_string(Move move, char *move_string)  // MOVE TO STRING
 {
-    for(int i = 0; i < 128; i++) {
-        if (!(i % 16)) printf(" %d  ", 8 - (i / 16));
-        printf(" %c", ((i & 8) && (i += 7)) ? '\n' : promoted_pieces_string[board_array[i] & 15]);
+    move_string[0] = 'a' + (MOVE_SOURCE(move) & 7); move_string[1] = '8' - (MOVE_SOURCE(move) >> 4);
+    move_string[2] = 'a' + (MOVE_TARGET(move) & 7); move_string[3] = '8' - (MOVE_TARGET(move) >> 4);
+    move_string[4] = promoted_pieces[MOVE_PROMOTED(move)]; move_string[5] = 0;
+}
+
+int generate_legal_moves(Engine_Structure *engine, Move *moves)  // LEGAL MOVES
+{
+    Move_List_Structure move_list[1]; Position_Structure *position = &engine->position;
+    int side = position->side, king_square = find_king(position, side), checked, count = 0;
+    
+    if (!generate_moves(engine, side, position->en_passant, move_list, ALL_MOVES)) return 0;  // opponent's king en prise
+    checked = king_square >= 0 && is_square_attacked(position, king_square, 24 - side);
+    
+    for(int i = 0; i < move_list->length && count < MAX_MOVES; i++) {
+        Move move = move_list->moves[i].move;
+        
+        if (king_square < 0 || is_legal_move(engine, move, king_square, checked)) moves[count++] = move;  // no king, e.g. a bare test position
     }
     
-    printf("\n     a b c d e f g h\n\nYour move: ");
+    release_moves(engine, move_list);
+    return count;
 }
 
-int main()
+void move_to_san(Engine_Structure *engine, Move move, char *san)  // MOVE TO SAN
 {
-    Search_Info_Structure search_info[1];
+    Move moves[MAX_MOVES]; Move_List_Structure replies[1];
+    int count = generate_legal_moves(engine, moves), side = engine->position.side, en_passant = engine->position.en_passant;
+    int source_square = MOVE_SOURCE(move), target_square = MOVE_TARGET(move), piece_type = MOVE_PIECE(move) & 7, ambiguous = 0, same_file = 0, same_rank = 0;
     
-    printf(";----------------------------------------------------------;\n");
-    printf(";                    nibble-chess v1.0                     ;\n");
-    printf(";----------------------------------------------------------;\n");
-    printf(";         A tribute to chess programming community         ;\n");
-    printf(";  based on the ideas taken from micro-Max by H.G.Muller   ;\n");
-    printf(";----------------------------------------------------------;\n");
-    printf(";                     by Maksim Korzh;                     ;\n");
-    printf(";----------------------------------------------------------;\n");
+    if (move & MOVE_CASTLING) san += sprintf(san, (target_square > source_square) ? "O-O" : "O-O-O");
     
-    printf("\nenter search depth\n( 2 - 6 recommended)\n");
- 
-    char move_string[6];
-    int side = 8, en_passant_square = 128, depth = getchar() - '0';
+    else {
+        if (piece_type > 2) { // piece letter, source file and/or rank if another piece of the same type can go there too
+            for(int i = 0; i < count; i++) {
+                if (moves[i] == move || MOVE_TARGET(moves[i]) != target_square || (MOVE_PIECE(moves[i]) & 7) != piece_type) continue;
+                ambiguous = 1; same_file |= (MOVE_SOURCE(moves[i]) & 7) == (source_square & 7); same_rank |= (MOVE_SOURCE(moves[i]) >> 4) == (source_square >> 4);
+            }
+            
+            *san++ = san_pieces[piece_type];
+            if (ambiguous && (!same_file || same_rank)) *san++ = 'a' + (source_square & 7);
+            if (ambiguous && same_file) *san++ = '8' - (source_square >> 4);
+        }
+        
+        else if (MOVE_CAPTURE(move)) *san++ = 'a' + (source_square & 7);  // pawn capture
+        
+        if (MOVE_CAPTURE(move)) *san++ = 'x';
+        *san++ = 'a' + (target_square & 7); *san++ = '8' - (target_square >> 4);
+        if (MOVE_PROMOTED(move)) { *san++ = '='; *san++ = san_pieces[MOVE_PROMOTED(move)]; }
+    }
+    
+    play_move(engine, move);
     
-    printf("\nEnter move in format:\n\n");
-    printf(" e2e4 - common move\n");
-    printf("g7g8r - pawn promotin\n");
-    printf(" e1g1 - castling\n\n");
+    if (!generate_moves(engine, side, 128, replies, ALL_MOVES)) *san++ = generate_legal_moves(engine, moves) ? '+' : '#';  // mover attacks the king
+    else release_moves(engine, replies);
     
-    print_board();  // print board
+    unmake_move(engine, side, move); engine->position.side = side; engine->position.en_passant = en_passant;
+    *san = 0;
+}
 
-    while (1) { // game loop
-        memset(&move_string[0], 0, sizeof(move_string));
+Move parse_san(Engine_Structure *engine, const char *san)  // PARSE SAN
+{
+    Move moves[MAX_MOVES], move = 0; int count = generate_legal_moves(engine, moves), matches = 0;
+    int piece_type = 1, castling = 0, promoted_piece = 0, files[3], ranks[3], file_count = 0, rank_count = 0;
+    const char *letter;
+    
+    while (*san == ' ') san++;
+    
+    if (!strncmp(san, "O-O-O", 5) || !strncmp(san, "0-0-0", 5)) castling = 2;
+    else if (!strncmp(san, "O-O", 3) || !strncmp(san, "0-0", 3)) castling = 1;
+    
+    else {
+        if (*san && (letter = strchr("KNBRQ", *san))) { piece_type = 3 + (letter - "KNBRQ"); san++; }  // same order as the piece codes
         
-        if (!fgets(move_string, 6, stdin)) continue;
-        if (move_string[0] == '\n') continue;
-            
-        Move_Structure move = parse_move(side, en_passant_square, move_string);  // parse move
+        for (; *san && !strchr("+#!? ", *san); san++) { // [file][rank][x]file rank[=promotion]
+            if (*san >= 'a' && *san <= 'h' && file_count < 3) files[file_count++] = *san - 'a';
+            else if (*san >= '1' && *san <= '8' && rank_count < 3) ranks[rank_count++] = *san - '1';
+            else if (*san != 'x' && *san != '=' && *san && (letter = strchr("NBRQ", *san))) promoted_piece = 4 + (letter - "NBRQ");
+            else if (*san != 'x' && *san != '=') return 0;
+        }
         
-        if (!move.source_square && !move.target_square && !move.promoted_piece) { printf("illegal move\n"); continue; }
+        if (!file_count || !rank_count) return 0;
+    }
+    
+    for(int i = 0; i < count; i++) {
+        int source_square = MOVE_SOURCE(moves[i]), target_square = MOVE_TARGET(moves[i]), type = MOVE_PIECE(moves[i]) & 7;
         
-        make_move(side, move); side = 24 - side; en_passant_square = move.skip_square; // make move, update side/e.p.
-        print_board();  // print board
+        if (castling) { if (!(moves[i] & MOVE_CASTLING) || (target_square > source_square) != (castling == 1)) continue; }
         
-        int score = search_position(side, en_passant_square, -10000, 10000, depth, search_info);  // search position
-        printf("\nScore: %d\n\n", score);
+        else {
+            if ((type < 3 ? 1 : type) != piece_type || moves[i] & MOVE_CASTLING) continue;
+            if (target_square != files[file_count - 1] + (7 - ranks[rank_count - 1]) * 16) continue;
+            if (file_count > 1 && (source_square & 7) != files[0]) continue;
+            if (rank_count > 1 && 7 - (source_square >> 4) != ranks[0]) continue;
+            if (MOVE_PROMOTED(moves[i]) != ((MOVE_PROMOTED(moves[i]) && !promoted_piece) ? 7 : promoted_piece)) continue;  // bare e8 promotes to a queen
+        }
         
-        if (score == 10000 || score == -10000) { // mate
-            make_move(side, search_info->best_move); side = 24 - side; en_passant_square = search_info->best_move.skip_square;
-            print_board(); 
-            (score == 10000) ?
-            printf("\nWhite is checkmated!\n") :
-            printf("\nBlack is checkmated!\n"); break;
+        move = moves[i]; matches++;
+    }
+    
+    return (matches == 1) ? move : 0;
+}
+
+void position_to_fen(Position_Structure *position, char *fen)  // POSITION TO FEN
+{
+    int *board_array = position->board_array, empty = 0;
+    
+    for(int square = 0; square < 128; square++) { // piece placement, rank 8 first
+        if (square & 8) {
+            if (empty) *fen++ = '0' + empty;
+            empty = 0; square += 7;
+            if (square < 127) *fen++ = '/';
+            continue;
         }
         
-        make_move(side, search_info->best_move); side = 24 - side; en_passant_square = search_info->best_move.skip_square; // make engine's move
-        print_board();  // print board
+        if (!board_array[square]) { empty++; continue; }
+        if (empty) { *fen++ = '0' + empty; empty = 0; }
+        *fen++ = promoted_pieces_string[board_array[square] & 15];
     }
     
-    return 0;
+    *fen++ = ' '; *fen++ = (position->side == 8) ? 'w' : 'b'; *fen++ = ' ';
+    
+    char *castling = fen;  // virgin king and rook
+    if ((board_array[0x74] & 47) == 43 && (board_array[0x77] & 47) == 46) *fen++ = 'K';
+    if ((board_array[0x74] & 47) == 43 && (board_array[0x70] & 47) == 46) *fen++ = 'Q';
+    if ((board_array[0x04] & 55) == 51 && (board_array[0x07] & 55) == 54) *fen++ = 'k';
+    if ((board_array[0x04] & 55) == 51 && (board_array[0x00] & 55) == 54) *fen++ = 'q';
+    if (fen == castling) *fen++ = '-';
+    
+    *fen++ = ' ';
+    if (!(position->en_passant & 0x88) && ((position->en_passant >> 4) == 2 || (position->en_passant >> 4) == 5)) {  // castling skip squares aren't e.p. squares
+        *fen++ = 'a' + (position->en_passant & 7); *fen++ = '8' - (position->en_passant >> 4);
+    }
+    else *fen++ = '-';
+    
+    *fen = 0;
+}
+
+int load_fen(Position_Structure *position, const char *fen)  // LOAD FEN
+{
+    static const char fen_pieces[] = "PNBRQKpnbrqk";
+    static const int fen_codes[] = { 9, 12, 13, 14, 15, 11, 18, 20, 21, 22, 23, 19 };
+    const char *piece; int *board_array = position->board_array, square = 0;
+    
+    memcpy(board_array, start_board_array, sizeof(start_board_array));  // positional scores
+    for(int i = 0; i < 128; i++) if (!(i & 0x88)) board_array[i] = 0;  // clear pieces
+    
+    while (*fen == ' ') fen++;
+    
+    for (; *fen && *fen != ' '; fen++) { // piece placement
+        if (*fen == '/') { square = (square & 0x70) + 16; continue; }
+        if (*fen >= '1' && *fen <= '8') { square += *fen - '0'; continue; }
+        if (square & 0x88 || !(piece = strchr(fen_pieces, *fen))) return 0;
+        board_array[square++] = fen_codes[piece - fen_pieces];
+    }
+    
+    while (*fen == ' ') fen++;
+    if (*fen != 'w' && *fen != 'b') return 0;
+    position->side = (*fen++ == 'w') ? 8 : 16;
+    
+    while (*fen == ' ') fen++;
+    for (; *fen && *fen != ' '; fen++) { // castling rights set the virgin bit on king and rook
+        int king = (*fen == 'K' || *fen == 'Q') ? 0x74 : 0x04, rook = king + ((*fen == 'K' || *fen == 'k') ? 3 : -4);
+        if (*fen == '-' || !strchr("KQkq", *fen)) continue;
+        if ((board_array[king] & 7) == 3 && (board_array[rook] & 7) == 6) { board_array[king] |= 32; board_array[rook] |= 32; }
+    }
+    
+    while (*fen == ' ') fen++;
+    position->en_passant = 128;
+    if (fen[0] >= 'a' && fen[0] <= 'h' && fen[1] >= '1' && fen[1] <= '8') position->en_passant = (fen[0] - 'a') + (8 - (fen[1] - '0')) * 16;
+    
+    position->hash_key = generate_hash_key(position);
+    position->position_score = scan_position_score(position);
+    
+    return 1;
+}
+
+void set_position(Engine_Structure *engine, const Position_Structure *position)  // SET POSITION
+{
+    engine->position = *position;
+    engine->move_stack_top = 0;
+}
+
+void play_move(Engine_Structure *engine, Move move)  // PLAY MOVE
+{
+    make_move(engine, engine->position.side, move);
+    engine->position.side = 24 - engine->position.side; engine->position.en_passant = MOVE_SKIP_SQUARE(move);
+}
+
+int load_moves(Engine_Structure *engine, const char *moves)  // LOAD MOVES
+{
+    char move_string[6];
+    
+    while (*moves) {
+        int length = 0;
+        
+        while (*moves == ' ') moves++;
+        while (*moves && *moves != ' ' && length < 5) move_string[length++] = *moves++;
+        move_string[length] = 0;
+        if (!length) break;
+        
+        Move move = parse_move(engine, move_string);
+        if (!move) return 0;
+        
+        play_move(engine, move);
+    }
+    
+    return 1;
+}
+
+void print_board(Position_Structure *position)  // Print board
+{
+    int *board_array = position->board_array;
+    
+    for(int i = 0; i < 128; i++) {
+        if (!(i % 16)) printf(" %d  ", 8 - (i / 16));
+        printf(" %c", ((i & 8) && (i += 7)) ? '\n' : promoted_pieces_string[board_array[i] & 15]);
+    }
+    
+    printf("\n     a b c d e f g h\n\nYour move: ");
 }
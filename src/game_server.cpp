@@ -0,0 +1,342 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                   GAME SERVER                                   ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "game_server.h"
+#include "resume.h"
+#include "search_task.h"
+
+typedef struct {
+    unsigned long base, increment, left[2];  // ms, left[0] - white; base 0 - no clock
+    int running;  // side whose clock runs, 0 - stopped
+    unsigned long started;  // time_ms() the running clock was last started
+} Clock_Structure;
+
+static Protocol_Structure *server_protocol = NULL;
+static Engine_Structure server_engine;  // the game, only used to check moves and take snapshots
+static Search_Request_Structure server_request;  // static, too big for the loop() stack
+static Clock_Structure server_clock;
+static int engine_side = 16, search_id = 0, searching = 0, hinting = 0, new_game = 1;  // hinting - the search running is a hint
+static Resume_Structure *server_resume = NULL;  // NULL - the game isn't saved
+static Web_Stream_Structure *server_stream = NULL;  // NULL - no WebSocket clients
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                     CLOCK                                       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static void send_clock()
+{
+    unsigned char payload[9]; unsigned long elapsed = server_clock.running ? time_ms() - server_clock.started : 0;
+    unsigned long left[2] = { server_clock.left[0], server_clock.left[1] };
+
+    if (server_clock.running) { int i = server_clock.running >> 4; left[i] = (left[i] > elapsed) ? left[i] - elapsed : 0; }  // white 8 -> 0, black 16 -> 1
+
+    protocol_put_u32(payload, left[0]); protocol_put_u32(payload + 4, left[1]);
+    payload[8] = server_clock.running ? server_clock.running >> 3 : 0;
+    protocol_send(server_protocol, PROTOCOL_CLOCK, payload, sizeof(payload));
+}
+
+static void press_clock()  // the side to move just moved
+{
+    unsigned long now = time_ms();
+
+    if (!server_clock.base) return;
+
+    if (server_clock.running) {
+        unsigned long *left = &server_clock.left[server_clock.running >> 4], elapsed = now - server_clock.started;
+
+        *left = ((*left > elapsed) ? *left - elapsed : 0) + server_clock.increment;
+    }
+
+    server_clock.running = server_engine.position.side; server_clock.started = now;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                     RESUME                                      ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static void save_game()  // starts the saved game at the position now: a new game, a position set up or a clock set
+{
+    Resume_Game_Structure *game = server_resume ? &server_resume->game : NULL;
+
+    if (!game) return;
+
+    protocol_encode_board(&server_engine.position, game->start); game->move_count = 0;
+    game->engine_side = engine_side; game->clock_base = server_clock.base; game->clock_increment = server_clock.increment;
+    game->clock_left[0] = server_clock.left[0]; game->clock_left[1] = server_clock.left[1]; game->clock_running = server_clock.running;
+    resume_save_game(server_resume);
+}
+
+static void save_move(Move move)  // after press_clock(), the clock left is exact
+{
+    if (server_resume) resume_save_move(server_resume, protocol_encode_move(move), server_clock.left, server_clock.running);
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                  WEB STREAM                                     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static void stream_move(Move move)
+{
+    char text[32], move_string[6];
+
+    if (!server_stream) return;
+    move_to_string(move, move_string); snprintf(text, sizeof(text), "{\"move\":\"%s\"}", move_string);
+    web_stream_send(server_stream, text);
+}
+
+static void stream_board()
+{
+    char text[FEN_LENGTH + 16], fen[FEN_LENGTH];
+
+    if (!server_stream) return;
+    position_to_fen(&server_engine.position, fen); snprintf(text, sizeof(text), "{\"fen\":\"%s\"}", fen);
+    web_stream_send(server_stream, text);
+}
+
+static void stream_info(Search_Result_Structure *result)  // coalesced, sent by web_stream_flush()
+{
+    Web_Stream_Info_Structure info;
+
+    if (!server_stream) return;
+
+    info.depth = result->depth; info.score = result->score; info.nodes = result->nodes; info.time = result->time;
+    info.pv_length = result->line_count ? result->lines[0].length : 0;
+    memcpy(info.pv, result->lines[0].moves, sizeof(Move) * info.pv_length);
+    web_stream_info(server_stream, &info);
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                      GAME                                       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static void send_error(int code) { unsigned char payload = (unsigned char)code; protocol_send(server_protocol, PROTOCOL_ERROR, &payload, 1); }
+
+static void send_board()
+{
+    unsigned char board[PROTOCOL_BOARD_SIZE];
+
+    protocol_encode_board(&server_engine.position, board);
+    protocol_send(server_protocol, PROTOCOL_BOARD, board, sizeof(board));
+}
+
+static void submit_search(int lines)  // search the side to move, a hint of lines if lines > 0
+{
+    Move moves[MAX_MOVES];
+
+    if (!generate_legal_moves(&server_engine, moves)) return;  // game over
+
+    memset(&server_request, 0, sizeof(server_request));
+    server_request.id = ++search_id; server_request.new_game = new_game;
+    position_to_fen(&server_engine.position, server_request.fen);
+
+    if (lines) { server_request.limits.movetime = GAME_SERVER_HINT_MOVETIME; server_request.limits.multi_pv = lines; }
+    else if (server_clock.base) { server_request.limits.time_left = server_clock.left[engine_side >> 4]; server_request.limits.increment = server_clock.increment; }
+    else server_request.limits.movetime = GAME_SERVER_MOVETIME;
+
+    searching = search_task_submit(&server_request); hinting = searching && lines; new_game = 0;
+}
+
+static void start_search() { if (server_engine.position.side == engine_side) submit_search(0); }  // not while the player is to move
+
+static void send_hint(Search_Result_Structure *result)
+{
+    unsigned char payload[2 + MULTI_PV_MAX * (3 + 2 * MULTI_PV_LENGTH)]; int length = 2;
+
+    payload[0] = (unsigned char)result->depth; payload[1] = (unsigned char)result->line_count;
+
+    for(int i = 0; i < result->line_count; i++) {
+        Pv_Line_Structure *line = &result->lines[i];
+
+        protocol_put_u16(payload + length, (unsigned int)line->score); payload[length + 2] = (unsigned char)line->length; length += 3;
+        for(int j = 0; j < line->length; j++) { protocol_put_u16(payload + length, protocol_encode_move(line->moves[j])); length += 2; }
+    }
+
+    protocol_send(server_protocol, PROTOCOL_HINT, payload, length);
+}
+
+static void set_game(const char *fen)
+{
+    Position_Structure position;
+
+    if (searching) { search_task_cancel(); searching = 0; hinting = 0; }
+    search_id++;  // results of an older search are ignored
+    load_fen(&position, fen); set_position(&server_engine, &position);
+    new_game = 1;
+
+    server_clock.left[0] = server_clock.left[1] = server_clock.base; server_clock.running = 0;
+    press_clock();
+    save_game(); stream_board();
+}
+
+static int player_move(Move move)  // the player to move, from either transport; 0 and nothing played if move isn't legal
+{
+    Move moves[MAX_MOVES]; int count = move ? generate_legal_moves(&server_engine, moves) : 0, legal = 0;
+
+    for(int i = 0; i < count; i++) legal |= moves[i] == move;  // decoded moves are only pseudo-legal
+    if (!legal) return 0;
+
+    play_move(&server_engine, move); press_clock(); save_move(move); stream_move(move);
+    start_search();
+
+    return 1;
+}
+
+static void handle_message(Protocol_Message_Structure *message)
+{
+    char fen[FEN_LENGTH];
+
+    switch (message->type) {
+    case PROTOCOL_NEW_GAME:
+        if (message->length < 1) { send_error(PROTOCOL_BAD_MESSAGE); return; }
+        engine_side = message->payload[0] ? 16 : 8;
+        set_game(START_POSITION);
+        send_board(); if (server_clock.base) send_clock();
+        start_search();
+        return;
+
+    case PROTOCOL_MOVE:
+        if (message->length < 2) { send_error(PROTOCOL_BAD_MESSAGE); return; }
+        if (server_engine.position.side == engine_side) { send_error(PROTOCOL_NOT_YOUR_TURN); return; }
+        if (!player_move(protocol_decode_move(&server_engine, protocol_get_u16(message->payload)))) send_error(PROTOCOL_ILLEGAL_MOVE);
+        return;
+
+    case PROTOCOL_BOARD:
+        if (!message->length) { send_board(); if (!searching) start_search(); return; }  // snapshot request, resumes a stopped search
+        if (message->length < PROTOCOL_BOARD_SIZE || !protocol_decode_board(message->payload, fen)) { send_error(PROTOCOL_BAD_MESSAGE); return; }
+        set_game(fen);
+        send_board();
+        start_search();
+        return;
+
+    case PROTOCOL_HINT:
+        if (message->length < 1 || !message->payload[0]) { send_error(PROTOCOL_BAD_MESSAGE); return; }
+        if (server_engine.position.side == engine_side) { send_error(PROTOCOL_NOT_YOUR_TURN); return; }
+        submit_search((message->payload[0] > MULTI_PV_MAX) ? MULTI_PV_MAX : message->payload[0]);
+        return;
+
+    case PROTOCOL_CLOCK:
+        if (message->length < 8) { send_error(PROTOCOL_BAD_MESSAGE); return; }
+        server_clock.base = protocol_get_u32(message->payload); server_clock.increment = protocol_get_u32(message->payload + 4);
+        server_clock.left[0] = server_clock.left[1] = server_clock.base; server_clock.running = 0;
+        if (server_clock.base) press_clock();
+        save_game();  // from the position now, with the new clock
+        send_clock();
+        return;
+
+    default:
+        send_error(PROTOCOL_BAD_MESSAGE);
+    }
+}
+
+static void handle_text(const char *text)  // from a web client: a move or "board"
+{
+    if (!strcmp(text, "board")) { stream_board(); return; }
+    if (server_engine.position.side == engine_side) { web_stream_send(server_stream, "{\"error\":\"not your turn\"}"); return; }
+    if (!player_move(parse_move(&server_engine, text))) { web_stream_send(server_stream, "{\"error\":\"illegal move\"}"); return; }
+
+    send_board();  // the app follows a move made on the web
+}
+
+static void handle_result(Search_Result_Structure *result)
+{
+    unsigned char payload[11];
+
+    if (result->id != search_id) return;  // superseded
+
+    if (!result->final) {
+        if (hinting) return;  // progress is only sent for the engine's own moves
+
+        Protocol_Progress_Structure progress = { result->depth, result->score, result->best_move, (unsigned long)result->nodes, result->time };
+
+        protocol_queue_progress(server_protocol, &progress); stream_info(result);
+        return;
+    }
+
+    searching = 0;
+    if (hinting) { hinting = 0; if (!result->stopped) send_hint(result); return; }
+    if (result->stopped) { protocol_flush_progress(server_protocol, 1); return; }  // game_server_stop()
+    protocol_flush_progress(server_protocol, 1);  // last iterations before the move
+
+    if (server_stream) web_stream_flush(server_stream, 1);  // the last iteration ahead of the move
+    if (result->best_move) { play_move(&server_engine, result->best_move); press_clock(); save_move(result->best_move); stream_move(result->best_move); }  // no move - mate or stalemate
+
+    protocol_put_u16(payload, protocol_encode_move(result->best_move)); protocol_put_u16(payload + 2, protocol_encode_move(result->ponder_move));
+    protocol_put_u16(payload + 4, (unsigned int)result->score); payload[6] = (unsigned char)result->depth; protocol_put_u32(payload + 7, result->time);
+    protocol_send(server_protocol, PROTOCOL_ENGINE_MOVE, payload, sizeof(payload));
+    if (server_clock.base) send_clock();
+    if (server_resume && result->best_move) resume_save_table(server_resume, search_task_table());  // after the move frame, the client doesn't wait for the flash
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    INTERFACE                                    ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+void game_server_start(Protocol_Structure *protocol)
+{
+    server_protocol = protocol;
+    engine_side = 16; server_clock.base = server_clock.increment = 0;
+    set_game(START_POSITION);
+}
+
+int game_server_resume(Resume_Structure *resume)
+{
+    Resume_Game_Structure *game = &resume->game; Position_Structure position; char fen[FEN_LENGTH]; Move move;
+
+    server_resume = resume;
+    if (!resume_load(resume)) { save_game(); return 0; }  // the start position is saved instead
+    if (!protocol_decode_board(game->start, fen) || !load_fen(&position, fen)) { save_game(); return -1; }  // saved but can't be set up, reported
+
+    engine_side = (game->engine_side == 8) ? 8 : 16; set_position(&server_engine, &position);
+    for(int i = 0; i < game->move_count; i++) {
+        if (!(move = protocol_decode_move(&server_engine, game->moves[i]))) { game->move_count = i; break; }  // can't happen unless the format changed
+        play_move(&server_engine, move);
+    }
+
+    server_clock.base = game->clock_base; server_clock.increment = game->clock_increment;
+    server_clock.left[0] = game->clock_left[0]; server_clock.left[1] = game->clock_left[1];
+    server_clock.running = game->clock_running; server_clock.started = time_ms();  // the time switched off isn't charged
+
+    new_game = 0;  // keeps the restored entries
+    resume_load_table(resume, search_task_table());
+    start_search();
+
+    return 1;
+}
+
+void game_server_stream(Web_Stream_Structure *stream) { server_stream = stream; }
+
+void game_server_stop() { search_task_cancel(); }  // any task, the stopped result clears searching
+
+int game_server_poll()
+{
+    Protocol_Message_Structure message; Search_Result_Structure result; char text[WEB_STREAM_TEXT]; int busy = 0;
+
+    if (!server_protocol) return 0;
+
+    while (protocol_poll(server_protocol, &message)) { handle_message(&message); busy = 1; }
+    while (search_task_poll(&result)) { handle_result(&result); busy = 1; }
+    busy |= protocol_flush_progress(server_protocol, 0);
+
+    if (server_stream) {
+        while (web_stream_poll(server_stream, text, sizeof(text))) { handle_text(text); busy = 1; }
+        busy |= web_stream_flush(server_stream, 0);
+    }
+
+    return busy;
+}
@@ -0,0 +1,1336 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                   nibble-chess perft and search benchmark (native host)         ;
+;---------------------------------------------------------------------------------;
+;                                                                                 ;
+;   bench                      - perft suite to default depth + search benchmark  ;
+;   bench perft  [depth]       - perft suite, every position up to depth, on the  ;
+;                                0x88 and the bitboard backend                    ;
+;   bench divide depth fen     - per-move node counts for a single position       ;
+;   bench search [depth] [kb]  - fixed depth search_position NPS benchmark, with   ;
+;                                and without a kb sized transposition table       ;
+;   bench movetime [ms]        - iterative deepening, depth reached per position  ;
+;   bench depth [depth]        - iterative deepening time to depth, quiescence    ;
+;                                share and the work of each SEARCH_xxx feature    ;
+;   bench multipv [depth] [lines] - MultiPV nodes and time against a single PV    ;
+;                                search to the same depth                         ;
+;   bench task [ms]            - search thread: cancel latency, queued requests   ;
+;   bench ponder [ms]          - depth reached after pondering on the reply       ;
+;   bench smp [depth] [threads] - Lazy SMP time to depth, 1 to 16 threads         ;
+;   bench games [depth] [workers] [games] - independent fixed depth searches of   ;
+;                                many games on a pool of 1, 2, 4... workers       ;
+;   bench stats [ms]           - the "stats <hex>" records of a search task on    ;
+;                                the search positions, SEARCH_STATS builds only   ;
+;   bench book file [probes]   - opening book lookup time, random walks from the  ;
+;                                start position until out of book                 ;
+;   bench protocol [rounds]    - binary protocol over the in-process loopback at  ;
+;                                MTU 23 and 185: snapshot round trips, a game,    ;
+;                                progress batching, errors and lost frames        ;
+;   bench endgame [depth]      - KQK, KRK and KPK games played out at a fixed     ;
+;                                depth: moves to mate, nodes and time; compare a  ;
+;                                -D SEARCH_BITBASES=0 build; drawn KPK positions  ;
+;                                must score 0 with a legal move at depths 1-10    ;
+;   bench sensor [games]       - sensor board move inference on random games     ;
+;                                played by simulated hands, jitter and bounce,    ;
+;                                latency from the last piece placed               ;
+;   bench resume [plies]       - games against random moves saved to a resume     ;
+;                                file: save and load times, a torn write, the     ;
+;                                table restored, the flash wear and a castled game;
+;   bench web [moves]          - a WebSocket client on the loopback interface     ;
+;                                plays random moves: handshake, info frame rate   ;
+;                                and coalescing, move latency, errors             ;
+;                                                                                 ;
+;   Exits with status 1 if any perft count differs from the published value.      ;
+;                                                                                 ;
+\*********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "bitbase.h"
+#include "board.h"
+#include "book.h"
+#include "chess.h"
+#include "game_server.h"
+#include "protocol.h"
+#include "resume.h"
+#include "search_task.h"
+#include "sensor_board.h"
+#include "smp.h"
+#include "stats.h"
+#include "tt.h"
+#include "web_stream.h"
+
+typedef struct { const char *name, *fen; unsigned long long nodes[8]; int default_depth; } Perft_Position_Structure;
+
+// published node counts by depth (0 - not published, reported unchecked), https://www.chessprogramming.org/Perft_Results
+static const Perft_Position_Structure perft_positions[] = {
+    { "startpos", "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -",
+      { 1, 20, 400, 8902, 197281, 4865609, 119060324 }, 4 },
+    { "kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -",
+      { 1, 48, 2039, 97862, 4085603, 193690690 }, 3 },
+    { "position 3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -",
+      { 1, 14, 191, 2812, 43238, 674624, 11030083 }, 5 },
+    { "position 4", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq -",
+      { 1, 6, 264, 9467, 422333, 15833292 }, 4 },
+    { "position 5", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ -",
+      { 1, 44, 1486, 62379, 2103487, 89941194 }, 3 },
+    { "position 6", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - -",
+      { 1, 46, 2079, 89890, 3894594, 164075551 }, 3 },
+
+    // en passant, castling and promotion edge cases
+    { "illegal ep move #1", "3k4/3p4/8/K1P4r/8/8/8/8 b - -", { 1, 0, 0, 0, 0, 0, 1134888 }, 6 },
+    { "illegal ep move #2", "8/8/4k3/8/2p5/8/B2P2K1/8 w - -", { 1, 0, 0, 0, 0, 0, 1015133 }, 6 },
+    { "ep capture checks", "8/8/1k6/2b5/2pP4/8/5K2/8 b - d3", { 1, 0, 0, 0, 0, 0, 1440467 }, 6 },
+    { "short castling check", "5k2/8/8/8/8/8/8/4K2R w K -", { 1, 0, 0, 0, 0, 0, 661072 }, 6 },
+    { "long castling check", "3k4/8/8/8/8/8/8/R3K3 w Q -", { 1, 0, 0, 0, 0, 0, 803711 }, 6 },
+    { "castle rights", "r3k2r/1b4bq/8/8/8/8/7B/R3K2R w KQkq -", { 1, 0, 0, 0, 1274206 }, 4 },
+    { "castling prevented", "r3k2r/8/3Q4/8/8/5q2/8/R3K2R b KQkq -", { 1, 0, 0, 0, 1720476 }, 4 },
+    { "promote out of check", "2K2r2/4P3/8/8/8/8/8/3k4 w - -", { 1, 0, 0, 0, 0, 0, 3821001 }, 6 },
+    { "discovered check", "8/8/1P2K3/8/2n5/1q6/8/5k2 b - -", { 1, 0, 0, 0, 0, 1004658 }, 5 },
+    { "promote to give check", "4k3/1P6/8/8/8/8/K7/8 w - -", { 1, 0, 0, 0, 0, 0, 217342 }, 6 },
+    { "underpromote to check", "8/P1k5/K7/8/8/8/8/8 w - -", { 1, 0, 0, 0, 0, 0, 92683 }, 6 },
+    { "self stalemate", "K1k5/8/P7/8/8/8/8/8 w - -", { 1, 0, 0, 0, 0, 0, 2217 }, 6 },
+    { "stalemate and mate", "8/k1P5/8/1K6/8/8/8/8 w - -", { 1, 0, 0, 0, 0, 0, 0, 567584 }, 7 },
+    { "double check", "8/8/2k5/5q2/5n2/8/5K2/8 b - -", { 1, 0, 0, 0, 23527 }, 4 },
+};
+
+// search benchmark, middlegame and endgame positions
+static const char *search_positions[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - -",
+    "r1bqkb1r/pppp1ppp/2n2n2/4p2Q/2B1P3/8/PPPP1PPP/RNB1K1NR w KQkq -",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -",
+    "6k1/5ppp/8/8/8/8/5PPP/3R2K1 w - -",
+};
+
+static Engine_Structure bench_engine;  // perft and single threaded searches
+static TT_Structure bench_tt;
+static Smp_Helper_Structure bench_helpers[SMP_MAX_THREADS - 1];
+
+static double elapsed_seconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static int set_bench_position(const char *fen)  // 0 on bad FEN
+{
+    Position_Structure position;
+
+    if (!load_fen(&position, fen)) return 0;
+    set_position(&bench_engine, &position);
+
+    return 1;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                      PERFT                                      ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static unsigned long long perft(int side, int en_passant, int depth)
+{
+    Move_List_Structure move_list[1]; unsigned long long nodes = 0;
+
+    if (!generate_moves(&bench_engine, side, en_passant, move_list, ALL_MOVES)) return 0;  // king en prise, previous move was illegal
+    if (!depth) { release_moves(&bench_engine, move_list); return 1; }
+
+    for(int i = 0; i < move_list->length; i++) {
+        Move move = move_list->moves[i].move;
+
+        make_move(&bench_engine, side, move);
+        nodes += perft(24 - side, MOVE_SKIP_SQUARE(move), depth - 1);
+        unmake_move(&bench_engine, side, move);
+    }
+
+    release_moves(&bench_engine, move_list);
+    return nodes;
+}
+
+static Board_0x88_Structure board_0x88;
+static Board_Bitboard_Structure board_bitboard;
+
+template <typename Board> static unsigned long long timed_perft(Board *board, int depth, double *seconds)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    unsigned long long nodes = perft(board, depth);
+
+    *seconds = elapsed_seconds(start);
+    return nodes;
+}
+
+static int perft_suite(int max_depth)  // both board backends, * marks Board_Structure
+{
+    int failures = 0, count = sizeof(perft_positions) / sizeof(perft_positions[0]);
+    unsigned long long total_nodes = 0; double total_time[2] = { 0, 0 };
+
+    printf("%-22s %5s %12s %12s %10s %12s %10s %12s\n", "position", "depth", "nodes", "expected", BOARD_BITBOARD ? "0x88 s" : "0x88* s", "nodes/sec",
+           BOARD_BITBOARD ? "bitboard* s" : "bitboard s", "nodes/sec");
+
+    for(int p = 0; p < count; p++) {
+        const Perft_Position_Structure *position = &perft_positions[p];
+        int depth_limit = max_depth ? max_depth : position->default_depth;
+
+        if (!board_load(&board_0x88, position->fen) || !board_load(&board_bitboard, position->fen)) { printf("%-22s bad FEN\n", position->name); failures++; continue; }
+
+        for(int depth = 1; depth <= depth_limit && depth < 8; depth++) {
+            double seconds[2]; unsigned long long nodes = timed_perft(&board_0x88, depth, &seconds[0]), bitboard_nodes = timed_perft(&board_bitboard, depth, &seconds[1]);
+            int mismatch = (position->nodes[depth] && nodes != position->nodes[depth]) || bitboard_nodes != nodes;
+
+            total_nodes += nodes; total_time[0] += seconds[0]; total_time[1] += seconds[1]; failures += mismatch;
+
+            printf("%-22s %5d %12llu %12llu %10.3f %12.0f %10.3f %12.0f%s\n", position->name, depth, nodes, position->nodes[depth],
+                   seconds[0], seconds[0] > 0 ? nodes / seconds[0] : 0, seconds[1], seconds[1] > 0 ? nodes / seconds[1] : 0, mismatch ? "  MISMATCH" : "");
+            if (bitboard_nodes != nodes) printf("%-22s %5d bitboard %llu\n", position->name, depth, bitboard_nodes);
+        }
+    }
+
+    printf("\nperft: %llu nodes, 0x88 %.3f s %.0f nodes/sec, bitboard %.3f s %.0f nodes/sec, %d mismatches\n\n", total_nodes,
+           total_time[0], total_time[0] > 0 ? total_nodes / total_time[0] : 0, total_time[1], total_time[1] > 0 ? total_nodes / total_time[1] : 0, failures);
+
+    return failures;
+}
+
+static int divide(int depth, const char *fen)
+{
+    Move_List_Structure move_list[1]; int side, en_passant; unsigned long long total_nodes = 0; char move_string[6];
+
+    if (!set_bench_position(fen)) { printf("bad FEN\n"); return 1; }
+    side = bench_engine.position.side; en_passant = bench_engine.position.en_passant;
+    if (!generate_moves(&bench_engine, side, en_passant, move_list, ALL_MOVES) || depth < 1) { printf("illegal position or depth\n"); return 1; }
+
+    for(int i = 0; i < move_list->length; i++) {
+        Move move = move_list->moves[i].move;
+
+        make_move(&bench_engine, side, move);
+        unsigned long long nodes = perft(24 - side, MOVE_SKIP_SQUARE(move), depth - 1);
+        unmake_move(&bench_engine, side, move);
+
+        if (!nodes) continue;  // illegal move
+        move_to_string(move, move_string);
+        printf("%s: %llu\n", move_string, nodes);
+        total_nodes += nodes;
+    }
+
+    release_moves(&bench_engine, move_list);
+    printf("\nnodes: %llu\n", total_nodes);
+    return 0;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                      SEARCH                                     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static int timed_search(const char *fen, int depth, Search_Info_Structure *search_info, double *seconds)
+{
+    memset(search_info, 0, sizeof(*search_info));
+    set_bench_position(fen);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int score = search_position(&bench_engine, bench_engine.position.side, bench_engine.position.en_passant, -10000, 10000, depth, search_info);
+    *seconds = elapsed_seconds(start);
+
+    return score;
+}
+
+static void search_benchmark(int depth, size_t tt_size)
+{
+    int count = sizeof(search_positions) / sizeof(search_positions[0]);
+    unsigned long long total_nodes = 0, total_plain_nodes = 0, total_probes = 0, total_hits = 0, total_cutoffs = 0, total_first_cutoffs = 0; double total_time = 0, seconds;
+    long stack_peak = 0;
+    char move_string[6];
+
+    printf("%-5s %6s %6s %12s %12s %7s %7s %7s %10s %12s %8s  %s\n", "pos", "depth", "move", "nodes", "no TT", "saved", "TT hit",
+           "1st cut", "seconds", "nodes/sec", "stack", "score");
+
+    for(int p = 0; p < count; p++) {
+        Search_Info_Structure search_info[1];
+
+        tt_init(&bench_tt, 0);  // reference run without transposition table
+        timed_search(search_positions[p], depth, search_info, &seconds);
+        unsigned long long plain_nodes = search_info->nodes;
+
+        tt_init(&bench_tt, tt_size);
+        int score = timed_search(search_positions[p], depth, search_info, &seconds);
+
+        total_nodes += search_info->nodes; total_plain_nodes += plain_nodes; total_time += seconds;
+        total_probes += search_info->tt_probes; total_hits += search_info->tt_hits;
+        total_cutoffs += search_info->beta_cutoffs; total_first_cutoffs += search_info->first_move_cutoffs;
+        if (search_info->stack_peak > stack_peak) stack_peak = search_info->stack_peak;
+        move_to_string(search_info->best_move, move_string);
+
+        printf("%-5d %6d %6s %12llu %12llu %6.1f%% %6.1f%% %6.1f%% %10.3f %12.0f %8ld  %d\n", p + 1, depth, move_string, search_info->nodes, plain_nodes,
+               100.0 - 100.0 * search_info->nodes / plain_nodes, search_info->tt_probes ? 100.0 * search_info->tt_hits / search_info->tt_probes : 0,
+               search_info->beta_cutoffs ? 100.0 * search_info->first_move_cutoffs / search_info->beta_cutoffs : 0,
+               seconds, seconds > 0 ? search_info->nodes / seconds : 0, search_info->stack_peak, score);
+    }
+
+    printf("\nsearch: %llu nodes in %.3f s, %.0f nodes/sec, TT %zu KB: %.1f%% hit rate, %.1f%% fewer nodes, peak stack %ld bytes\n",
+           total_nodes, total_time, total_time > 0 ? total_nodes / total_time : 0, tt_size / 1024,
+           total_probes ? 100.0 * total_hits / total_probes : 0, 100.0 - 100.0 * total_nodes / total_plain_nodes, stack_peak);
+    printf("move ordering: %.1f%% of %llu beta cutoffs on the first move\n\n", total_cutoffs ? 100.0 * total_first_cutoffs / total_cutoffs : 0, total_cutoffs);
+}
+
+static void depth_benchmark(int depth)  // iterative deepening time to depth, compare builds with -D SEARCH_xxx=0
+{
+    int count = sizeof(search_positions) / sizeof(search_positions[0]);
+    unsigned long long total_nodes = 0, total_qnodes = 0; double total_time = 0; char move_string[6];
+
+    printf("PVS %d, null move %d, LMR %d, check extension %d, SEE pruning %d, delta pruning %d, %d KB table\n\n", SEARCH_PVS, SEARCH_NULL_MOVE, SEARCH_LMR,
+           SEARCH_CHECK_EXTENSION, SEARCH_SEE_PRUNING, SEARCH_DELTA_PRUNING, TT_SIZE_KB);
+    printf("%-5s %6s %12s %10s %7s %9s %9s %9s %9s %9s %9s %10s  %s\n", "pos", "move", "nodes", "seconds", "qnodes", "null cuts", "reduced", "re-search",
+           "extended", "SEE cuts", "delta", "nodes/sec", "score");
+
+    tt_init(&bench_tt, (size_t)TT_SIZE_KB * 1024);
+
+    for(int p = 0; p < count; p++) {
+        Search_Info_Structure search_info[1]; Search_Limits_Structure limits[1] = {};
+
+        memset(search_info, 0, sizeof(*search_info)); limits->depth = depth;
+        tt_clear(&bench_tt); memset(bench_engine.history_table, 0, sizeof(bench_engine.history_table));
+        set_bench_position(search_positions[p]);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        int score = search_iterative(&bench_engine, limits, search_info);
+        double seconds = elapsed_seconds(start);
+
+        total_nodes += search_info->nodes; total_qnodes += search_info->qnodes; total_time += seconds;
+        move_to_string(search_info->best_move, move_string);
+
+        printf("%-5d %6s %12llu %10.3f %6.1f%% %9llu %9llu %9llu %9llu %9llu %9llu %10.0f  %d\n", p + 1, move_string, search_info->nodes, seconds,
+               100.0 * search_info->qnodes / search_info->nodes, search_info->null_move_cutoffs, search_info->reductions, search_info->re_searches,
+               search_info->check_extensions, search_info->see_pruned, search_info->delta_pruned, seconds > 0 ? search_info->nodes / seconds : 0, score);
+    }
+
+    printf("\ndepth %d: %llu nodes in %.3f s, %.0f nodes/sec, %.1f%% in quiescence\n\n", depth, total_nodes, total_time,
+           total_time > 0 ? total_nodes / total_time : 0, total_nodes ? 100.0 * total_qnodes / total_nodes : 0);
+}
+
+static void movetime_benchmark(int movetime)  // iterative deepening under a time budget
+{
+    int count = sizeof(search_positions) / sizeof(search_positions[0]);
+    unsigned long long total_nodes = 0; unsigned long total_time = 0, worst_time = 0;
+    char move_string[6];
+
+    printf("%-5s %6s %6s %12s %10s %12s  %s\n", "pos", "depth", "move", "nodes", "ms", "nodes/sec", "score");
+
+    for(int p = 0; p < count; p++) {
+        Search_Info_Structure search_info[1]; Search_Limits_Structure limits[1] = {};
+
+        memset(search_info, 0, sizeof(*search_info));
+        set_bench_position(search_positions[p]);
+        tt_clear(&bench_tt);
+
+        limits->movetime = movetime;
+        int score = search_iterative(&bench_engine, limits, search_info);
+        unsigned long time = time_ms() - search_info->start_time;
+
+        total_nodes += search_info->nodes; total_time += time;
+        if (time > worst_time) worst_time = time;
+        move_to_string(search_info->best_move, move_string);
+
+        printf("%-5d %6d %6s %12llu %10lu %12.0f  %d\n", p + 1, search_info->completed_depth, move_string, search_info->nodes, time,
+               time ? search_info->nodes * 1000.0 / time : 0, score);
+    }
+
+    printf("\nmovetime %d ms: %llu nodes in %lu ms, %.0f nodes/sec, longest move %lu ms\n\n", movetime, total_nodes, total_time,
+           total_time ? total_nodes * 1000.0 / total_time : 0, worst_time);
+}
+
+static int wait_for_final_result(int id, Search_Result_Structure *result)  // drains progress, 0 on timeout
+{
+    unsigned long start = time_ms();
+
+    while (time_ms() - start < 30000) {
+        if (!search_task_poll(result)) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); continue; }
+        if (result->final && result->id == id) return 1;
+    }
+
+    return 0;
+}
+
+static int stats_benchmark(int movetime)  // the lines loop() prints to Serial in an instrumented build, for the stats-csv decoder
+{
+    Search_Request_Structure request[1] = {}; Search_Result_Structure result[1]; unsigned char record[STATS_RECORD_SIZE];
+    int count = sizeof(search_positions) / sizeof(search_positions[0]);
+
+    if (!SEARCH_STATS) { fprintf(stderr, "built without SEARCH_STATS, use env:bench-stats\n"); return 1; }
+    search_task_start(1);
+
+    for(int p = 0; p < count; p++) {
+        request->id = p + 1; strcpy(request->fen, search_positions[p]); request->new_game = 1;
+        request->limits.movetime = movetime;
+        search_task_submit(request);
+
+        if (!wait_for_final_result(request->id, result)) return 1;
+
+        while (search_task_poll_stats(record)) {
+            printf("stats ");
+            for(int i = 0; i < STATS_RECORD_SIZE; i++) printf("%02x", record[i]);
+            printf("\n");
+        }
+    }
+
+    search_task_stop();
+    return 0;
+}
+
+static int task_benchmark(int movetime)  // search task: cancel latency and a search running next to the caller
+{
+    Search_Request_Structure request[1] = {}; Search_Result_Structure result[1];
+    unsigned long latency = 0, worst_latency = 0; int rounds = 10, failures = 0;
+
+    search_task_start(1);
+
+    for(int round = 0; round < rounds; round++) { // long search, cancelled by the next request
+        request->id = 2 * round + 1; strcpy(request->fen, search_positions[round % 2]); request->moves[0] = 0;
+        request->limits = (Search_Limits_Structure){}; request->limits.movetime = 60000;
+        search_task_submit(request);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50 + 17 * round));
+
+        request->id++; request->fen[0] = 0; strcpy(request->moves, "e2e4 e7e5 g1f3");
+        request->limits.movetime = movetime;
+        unsigned long submit_time = time_ms();
+        search_task_submit(request);
+
+        if (!wait_for_final_result(request->id - 1, result) || !result->stopped) failures++;
+        latency = time_ms() - submit_time;
+        if (latency > worst_latency) worst_latency = latency;
+
+        if (!wait_for_final_result(request->id, result) || result->stopped || !result->best_move) failures++;
+        printf("round %2d: cancelled in %3lu ms, then depth %2d %s in %4lu ms\n", round + 1, latency, result->depth, result->move_string, result->time);
+    }
+
+    request->id = 1000; strcpy(request->moves, "e2e4 e7e4");  // illegal move
+    search_task_submit(request);
+    if (!wait_for_final_result(1000, result) || !result->stopped) failures++;
+
+    search_task_stop();
+    printf("\nsearch task: %d rounds, worst cancel latency %lu ms, %d failures\n\n", rounds, worst_latency, failures);
+
+    return failures;
+}
+
+static int ponder_benchmark(int movetime)  // depth reached with movetime, with and without pondering movetime on the expected reply
+{
+    int count = sizeof(search_positions) / sizeof(search_positions[0]), id = 0, total_plain = 0, total_ponder = 0, positions = 0;
+    Search_Request_Structure request[1] = {}; Search_Result_Structure result[1];
+    char expected_reply[6];
+
+    search_task_start(1);
+    printf("%-5s %6s %6s %12s %12s\n", "pos", "reply", "move", "plain depth", "ponder depth");
+
+    for(int p = 0; p < count; p++) {
+        memset(request, 0, sizeof(*request)); strcpy(request->fen, search_positions[p]);
+        request->limits.movetime = movetime; request->id = ++id;
+        search_task_submit(request);
+        if (!wait_for_final_result(id, result) || !result->ponder_move) continue;  // nothing to ponder on, e.g. mate
+
+        strcpy(expected_reply, result->ponder_string);
+        snprintf(request->moves, sizeof(request->moves), "%s %s", result->move_string, expected_reply);
+
+        request->id = ++id; request->new_game = 1;  // engine's next move searched the usual way
+        search_task_submit(request);
+        wait_for_final_result(id, result);
+        int plain_depth = result->depth;
+
+        request->id = ++id; request->ponder = 1;  // the same after pondering while the player thinks for movetime
+        search_task_submit(request);
+        std::this_thread::sleep_for(std::chrono::milliseconds(movetime));
+        search_task_ponder_hit(id);
+        wait_for_final_result(id, result);
+
+        printf("%-5d %6s %6s %12d %12d\n", p + 1, expected_reply, result->move_string, plain_depth, result->depth);
+        total_plain += plain_depth; total_ponder += result->depth; positions++;
+    }
+
+    search_task_stop();
+    printf("\nponder %d ms: average depth %.2f without, %.2f with pondering\n\n", movetime, positions ? (double)total_plain / positions : 0,
+           positions ? (double)total_ponder / positions : 0);
+
+    return 0;
+}
+
+static void smp_benchmark(int depth, int max_threads)  // Lazy SMP time to depth, 1, 2, 4... threads
+{
+    int count = sizeof(search_positions) / sizeof(search_positions[0]);
+    double base_time = 0;
+
+    printf("%-8s %12s %10s %12s %8s\n", "threads", "nodes", "seconds", "nodes/sec", "speedup");
+
+    for(int threads = 1; threads <= max_threads; threads *= 2) {
+        unsigned long long nodes = 0; double time = 0;
+
+        for(int p = 0; p < count; p++) {
+            Search_Info_Structure search_info[1]; Search_Limits_Structure limits[1] = {};
+
+            memset(search_info, 0, sizeof(*search_info));
+            set_bench_position(search_positions[p]);
+            tt_clear(&bench_tt); memset(bench_engine.history_table, 0, sizeof(bench_engine.history_table));
+
+            limits->depth = depth;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            search_parallel(&bench_engine, bench_helpers, threads - 1, limits, search_info);
+            time += elapsed_seconds(start); nodes += search_info->nodes;
+        }
+
+        if (threads == 1) base_time = time;
+        printf("%-8d %12llu %10.3f %12.0f %7.2fx\n", threads, nodes, time, time > 0 ? nodes / time : 0, time > 0 ? base_time / time : 0);
+    }
+
+    printf("\nLazy SMP: depth %d, %u hardware threads\n\n", depth, std::thread::hardware_concurrency());
+}
+
+static void multipv_benchmark(int depth, int lines)  // cost of MultiPV against a single PV iterative deepening to the same depth
+{
+    int count = sizeof(search_positions) / sizeof(search_positions[0]);
+    unsigned long long total_nodes[2] = { 0, 0 }; double total_time[2] = { 0, 0 };
+
+    printf("%-5s %12s %10s %12s %10s %7s  %s\n", "pos", "1 PV nodes", "seconds", "MultiPV", "seconds", "nodes", "lines");
+    tt_init(&bench_tt, (size_t)TT_SIZE_KB * 1024);
+
+    for(int p = 0; p < count; p++) {
+        Search_Info_Structure search_info[2]; Search_Limits_Structure limits[1] = {}; double seconds[2];
+
+        for(int i = 0; i < 2; i++) { // the same start for both: empty table and history
+            memset(&search_info[i], 0, sizeof(search_info[i])); limits->depth = depth; limits->multi_pv = i ? lines : 0;
+            tt_clear(&bench_tt); memset(bench_engine.history_table, 0, sizeof(bench_engine.history_table));
+            set_bench_position(search_positions[p]);
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            search_iterative(&bench_engine, limits, &search_info[i]);
+            seconds[i] = elapsed_seconds(start);
+            total_nodes[i] += search_info[i].nodes; total_time[i] += seconds[i];
+        }
+
+        printf("%-5d %12llu %10.3f %12llu %10.3f %6.2fx ", p + 1, search_info[0].nodes, seconds[0], search_info[1].nodes, seconds[1],
+               (double)search_info[1].nodes / search_info[0].nodes);
+
+        for(int i = 0; i < search_info[1].line_count; i++) { // best move and score of each line
+            char move_string[6]; move_to_string(search_info[1].lines[i].moves[0], move_string);
+            printf(" %s %d", move_string, search_info[1].lines[i].score);
+        }
+        printf("\n");
+    }
+
+    printf("\ndepth %d, %d lines: %llu nodes in %.3f s against %llu nodes in %.3f s for one PV, %.2fx the nodes, %.2fx the time\n\n", depth, lines,
+           total_nodes[1], total_time[1], total_nodes[0], total_time[0], (double)total_nodes[1] / total_nodes[0], total_time[0] > 0 ? total_time[1] / total_time[0] : 0);
+}
+
+// endgames the search alone plays slowly or not at all, the strong side first
+static const char *endgame_positions[] = {
+    "8/8/8/4k3/8/8/8/1Q2K3 w - -",  // KQK
+    "8/8/3k4/8/8/8/8/1Q5K w - -",
+    "8/8/8/4k3/8/8/8/R3K3 w - -",  // KRK
+    "8/8/8/3k4/8/8/8/6RK w - -",
+    "r3k3/8/8/8/3K4/8/8/8 b - -",
+    "8/8/8/8/2k5/8/5P2/6K1 w - -",  // KPK
+    "4k3/8/4K3/4P3/8/8/8/8 b - -",
+    "8/8/2k5/2p5/8/8/8/5K2 b - -",
+};
+
+// drawn KPK positions where a king move next to the lone king looks like a draw to a careless probe
+static const char *endgame_draws[] = {
+    "8/7k/5K2/7P/8/8/8/8 w - -",
+    "8/8/8/8/7p/5k2/7K/8 b - -",
+    "8/4k3/8/4K3/4P3/8/8/8 w - -",
+    "8/8/8/8/8/1k6/p7/K7 b - -",
+};
+
+#define ENDGAME_PLIES 200
+
+static int endgame_draw_check(const char *fen, int depth)  // 1 if the search plays a legal move and scores the draw
+{
+    Search_Info_Structure search_info[1] = {}; Search_Limits_Structure limits[1] = {}; Move moves[MAX_MOVES];
+    int count, legal = 0;
+
+    tt_clear(&bench_tt); set_bench_position(fen);
+    count = generate_legal_moves(&bench_engine, moves);
+
+    limits->depth = depth;
+    search_iterative(&bench_engine, limits, search_info);
+    for(int i = 0; i < count; i++) legal |= moves[i] == search_info->best_move;
+
+    return legal && !search_info->best_score;
+}
+
+static int endgame_benchmark(int depth)  // games played out at a fixed depth, compare a -D SEARCH_BITBASES=0 build; drawn positions checked, failures
+{
+    int count = sizeof(endgame_positions) / sizeof(endgame_positions[0]), total_moves = 0, failures = 0;
+    unsigned long long total_nodes = 0; double total_time = 0;
+
+    printf("bitbases %d, depth %d\n\n%-40s %-20s %6s %12s %10s\n", SEARCH_BITBASES, depth, "position", "result", "moves", "nodes", "seconds");
+    tt_init(&bench_tt, (size_t)TT_SIZE_KB * 1024);
+
+    for(int p = 0; p < count; p++) {
+        unsigned long long nodes = 0; double seconds = 0; int plies = 0; char result[32] = "no mate";
+        Move moves[MAX_MOVES];
+
+        tt_clear(&bench_tt); memset(bench_engine.history_table, 0, sizeof(bench_engine.history_table));
+        set_bench_position(endgame_positions[p]);
+
+        for(; plies < ENDGAME_PLIES; plies++) {
+            Search_Info_Structure search_info[1]; Search_Limits_Structure limits[1] = {};
+
+            if (!generate_legal_moves(&bench_engine, moves)) { strcpy(result, in_check(&bench_engine.position, bench_engine.position.side) ? "mate" : "stalemate"); break; }
+            if (bitbase_pieces(&bench_engine.position) < 3) { strcpy(result, "piece lost"); break; }
+
+            memset(search_info, 0, sizeof(*search_info)); limits->depth = depth;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            search_iterative(&bench_engine, limits, search_info);
+            seconds += elapsed_seconds(start); nodes += search_info->nodes;
+
+            if (!search_info->best_move) break;
+            play_move(&bench_engine, search_info->best_move);
+        }
+
+        total_moves += (plies + 1) / 2; total_nodes += nodes; total_time += seconds;
+        printf("%-40s %-20s %6d %12llu %10.3f\n", endgame_positions[p], result, (plies + 1) / 2, nodes, seconds);
+    }
+
+    printf("\nendgames: %d moves, %llu nodes, %.3f s\n\n", total_moves, total_nodes, total_time);
+
+    for(int p = 0; p < (int)(sizeof(endgame_draws) / sizeof(endgame_draws[0])); p++) {
+        static const int depths[] = { 1, 3, 6, 10 }; char result[32] = "draw";
+
+        for(int d = 0; d < 4; d++) if (!endgame_draw_check(endgame_draws[p], depths[d])) { snprintf(result, sizeof(result), "FAILED at depth %d", depths[d]); failures++; break; }
+        printf("%-40s %s\n", endgame_draws[p], result);
+    }
+
+    printf("\nendgame draws: %d failures\n\n", failures);
+
+    return failures;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                   THROUGHPUT                                    ;
+;---------------------------------------------------------------------------------;
+;   Many games held as plain positions, searched by a pool of workers that each   ;
+;   own an engine and a table; a game borrows whichever worker is free. Every     ;
+;   search starts from a cleared table and history, so the results must not      ;
+;   depend on the number of workers.                                              ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#define GAMES_TT_KB 1024  // per worker
+
+typedef struct { Position_Structure position; int score; Move best_move; unsigned long long nodes; } Bench_Game_Structure;
+
+typedef struct {
+    Bench_Game_Structure *games; int game_count, depth;
+    std::atomic<int> next_game;  // work queue: index of the next game to search
+} Game_Pool_Structure;
+
+static int random_legal_move(Engine_Structure *engine, unsigned int *seed, Move *move)  // 0 if mated or stalemated
+{
+    Move_List_Structure move_list[1], replies[1]; Move legal_moves[256]; int side = engine->position.side, count = 0;
+
+    generate_moves(engine, side, engine->position.en_passant, move_list, ALL_MOVES);
+
+    for(int i = 0; i < move_list->length && count < 256; i++) {
+        make_move(engine, side, move_list->moves[i].move);
+        if (generate_moves(engine, 24 - side, MOVE_SKIP_SQUARE(move_list->moves[i].move), replies, ALL_MOVES)) legal_moves[count++] = move_list->moves[i].move;
+        release_moves(engine, replies);
+        unmake_move(engine, side, move_list->moves[i].move);
+    }
+
+    release_moves(engine, move_list);
+    if (!count) return 0;
+
+    *seed = *seed * 1103515245 + 12345;
+    *move = legal_moves[(*seed >> 16) % count];
+
+    return 1;
+}
+
+static void setup_games(Bench_Game_Structure *games, int game_count)  // the search positions after 0..11 random plies
+{
+    int count = sizeof(search_positions) / sizeof(search_positions[0]);
+
+    for(int g = 0; g < game_count; g++) {
+        unsigned int seed = g * 2654435761u + 1; Move move;
+
+        set_bench_position(search_positions[g % count]);
+        for(int ply = 0; ply < (g / count) % 12 && random_legal_move(&bench_engine, &seed, &move); ply++) play_move(&bench_engine, move);
+
+        memset(&games[g], 0, sizeof(games[g]));
+        games[g].position = bench_engine.position;
+    }
+}
+
+static void games_worker(Game_Pool_Structure *pool, Engine_Structure *engine)
+{
+    Search_Info_Structure search_info[1]; Search_Limits_Structure limits[1] = {}; int g;
+
+    limits->depth = pool->depth;
+
+    while ((g = pool->next_game++) < pool->game_count) {
+        Bench_Game_Structure *game = &pool->games[g];
+
+        memset(search_info, 0, sizeof(*search_info));
+        tt_clear(engine->tt); memset(engine->history_table, 0, sizeof(engine->history_table));
+        set_position(engine, &game->position);
+
+        game->score = search_iterative(engine, limits, search_info);
+        game->best_move = search_info->best_move; game->nodes = search_info->nodes;
+    }
+}
+
+static int games_benchmark(int depth, int max_workers, int game_count)  // games/sec on 1, 2, 4... workers, 1 if results differ between runs
+{
+    Bench_Game_Structure *games = (Bench_Game_Structure *)calloc(game_count, sizeof(Bench_Game_Structure));
+    Engine_Structure *engines = (Engine_Structure *)calloc(max_workers, sizeof(Engine_Structure));
+    TT_Structure *tables = (TT_Structure *)calloc(max_workers, sizeof(TT_Structure));
+    std::thread *threads = new std::thread[max_workers];
+    unsigned long long first_checksum = 0; double base_time = 0; int failures = 0;
+
+    if (!games || !engines || !tables) { printf("out of memory\n"); return 1; }
+
+    for(int i = 0; i < max_workers; i++) { tt_init(&tables[i], (size_t)GAMES_TT_KB * 1024); engines[i].tt = &tables[i]; }
+    setup_games(games, game_count);
+
+    printf("%d games of %zu bytes, depth %d, %d KB table per worker\n\n", game_count, sizeof(Position_Structure), depth, GAMES_TT_KB);
+    printf("%-8s %12s %10s %10s %12s %8s  %s\n", "workers", "nodes", "seconds", "games/sec", "nodes/sec", "speedup", "results");
+
+    for(int workers = 1; workers <= max_workers; workers *= 2) {
+        Game_Pool_Structure pool; unsigned long long nodes = 0, checksum = 0;
+
+        pool.games = games; pool.game_count = game_count; pool.depth = depth; pool.next_game = 0;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for(int i = 0; i < workers; i++) threads[i] = std::thread(games_worker, &pool, &engines[i]);
+        for(int i = 0; i < workers; i++) threads[i].join();
+        double time = elapsed_seconds(start);
+
+        for(int g = 0; g < game_count; g++) {
+            nodes += games[g].nodes;
+            checksum = (checksum ^ games[g].best_move ^ (unsigned long long)(games[g].score & 0xffff) << 32 ^ games[g].nodes) * 0x100000001b3ull;
+        }
+
+        if (workers == 1) { base_time = time; first_checksum = checksum; }
+        failures += checksum != first_checksum;
+
+        printf("%-8d %12llu %10.3f %10.0f %12.0f %7.2fx  %s\n", workers, nodes, time, time > 0 ? game_count / time : 0,
+               time > 0 ? nodes / time : 0, time > 0 ? base_time / time : 0, checksum == first_checksum ? "same" : "DIFFERENT");
+    }
+
+    printf("\ngames: %u hardware threads, %d runs with results different from 1 worker\n\n", std::thread::hardware_concurrency(), failures);
+
+    for(int i = 0; i < max_workers; i++) tt_init(&tables[i], 0);
+    delete[] threads; free(tables); free(engines); free(games);
+
+    return failures;
+}
+
+static int book_benchmark(const char *path, int probes)  // microseconds per lookup, hits along book lines and misses
+{
+    Book_Structure book; Position_Structure start; unsigned int seed = 1; int hits = 0, misses = 0, lines = 0, longest = 0;
+    double hit_time = 0, miss_time = 0;
+
+    if (!book_open(&book, path)) { printf("can't open book %s\n", path); return 1; }
+    load_fen(&start, START_POSITION);
+
+    while (hits + misses < probes) {
+        int plies = 0; Move move = 1;
+
+        set_position(&bench_engine, &start); lines++;
+
+        while (move && hits + misses < probes) {
+            seed = seed * 1103515245 + 12345;
+
+            std::chrono::steady_clock::time_point probe_start = std::chrono::steady_clock::now();
+            move = book_move(&book, &bench_engine, seed | 1);
+            double time = elapsed_seconds(probe_start);
+
+            if (move) { hits++; hit_time += time; plies++; play_move(&bench_engine, move); }
+            else { misses++; miss_time += time; }
+        }
+
+        if (plies > longest) longest = plies;
+    }
+
+    printf("book %s: %zu entries, %zu bytes mapped\n", path, book.count, book.count * BOOK_ENTRY_SIZE);
+    printf("%d lines, longest %d plies\n", lines, longest);
+    printf("hits   %8d  %8.2f us/lookup\n", hits, hits ? hit_time * 1e6 / hits : 0);
+    printf("misses %8d  %8.2f us/lookup\n", misses, misses ? miss_time * 1e6 / misses : 0);
+
+    book_close(&book);
+    return !hits;
+}
+
+static Protocol_Structure client_end, server_end;
+static Transport_Structure loopback[2];
+static std::atomic<int> server_running{0};
+static int (*loopback_send)(Transport_Structure *transport, const unsigned char *frame, int length);
+static int drop_frames = 0;  // client frames still to lose
+
+static int lossy_send(Transport_Structure *transport, const unsigned char *frame, int length)
+{
+    if (drop_frames) { drop_frames--; return 1; }  // lost on the air, the sender doesn't know
+    return loopback_send(transport, frame, length);
+}
+
+static void server_loop() { while (server_running.load()) if (!game_server_poll()) std::this_thread::sleep_for(std::chrono::microseconds(50)); }  // loop() with delay(1)
+
+static int wait_for_message(int type, Protocol_Message_Structure *message, int *progress_messages, int *progress_entries)  // skips other types, 0 after 30 s
+{
+    unsigned long start = time_ms();
+
+    while (time_ms() - start < 30000) {
+        if (!protocol_poll(&client_end, message)) { std::this_thread::yield(); continue; }
+        if (message->type == PROTOCOL_PROGRESS && progress_messages) { (*progress_messages)++; *progress_entries += message->payload[0]; }
+        if (message->type == type) return 1;
+    }
+
+    return 0;
+}
+
+static unsigned int move_code(const char *move_string) { return (move_string[0] - 'a') | (move_string[1] - '1') << 3 | ((move_string[2] - 'a') | (move_string[3] - '1') << 3) << 6; }  // protocol_encode_move() of "e2e4"
+
+// pseudo-legal player moves the server must refuse, white to move: a pinned bishop, check ignored, castling through an attacked square
+static const char *illegal_moves[][2] = {
+    { "4r1k1/8/8/8/8/8/4B3/4K3 w - -", "e2d3" },
+    { "4k3/8/8/8/8/8/4r3/R3K3 w - -", "a1a2" },
+    { "4kr2/8/8/8/8/8/8/R3K2R w KQ -", "e1g1" },
+};
+
+static int protocol_benchmark(int rounds)  // 1 on a protocol failure
+{
+    static const int mtus[] = { 23, 185 };
+    Protocol_Message_Structure message[1]; unsigned char payload[PROTOCOL_BOARD_SIZE]; int failures = 0; char fen[FEN_LENGTH];
+
+    set_bench_position("r3k2r/8/8/8/8/8/8/R3K2R w KQkq -"); load_moves(&bench_engine, "e1g1");  // the castling skip square isn't sent as e.p.
+    protocol_encode_board(&bench_engine.position, payload);
+    if (!protocol_decode_board(payload, fen) || !strstr(fen, " kq -")) { printf("snapshot after castling: %s\n", fen); failures++; }
+    set_bench_position("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -"); load_moves(&bench_engine, "e2e4");  // a double push still is
+    protocol_encode_board(&bench_engine.position, payload);
+    if (!protocol_decode_board(payload, fen) || !strstr(fen, " KQkq e3")) { printf("snapshot after a double push: %s\n", fen); failures++; }
+
+    search_task_start(1);
+
+    for(int m = 0; m < 2; m++) {
+        int frame_size = mtus[m] - 3, progress_messages = 0, progress_entries = 0, engine_moves = 0;
+        unsigned long frames_before = 0; double seconds = 0, worst = 0;
+        std::thread server;
+
+        loopback_connect(&client_end, &server_end, loopback, frame_size);
+        loopback_send = loopback[0].send; loopback[0].send = lossy_send;
+        game_server_start(&server_end);
+        server_running.store(1); server = std::thread(server_loop);
+
+        for(int round = 0; round < rounds; round++) { // snapshot round trip
+            frames_before = server_end.frames_sent;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+            protocol_send(&client_end, PROTOCOL_BOARD, NULL, 0);
+            if (!wait_for_message(PROTOCOL_BOARD, message, NULL, NULL) || message->length != PROTOCOL_BOARD_SIZE) { failures++; break; }
+
+            double time = elapsed_seconds(start);
+            seconds += time; if (time > worst) worst = time;
+        }
+
+        printf("MTU %3d: board snapshot %lu frames, round trip %.1f us average, %.1f us worst\n", mtus[m], server_end.frames_sent - frames_before,
+               seconds * 1e6 / rounds, worst * 1e6);
+
+        protocol_put_u32(payload, 3000); protocol_put_u32(payload + 4, 0);  // 3 s game, ~75 ms a move
+        protocol_send(&client_end, PROTOCOL_CLOCK, payload, 8);
+        if (!wait_for_message(PROTOCOL_CLOCK, message, NULL, NULL)) failures++;
+
+        payload[0] = 1; protocol_send(&client_end, PROTOCOL_NEW_GAME, payload, 1);  // engine plays black
+        if (!wait_for_message(PROTOCOL_BOARD, message, NULL, NULL)) failures++;
+
+        static const char *moves[] = { "e2e4", "g1f3", "f1c4", "b1c3", "d2d3" };
+        for(int i = 0; i < 5; i++) { // the engine's replies, a player move that isn't legal any more is reported
+            unsigned int move = move_code(moves[i]);
+
+            protocol_put_u16(payload, move); protocol_send(&client_end, PROTOCOL_MOVE, payload, 2);
+            if (!wait_for_message(PROTOCOL_ENGINE_MOVE, message, &progress_messages, &progress_entries)) {
+                if (message->type != PROTOCOL_ERROR) failures++;
+                continue;
+            }
+            engine_moves++;
+        }
+
+        protocol_put_u16(payload, 12 | 28 << 6); protocol_send(&client_end, PROTOCOL_MOVE, payload, 2);  // e2e4 again, e2 is empty
+        if (!wait_for_message(PROTOCOL_ERROR, message, NULL, NULL) || message->payload[0] != PROTOCOL_ILLEGAL_MOVE) failures++;
+
+        printf("         %d engine moves, %d iterations in %d progress messages\n", engine_moves, progress_entries, progress_messages);
+
+        payload[0] = 3; protocol_send(&client_end, PROTOCOL_HINT, payload, 1);  // top 3 moves for the player, fewer if fewer are legal
+        if (!wait_for_message(PROTOCOL_HINT, message, NULL, NULL) || message->length < 2 || !message->payload[1] || message->payload[1] > 3) failures++;
+        else {
+            int length = 2;
+            for(int i = 0; i < message->payload[1] && length + 3 <= message->length; i++) length += 3 + 2 * message->payload[length + 2];
+            if (length != message->length) failures++;
+            printf("         hint: depth %d, %d lines in %d bytes\n", message->payload[0], message->payload[1], message->length);
+        }
+
+        for(int i = 0; i < 3; i++) { // refused with an error, the player is still to move
+            set_bench_position(illegal_moves[i][0]); protocol_encode_board(&bench_engine.position, payload);
+            protocol_send(&client_end, PROTOCOL_BOARD, payload, PROTOCOL_BOARD_SIZE);
+            if (!wait_for_message(PROTOCOL_BOARD, message, NULL, NULL)) failures++;
+
+            protocol_put_u16(payload, move_code(illegal_moves[i][1])); protocol_send(&client_end, PROTOCOL_MOVE, payload, 2);
+            if (!wait_for_message(PROTOCOL_ERROR, message, NULL, NULL) || message->payload[0] != PROTOCOL_ILLEGAL_MOVE) { printf("         %s accepted\n", illegal_moves[i][1]); failures++; }
+        }
+        protocol_put_u16(payload, move_code("e1d1")); protocol_send(&client_end, PROTOCOL_MOVE, payload, 2);  // and the game goes on
+        if (!wait_for_message(PROTOCOL_ENGINE_MOVE, message, NULL, NULL)) failures++;
+
+        memset(payload, 0, sizeof(payload));  // a board the server would reject, its first frame lost
+        drop_frames = 1; protocol_send(&client_end, PROTOCOL_BOARD, payload, PROTOCOL_BOARD_SIZE);
+        protocol_send(&client_end, PROTOCOL_BOARD, NULL, 0);
+        if (!wait_for_message(PROTOCOL_BOARD, message, NULL, NULL) || message->length != PROTOCOL_BOARD_SIZE) failures++;
+
+        server_running.store(0); server.join();
+
+        printf("         %lu frame lost, %s, next message received\n\n", server_end.frames_lost,
+               frame_size < PROTOCOL_BOARD_SIZE + PROTOCOL_HEADER_SIZE ? "rest of the board skipped" : "whole board lost");
+        if (server_end.frames_lost != 1) failures++;
+    }
+
+    search_task_stop();
+    printf("protocol: %d failures\n", failures);
+
+    return failures;
+}
+
+#define SENSOR_POLL_MS 1
+
+typedef struct { unsigned long time; unsigned long long reading; } Sensor_Event_Structure;
+
+static unsigned int next_random(unsigned int *seed, unsigned int range) { *seed = *seed * 1103515245 + 12345; return (*seed >> 16) % range; }
+
+static int hand_events(unsigned long long reading, Move move, unsigned long time, unsigned int *seed, Sensor_Event_Structure *events)  // readings while a hand plays move, last is the piece placed
+{
+    unsigned long long from = 1ULL << ((7 - (MOVE_SOURCE(move) >> 4)) * 8 + (MOVE_SOURCE(move) & 7)), to = 1ULL << ((7 - (MOVE_TARGET(move) >> 4)) * 8 + (MOVE_TARGET(move) & 7));
+    unsigned long long steps[4][2]; int step_count = 0, count = 0;  // squares to lift, squares to place
+
+    if (MOVE_CAPTURE(move) && !(move & MOVE_EN_PASSANT)) { // victim or own piece first
+        if (next_random(seed, 2)) { steps[0][0] = to; steps[0][1] = 0; steps[1][0] = from; steps[1][1] = 0; }
+        else { steps[0][0] = from; steps[0][1] = 0; steps[1][0] = to; steps[1][1] = 0; }
+        steps[2][0] = 0; steps[2][1] = to; step_count = 3;
+    }
+    else {
+        steps[0][0] = from; steps[0][1] = 0; steps[1][0] = 0; steps[1][1] = to; step_count = 2;
+        if (move & MOVE_CASTLING) { // king first, then the rook
+            int rook = MOVE_ROOK_SQUARE(move), skip = MOVE_SKIP_SQUARE(move);
+            steps[2][0] = 1ULL << ((7 - (rook >> 4)) * 8 + (rook & 7)); steps[2][1] = 0;
+            steps[3][0] = 0; steps[3][1] = 1ULL << ((7 - (skip >> 4)) * 8 + (skip & 7)); step_count = 4;
+        }
+        if (move & MOVE_EN_PASSANT) { int victim = MOVE_CAPTURED_SQUARE(move); steps[2][0] = 1ULL << ((7 - (victim >> 4)) * 8 + (victim & 7)); steps[2][1] = 0; step_count = 3; }
+    }
+
+    for(int i = 0; i < step_count; i++) {
+        time += 150 + next_random(seed, 500);  // hand moving
+
+        if (steps[i][1]) { // contact bounce as the piece lands
+            for(int bounce = next_random(seed, 4); bounce > 0; bounce--) {
+                events[count].time = time; events[count++].reading = reading ^ steps[i][1];
+                time += 2 + next_random(seed, 14); events[count].time = time; events[count++].reading = reading;
+                time += 2 + next_random(seed, 14);
+            }
+            reading |= steps[i][1];
+        }
+        else reading &= ~steps[i][0];
+
+        events[count].time = time; events[count++].reading = reading;
+    }
+
+    return count;
+}
+
+static int sensor_benchmark(int games)  // 1 if a move was missed or misread
+{
+    static Sensor_Board_Structure board; Sensor_Event_Structure events[32];
+    unsigned int seed = 12345; int moves = 0, failures = 0, early = 0, kinds[4] = { 0, 0, 0, 0 };
+    unsigned long total_latency = 0, worst_latency = 0, updates = 0; double index_time = 0, update_time = 0, parse_time = 0;
+    int position_count = sizeof(perft_positions) / sizeof(perft_positions[0]);
+
+    for(int game = 0; game < games; game++) {
+        Move move, sensed; unsigned long time = 0;
+        unsigned long long reading;
+
+        set_bench_position(perft_positions[game % position_count].fen);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        sensor_board_set_position(&board, &bench_engine);
+        index_time += elapsed_seconds(start);
+        reading = board.position;
+
+        for(int ply = 0; ply < 60 && random_legal_move(&bench_engine, &seed, &move); ply++) {
+            char move_string[6]; int count, event = 0, result = SENSOR_NONE;
+
+            move_to_string(move, move_string);
+            start = std::chrono::steady_clock::now();
+            if (parse_move(&bench_engine, move_string) != move) failures++;  // what a string from the board would cost
+            parse_time += elapsed_seconds(start);
+
+            if (MOVE_PROMOTED(move)) board.promotion = MOVE_PROMOTED(move);  // chosen on the app
+            count = hand_events(reading, move, time, &seed, events);
+
+            for (; time < events[count - 1].time + 1000; time += SENSOR_POLL_MS) {
+                while (event < count && events[event].time <= time) reading = events[event++].reading;
+
+                start = std::chrono::steady_clock::now();
+                result = sensor_board_update(&board, reading, time, &sensed);
+                update_time += elapsed_seconds(start); updates++;
+
+                if (result == SENSOR_MOVE) break;
+            }
+
+            if (result != SENSOR_MOVE || sensed != move) { failures++; break; }
+            if (event < count) early++;
+
+            unsigned long latency = time - events[count - 1].time;
+            total_latency += latency; if (latency > worst_latency) worst_latency = latency;
+            moves++; kinds[(move & MOVE_CASTLING) ? 1 : (move & MOVE_EN_PASSANT) ? 2 : MOVE_PROMOTED(move) ? 3 : 0]++;
+
+            play_move(&bench_engine, move);
+            start = std::chrono::steady_clock::now();
+            sensor_board_set_position(&board, &bench_engine);
+            index_time += elapsed_seconds(start);
+        }
+    }
+
+    printf("sensor board: %d games, %d moves (%d castling, %d e.p., %d promotions), %d failures, %d accepted early\n", games, moves, kinds[1], kinds[2], kinds[3], failures, early);
+    printf("latency from the last piece placed: %.1f ms average, %lu ms worst (settle %d ms, poll %d ms)\n",
+           moves ? (double)total_latency / moves : 0, worst_latency, SENSOR_SETTLE_MS, SENSOR_POLL_MS);
+    printf("index %.2f us/position, update %.3f us/reading, parse_move %.2f us/move\n\n",
+           index_time * 1e6 / (moves + games), update_time * 1e6 / updates, parse_time * 1e6 / moves);
+
+    return failures + early;
+}
+
+#define RESUME_BENCH_FILE "/tmp/nibble-resume.bin"
+#define RESUME_BENCH_PLIES 24  // a new game after that many, before the random side is mated
+
+static void new_resume_game(Resume_Structure *resume)  // engine black from the start position, 5 min + 3 s
+{
+    set_bench_position(START_POSITION);
+    protocol_encode_board(&bench_engine.position, resume->game.start); resume->game.move_count = 0; resume->game.engine_side = 16;
+    resume->game.clock_base = resume->game.clock_left[0] = resume->game.clock_left[1] = 300000; resume->game.clock_increment = 3000;
+    resume->game.clock_running = 8;
+    resume_save_game(resume);
+}
+
+static int same_game(Resume_Game_Structure *a, Resume_Game_Structure *b)
+{
+    return a->move_count == b->move_count && !memcmp(a->moves, b->moves, a->move_count * sizeof(a->moves[0])) && !memcmp(a->start, b->start, PROTOCOL_BOARD_SIZE) &&
+           a->engine_side == b->engine_side && a->clock_left[0] == b->clock_left[0] && a->clock_left[1] == b->clock_left[1] && a->clock_running == b->clock_running;
+}
+
+static int replay_game(Resume_Game_Structure *game)  // as game_server_resume() does, 0 on a move that isn't legal
+{
+    Position_Structure position; char fen[FEN_LENGTH]; Move move;
+
+    if (!protocol_decode_board(game->start, fen) || !load_fen(&position, fen)) return 0;
+    set_position(&bench_engine, &position);
+
+    for(int i = 0; i < game->move_count; i++) {
+        if (!(move = protocol_decode_move(&bench_engine, game->moves[i]))) return 0;
+        play_move(&bench_engine, move);
+    }
+
+    return 1;
+}
+
+static int resume_benchmark(int plies)  // 1 if a game didn't come back as saved
+{
+    static Resume_Structure resume; static Resume_Game_Structure saved; static TT_Structure resumed_tt;
+    Search_Info_Structure search_info[1]; Search_Limits_Structure limits[1] = {}; Move move;
+    unsigned int seed = 12345; int failures = 0, games = 1, tables = 0, played = 0, table_entries;
+    double move_time = 0, move_worst = 0, table_time = 0, table_worst = 0, load_time, replay_time, table_load_time;
+
+    unlink(RESUME_BENCH_FILE);
+    if (!resume_open(&resume, RESUME_BENCH_FILE)) { printf("can't create %s\n", RESUME_BENCH_FILE); return 1; }
+
+    tt_init(&bench_tt, (size_t)2048 * 1024); limits->depth = 5;  // the ESP32 PSRAM table
+    new_resume_game(&resume);
+
+    for(int ply = 0; ply < plies || resume.game.move_count < RESUME_BENCH_PLIES / 3 || bench_engine.position.side == resume.game.engine_side; ply++) {  // ends in a game, the player to move
+        int engine = bench_engine.position.side == resume.game.engine_side, side = bench_engine.position.side >> 4;
+        unsigned long left[2] = { resume.game.clock_left[0], resume.game.clock_left[1] };
+
+        if (engine) { memset(search_info, 0, sizeof(search_info)); search_iterative(&bench_engine, limits, search_info); move = search_info->best_move; }
+        if ((engine ? !move : !random_legal_move(&bench_engine, &seed, &move)) || resume.game.move_count >= RESUME_BENCH_PLIES) {
+            new_resume_game(&resume); games++; ply--;
+            continue;
+        }
+
+        left[side] = (left[side] > 2000 ? left[side] - 2000 : 0) + resume.game.clock_increment;  // 2 s a move
+        play_move(&bench_engine, move); played++;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        if (!resume_save_move(&resume, protocol_encode_move(move), left, bench_engine.position.side)) failures++;
+        double time = elapsed_seconds(start);
+        move_time += time; if (time > move_worst) move_worst = time;
+
+        if (!engine) continue;
+
+        start = std::chrono::steady_clock::now();
+        if (resume_save_table(&resume, &bench_tt)) tables++;
+        time = elapsed_seconds(start);
+        table_time += time; if (time > table_worst) table_worst = time;
+    }
+
+    printf("%d plies in %d games: %lu records, %lu sector erases of %d sectors\n", played, games, resume.writes, resume.erases, resume.sector_count);
+    printf("save move  %8.1f us average, %8.1f us worst (with the sector erases)\n", move_time * 1e6 / played, move_worst * 1e6);
+    printf("save table %8.1f us average, %8.1f us worst, %d tables of up to %d entries\n", tables ? table_time * 1e6 / tables : 0, table_worst * 1e6, tables, RESUME_TABLE_ENTRIES);
+    printf("wear: %.1f erases a sector, %.0f plies a sector erase, %.0f plies until 100000 erase cycles\n\n", (double)resume.erases / resume.sector_count,
+           resume.erases ? (double)played / resume.erases : 0, resume.erases ? 100000.0 * resume.sector_count * played / resume.erases : 0);
+
+    // power cycle: the region read back from scratch
+    memcpy(&saved, &resume.game, sizeof(saved));
+    resume_close(&resume);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (!resume_open(&resume, RESUME_BENCH_FILE) || !resume_load(&resume)) failures++;
+    load_time = elapsed_seconds(start);
+    if (!same_game(&resume.game, &saved)) failures++;
+
+    start = std::chrono::steady_clock::now();
+    if (!replay_game(&resume.game)) failures++;
+    replay_time = elapsed_seconds(start);
+
+    tt_init(&resumed_tt, (size_t)2048 * 1024);
+    start = std::chrono::steady_clock::now();
+    table_entries = resume_load_table(&resume, &resumed_tt);
+    table_load_time = elapsed_seconds(start);
+
+    printf("resume: load %.1f us, %d plies replayed in %.1f us, %d table entries in %.1f us\n", load_time * 1e6, resume.game.move_count, replay_time * 1e6,
+           table_entries, table_load_time * 1e6);
+
+    for(int i = 0; i < 2; i++) { // the next search with the restored entries and with an empty table
+        memset(search_info, 0, sizeof(search_info)); limits->depth = 7;
+        memset(bench_engine.history_table, 0, sizeof(bench_engine.history_table)); bench_engine.tt = i ? &bench_tt : &resumed_tt;
+        if (i) tt_clear(&bench_tt);
+
+        replay_game(&resume.game);
+        search_iterative(&bench_engine, limits, search_info);
+        printf("        depth %d search, %s: %llu nodes, score %d\n", limits->depth, i ? "empty table" : "restored table", search_info->nodes, search_info->best_score);
+    }
+    bench_engine.tt = &bench_tt;
+
+    // a reset while writing: the next record's header is cut before its CRC
+    int count = resume.game.move_count, offset, fd;
+
+    if (replay_game(&resume.game) && random_legal_move(&bench_engine, &seed, &move)) {
+        unsigned long left[2] = { resume.game.clock_left[0], resume.game.clock_left[1] };
+
+        play_move(&bench_engine, move);
+        resume_save_move(&resume, protocol_encode_move(move), left, bench_engine.position.side);  // opens a new sector, the last one may hold a torn tail
+
+        if (random_legal_move(&bench_engine, &seed, &move)) {
+            offset = resume.sector * RESUME_SECTOR_SIZE + resume.offset;
+            resume_save_move(&resume, protocol_encode_move(move), left, 24 - bench_engine.position.side);
+            resume_close(&resume);
+
+            unsigned char erased[4] = { 0xff, 0xff, 0xff, 0xff };
+            if ((fd = open(RESUME_BENCH_FILE, O_WRONLY)) < 0 || pwrite(fd, erased, 4, offset + 8) != 4) failures++;
+            if (fd >= 0) close(fd);
+
+            if (!resume_open(&resume, RESUME_BENCH_FILE) || !resume_load(&resume) || resume.game.move_count != count + 1 || !replay_game(&resume.game)) failures++;
+            printf("torn write: %d plies saved, %d back after the reset\n", count + 2, resume.game.move_count);
+        }
+    }
+
+    // a game saved whole after castling, as a clock set mid-game does: the king's skip square isn't an e.p. square
+    set_bench_position("r3k2r/pppq1ppp/2npbn2/4p3/4P3/2NPBN2/PPPQ1PPP/R3K2R w KQkq -"); load_moves(&bench_engine, "e1g1 e8c8");
+    protocol_encode_board(&bench_engine.position, resume.game.start); resume.game.move_count = 0;
+    resume_save_game(&resume); resume_close(&resume);
+    memcpy(&saved, &resume.game, sizeof(saved));
+
+    if (!resume_open(&resume, RESUME_BENCH_FILE) || !resume_load(&resume) || !same_game(&resume.game, &saved) || !replay_game(&resume.game)) {
+        printf("castled game: not resumed\n"); failures++;
+    }
+
+    resume_close(&resume); unlink(RESUME_BENCH_FILE);
+    printf("resume: %d failures\n\n", failures);
+
+    return failures;
+}
+
+static int web_read_frame(int client, char *text, int size)  // text payload length of the next frame, -1 on a timeout or a bad frame
+{
+    unsigned char header[4]; int length;
+
+    if (recv(client, header, 2, MSG_WAITALL) != 2 || (header[1] & 0x80)) return -1;  // server frames aren't masked
+    length = header[1] & 127;
+    if (length == 126) { if (recv(client, header + 2, 2, MSG_WAITALL) != 2) return -1; length = header[2] << 8 | header[3]; }
+    if (length >= size || (length && recv(client, text, length, MSG_WAITALL) != length)) return -1;
+
+    text[length] = 0;
+    return length;
+}
+
+static void web_send_text(int client, const char *text)  // a client frame, masked
+{
+    unsigned char frame[6 + WEB_STREAM_TEXT]; int length = strlen(text); unsigned char mask[4] = { 0x12, 0x34, 0x56, 0x78 };
+
+    frame[0] = 0x81; frame[1] = 0x80 | length; memcpy(frame + 2, mask, 4);
+    for(int i = 0; i < length; i++) frame[6 + i] = text[i] ^ mask[i & 3];
+    send(client, frame, 6 + length, 0);
+}
+
+static int web_wait_for(int client, const char *prefix, char *text, int *infos, unsigned long *worst_gap)  // skips other messages, counts info frames
+{
+    unsigned long last_info = 0;
+
+    while (web_read_frame(client, text, WEB_STREAM_TEXT * 2) >= 0) {
+        if (!strncmp(text, "{\"depth\"", 8)) {
+            unsigned long now = time_ms();
+            if (last_info && now - last_info > *worst_gap) *worst_gap = now - last_info;
+            if (last_info && now - last_info < WEB_STREAM_INFO_MS / 2) return 0;  // the rate cap broken
+            last_info = now; (*infos)++;
+        }
+        if (!strncmp(text, prefix, strlen(prefix))) return 1;
+    }
+
+    return 0;
+}
+
+static int web_benchmark(int moves)  // 1 on a failure
+{
+    static Web_Stream_Structure stream; Protocol_Message_Structure message[1]; unsigned char payload[8];
+    struct sockaddr_in address; struct timeval timeout = { 30, 0 }; char text[WEB_STREAM_TEXT * 2];
+    int client, failures = 0, infos = 0, played = 0; unsigned int seed = 12345; unsigned long worst_gap = 0; double latency = 0;
+    std::thread server;
+
+    search_task_start(1);
+    loopback_connect(&client_end, &server_end, loopback, 180);
+    game_server_start(&server_end);
+    if (!web_stream_open(&stream, 0, 1)) { printf("can't listen on the loopback interface\n"); return 1; }
+    game_server_stream(&stream);
+    server_running.store(1); server = std::thread(server_loop);
+
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET; address.sin_port = htons(stream.port); address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    client = socket(AF_INET, SOCK_STREAM, 0); setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    if (connect(client, (struct sockaddr *)&address, sizeof(address))) { printf("can't connect to port %d\n", stream.port); failures++; goto done; }
+
+    { // the handshake of RFC 6455 section 1.3
+        const char *request = "GET / HTTP/1.1\r\nHost: localhost\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                              "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+        int length = 0, received;
+
+        text[0] = 0; send(client, request, strlen(request), 0);
+        while (!strstr(text, "\r\n\r\n") && (received = recv(client, text + length, 1, 0)) == 1) text[++length] = 0;  // byte by byte, frames follow
+        text[length] = 0;
+        if (!strstr(text, "Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n")) { printf("bad handshake reply:\n%s\n", text); failures++; goto done; }
+        printf("web stream on port %d: handshake accepted\n", stream.port);
+    }
+
+    protocol_put_u32(payload, 60000); protocol_put_u32(payload + 4, 0);  // 1 min game, ~1.5 s a move
+    protocol_send(&client_end, PROTOCOL_CLOCK, payload, 8);
+    if (!wait_for_message(PROTOCOL_CLOCK, message, NULL, NULL)) failures++;
+    payload[0] = 1; protocol_send(&client_end, PROTOCOL_NEW_GAME, payload, 1);  // engine black, the web client plays white
+    if (!web_wait_for(client, "{\"fen\"", text, &infos, &worst_gap)) failures++;
+    set_bench_position(START_POSITION);
+
+    web_send_text(client, "e7e5");  // black's move, white to move
+    if (!web_wait_for(client, "{\"error\":\"illegal move\"", text, &infos, &worst_gap)) failures++;
+
+    for(; played < moves; played++) {
+        Move move; char move_string[6], expected[32];
+
+        if (!random_legal_move(&bench_engine, &seed, &move)) break;
+        move_to_string(move, move_string); play_move(&bench_engine, move);
+
+        web_send_text(client, move_string);
+        snprintf(expected, sizeof(expected), "{\"move\":\"%s\"}", move_string);
+        if (!web_wait_for(client, expected, text, &infos, &worst_gap)) { failures++; break; }
+
+        web_send_text(client, "a2a3");  // the engine is to move now
+        if (!web_wait_for(client, "{\"error\":\"not your turn\"", text, &infos, &worst_gap)) { failures++; break; }
+
+        unsigned long start = time_ms();
+        if (!web_wait_for(client, "{\"move\"", text, &infos, &worst_gap) || !(move = parse_move(&bench_engine, text + 9))) { failures++; break; }  // {"move":"e7e5"}
+        latency += time_ms() - start; play_move(&bench_engine, move);
+        while (protocol_poll(&client_end, message));  // the app end isn't read here
+    }
+
+    web_send_text(client, "board");
+    if (!web_wait_for(client, "{\"fen\"", text, &infos, &worst_gap)) failures++;
+    else {
+        char fen[FEN_LENGTH]; position_to_fen(&bench_engine.position, fen);
+        if (!strstr(text, fen)) { printf("board differs: %s, expected %s\n", text, fen); failures++; }
+    }
+
+    for(int i = 0; i < 3; i++) { // the app sets up a position, the pseudo-legal move from the web is refused
+        unsigned char board[PROTOCOL_BOARD_SIZE];
+
+        set_bench_position(illegal_moves[i][0]); protocol_encode_board(&bench_engine.position, board);
+        protocol_send(&client_end, PROTOCOL_BOARD, board, PROTOCOL_BOARD_SIZE);
+        if (!web_wait_for(client, "{\"fen\"", text, &infos, &worst_gap)) failures++;
+
+        web_send_text(client, illegal_moves[i][1]);
+        if (!web_wait_for(client, "{\"error\":\"illegal move\"", text, &infos, &worst_gap)) { printf("%s accepted\n", illegal_moves[i][1]); failures++; }
+        while (protocol_poll(&client_end, message));
+    }
+    web_send_text(client, "e1d1");  // and the game goes on
+    if (!web_wait_for(client, "{\"move\":\"e1d1\"}", text, &infos, &worst_gap) || !web_wait_for(client, "{\"move\"", text, &infos, &worst_gap)) failures++;
+
+    printf("%d moves each side: %d info frames (%lu sent, %lu coalesced), %.0f ms a move, longest info gap %lu ms, cap %d ms\n", played, infos, stream.infos_sent,
+           stream.infos_coalesced, played ? latency / played : 0, worst_gap, WEB_STREAM_INFO_MS);
+
+done:
+    close(client);
+    server_running.store(0); server.join();
+    game_server_stream(NULL); web_stream_close(&stream);
+    search_task_stop();
+    printf("web: %d failures\n\n", failures);
+
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    const char *command = argc > 1 ? argv[1] : "";
+    int depth = argc > 2 ? atoi(argv[2]) : 0;
+
+    bench_engine.tt = &bench_tt;
+
+    if (!strcmp(command, "divide")) {
+        char fen[256] = "";
+        for(int i = 3; i < argc; i++) { strncat(fen, argv[i], sizeof(fen) - strlen(fen) - 2); strcat(fen, " "); }
+        return divide(depth, fen);
+    }
+
+    if (!strcmp(command, "search")) { search_benchmark(depth ? depth : 4, (argc > 3 ? atoi(argv[3]) : TT_SIZE_KB) * (size_t)1024); return 0; }
+    if (!strcmp(command, "perft")) return perft_suite(depth) != 0;
+    if (!strcmp(command, "smp")) { smp_benchmark(depth ? depth : 7, argc > 3 ? atoi(argv[3]) : SMP_MAX_THREADS); return 0; }
+    if (!strcmp(command, "games")) {
+        int workers = argc > 3 ? atoi(argv[3]) : (int)std::thread::hardware_concurrency();
+        return games_benchmark(depth ? depth : 4, workers > 0 ? workers : 1, argc > 4 ? atoi(argv[4]) : 1000) != 0;
+    }
+    if (!strcmp(command, "book")) return argc > 2 ? book_benchmark(argv[2], argc > 3 ? atoi(argv[3]) : 100000) : 1;
+    if (!strcmp(command, "ponder")) return ponder_benchmark(depth ? depth : 1000);
+    if (!strcmp(command, "stats")) return stats_benchmark(depth ? depth : 1000);
+    if (!strcmp(command, "task")) return task_benchmark(depth ? depth : 200) != 0;
+    if (!strcmp(command, "sensor")) return sensor_benchmark(depth ? depth : 200) != 0;
+    if (!strcmp(command, "resume")) return resume_benchmark(depth ? depth : 2000) != 0;
+    if (!strcmp(command, "web")) return web_benchmark(depth ? depth : 5) != 0;
+    if (!strcmp(command, "protocol")) return protocol_benchmark(depth ? depth : 1000) != 0;
+    if (!strcmp(command, "endgame")) return endgame_benchmark(depth ? depth : 4) != 0;
+    if (!strcmp(command, "multipv")) { multipv_benchmark(depth ? depth : 6, argc > 3 ? atoi(argv[3]) : 3); return 0; }
+    if (!strcmp(command, "depth")) { depth_benchmark(depth ? depth : 6); return 0; }
+    if (!strcmp(command, "movetime")) { movetime_benchmark(depth ? depth : 1000); return 0; }
+
+    int failures = perft_suite(0);
+    search_benchmark(4, (size_t)TT_SIZE_KB * 1024);
+
+    return failures != 0;
+}
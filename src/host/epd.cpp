@@ -0,0 +1,320 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                 nibble-chess EPD batch analysis (native host)                   ;
+;---------------------------------------------------------------------------------;
+;                                                                                 ;
+;   epd [-d depth] [-t ms] [-j workers] [-m kb] [-q records] [file]               ;
+;                                                                                 ;
+;      -d  fixed depth per position (default 6)                                   ;
+;      -t  time per position in ms, overrides -d                                  ;
+;      -j  worker threads (default: hardware threads)                             ;
+;      -m  transposition table per worker in KB (default 4096)                    ;
+;      -q  records in flight (default 4 per worker), bounds memory use            ;
+;    file  EPD or FEN lines, one position each; stdin if omitted or "-"           ;
+;                                                                                 ;
+;   Streams: each input record is written to stdout in input order as soon as     ;
+;   it and all records before it are searched, with the analysis appended:       ;
+;                                                                                 ;
+;      <position> <input opcodes> sm Nf3; ce 35; acd 6; acn 81234; acs 0.12;      ;
+;      pv Nf3 d5 d4;                                                              ;
+;                                                                                 ;
+;   Records with bm or am opcodes (SAN) count as solved when the supplied move    ;
+;   is one of the bm moves and none of the am moves; the summary goes to stderr.  ;
+;                                                                                 ;
+\*********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "chess.h"
+#include "tt.h"
+
+#define EPD_LINE_LENGTH 512  // longer records are reported as errors
+#define EPD_OUTPUT_LENGTH (EPD_LINE_LENGTH + 512)
+
+// record states
+#define SLOT_FREE 0
+#define SLOT_READ 1  // waiting for a worker
+#define SLOT_DONE 2  // waiting for the writer
+
+typedef struct {
+    char line[EPD_LINE_LENGTH], output[EPD_OUTPUT_LENGTH];
+    int state, error, solved;  // solved: -1 no bm/am, 0 missed, 1 found
+    unsigned long long nodes;
+} Epd_Record_Structure;
+
+typedef struct {  // records in flight form a ring: read_count - written_count <= record_count
+    Epd_Record_Structure *records; int record_count;
+    long read_count, next_record, written_count; int end_of_input;
+    std::mutex mutex; std::condition_variable changed;
+
+    Search_Limits_Structure limits; size_t tt_size;
+    long positions, solvable, solved, errors; unsigned long long nodes;  // written so far
+} Epd_Pool_Structure;
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    ANALYSIS                                     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static int split_record(char *line, char *fen)  // first four fields to fen, returns offset of the opcodes, 0 if malformed
+{
+    int length = 0, fields = 0; char *cursor = line;
+
+    while (*cursor == ' ' || *cursor == '\t') cursor++;
+
+    while (*cursor && fields < 4) {
+        if (length >= FEN_LENGTH - 2) return 0;
+        if (fields) fen[length++] = ' ';
+        while (*cursor && *cursor != ' ' && *cursor != '\t' && length < FEN_LENGTH - 1) fen[length++] = *cursor++;
+        while (*cursor == ' ' || *cursor == '\t') cursor++;
+        fields++;
+    }
+
+    fen[length] = 0;
+    if (fields < 4) return 0;
+
+    for(int counter = 0; counter < 2 && *cursor >= '0' && *cursor <= '9'; counter++) { // FEN halfmove clock and move number
+        while (*cursor >= '0' && *cursor <= '9') cursor++;
+        while (*cursor == ' ' || *cursor == '\t') cursor++;
+    }
+
+    return cursor - line;
+}
+
+static void strip_san(const char *san, char *stripped)  // drop check, mate and annotation marks
+{
+    int length = 0;
+
+    for (; *san && length < 9; san++) if (!strchr("+#!?", *san)) stripped[length++] = *san;
+    stripped[length] = 0;
+}
+
+static int find_move(const char *opcodes, const char *opcode, const char *san)  // -1 opcode missing, 1 san listed
+{
+    char stripped[10], candidate[10], name[8]; int found = -1;
+
+    snprintf(name, sizeof(name), "%s ", opcode);
+    strip_san(san, stripped);
+
+    for(const char *operation = opcodes; *operation; ) { // operations end with ';', the operands of opcode are SAN moves
+        while (*operation == ' ') operation++;
+
+        if (!strncmp(operation, name, strlen(name))) {
+            const char *operand = operation + strlen(name);
+
+            found = 0;
+            while (*operand && *operand != ';') {
+                int length = 0; char move[10];
+
+                while (*operand == ' ') operand++;
+                while (*operand && *operand != ' ' && *operand != ';' && length < 9) move[length++] = *operand++;
+                while (*operand && *operand != ' ' && *operand != ';') operand++;
+                move[length] = 0;
+
+                strip_san(move, candidate);
+                if (length && !strcmp(candidate, stripped)) return 1;
+            }
+        }
+
+        while (*operation && *operation != ';') {
+            if (*operation++ == '"') while (*operation && *operation != '"') operation++;  // quoted operand may hold ';'
+            if (*operation == '"') operation++;
+        }
+
+        if (*operation == ';') operation++;
+    }
+
+    return found;
+}
+
+static int is_legal(Engine_Structure *engine, Move move)  // search results may end in a king capture
+{
+    Move moves[MAX_MOVES]; int count = generate_legal_moves(engine, moves);
+
+    for(int i = 0; i < count; i++) if (moves[i] == move) return 1;
+    return 0;
+}
+
+static void analyse_record(Epd_Record_Structure *record, Engine_Structure *engine, Search_Limits_Structure *limits)
+{
+    Search_Info_Structure search_info[1]; Position_Structure position[1];
+    char fen[FEN_LENGTH], san[8], *output = record->output; int opcodes, length;
+
+    record->error = 0; record->solved = -1; record->nodes = 0;
+    length = strlen(record->line);
+    while (length && (record->line[length - 1] == '\n' || record->line[length - 1] == '\r' || record->line[length - 1] == ' ')) record->line[--length] = 0;
+
+    if (!(opcodes = split_record(record->line, fen)) || !load_fen(position, fen)) {
+        snprintf(output, EPD_OUTPUT_LENGTH, "%s ; error \"bad position\";\n", record->line);
+        record->error = 1;
+        return;
+    }
+
+    memset(search_info, 0, sizeof(*search_info));
+    tt_clear(engine->tt); memset(engine->history_table, 0, sizeof(engine->history_table));  // records are independent, results don't depend on the worker
+    set_position(engine, position);
+
+    int score = search_iterative(engine, limits, search_info);
+    double seconds = (time_ms() - search_info->start_time) / 1000.0;
+    record->nodes = search_info->nodes;
+
+    position_to_fen(position, fen);
+    output += snprintf(output, EPD_OUTPUT_LENGTH, "%s %s%s", fen, record->line + opcodes, record->line[opcodes] ? " " : "");
+
+    if (search_info->best_move && is_legal(engine, search_info->best_move)) {
+        move_to_san(engine, search_info->best_move, san);
+        output += sprintf(output, "sm %s; ", san);
+
+        int best = find_move(record->line + opcodes, "bm", san), avoid = find_move(record->line + opcodes, "am", san);
+        if (best >= 0 || avoid >= 0) record->solved = best != 0 && avoid != 1;
+    }
+
+    output += sprintf(output, "ce %d; acd %d; acn %llu; acs %.2f;", score, search_info->completed_depth, search_info->nodes, seconds);
+
+    if (search_info->pv_line_length) { // SAN needs the position before each move
+        output += sprintf(output, " pv");
+
+        for(int i = 0; i < search_info->pv_line_length && output - record->output < EPD_OUTPUT_LENGTH - 16 && is_legal(engine, search_info->pv_line[i]); i++) {
+            move_to_san(engine, search_info->pv_line[i], san);
+            output += sprintf(output, " %s", san);
+            play_move(engine, search_info->pv_line[i]);
+        }
+
+        output += sprintf(output, ";");
+    }
+
+    sprintf(output, "\n");
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                  WORKER POOL                                    ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static void epd_worker(Epd_Pool_Structure *pool)
+{
+    Engine_Structure *engine = (Engine_Structure *)calloc(1, sizeof(Engine_Structure)); TT_Structure tt = {};
+
+    tt_init(&tt, pool->tt_size); engine->tt = &tt;
+
+    while (1) {
+        std::unique_lock<std::mutex> lock(pool->mutex);
+        pool->changed.wait(lock, [pool] { return pool->next_record < pool->read_count || pool->end_of_input; });
+        if (pool->next_record == pool->read_count) break;  // end of input, nothing left
+
+        Epd_Record_Structure *record = &pool->records[pool->next_record++ % pool->record_count];
+        lock.unlock();
+
+        analyse_record(record, engine, &pool->limits);
+
+        lock.lock();
+        record->state = SLOT_DONE;
+        pool->changed.notify_all();
+    }
+
+    tt_init(&tt, 0); free(engine);
+}
+
+static void epd_writer(Epd_Pool_Structure *pool)  // input order, flushed per record so a long batch can be followed
+{
+    while (1) {
+        std::unique_lock<std::mutex> lock(pool->mutex);
+        Epd_Record_Structure *record = &pool->records[pool->written_count % pool->record_count];
+
+        pool->changed.wait(lock, [pool, record] { return record->state == SLOT_DONE || (pool->end_of_input && pool->written_count == pool->read_count); });
+        if (record->state != SLOT_DONE) break;
+        lock.unlock();
+
+        fputs(record->output, stdout); fflush(stdout);
+
+        lock.lock();
+        pool->positions++; pool->nodes += record->nodes;
+        pool->errors += record->error;
+        if (record->solved >= 0) { pool->solvable++; pool->solved += record->solved; }
+
+        record->state = SLOT_FREE; pool->written_count++;
+        pool->changed.notify_all();
+    }
+}
+
+static void read_records(Epd_Pool_Structure *pool, FILE *input)
+{
+    char line[EPD_LINE_LENGTH];
+
+    while (fgets(line, sizeof(line), input)) {
+        if (!strchr(line, '\n') && !feof(input)) { // too long, skip the rest and let the worker report it
+            int c; while ((c = fgetc(input)) != EOF && c != '\n');
+            strcpy(line, "-");
+        }
+
+        if (line[strspn(line, " \t\r\n")] == 0 || line[0] == '#') continue;  // blank line or comment
+
+        std::unique_lock<std::mutex> lock(pool->mutex);
+        pool->changed.wait(lock, [pool] { return pool->read_count - pool->written_count < pool->record_count; });  // bounded: wait for the writer
+
+        Epd_Record_Structure *record = &pool->records[pool->read_count % pool->record_count];
+        strcpy(record->line, line); record->state = SLOT_READ;
+        pool->read_count++;
+        pool->changed.notify_all();
+    }
+
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    pool->end_of_input = 1;
+    pool->changed.notify_all();
+}
+
+int main(int argc, char **argv)
+{
+    Epd_Pool_Structure *pool = new Epd_Pool_Structure(); FILE *input = stdin;
+    int workers = (int)std::thread::hardware_concurrency(), depth = 6, movetime = 0, records = 0; size_t tt_kb = 4096;
+
+    for(int i = 1; i < argc; i++) {
+        if (argv[i][0] == '-' && argv[i][1] && !argv[i][2] && i + 1 < argc && strchr("dtjmq", argv[i][1])) {
+            int value = atoi(argv[++i]);
+
+            switch (argv[i - 1][1]) {
+                case 'd': depth = value; break;
+                case 't': movetime = value; break;
+                case 'j': workers = value; break;
+                case 'm': tt_kb = value; break;
+                case 'q': records = value; break;
+            }
+        }
+
+        else if (strcmp(argv[i], "-") && !(input = fopen(argv[i], "r"))) { fprintf(stderr, "can't open %s\n", argv[i]); return 1; }
+    }
+
+    if (workers < 1) workers = 1;
+    if (records < workers) records = 4 * workers;
+
+    pool->records = (Epd_Record_Structure *)calloc(records, sizeof(Epd_Record_Structure)); pool->record_count = records;
+    pool->limits.depth = movetime ? 0 : depth; pool->limits.movetime = movetime; pool->tt_size = tt_kb * 1024;
+    if (!pool->records) { fprintf(stderr, "out of memory\n"); return 1; }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::thread *threads = new std::thread[workers], writer(epd_writer, pool);
+
+    for(int i = 0; i < workers; i++) threads[i] = std::thread(epd_worker, pool);
+    read_records(pool, input);
+    for(int i = 0; i < workers; i++) threads[i].join();
+    writer.join();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    fprintf(stderr, "\n%ld positions, %ld errors, %llu nodes in %.2f s, %.1f positions/sec, %.0f nodes/sec, %d workers\n", pool->positions, pool->errors,
+            pool->nodes, seconds, seconds > 0 ? pool->positions / seconds : 0, seconds > 0 ? pool->nodes / seconds : 0, workers);
+    if (pool->solvable) fprintf(stderr, "solved %ld of %ld (%.1f%%)\n", pool->solved, pool->solvable, 100.0 * pool->solved / pool->solvable);
+
+    if (input != stdin) fclose(input);
+    delete[] threads; free(pool->records); delete pool;
+
+    return 0;
+}
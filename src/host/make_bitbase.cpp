@@ -0,0 +1,216 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                 nibble-chess endgame bitbase generator (native host)            ;
+;---------------------------------------------------------------------------------;
+;                                                                                 ;
+;   make_bitbase [-o src/bitbase_tables.cpp]                                      ;
+;                                                                                 ;
+;   Solves KQK and KRK by distance to mate and KPK by distance to a promotion     ;
+;   that keeps the win, retrograde from the mates and promotions: a position      ;
+;   with the strong side to move is won in n if one move reaches a loss in n - 1, ;
+;   one with the lone king to move is lost in n if all its moves reach wins in    ;
+;   at most n. Stalemate and a captured piece are draws, a promotion takes the    ;
+;   value of its KQK or KRK position. Writes the packed tables as C++ source,     ;
+;   run it again only if the format in bitbase.h changes.                         ;
+;                                                                                 ;
+\*********************************************************************************/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bitbase.h"
+
+#define POSITIONS (64 * 64 * 64)  // strong king, piece, weak king; a1 = 0, strong side white
+
+typedef struct {
+    const char *name; int table, piece_type;  // piece_type as on the 0x88 board: 1 pawn, 6 rook, 7 queen
+    unsigned char weak[POSITIONS], strong[POSITIONS];  // lone king to move: 1 + moves to be mated, 0 draw; strong side to move: moves to mate, 0 draw
+} Solution_Structure;
+
+static Solution_Structure kqk = { "KQK", BITBASE_KQK, 7, {}, {} }, krk = { "KRK", BITBASE_KRK, 6, {}, {} }, kpk = { "KPK", BITBASE_KPK, 1, {}, {} };
+
+static const int king_files[8] = { 0, 1, 1, 1, 0, -1, -1, -1 }, king_ranks[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+
+static inline int index_of(int strong_king, int piece, int weak_king) { return (strong_king * 64 + piece) * 64 + weak_king; }
+static inline int step(int square, int i) { int file = (square & 7) + king_files[i], rank = (square >> 3) + king_ranks[i]; return (file < 0 || file > 7 || rank < 0 || rank > 7) ? -1 : rank * 8 + file; }
+static inline int distance(int a, int b) { int files = abs((a & 7) - (b & 7)), ranks = abs((a >> 3) - (b >> 3)); return files > ranks ? files : ranks; }
+
+static int attacks(int piece_type, int source, int target, int blocker)  // piece on source attacks target, past an empty source square for the lone king
+{
+    int files = (target & 7) - (source & 7), ranks = (target >> 3) - (source >> 3), direction = -1;
+
+    if (piece_type == 1) return ranks == 1 && abs(files) == 1;
+    if (!files && !ranks) return 0;
+
+    for(int i = 0; i < 8; i++) { // direction towards target
+        int straight = !king_files[i] || !king_ranks[i];
+
+        if (piece_type == 6 && !straight) continue;
+        if ((files ? (files > 0 ? 1 : -1) : 0) == king_files[i] && (ranks ? (ranks > 0 ? 1 : -1) : 0) == king_ranks[i] &&
+            (straight ? !files || !ranks : abs(files) == abs(ranks))) direction = i;
+    }
+    if (direction < 0) return 0;
+
+    for(int square = step(source, direction); square != target; square = step(square, direction)) if (square == blocker) return 0;
+    return 1;
+}
+
+static int valid(Solution_Structure *solution, int strong_king, int piece, int weak_king)
+{
+    if (strong_king == piece || piece == weak_king || distance(strong_king, weak_king) < 2) return 0;
+    return solution->piece_type != 1 || (piece >= 8 && piece < 56);
+}
+
+static int strong_value(Solution_Structure *solution, int strong_king, int piece, int weak_king, int n)  // moves to mate if the strong side wins within n, else 0
+{
+    int best = 0, target;
+
+    for(int i = 0; i < 8; i++) { // king moves
+        if ((target = step(strong_king, i)) < 0 || target == piece || distance(target, weak_king) < 2) continue;
+        int value = solution->weak[index_of(target, piece, weak_king)];
+        if (value && value <= n && (!best || value < best)) best = value;
+    }
+
+    if (solution->piece_type == 1) { // pawn pushes, promotions to a queen or a rook
+        target = piece + 8;
+        if (target == strong_king || target == weak_king) return best;
+
+        if (target >= 56) {
+            if (kqk.weak[index_of(strong_king, target, weak_king)] || krk.weak[index_of(strong_king, target, weak_king)]) best = 1;  // a won KQK or KRK is as good as won here
+            return best;
+        }
+
+        int value = solution->weak[index_of(strong_king, target, weak_king)];
+        if (value && value <= n && (!best || value < best)) best = value;
+
+        if (piece < 16 && target + 8 != strong_king && target + 8 != weak_king) {
+            value = solution->weak[index_of(strong_king, target + 8, weak_king)];
+            if (value && value <= n && (!best || value < best)) best = value;
+        }
+        return best;
+    }
+
+    for(int i = 0; i < 8; i++) { // rook or queen slides
+        if (solution->piece_type == 6 && king_files[i] && king_ranks[i]) continue;
+
+        for(target = step(piece, i); target >= 0 && target != strong_king && target != weak_king; target = step(target, i)) {
+            int value = solution->weak[index_of(strong_king, target, weak_king)];
+            if (value && value <= n && (!best || value < best)) best = value;
+        }
+    }
+
+    return best;
+}
+
+static int weak_value(Solution_Structure *solution, int strong_king, int piece, int weak_king, int n)  // 1 + moves to be mated if every move loses within n, else 0
+{
+    int worst = 0, moves = 0, target;
+
+    for(int i = 0; i < 8; i++) {
+        if ((target = step(weak_king, i)) < 0 || distance(target, strong_king) < 2) continue;
+        if (target != piece && attacks(solution->piece_type, piece, target, strong_king)) continue;  // into check
+        if (target == piece) return 0;  // takes the unprotected piece, draw
+
+        int value = solution->strong[index_of(strong_king, piece, target)];
+        if (!value || value > n) return 0;
+        if (value > worst) worst = value;
+        moves++;
+    }
+
+    if (!moves) return attacks(solution->piece_type, piece, weak_king, strong_king) ? 1 : 0;  // mated, or stalemate
+    return worst + 1;
+}
+
+static void solve(Solution_Structure *solution)
+{
+    int changed = 1, wins = 0, losses = 0, longest = 0;
+
+    memset(solution->weak, 0, sizeof(solution->weak)); memset(solution->strong, 0, sizeof(solution->strong));
+
+    for(int n = 0; changed || n < 2; n++) { // n = 0 only finds the mates, KPK has none and starts from the promotions
+        changed = 0;
+
+        for(int pass = 0; pass < 2; pass++) // strong side to move first, its wins in n decide the losses in n + 1
+            for(int strong_king = 0; strong_king < 64; strong_king++)
+                for(int piece = 0; piece < 64; piece++)
+                    for(int weak_king = 0; weak_king < 64; weak_king++) {
+                        int index = index_of(strong_king, piece, weak_king), value;
+
+                        if (!valid(solution, strong_king, piece, weak_king)) continue;
+
+                        if (!pass) {
+                            if (n && !solution->strong[index] && !attacks(solution->piece_type, piece, weak_king, strong_king) &&
+                                (value = strong_value(solution, strong_king, piece, weak_king, n))) { solution->strong[index] = value; changed = 1; wins++; }
+                        }
+                        else if (!solution->weak[index] && (value = weak_value(solution, strong_king, piece, weak_king, n))) {
+                            solution->weak[index] = value; changed = 1; losses++;
+                            if (value > longest) longest = value;
+                        }
+                    }
+    }
+
+    fprintf(stderr, "%s: %d wins with the strong side to move, %d losses with the lone king to move", solution->name, wins, losses);
+    fprintf(stderr, (solution->piece_type == 1) ? ", longest %d moves to a won promotion" : ", longest mate %d moves", longest - 1);  // the lone king to move
+    fprintf(stderr, "\n");
+}
+
+static int write_table(FILE *file, Solution_Structure *solution, int bits, int size)
+{
+    int bytes = (size * bits + 7) / 8 + 2, errors = 0; unsigned char *data = (unsigned char *)calloc(bytes, 1); signed char *seen = (signed char *)malloc(size);
+
+    memset(seen, -1, size);
+
+    for(int strong_king = 0; strong_king < 64; strong_king++)
+        for(int piece = 0; piece < 64; piece++)
+            for(int weak_king = 0; weak_king < 64; weak_king++) {
+                int index, value = solution->weak[index_of(strong_king, piece, weak_king)];
+
+                if (!valid(solution, strong_king, piece, weak_king) || (index = bitbase_index(solution->table, strong_king, piece, weak_king)) < 0) continue;
+                if (value >= 1 << bits || (seen[index] >= 0 && seen[index] != value)) errors++;  // too long, or reflections disagree
+
+                seen[index] = value;
+                for(int bit = 0; bit < bits; bit++) if (value >> bit & 1) data[(index * bits + bit) >> 3] |= 1 << ((index * bits + bit) & 7);
+            }
+
+    fprintf(file, "\nstatic const unsigned char %c%c%c_data[%d] = {  // %s, %d entries of %d bits", tolower(solution->name[0]), tolower(solution->name[1]), tolower(solution->name[2]),
+            bytes, solution->name, size, bits);
+    for(int i = 0; i < bytes; i++) fprintf(file, "%s0x%02x,", (i % 24) ? " " : "\n    ", data[i]);
+    fprintf(file, "\n};\n");
+
+    free(data); free(seen);
+    if (errors) fprintf(stderr, "%s: %d entries don't fit or disagree\n", solution->name, errors);
+
+    return errors;
+}
+
+int main(int argc, char **argv)
+{
+    const char *output = "src/bitbase_tables.cpp"; FILE *file; int errors = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc) output = argv[++i];
+        else { fprintf(stderr, "usage: make_bitbase [-o src/bitbase_tables.cpp]\n"); return 1; }
+    }
+
+    solve(&kqk); solve(&krk); solve(&kpk);  // promotions look up the solved KQK and KRK
+
+    if (!(file = fopen(output, "w"))) { perror(output); return 1; }
+
+    fprintf(file, "/*********************************************************************************\\\n");
+    fprintf(file, ";---------------------------------------------------------------------------------;\n");
+    fprintf(file, ";                     ENDGAME BITBASES, written by make_bitbase                   ;\n");
+    fprintf(file, ";---------------------------------------------------------------------------------;\n");
+    fprintf(file, "\\*********************************************************************************/\n\n");
+    fprintf(file, "#include \"bitbase.h\"\n");
+
+    errors += write_table(file, &kpk, 5, 24 * 4096);
+    errors += write_table(file, &krk, 5, 10 * 4096);
+    errors += write_table(file, &kqk, 4, 10 * 4096);
+
+    fprintf(file, "\nconst Bitbase_Table_Structure bitbase_tables[3] = { { kpk_data, 5, 24 * 4096 }, { krk_data, 5, 10 * 4096 }, { kqk_data, 4, 10 * 4096 } };\n");
+    fclose(file);
+
+    return errors != 0;
+}
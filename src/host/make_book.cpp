@@ -0,0 +1,255 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                nibble-chess opening book generator (native host)                ;
+;---------------------------------------------------------------------------------;
+;                                                                                 ;
+;   make_book [-p plies] [-n games] [-o book.bin] [games.pgn ...]                 ;
+;                                                                                 ;
+;      -p  book depth in plies (default 16)                                       ;
+;      -n  drop moves played in fewer games (default 2)                           ;
+;      -o  output file (default book.bin)                                         ;
+;   games  PGN files, stdin if none; [FEN] tags, comments, NAGs and variations    ;
+;          are understood, variations are skipped                                 ;
+;                                                                                 ;
+;   Weight of a move: 2 per game won by the side playing it, 1 per draw, scaled   ;
+;   to 16 bits; moves that only lost are dropped. Flash the book with             ;
+;   parttool.py write_partition --partition-name book --input book.bin           ;
+;                                                                                 ;
+\*********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "book.h"
+#include "chess.h"
+
+#define MAX_BOOK_PLIES 64
+#define COMPACT_ENTRIES (1 << 22)  // merge duplicates whenever this many moves are collected, bounds memory on big PGN files
+
+typedef struct { unsigned long long key; unsigned short move; unsigned int weight, games; } Book_Move_Structure;
+
+typedef struct {
+    Book_Move_Structure *moves; size_t count, capacity;
+    long games, skipped_games, plies;
+} Book_Table_Structure;
+
+typedef struct {  // game being read
+    unsigned long long keys[MAX_BOOK_PLIES]; unsigned short moves[MAX_BOOK_PLIES];
+    int plies, sides[MAX_BOOK_PLIES], moves_seen, illegal;
+    char fen[FEN_LENGTH], result[8];
+} Pgn_Game_Structure;
+
+static Engine_Structure book_engine;
+static int book_plies = 16, min_games = 2;
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                      TABLE                                      ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static int compare_moves(const void *a, const void *b)  // key, then move
+{
+    const Book_Move_Structure *x = (const Book_Move_Structure *)a, *y = (const Book_Move_Structure *)b;
+
+    if (x->key != y->key) return (x->key < y->key) ? -1 : 1;
+    return (int)x->move - (int)y->move;
+}
+
+static int compare_entries(const void *a, const void *b)  // key, then heaviest first
+{
+    const Book_Move_Structure *x = (const Book_Move_Structure *)a, *y = (const Book_Move_Structure *)b;
+
+    if (x->key != y->key) return (x->key < y->key) ? -1 : 1;
+    return (x->weight != y->weight) ? ((x->weight > y->weight) ? -1 : 1) : (int)x->move - (int)y->move;
+}
+
+static void compact_table(Book_Table_Structure *table)  // merge equal key and move
+{
+    size_t count = 0;
+
+    qsort(table->moves, table->count, sizeof(Book_Move_Structure), compare_moves);
+
+    for(size_t i = 0; i < table->count; i++) {
+        if (count && table->moves[count - 1].key == table->moves[i].key && table->moves[count - 1].move == table->moves[i].move) {
+            table->moves[count - 1].weight += table->moves[i].weight; table->moves[count - 1].games += table->moves[i].games;
+        }
+        else table->moves[count++] = table->moves[i];
+    }
+
+    table->count = count;
+}
+
+static void add_move(Book_Table_Structure *table, unsigned long long key, unsigned short move, int weight)
+{
+    if (table->count == table->capacity) {
+        if (table->count >= COMPACT_ENTRIES) compact_table(table);
+
+        if (table->count >= table->capacity * 3 / 4) {  // grow unless compacting freed a quarter
+            table->capacity = table->capacity ? table->capacity * 2 : 4096;
+            table->moves = (Book_Move_Structure *)realloc(table->moves, table->capacity * sizeof(Book_Move_Structure));
+            if (!table->moves) { fprintf(stderr, "out of memory\n"); exit(1); }
+        }
+    }
+
+    Book_Move_Structure *entry = &table->moves[table->count++];
+    entry->key = key; entry->move = move; entry->weight = weight; entry->games = 1;
+}
+
+static void finish_game(Book_Table_Structure *table, Pgn_Game_Structure *game)
+{
+    int white_score = !strcmp(game->result, "1-0") ? 2 : !strcmp(game->result, "0-1") ? 0 : 1;  // "*" counts as a draw
+
+    if (!game->moves_seen) return;
+    if (game->illegal) table->skipped_games++;
+
+    for(int i = 0; i < game->plies; i++) add_move(table, game->keys[i], game->moves[i], (game->sides[i] == 8) ? white_score : 2 - white_score);
+    table->games++; table->plies += game->plies;
+}
+
+static int write_book(Book_Table_Structure *table, const char *path)  // entries written, -1 on error
+{
+    unsigned int max_weight = 0; size_t count = 0; unsigned char entry[BOOK_ENTRY_SIZE];
+    FILE *output = fopen(path, "wb");
+
+    if (!output) return -1;
+
+    compact_table(table);
+
+    for(size_t i = 0; i < table->count; i++) { // drop rare and losing moves
+        if (table->moves[i].games < (unsigned int)min_games || !table->moves[i].weight) continue;
+        table->moves[count++] = table->moves[i];
+        if (table->moves[i].weight > max_weight) max_weight = table->moves[i].weight;
+    }
+
+    qsort(table->moves, count, sizeof(Book_Move_Structure), compare_entries);
+
+    for(size_t i = 0; i < count; i++) {
+        unsigned int weight = (max_weight > 0xffff) ? (unsigned int)((unsigned long long)table->moves[i].weight * 0xffff / max_weight) : table->moves[i].weight;
+
+        book_pack_entry(entry, table->moves[i].key, table->moves[i].move, weight ? weight : 1);
+        if (fwrite(entry, BOOK_ENTRY_SIZE, 1, output) != 1) { fclose(output); return -1; }
+    }
+
+    return fclose(output) ? -1 : (int)count;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                       PGN                                       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static void start_game(Pgn_Game_Structure *game)
+{
+    Position_Structure position;
+
+    if (!load_fen(&position, game->fen[0] ? game->fen : START_POSITION)) { load_fen(&position, START_POSITION); game->illegal = 1; }
+    set_position(&book_engine, &position);
+}
+
+static void read_tag(Pgn_Game_Structure *game, const char *tag)  // [Name "value"]
+{
+    const char *value = strchr(tag, '"'); int length = 0;
+    char *target = !strncmp(tag, "FEN ", 4) ? game->fen : !strncmp(tag, "Result ", 7) ? game->result : NULL;
+    int size = (target == game->fen) ? FEN_LENGTH : sizeof(game->result);
+
+    if (!target || !value) return;
+    for (value++; *value && *value != '"' && length < size - 1; value++) target[length++] = *value;
+    target[length] = 0;
+}
+
+static void read_token(Book_Table_Structure *table, Pgn_Game_Structure *game, char *token)
+{
+    Move move;
+
+    if (!strcmp(token, "1-0") || !strcmp(token, "0-1") || !strcmp(token, "1/2-1/2") || !strcmp(token, "*")) {
+        if (!game->result[0]) strcpy(game->result, token);
+        finish_game(table, game);
+        memset(game, 0, sizeof(*game));
+        return;
+    }
+
+    while (*token >= '0' && *token <= '9') token++;  // move number, "12." "12..." or glued "12.e4"
+    while (*token == '.') token++;
+    if (!*token || *token == '$') return;  // NAG
+
+    if (!game->moves_seen++) start_game(game);
+    if (game->illegal || game->plies >= book_plies) return;
+
+    if (!(move = parse_san(&book_engine, token))) { game->illegal = 1; return; }  // keep the moves before it
+
+    game->keys[game->plies] = book_key(&book_engine.position); game->moves[game->plies] = book_encode_move(move);
+    game->sides[game->plies++] = book_engine.position.side;
+    play_move(&book_engine, move);
+}
+
+static void read_pgn(Book_Table_Structure *table, FILE *input)
+{
+    static Pgn_Game_Structure game; char token[256], tag[256]; int c, length = 0, variation = 0;
+
+    memset(&game, 0, sizeof(game));
+
+    while ((c = fgetc(input)) != EOF) {
+        if (c == '{') { while ((c = fgetc(input)) != EOF && c != '}'); continue; }  // comment
+        if (c == ';') { while ((c = fgetc(input)) != EOF && c != '\n'); continue; }  // rest of line comment
+        if (c == '(' || c == ')') { // ends the token before it, "h3)" belongs to the variation
+            token[length] = 0;
+            if (length && !variation) read_token(table, &game, token);
+            length = 0;
+            variation += (c == '(') ? 1 : (variation ? -1 : 0);
+            continue;
+        }
+
+        if (c == '[' && !length && !variation) { // tag, a tag after moves starts the next game
+            int tag_length = 0;
+
+            if (game.moves_seen) { finish_game(table, &game); memset(&game, 0, sizeof(game)); }
+            while ((c = fgetc(input)) != EOF && c != ']' && c != '\n') if (tag_length < (int)sizeof(tag) - 1) tag[tag_length++] = c;
+            tag[tag_length] = 0;
+            read_tag(&game, tag);
+            continue;
+        }
+
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            token[length] = 0;
+            if (length && !variation) read_token(table, &game, token);
+            length = 0;
+            continue;
+        }
+
+        if (length < (int)sizeof(token) - 1) token[length++] = c;
+    }
+
+    token[length] = 0;
+    if (length && !variation) read_token(table, &game, token);
+    finish_game(table, &game);  // no result token at the end
+}
+
+int main(int argc, char **argv)
+{
+    static Book_Table_Structure table; const char *output = "book.bin"; int files = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-p") && i + 1 < argc) { book_plies = atoi(argv[++i]); continue; }
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) { min_games = atoi(argv[++i]); continue; }
+        if (!strcmp(argv[i], "-o") && i + 1 < argc) { output = argv[++i]; continue; }
+
+        FILE *input = fopen(argv[i], "r");
+        if (!input) { fprintf(stderr, "can't open %s\n", argv[i]); return 1; }
+        read_pgn(&table, input); fclose(input); files++;
+    }
+
+    if (book_plies > MAX_BOOK_PLIES) book_plies = MAX_BOOK_PLIES;
+    if (!files) read_pgn(&table, stdin);
+
+    int entries = write_book(&table, output);
+    if (entries < 0) { fprintf(stderr, "can't write %s\n", output); return 1; }
+
+    fprintf(stderr, "%ld games (%ld with an illegal or unknown move, kept up to it), %ld book plies, %d entries, %d bytes -> %s\n",
+            table.games, table.skipped_games, table.plies, entries, entries * BOOK_ENTRY_SIZE, output);
+
+    free(table.moves);
+    return 0;
+}
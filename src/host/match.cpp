@@ -0,0 +1,365 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                  nibble-chess self-play match with SPRT (native host)           ;
+;---------------------------------------------------------------------------------;
+;                                                                                 ;
+;   match [-n nodes | -t ms] [-j workers] [-g games] [-e elo0 elo1]               ;
+;         [-a alpha] [-b beta] [-o openings.epd] "engine A" "engine B"            ;
+;                                                                                 ;
+;      -n  nodes per move (default 20000), -t  fixed time per move in ms          ;
+;      -j  games played at once (default: hardware threads)                       ;
+;      -g  most games (default 20000), the SPRT usually stops the match sooner    ;
+;      -e  SPRT hypotheses H0: A is elo0 stronger, H1: elo1 (default 0 5)         ;
+;      -a  -b  false positive and false negative rates (default 0.05)             ;
+;      -o  EPD or FEN openings, each played twice with colours swapped; the       ;
+;          built-in openings if omitted                                           ;
+;                                                                                 ;
+;   Engines are UCI commands run by /bin/sh, usually two builds of env:uci:       ;
+;                                                                                 ;
+;      match -n 20000 -o book.epd ./uci-new ./uci-old                             ;
+;                                                                                 ;
+;   The harness keeps the rules: mate, stalemate, threefold repetition, the       ;
+;   50-move rule and bare kings end a game, MATCH_MAX_PLIES is a draw. An         ;
+;   illegal move or an engine that dies loses the game.                           ;
+;                                                                                 ;
+;   After every game: A's wins, draws and losses, the Elo difference with its     ;
+;   95% interval and the log-likelihood ratio of the GSPRT (normal approximation  ;
+;   of the win/draw/loss model); the match stops once it leaves                   ;
+;   [log(beta / (1 - alpha)), log((1 - beta) / alpha)]. The summary adds each     ;
+;   engine's average nodes per second and depth.                                  ;
+;                                                                                 ;
+\*********************************************************************************/
+
+#include <math.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "chess.h"
+
+#define MATCH_MAX_PLIES 400  // adjudicated a draw
+#define MATCH_LINE_LENGTH (MATCH_MAX_PLIES * 6 + FEN_LENGTH + 64)
+
+// openings of the usual main lines when no file is given
+static const char *builtin_openings[] = {
+    "rnbqkbnr/pp1ppppp/8/2p5/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -",  // Sicilian
+    "rnbqkbnr/pppp1ppp/4p3/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -",  // French
+    "rnbqkbnr/pp1ppppp/2p5/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -",  // Caro-Kann
+    "r1bqkbnr/pppp1ppp/2n5/1B2p3/4P3/5N2/PPPP1PPP/RNBQK2R b KQkq -",  // Ruy Lopez
+    "r1bqkbnr/pppp1ppp/2n5/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R b KQkq -",  // Italian
+    "rnbqkbnr/ppp2ppp/4p3/3p4/2PP4/8/PP2PPPP/RNBQKBNR w KQkq -",  // Queen's Gambit Declined
+    "rnbqkb1r/pppppp1p/5np1/8/2PP4/8/PP2PPPP/RNBQKBNR w KQkq -",  // King's Indian
+    "rnbqkb1r/pppp1ppp/4pn2/8/2PP4/8/PP2PPPP/RNBQKBNR w KQkq -",  // Nimzo/Queen's Indian
+    "rnbqkbnr/pppppppp/8/8/2P5/8/PP1PPPPP/RNBQKBNR b KQkq -",  // English
+    "rnbqkbnr/ppp1pppp/8/3p4/3P4/5N2/PPP1PPPP/RNBQKB1R b KQkq -",  // Queen's pawn
+    "rnbqkbnr/ppp1pppp/8/8/2pP4/8/PP2PPPP/RNBQKBNR w KQkq -",  // Queen's Gambit Accepted
+    "rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq -",  // open game
+};
+
+typedef struct {
+    pid_t pid; FILE *input, *output;  // input - the engine's stdin
+    int dead;  // stopped answering, restarted before the next game
+} Engine_Process_Structure;
+
+typedef struct {
+    unsigned long long nodes, time; long depth_sum, moves;  // time in ms, depth of each move summed
+} Engine_Stats_Structure;
+
+typedef struct {
+    const char *commands[2]; char (*openings)[FEN_LENGTH]; int opening_count;
+    unsigned long long nodes; int movetime, max_games;
+    double elo0, elo1, alpha, beta;
+
+    std::atomic<int> next_game, stop;
+    std::mutex mutex;  // everything below
+    int wins, draws, losses;  // engine A's
+    Engine_Stats_Structure stats[2];  // engine A, engine B
+} Match_Structure;
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                   ENGINES                                       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static int start_engine(Engine_Process_Structure *process, const char *command)  // 0 if it couldn't be started
+{
+    int to_engine[2], from_engine[2];
+
+    if (pipe(to_engine) || pipe(from_engine)) return 0;
+
+    if (!(process->pid = fork())) {
+        dup2(to_engine[0], 0); dup2(from_engine[1], 1);
+        close(to_engine[0]); close(to_engine[1]); close(from_engine[0]); close(from_engine[1]);
+        execl("/bin/sh", "sh", "-c", command, (char *)NULL);
+        _exit(127);
+    }
+
+    close(to_engine[0]); close(from_engine[1]);
+    process->input = fdopen(to_engine[1], "w"); process->output = fdopen(from_engine[0], "r"); process->dead = 0;
+
+    return process->pid > 0 && process->input && process->output;
+}
+
+static void stop_engine(Engine_Process_Structure *process)
+{
+    if (!process->pid) return;
+
+    if (process->dead) kill(process->pid, SIGKILL);
+    else { fprintf(process->input, "quit\n"); fflush(process->input); }
+    fclose(process->input); fclose(process->output);
+    waitpid(process->pid, NULL, 0);
+    process->pid = 0;
+}
+
+static int read_line(Engine_Process_Structure *process, const char *prefix, char *line)  // next line starting with prefix, 0 if the engine died
+{
+    while (fgets(line, MATCH_LINE_LENGTH, process->output))
+        if (!strncmp(line, prefix, strlen(prefix))) return 1;
+
+    process->dead = 1;
+    return 0;
+}
+
+static unsigned long long info_value(const char *line, const char *word)
+{
+    const char *value = strstr(line, word);
+    return value ? strtoull(value + strlen(word), NULL, 10) : 0;
+}
+
+static int engine_move(Engine_Process_Structure *process, Match_Structure *match, const char *opening, const char *moves, char *move_string, Engine_Stats_Structure *stats)  // 0 if the engine died
+{
+    static thread_local char line[MATCH_LINE_LENGTH]; int depth = 0; unsigned long long nodes = 0, time = 0;
+
+    fprintf(process->input, "position fen %s%s%s\n", opening, *moves ? " moves " : "", moves);
+    if (match->movetime) fprintf(process->input, "go movetime %d\n", match->movetime);
+    else fprintf(process->input, "go nodes %llu\n", match->nodes);
+    fflush(process->input);
+
+    while (read_line(process, "", line)) {
+        if (!strncmp(line, "info ", 5) && strstr(line, " nodes ")) { depth = info_value(line, " depth "); nodes = info_value(line, " nodes "); time = info_value(line, " time "); }
+        if (strncmp(line, "bestmove ", 9)) continue;
+
+        if (sscanf(line + 9, "%5s", move_string) != 1) move_string[0] = 0;
+        stats->nodes += nodes; stats->time += time; stats->depth_sum += depth; stats->moves++;  // the last info line covers the whole move
+        return 1;
+    }
+
+    return 0;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                     GAMES                                       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static int bare_kings(Position_Structure *position)  // neither side can mate: kings alone or with one minor piece
+{
+    int minors = 0, square = 0;
+
+    do {
+        int piece = position->board_array[square] & 7;
+
+        if (piece == 1 || piece == 2 || piece == 6 || piece == 7) return 0;
+        minors += piece == 4 || piece == 5;
+        square = (square + 9) & ~0x88;
+    } while (square);
+
+    return minors <= 1;
+}
+
+static Move legal_move(Engine_Structure *engine, const char *move_string)  // 0 if move_string isn't a legal move
+{
+    Move moves[MAX_MOVES], move = parse_move(engine, move_string); int count = generate_legal_moves(engine, moves);
+
+    for(int i = 0; i < count; i++) if (moves[i] == move) return move;
+    return 0;
+}
+
+static int play_game(Engine_Process_Structure processes[2], Match_Structure *match, const char *opening, int a_white, Engine_Stats_Structure stats[2])  // A's points doubled: 2 win, 1 draw, 0 loss
+{
+    static thread_local char moves[MATCH_MAX_PLIES * 6 + 1], line[MATCH_LINE_LENGTH]; static thread_local unsigned long long keys[MATCH_MAX_PLIES];
+    Engine_Structure *engine = (Engine_Structure *)calloc(1, sizeof(Engine_Structure)); Position_Structure position[1];
+    Move legal_moves[MAX_MOVES]; char move_string[8]; int result = 1, fifty = 0, length = 0;
+
+    load_fen(position, opening); set_position(engine, position);
+    moves[0] = 0;
+
+    for(int i = 0; i < 2; i++) {
+        fprintf(processes[i].input, "ucinewgame\nisready\n"); fflush(processes[i].input);
+        if (!read_line(&processes[i], "readyok", line)) { free(engine); return i ? 2 : 0; }
+    }
+
+    for(int ply = 0; ply < MATCH_MAX_PLIES; ply++) {
+        int count = generate_legal_moves(engine, legal_moves), mover = (engine->position.side == 8) != a_white, repetitions = 0;  // mover 0 - A
+        Move move;
+
+        if (!count) { result = in_check(&engine->position, engine->position.side) ? (mover ? 2 : 0) : 1; break; }  // mated or stalemated
+        if (fifty >= 100 || bare_kings(&engine->position)) break;
+
+        keys[ply] = position_key(&engine->position, engine->position.en_passant);
+        for(int i = ply; i >= 0 && i >= ply - fifty; i -= 2) repetitions += keys[i] == keys[ply];  // same side to move, nothing irreversible in between
+        if (repetitions >= 3) break;
+
+        if (!engine_move(&processes[mover], match, opening, moves, move_string, &stats[mover]) || !(move = legal_move(engine, move_string))) { // died or illegal
+            result = mover ? 2 : 0;
+            break;
+        }
+
+        fifty = (MOVE_CAPTURE(move) || (MOVE_PIECE(move) & 7) < 3) ? 0 : fifty + 1;  // capture or pawn move
+        length += sprintf(moves + length, "%s%s", length ? " " : "", move_string);
+        play_move(engine, move);
+    }
+
+    free(engine);
+    return result;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                      SPRT                                       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static double elo_to_score(double elo) { return 1 / (1 + pow(10, -elo / 400)); }
+static double score_to_elo(double score) { score = (score < 1e-6) ? 1e-6 : (score > 1 - 1e-6) ? 1 - 1e-6 : score; return -400 * log10(1 / score - 1); }
+
+static void match_statistics(Match_Structure *match, double *elo, double *margin, double *llr)  // A's Elo difference, its 95% half interval and the GSPRT log-likelihood ratio
+{
+    double games = match->wins + match->draws + match->losses, score, variance, s0 = elo_to_score(match->elo0), s1 = elo_to_score(match->elo1);
+
+    *elo = *margin = *llr = 0;
+    if (!games) return;
+
+    score = (match->wins + match->draws / 2.0) / games;
+    variance = (match->wins * (1 - score) * (1 - score) + match->draws * (0.5 - score) * (0.5 - score) + match->losses * score * score) / games;
+
+    *elo = score_to_elo(score);
+    *margin = (score_to_elo(score + 1.96 * sqrt(variance / games)) - score_to_elo(score - 1.96 * sqrt(variance / games))) / 2;
+    if (variance > 0) *llr = games * (s1 - s0) * (2 * score - s0 - s1) / (2 * variance);
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                     WORKERS                                     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static void match_worker(Match_Structure *match)  // plays games until the SPRT decides or max_games are taken
+{
+    Engine_Process_Structure processes[2] = {}; Engine_Stats_Structure stats[2]; int game;
+    double lower = log(match->beta / (1 - match->alpha)), upper = log((1 - match->beta) / match->alpha), elo, margin, llr;
+
+    while (!match->stop.load() && (game = match->next_game.fetch_add(1)) < match->max_games) {
+        for(int i = 0; i < 2; i++) {
+            if (processes[i].pid && processes[i].dead) stop_engine(&processes[i]);
+            if (!processes[i].pid && !start_engine(&processes[i], match->commands[i])) { fprintf(stderr, "can't start %s\n", match->commands[i]); match->stop.store(1); return; }
+        }
+
+        memset(stats, 0, sizeof(stats));
+        int result = play_game(processes, match, match->openings[(game / 2) % match->opening_count], !(game & 1), stats);  // a pair per opening, colours swapped
+
+        std::lock_guard<std::mutex> lock(match->mutex);
+        if (match->stop.load()) break;  // decided while this game was played
+
+        match->wins += result == 2; match->draws += result == 1; match->losses += result == 0;
+        for(int i = 0; i < 2; i++) {
+            match->stats[i].nodes += stats[i].nodes; match->stats[i].time += stats[i].time;
+            match->stats[i].depth_sum += stats[i].depth_sum; match->stats[i].moves += stats[i].moves;
+        }
+
+        match_statistics(match, &elo, &margin, &llr);
+        fprintf(stderr, "games %d: +%d =%d -%d, elo %+.1f +- %.1f, LLR %.2f [%.2f, %.2f]\n", match->wins + match->draws + match->losses,
+                match->wins, match->draws, match->losses, elo, margin, llr, lower, upper);
+        if (llr <= lower || llr >= upper) match->stop.store(1);
+    }
+
+    for(int i = 0; i < 2; i++) stop_engine(&processes[i]);
+}
+
+static int read_openings(Match_Structure *match, const char *path)  // first four fields of each line, 0 if none could be read
+{
+    FILE *file = fopen(path, "r"); char line[512]; Position_Structure position;
+
+    if (!file) { perror(path); return 0; }
+
+    while (fgets(line, sizeof(line), file)) {
+        char fields[4][FEN_LENGTH]; int count = sscanf(line, "%95s %95s %95s %95s", fields[0], fields[1], fields[2], fields[3]);
+
+        if (count < 4 || line[0] == '#') continue;
+        match->openings = (char (*)[FEN_LENGTH])realloc(match->openings, (match->opening_count + 1) * FEN_LENGTH);
+        snprintf(match->openings[match->opening_count], FEN_LENGTH, "%.80s %.1s %.4s %.2s", fields[0], fields[1], fields[2], fields[3]);
+        if (load_fen(&position, match->openings[match->opening_count])) match->opening_count++;
+    }
+
+    fclose(file);
+    return match->opening_count;
+}
+
+int main(int argc, char **argv)
+{
+    static Match_Structure match; const char *openings = NULL; int workers = std::thread::hardware_concurrency(), engines = 0;
+    double elo, margin, llr;
+
+    match.nodes = 20000; match.max_games = 20000; match.elo0 = 0; match.elo1 = 5; match.alpha = match.beta = 0.05;
+    signal(SIGPIPE, SIG_IGN);  // a dead engine shows up as a failed read
+
+    for(int i = 1; i < argc; i++) {
+        if (argv[i][0] == '-' && argv[i][1] && !argv[i][2] && i + 1 < argc && strchr("ntjgeabo", argv[i][1])) {
+            const char *value = argv[++i];
+
+            switch (argv[i - 1][1]) {
+                case 'n': match.nodes = strtoull(value, NULL, 10); match.movetime = 0; break;
+                case 't': match.movetime = atoi(value); break;
+                case 'j': workers = atoi(value); break;
+                case 'g': match.max_games = atoi(value); break;
+                case 'e': match.elo0 = atof(value); if (i + 1 < argc) match.elo1 = atof(argv[++i]); break;
+                case 'a': match.alpha = atof(value); break;
+                case 'b': match.beta = atof(value); break;
+                case 'o': openings = value; break;
+            }
+        }
+
+        else if (engines < 2) match.commands[engines++] = argv[i];
+    }
+
+    if (engines < 2) { fprintf(stderr, "usage: match [-n nodes | -t ms] [-j workers] [-g games] [-e elo0 elo1] [-a alpha] [-b beta] [-o openings.epd] \"engine A\" \"engine B\"\n"); return 1; }
+
+    if (openings) { if (!read_openings(&match, openings)) { fprintf(stderr, "no openings in %s\n", openings); return 1; } }
+    else {
+        match.opening_count = sizeof(builtin_openings) / sizeof(builtin_openings[0]);
+        match.openings = (char (*)[FEN_LENGTH])calloc(match.opening_count, FEN_LENGTH);
+        for(int i = 0; i < match.opening_count; i++) strcpy(match.openings[i], builtin_openings[i]);
+    }
+
+    if (workers < 1) workers = 1;
+    fprintf(stderr, "%s vs %s, %d openings, %s %llu, %d workers, SPRT elo0 %.1f elo1 %.1f alpha %.3f beta %.3f\n", match.commands[0], match.commands[1],
+            match.opening_count, match.movetime ? "ms" : "nodes", match.movetime ? (unsigned long long)match.movetime : match.nodes, workers,
+            match.elo0, match.elo1, match.alpha, match.beta);
+
+    std::thread *threads = new std::thread[workers];
+    for(int i = 0; i < workers; i++) threads[i] = std::thread(match_worker, &match);
+    for(int i = 0; i < workers; i++) threads[i].join();
+    delete[] threads;
+
+    match_statistics(&match, &elo, &margin, &llr);
+    printf("%d games: +%d =%d -%d, elo %+.1f +- %.1f, LLR %.2f: %s\n", match.wins + match.draws + match.losses, match.wins, match.draws, match.losses, elo, margin, llr,
+           llr >= log((1 - match.beta) / match.alpha) ? "H1 accepted" : llr <= log(match.beta / (1 - match.alpha)) ? "H0 accepted" : "inconclusive");
+
+    for(int i = 0; i < 2; i++) {
+        Engine_Stats_Structure *stats = &match.stats[i];
+
+        printf("%s: %.0f nodes/sec, depth %.1f, %ld moves\n", match.commands[i], stats->time ? stats->nodes * 1000.0 / stats->time : 0,
+               stats->moves ? (double)stats->depth_sum / stats->moves : 0, stats->moves);
+    }
+
+    free(match.openings);
+    return 0;
+}
@@ -0,0 +1,152 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                     nibble-chess console game (native host)                     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+
+#include "book.h"
+#include "chess.h"
+#include "search_task.h"
+
+static Search_Request_Structure game, ponder;  // game - moves played so far, ponder - game + expected reply
+static Engine_Structure game_engine;  // board shown to the player, the search task has its own
+
+static void wait_for_result(int id, Search_Result_Structure *result, int print)  // final result of request id, progress printed
+{
+    while (1) {
+        if (!search_task_poll(result)) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); continue; }
+        if (result->id != id) continue;  // left over from a cancelled search
+        
+        if (print) printf("depth %2d  score %6d  nodes %10llu  time %6lu ms  move %s %s\n", result->depth, result->score, result->nodes, result->time,
+                          result->move_string, result->ponder_string);
+        if (result->final) return;
+    }
+}
+
+static void append_move(char *moves, const char *move_string)
+{
+    if (strlen(moves) + 7 > REQUEST_MOVES_LENGTH) return;
+    if (*moves) strcat(moves, " ");
+    strcat(moves, move_string);
+}
+
+static void set_up_game()  // board from the game record
+{
+    Position_Structure position;
+
+    load_fen(&position, START_POSITION); set_position(&game_engine, &position);
+    load_moves(&game_engine, game.moves);
+}
+
+int main(int argc, char **argv)  // play [book.bin]
+{
+    Search_Limits_Structure limits[1]; Search_Result_Structure result[1]; static Book_Structure book;
+    
+    printf(";----------------------------------------------------------;\n");
+    printf(";                    nibble-chess v1.0                     ;\n");
+    printf(";----------------------------------------------------------;\n");
+    printf(";         A tribute to chess programming community         ;\n");
+    printf(";  based on the ideas taken from micro-Max by H.G.Muller   ;\n");
+    printf(";----------------------------------------------------------;\n");
+    printf(";                     by Maksim Korzh;                     ;\n");
+    printf(";----------------------------------------------------------;\n");
+    
+    printf("\nenter time control:\n\n");
+    printf("    5 - 5 seconds per move\n");
+    printf("  3+2 - 3 minutes per game + 2 seconds per move\n");
+    printf("   d6 - fixed depth 6\n");
+ 
+    char move_string[6], ponder_string[6] = "", line[32] = "";
+    int value = 0, increment = 0, id = 0, ponder_id = 0;
+    
+    memset(limits, 0, sizeof(limits));
+    if (!fgets(line, sizeof(line), stdin)) return 1;
+    
+    if (line[0] == 'd') limits->depth = atoi(line + 1);
+    else if (sscanf(line, "%d+%d", &value, &increment) == 2) { limits->time_left = value * 60000; limits->increment = increment * 1000; }
+    else limits->movetime = value * 1000;
+    
+    if (limits->depth <= 0 && limits->time_left <= 0 && limits->movetime <= 0) limits->movetime = 5000;  // default 5 seconds per move
+    
+    set_up_game();
+    if (argc > 1 && book_open(&book, argv[1])) search_task_book(&book);
+    search_task_start(1);  // the engine owns the board while it searches or ponders
+    
+    printf("\nEnter move in format:\n\n");
+    printf(" e2e4 - common move\n");
+    printf("g7g8r - pawn promotin\n");
+    printf(" e1g1 - castling\n\n");
+    
+    print_board(&game_engine.position);  // print board
+
+    while (1) { // game loop
+        memset(&move_string[0], 0, sizeof(move_string));
+        
+        if (!fgets(line, sizeof(line), stdin)) break;
+        if (line[0] == '\n') continue;
+        sscanf(line, "%5s", move_string);
+        
+        if (ponder_id && !strcmp(move_string, ponder_string)) { // ponder hit, the search goes on
+            search_task_ponder_hit(ponder_id);
+            append_move(game.moves, move_string);
+            printf("\nponder hit\n");
+            wait_for_result(ponder_id, result, 1);
+        }
+        
+        else {
+            if (ponder_id) { search_task_cancel(); wait_for_result(ponder_id, result, 0); }  // ponder miss, drop the search
+            ponder_id = 0;
+            
+            set_up_game();
+            Move move = parse_move(&game_engine, move_string);  // parse move
+            
+            if (!move) { printf("illegal move\n"); continue; }
+            
+            move_to_string(move, move_string); append_move(game.moves, move_string);
+            play_move(&game_engine, move);  // make move, update side/e.p.
+            print_board(&game_engine.position);  // print board
+            
+            game.id = ++id; game.limits = *limits;
+            search_task_submit(&game);  // search position
+            wait_for_result(id, result, 1);
+        }
+        
+        int score = result->score;
+        
+        if (limits->time_left) { // engine clock
+            limits->time_left += limits->increment - (int)result->time;
+            if (limits->time_left < 1) limits->time_left = 1;
+            printf("\nEngine clock: %d.%d s", limits->time_left / 1000, limits->time_left % 1000 / 100);
+        }
+        
+        printf("\nScore: %d\n\n", score);
+        
+        append_move(game.moves, result->move_string);  // make engine's move
+        set_up_game();
+        print_board(&game_engine.position);  // print board
+        
+        if (score == 10000 || score == -10000) { // mate
+            (score == 10000) ?
+            printf("\nWhite is checkmated!\n") :
+            printf("\nBlack is checkmated!\n"); break;
+        }
+        
+        ponder_id = 0;
+        
+        if (result->ponder_move) { // think on the expected reply while the player thinks
+            ponder = game; ponder.id = ponder_id = ++id; ponder.limits = *limits; ponder.ponder = 1;
+            strcpy(ponder_string, result->ponder_string); append_move(ponder.moves, ponder_string);
+            search_task_submit(&ponder);
+        }
+    }
+    
+    search_task_stop();
+    
+    return 0;
+}
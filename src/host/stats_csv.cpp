@@ -0,0 +1,96 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                nibble-chess search statistics decoder (native host)             ;
+;---------------------------------------------------------------------------------;
+;                                                                                 ;
+;   stats_csv [-b] [file ...]  > stats.csv                                        ;
+;                                                                                 ;
+;      reads a Serial log and decodes its "stats <hex>" lines, other lines are    ;
+;      skipped; -b reads raw STATS_RECORD_SIZE byte records, e.g. saved BLE       ;
+;      notifications. stdin if no file.                                           ;
+;                                                                                 ;
+;   One CSV row per iteration, the cutoff record is joined to the iteration       ;
+;   record of the same search and depth.                                          ;
+;                                                                                 ;
+\*********************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "stats.h"
+
+static Stats_Record_Structure pending;  // iteration record waiting for its cutoffs
+static int has_pending = 0, last_id = -1;
+static unsigned long last_time = 0;
+
+static int hex_value(int c) { return (c >= '0' && c <= '9') ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1; }
+
+static void print_row(Stats_Record_Structure *iteration, Stats_Record_Structure *cutoffs)  // cutoffs NULL - not received
+{
+    unsigned long iteration_time = (iteration->id == last_id && iteration->time >= last_time) ? iteration->time - last_time : iteration->time;
+
+    printf("%d,%d,%lu,%lu,%lu,%.0f,%.1f,%.2f,%.1f,%d", iteration->id, iteration->depth, iteration->time, iteration_time, iteration->nodes,
+           iteration->time ? iteration->nodes * 1000.0 / iteration->time : 0.0, iteration->qnodes_permille / 10.0, iteration->branching_factor / 100.0,
+           iteration->tt_hit_permille / 10.0, iteration->stack_peak);
+
+    for(int i = 0; i < STATS_CUTOFF_BUCKETS; i++) {
+        if (cutoffs) printf(",%.1f", cutoffs->cutoff_permille[i] / 10.0);
+        else printf(",");
+    }
+
+    printf("\n");
+    last_id = iteration->id; last_time = iteration->time;
+}
+
+static void read_record(const unsigned char *bytes)
+{
+    Stats_Record_Structure record;
+
+    if (!stats_decode(bytes, &record)) return;
+
+    if (record.type == STATS_CUTOFFS && has_pending && record.id == pending.id && record.depth == pending.depth) { print_row(&pending, &record); has_pending = 0; return; }
+    if (has_pending) { print_row(&pending, NULL); has_pending = 0; }
+    if (record.type == STATS_ITERATION) { pending = record; has_pending = 1; }
+}
+
+static void read_log(FILE *input)
+{
+    char line[512]; unsigned char bytes[STATS_RECORD_SIZE];
+
+    while (fgets(line, sizeof(line), input)) {
+        char *hex = strstr(line, "stats "); int length = 0;
+
+        if (!hex) continue;
+        for (hex += 6; length < STATS_RECORD_SIZE && hex_value(hex[0]) >= 0 && hex_value(hex[1]) >= 0; hex += 2) bytes[length++] = hex_value(hex[0]) << 4 | hex_value(hex[1]);
+        if (length == STATS_RECORD_SIZE) read_record(bytes);
+    }
+}
+
+static void read_binary(FILE *input)
+{
+    unsigned char bytes[STATS_RECORD_SIZE];
+
+    while (fread(bytes, STATS_RECORD_SIZE, 1, input) == 1) read_record(bytes);
+}
+
+int main(int argc, char **argv)
+{
+    int binary = 0, files = 0;
+
+    printf("id,depth,time_ms,iteration_ms,nodes,nps,qnodes_pct,branching_factor,tt_hit_pct,stack_bytes,"
+           "cutoff_1_pct,cutoff_2_pct,cutoff_3_pct,cutoff_4_pct,cutoff_5_6_pct,cutoff_7_10_pct,cutoff_11_20_pct,cutoff_21_pct\n");
+
+    for(int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-b")) { binary = 1; continue; }
+
+        FILE *input = fopen(argv[i], binary ? "rb" : "r");
+        if (!input) { fprintf(stderr, "can't open %s\n", argv[i]); return 1; }
+        if (binary) read_binary(input); else read_log(input);
+        fclose(input); files++;
+    }
+
+    if (!files) { if (binary) read_binary(stdin); else read_log(stdin); }
+    if (has_pending) print_row(&pending, NULL);
+
+    return 0;
+}
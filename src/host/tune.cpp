@@ -0,0 +1,342 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                  nibble-chess evaluation tuner (native host)                    ;
+;---------------------------------------------------------------------------------;
+;                                                                                 ;
+;   tune [-i iterations] [-r rate] [-k scale] [-j threads] [-o file] positions... ;
+;                                                                                 ;
+;      -i  gradient descent passes over the whole set (default 1000)              ;
+;      -r  step of each weight in centipawns, Adam (default 1)                    ;
+;      -k  sigmoid scale, fitted to the starting weights if omitted               ;
+;      -j  worker threads (default: hardware threads)                             ;
+;      -o  output header (default include/eval_weights.h)                         ;
+;    positions  EPD or FEN lines with the game result anywhere after the board:   ;
+;               1-0, 0-1, 1/2-1/2 (c9 "1-0";) or [1.0], [0.5], [0.0]; "-" stdin   ;
+;                                                                                 ;
+;   Texel tuning of the material weights and the centre table, starting from      ;
+;   eval_weights.h. The evaluation is linear in piece counts and squares, so      ;
+;   each position is packed once into 37 signed feature bytes (white minus black: ;
+;   5 piece types, 32 squares of ranks 8-5 with ranks 1-4 folded onto them) and   ;
+;   the set is stored feature-major in blocks of TUNE_LANES positions. A pass     ;
+;   evaluates a block as TUNE_LANES float lanes: dot product, vector exp for the  ;
+;   sigmoid, the squared error and the gradient, split over the threads. Every    ;
+;   packed position is checked against scan_position_score().                     ;
+;                                                                                 ;
+;   Positions with the side to move in check are skipped; quiet positions (e.g.   ;
+;   no capture in the PV) tune best. Rebuild the engine after a run.              ;
+;                                                                                 ;
+\*********************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+
+#include "chess.h"
+#include "eval_weights.h"
+
+#define TUNE_LANES 8  // positions evaluated together, one AVX register of floats
+#define TUNE_MATERIAL 5  // pawn, knight, bishop, rook, queen; kings cancel out
+#define TUNE_CENTRE 32  // ranks 8-5, ranks 1-4 mirror them
+#define TUNE_FEATURES (TUNE_MATERIAL + TUNE_CENTRE)
+#define TUNE_CHUNK 256  // blocks summed in floats before the double totals
+#define TUNE_MAX_THREADS 64
+#define TUNE_LINE_LENGTH 512
+
+typedef float Float_Vector __attribute__((vector_size(TUNE_LANES * sizeof(float))));
+typedef int Int_Vector __attribute__((vector_size(TUNE_LANES * sizeof(int))));
+typedef signed char Byte_Vector __attribute__((vector_size(TUNE_LANES)));
+
+typedef struct { Byte_Vector features[TUNE_FEATURES]; Byte_Vector results; } Tune_Block_Structure;  // results in half points for white, 38 bytes a position
+
+typedef struct {
+    Tune_Block_Structure *blocks; long block_count, capacity;  // capacity in blocks
+    long positions, skipped, mismatched;
+} Tune_Set_Structure;
+
+typedef struct { double error, gradient[TUNE_FEATURES]; } Tune_Sum_Structure;
+
+static const int material_features[8] = { -1, 0, 0, -1, 1, 2, 3, 4 };  // by piece type
+static const int start_material[TUNE_MATERIAL] = { EVAL_PAWN, EVAL_KNIGHT, EVAL_BISHOP, EVAL_ROOK, EVAL_QUEEN };
+static const int start_centre[64] = { EVAL_CENTRE_RANK_8, EVAL_CENTRE_RANK_7, EVAL_CENTRE_RANK_6, EVAL_CENTRE_RANK_5,
+                                      EVAL_CENTRE_RANK_4, EVAL_CENTRE_RANK_3, EVAL_CENTRE_RANK_2, EVAL_CENTRE_RANK_1 };
+
+static double elapsed_seconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                 PACKED POSITIONS                                ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static int parse_result(const char *line)  // half points for white, -1 if the line has none
+{
+    if (strstr(line, "1/2-1/2") || strstr(line, "[0.5]")) return 1;
+    if (strstr(line, "1-0") || strstr(line, "[1.0]")) return 2;
+    if (strstr(line, "0-1") || strstr(line, "[0.0]")) return 0;
+    return -1;
+}
+
+static void extract_features(Position_Structure *position, signed char *features)  // piece counts and squares, white minus black
+{
+    int square = 0;
+
+    memset(features, 0, TUNE_FEATURES);
+
+    do {
+        int piece = position->board_array[square], sign = (piece & 8) ? 1 : -1, rank = square >> 4;  // rank 0 is rank 8
+
+        if (piece) {
+            if (material_features[piece & 7] >= 0) features[material_features[piece & 7]] += sign;
+            features[TUNE_MATERIAL + (rank < 4 ? rank : 7 - rank) * 8 + (square & 7)] += sign;
+        }
+        square = (square + 9) & ~0x88;
+    } while (square);
+}
+
+static void add_position(Tune_Set_Structure *set, const signed char *features, int result)
+{
+    long block = set->positions / TUNE_LANES; int lane = set->positions % TUNE_LANES;
+
+    if (block >= set->capacity) {
+        set->capacity = set->capacity ? set->capacity * 2 : 4096;
+        set->blocks = (Tune_Block_Structure *)realloc(set->blocks, set->capacity * sizeof(Tune_Block_Structure));
+        if (!set->blocks) { fprintf(stderr, "out of memory at %ld positions\n", set->positions); exit(1); }
+    }
+
+    for(int f = 0; f < TUNE_FEATURES; f++) set->blocks[block].features[f][lane] = features[f];
+    set->blocks[block].results[lane] = (signed char)result;
+    set->positions++; set->block_count = block + 1;
+}
+
+static int load_positions(Tune_Set_Structure *set, const char *path)  // 0 if the file can't be read
+{
+    FILE *file = strcmp(path, "-") ? fopen(path, "r") : stdin; char line[TUNE_LINE_LENGTH]; Position_Structure position; signed char features[TUNE_FEATURES];
+
+    if (!file) { perror(path); return 0; }
+
+    while (fgets(line, sizeof(line), file)) {
+        int result = parse_result(line), score = 0;
+
+        if (result < 0 || !load_fen(&position, line) || in_check(&position, position.side)) { set->skipped++; continue; }
+        extract_features(&position, features);
+
+        for(int f = 0; f < TUNE_MATERIAL; f++) score += features[f] * start_material[f];  // the engine's own score from the same weights
+        for(int f = 0; f < TUNE_CENTRE; f++) score += features[TUNE_MATERIAL + f] * start_centre[f];
+        if (score != scan_position_score(&position)) set->mismatched++;
+
+        add_position(set, features, result);
+    }
+
+    if (file != stdin) fclose(file);
+    return 1;
+}
+
+static void pad_last_block(Tune_Set_Structure *set)  // empty lanes score 0 with a draw, no error and no gradient
+{
+    for(long i = set->positions; i % TUNE_LANES; i++) {
+        for(int f = 0; f < TUNE_FEATURES; f++) set->blocks[i / TUNE_LANES].features[f][i % TUNE_LANES] = 0;
+        set->blocks[i / TUNE_LANES].results[i % TUNE_LANES] = 1;
+    }
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                 BATCH EVALUATION                                ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static inline Float_Vector vector_exp(Float_Vector x)  // e^x by 2^i * 2^f, relative error below 1e-6; x clamped to +-87
+{
+    Float_Vector t = x * 1.44269504f, f, p; Int_Vector i;
+
+    t = (t < -126.0f) ? (Float_Vector){} - 126.0f : t; t = (t > 126.0f) ? (Float_Vector){} + 126.0f : t;
+    i = __builtin_convertvector(t, Int_Vector); i += (t < __builtin_convertvector(i, Float_Vector));  // floor, the comparison is -1 where true
+    f = t - __builtin_convertvector(i, Float_Vector);
+
+    p = 1.33335581e-3f * f + 9.61812911e-3f; p = p * f + 5.55041087e-2f; p = p * f + 2.40226507e-1f; p = p * f + 6.93147181e-1f; p = p * f + 1.0f;
+
+    Int_Vector bits = (i + 127) << 23;
+    Float_Vector scale; memcpy(&scale, &bits, sizeof(scale));
+
+    return p * scale;
+}
+
+static void evaluate_blocks(const Tune_Block_Structure *blocks, long first, long last, const float *weights, float k, int with_gradient, Tune_Sum_Structure *sum)
+{
+    Float_Vector weight[TUNE_FEATURES], gradient[TUNE_FEATURES], error;
+
+    for(int f = 0; f < TUNE_FEATURES; f++) weight[f] = (Float_Vector){} + weights[f];
+    memset(sum, 0, sizeof(*sum));
+
+    for(long chunk = first; chunk < last; chunk += TUNE_CHUNK) {
+        long end = (chunk + TUNE_CHUNK < last) ? chunk + TUNE_CHUNK : last;
+
+        memset(gradient, 0, sizeof(gradient)); error = (Float_Vector){};
+
+        for(long b = chunk; b < end; b++) {
+            const Tune_Block_Structure *block = &blocks[b]; Float_Vector x[TUNE_FEATURES], score = {};
+
+            for(int f = 0; f < TUNE_FEATURES; f++) { x[f] = __builtin_convertvector(block->features[f], Float_Vector); score += weight[f] * x[f]; }
+
+            Float_Vector sigmoid = 1.0f / (1.0f + vector_exp(-k * score)), difference = sigmoid - __builtin_convertvector(block->results, Float_Vector) * 0.5f;
+            error += difference * difference;
+
+            if (!with_gradient) continue;
+            Float_Vector slope = difference * sigmoid * (1.0f - sigmoid);  // d error / d score, without 2k
+            for(int f = 0; f < TUNE_FEATURES; f++) gradient[f] += slope * x[f];
+        }
+
+        for(int lane = 0; lane < TUNE_LANES; lane++) {
+            sum->error += error[lane];
+            if (with_gradient) for(int f = 0; f < TUNE_FEATURES; f++) sum->gradient[f] += gradient[f][lane];
+        }
+    }
+}
+
+static double evaluate_set(Tune_Set_Structure *set, const float *weights, float k, int threads, double *gradient)  // mean squared error, gradient if not NULL
+{
+    static Tune_Sum_Structure sums[TUNE_MAX_THREADS]; std::thread workers[TUNE_MAX_THREADS]; double error = 0;
+
+    for(int t = 0; t < threads; t++) {
+        long first = set->block_count * t / threads, last = set->block_count * (t + 1) / threads;
+        workers[t] = std::thread(evaluate_blocks, set->blocks, first, last, weights, k, gradient != NULL, &sums[t]);
+    }
+
+    if (gradient) memset(gradient, 0, sizeof(double) * TUNE_FEATURES);
+    for(int t = 0; t < threads; t++) {
+        workers[t].join(); error += sums[t].error;
+        if (gradient) for(int f = 0; f < TUNE_FEATURES; f++) gradient[f] += sums[t].gradient[f] * 2 * k / set->positions;
+    }
+
+    return error / set->positions;
+}
+
+static float fit_scale(Tune_Set_Structure *set, const float *weights, int threads)  // golden section search for the k with the least error
+{
+    double low = 0.0001, high = 0.02, golden = 0.6180339887;
+    double a = high - golden * (high - low), b = low + golden * (high - low);
+    double error_a = evaluate_set(set, weights, a, threads, NULL), error_b = evaluate_set(set, weights, b, threads, NULL);
+
+    for(int i = 0; i < 40; i++) {
+        if (error_a < error_b) { high = b; b = a; error_b = error_a; a = high - golden * (high - low); error_a = evaluate_set(set, weights, a, threads, NULL); }
+        else { low = a; a = b; error_a = error_b; b = low + golden * (high - low); error_b = evaluate_set(set, weights, b, threads, NULL); }
+    }
+
+    return (float)((low + high) / 2);
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                     OUTPUT                                      ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static void banner_line(FILE *file, const char *text)  // ";   text   ;" padded to the 83 column frame
+{
+    fprintf(file, ";   %-77s ;\n", text);
+}
+
+static int write_weights(const char *path, const float *weights, long positions, double error, float k)
+{
+    FILE *file = fopen(path, "w"); char text[96]; static const char *names[TUNE_MATERIAL] = { "PAWN", "KNIGHT", "BISHOP", "ROOK", "QUEEN" };
+
+    if (!file) { perror(path); return 0; }
+
+    fprintf(file, "/*********************************************************************************\\\n");
+    fprintf(file, ";---------------------------------------------------------------------------------;\n");
+    fprintf(file, ";                       EVALUATION WEIGHTS, written by tune                       ;\n");
+    fprintf(file, ";---------------------------------------------------------------------------------;\n");
+    banner_line(file, "Material and the centre table of the incremental evaluation (chess.cpp).");
+    banner_line(file, "The centre table scores any piece of either colour on its square, ranks 1-4");
+    banner_line(file, "mirror ranks 8-5. src/host/tune.cpp starts from these values and rewrites");
+    snprintf(text, sizeof(text), "the file; tuned on %ld positions, error %.6f at k %.6f.", positions, error, k);
+    banner_line(file, text);
+    fprintf(file, ";---------------------------------------------------------------------------------;\n");
+    fprintf(file, "\\*********************************************************************************/\n\n");
+    fprintf(file, "#ifndef EVAL_WEIGHTS_H\n#define EVAL_WEIGHTS_H\n\n");
+
+    for(int f = 0; f < TUNE_MATERIAL; f++) fprintf(file, "#define EVAL_%s %d\n", names[f], (int)lrintf(weights[f]));
+
+    fprintf(file, "\n// files a..h\n");
+    for(int rank = 8; rank >= 1; rank--) {
+        int row = (rank > 4) ? 8 - rank : rank - 1;  // ranks 1-4 fold onto 8-5
+
+        fprintf(file, "#define EVAL_CENTRE_RANK_%d", rank);
+        for(int file_index = 0; file_index < 8; file_index++) fprintf(file, file_index ? ",%3d" : " %2d", (int)lrintf(weights[TUNE_MATERIAL + row * 8 + file_index]));
+        fprintf(file, "\n");
+    }
+
+    fprintf(file, "\n#endif\n");
+    fclose(file);
+
+    return 1;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                      MAIN                                       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+int main(int argc, char **argv)
+{
+    static Tune_Set_Structure set; float weights[TUNE_FEATURES], k = 0, rate = 1;
+    double gradient[TUNE_FEATURES], moment[TUNE_FEATURES] = {}, velocity[TUNE_FEATURES] = {}, error = 0, start_error, pass_time = 0;
+    const char *output = "include/eval_weights.h"; int iterations = 1000, threads = (int)std::thread::hardware_concurrency(), files = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-i") && i + 1 < argc) iterations = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-r") && i + 1 < argc) rate = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-k") && i + 1 < argc) k = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-j") && i + 1 < argc) threads = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) output = argv[++i];
+        else if (argv[i][0] == '-' && argv[i][1]) { fprintf(stderr, "usage: tune [-i iterations] [-r rate] [-k scale] [-j threads] [-o file] positions...\n"); return 1; }
+        else { std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now(); long before = set.positions;
+               if (!load_positions(&set, argv[i])) return 1;
+               fprintf(stderr, "%s: %ld positions in %.2f s\n", argv[i], set.positions - before, elapsed_seconds(start)); files++; }
+    }
+
+    if (!files || !set.positions) { fprintf(stderr, "no labelled positions\n"); return 1; }
+    if (threads < 1) threads = 1;
+    if (threads > TUNE_MAX_THREADS) threads = TUNE_MAX_THREADS;
+    if (threads > set.block_count) threads = (int)set.block_count;
+    pad_last_block(&set);
+
+    fprintf(stderr, "%ld positions (%ld skipped), %ld bytes packed, %d threads\n", set.positions, set.skipped, set.block_count * (long)sizeof(Tune_Block_Structure), threads);
+    if (set.mismatched) fprintf(stderr, "%ld positions score differently from the engine: the centre table in eval_weights.h isn't mirrored\n", set.mismatched);
+
+    for(int f = 0; f < TUNE_MATERIAL; f++) weights[f] = start_material[f];
+    for(int f = 0; f < TUNE_CENTRE; f++) weights[TUNE_MATERIAL + f] = start_centre[f];
+
+    if (!k) { k = fit_scale(&set, weights, threads); fprintf(stderr, "k %.6f fitted\n", k); }
+    start_error = error = evaluate_set(&set, weights, k, threads, NULL);
+    fprintf(stderr, "start error %.6f\n", start_error);
+
+    for(int i = 1; i <= iterations; i++) { // Adam: a step of about rate in the direction of the averaged gradient
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        error = evaluate_set(&set, weights, k, threads, gradient);
+        pass_time += elapsed_seconds(start);
+
+        for(int f = 0; f < TUNE_FEATURES; f++) {
+            moment[f] = 0.9 * moment[f] + 0.1 * gradient[f]; velocity[f] = 0.999 * velocity[f] + 0.001 * gradient[f] * gradient[f];
+            weights[f] -= rate * (moment[f] / (1 - pow(0.9, i))) / (sqrt(velocity[f] / (1 - pow(0.999, i))) + 1e-12);
+        }
+
+        if (i % 100 == 0 || i == iterations)
+            fprintf(stderr, "pass %5d  error %.6f  %.1f M positions/s\n", i, error, set.positions * (double)i / pass_time / 1e6);
+    }
+
+    error = evaluate_set(&set, weights, k, threads, NULL);
+    fprintf(stderr, "error %.6f -> %.6f\nmaterial", start_error, error);
+    for(int f = 0; f < TUNE_MATERIAL; f++) fprintf(stderr, " %d -> %.0f", start_material[f], weights[f]);
+    fprintf(stderr, "\n");
+
+    return write_weights(output, weights, set.positions, error, k) ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                      nibble-chess UCI engine (native host)                      ;
+;---------------------------------------------------------------------------------;
+;                                                                                 ;
+;   uci - the engine on stdin/stdout for the match harness and UCI GUIs:          ;
+;                                                                                 ;
+;      uci, isready, ucinewgame, quit                                             ;
+;      setoption name Hash value <MB>                                             ;
+;      position [startpos | fen <fen>] [moves <move>...]                          ;
+;      go [depth d] [nodes n] [movetime ms] [wtime ms] [btime ms] [winc ms]       ;
+;         [binc ms] [movestogo n]                                                 ;
+;                                                                                 ;
+;   Each completed iteration prints "info depth score cp nodes time nps pv",      ;
+;   the whole move "info depth nodes time nps", then "bestmove". The search       ;
+;   runs on the reading thread, so "stop" and "go infinite" aren't supported;     ;
+;   a budget is always needed. Builds with different -D SEARCH_xxx flags are      ;
+;   different engines to the match harness (match.cpp).                           ;
+;                                                                                 ;
+\*********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chess.h"
+#include "tt.h"
+
+#define UCI_LINE_LENGTH 8192  // position command of a long game
+
+static Engine_Structure uci_engine;
+static TT_Structure uci_tt;
+
+static void print_iteration(Search_Info_Structure *search_info)
+{
+    unsigned long time = time_ms() - search_info->start_time; char move_string[6];
+
+    printf("info depth %d score cp %d nodes %llu time %lu nps %llu pv", search_info->completed_depth, search_info->best_score, search_info->nodes, time,
+           time ? search_info->nodes * 1000 / time : 0);
+    for(int i = 0; i < search_info->pv_line_length; i++) { move_to_string(search_info->pv_line[i], move_string); printf(" %s", move_string); }
+    printf("\n"); fflush(stdout);
+}
+
+static const char *find_word(const char *line, const char *word)  // the text after word, NULL if missing
+{
+    int length = strlen(word);
+
+    for(const char *cursor = line; (cursor = strstr(cursor, word)); cursor += length)
+        if ((cursor == line || cursor[-1] == ' ') && (cursor[length] == ' ' || !cursor[length])) return cursor + length;
+
+    return NULL;
+}
+
+static long word_value(const char *line, const char *word) { const char *value = find_word(line, word); return value ? atol(value) : 0; }
+
+static void set_up_position(const char *line)
+{
+    Position_Structure position; char fen[FEN_LENGTH]; const char *moves = find_word(line, "moves"), *fen_start = find_word(line, "fen");
+    int length = 0;
+
+    if (fen_start) {
+        while (*fen_start == ' ') fen_start++;
+        while (fen_start[length] && (!moves || fen_start + length < moves - 5) && length < FEN_LENGTH - 1) { fen[length] = fen_start[length]; length++; }
+        fen[length] = 0;
+    }
+
+    if (!fen_start || !load_fen(&position, fen)) load_fen(&position, START_POSITION);
+    set_position(&uci_engine, &position);
+    if (moves && !load_moves(&uci_engine, moves)) printf("info string illegal move in %s\n", moves);
+}
+
+static void go(const char *line)
+{
+    Search_Info_Structure search_info[1]; Search_Limits_Structure limits[1] = {}; char move_string[6] = "0000";
+    int white = uci_engine.position.side == 8;
+
+    limits->depth = word_value(line, "depth"); limits->movetime = word_value(line, "movetime"); limits->nodes = word_value(line, "nodes");
+    limits->time_left = word_value(line, white ? "wtime" : "btime"); limits->increment = word_value(line, white ? "winc" : "binc");
+    limits->moves_to_go = word_value(line, "movestogo");
+
+    memset(search_info, 0, sizeof(*search_info)); search_info->on_iteration = print_iteration;
+    search_iterative(&uci_engine, limits, search_info);
+
+    unsigned long time = time_ms() - search_info->start_time;  // the whole move, the last iteration may be partial
+    printf("info depth %d nodes %llu time %lu nps %llu\n", search_info->completed_depth, search_info->nodes, time, time ? search_info->nodes * 1000 / time : 0);
+
+    if (search_info->best_move) move_to_string(search_info->best_move, move_string);
+    printf("bestmove %s\n", move_string); fflush(stdout);
+}
+
+int main()
+{
+    static char line[UCI_LINE_LENGTH];
+
+    uci_engine.tt = &uci_tt;
+    set_up_position("startpos");
+
+    while (fgets(line, sizeof(line), stdin)) {
+        line[strcspn(line, "\r\n")] = 0;
+
+        if (!strcmp(line, "uci")) printf("id name nibble-chess\nid author Maksim Korzh\noption name Hash type spin default %d min 1 max 4096\nuciok\n", TT_SIZE_KB / 1024);
+        else if (!strcmp(line, "isready")) printf("readyok\n");
+        else if (!strcmp(line, "ucinewgame")) { tt_clear(&uci_tt); memset(uci_engine.history_table, 0, sizeof(uci_engine.history_table)); }
+        else if (!strncmp(line, "setoption", 9) && find_word(line, "Hash")) tt_init(&uci_tt, (size_t)word_value(line, "value") * 1024 * 1024);
+        else if (!strncmp(line, "position", 8)) set_up_position(line);
+        else if (!strncmp(line, "go", 2)) go(line);
+        else if (!strcmp(line, "quit")) break;
+
+        fflush(stdout);
+    }
+
+    return 0;
+}
@@ -3,11 +3,27 @@
 #include <BLEServer.h>
 #include <BLEUtils.h>
 #include <BLE2902.h>
+#include <WiFi.h>
+
+#include "game_server.h"
+#include "search_task.h"
+#include "stats.h"
+#include "wifi_link.h"
+
+#ifndef WIFI_SSID
+#define WIFI_SSID ""  // no network, set NIBBLE_WIFI_SSID and NIBBLE_WIFI_PASSWORD when building
+#define WIFI_PASSWORD ""
+#endif
 
 BLEServer* pServer = NULL;
 BLECharacteristic* pCharacteristic = NULL;
 bool deviceConnected = false;
-uint32_t value = 0;
+Protocol_Structure protocol;
+Transport_Structure ble_transport;
+Book_Structure book;  // mapped from the "book" flash partition, see partitions.csv
+Resume_Structure resume;  // the game in the "resume" flash partition, survives a reset
+Web_Stream_Structure webStream;  // search info over WebSocket once Wi-Fi is up
+bool webStreamOpen = false;
 
 // See the following for generating UUIDs:
 // https://www.uuidgenerator.net/
@@ -15,28 +31,54 @@ uint32_t value = 0;
 #define SERVICE_UUID        "f88918be-312c-4a9b-a7a2-97db83b2e3a9"
 #define CHARACTERISTIC_UUID "82ca99da-f6c3-4eb7-ac2d-ea12cac9af5c"
 
+#if SEARCH_STATS
+#define STATS_CHARACTERISTIC_UUID "526e8355-7e0c-40ad-a457-dddccab04234"  // notifies STATS_RECORD_SIZE byte records, see stats.h
+
+BLECharacteristic* pStatsCharacteristic = NULL;
+#endif
+
+
+// Frames of the binary protocol (protocol.h) are notified on the game characteristic, one per notify
+int ble_send(Transport_Structure* transport, const unsigned char* frame, int length) {
+  if (!deviceConnected) return 0;
+  pCharacteristic->setValue((uint8_t*)frame, length);
+  pCharacteristic->notify();
+  return 1;
+}
 
 class MyServerCallbacks: public BLEServerCallbacks {
     void onConnect(BLEServer* pServer) {
       deviceConnected = true;
+      protocol_resynchronize(&protocol);  // the client numbers its frames from 0 again
       Serial.println("Connected!");
     };
 
     void onDisconnect(BLEServer* pServer) {
       deviceConnected = false;
-      value = 0;
+      game_server_stop();
       Serial.println("Disconnected!");
       pServer->startAdvertising(); // restart advertising
     }
 };
 
 
+// The client writes protocol frames. Runs on the BLE task, so it only reassembles
+// messages; loop() handles them and notifies the answers.
+class GameCallbacks: public BLECharacteristicCallbacks {
+    void onWrite(BLECharacteristic* pCharacteristic) {
+      std::string frame = pCharacteristic->getValue();
+
+      ble_transport.frame_size = pServer->getPeerMTU(pServer->getConnId()) - 3;  // known once the client exchanged MTUs
+      protocol_receive_frame(&protocol, (const unsigned char*)frame.data(), frame.length());
+    }
+};
 
 void setup() {
   Serial.begin(9600);
 
   // Create the BLE Device
   BLEDevice::init("Gambit");
+  BLEDevice::setMTU(PROTOCOL_MAX_FRAME + 3);  // a board snapshot fits one frame if the client accepts
 
   // Create the BLE Server
   pServer = BLEDevice::createServer();
@@ -57,6 +99,35 @@ void setup() {
   // https://www.bluetooth.com/specifications/gatt/viewer?attributeXmlFile=org.bluetooth.descriptor.gatt.client_characteristic_configuration.xml
   // Create a BLE Descriptor
   pCharacteristic->addDescriptor(new BLE2902());
+  pCharacteristic->setCallbacks(new GameCallbacks());
+
+#if SEARCH_STATS
+  // Search statistics of every iteration, instrumented builds only
+  pStatsCharacteristic = pService->createCharacteristic(STATS_CHARACTERISTIC_UUID, BLECharacteristic::PROPERTY_NOTIFY);
+  pStatsCharacteristic->addDescriptor(new BLE2902());
+#endif
+
+  // Opening moves are read in place from flash and played without a search
+  if (book_open(&book, "book")) search_task_book(&book);
+  else Serial.println("No opening book in flash");
+
+  // Engine runs on the other core, loop() only polls its results; a Lazy SMP helper
+  // uses the idle time of the BLE core at a priority below the BLE tasks
+  if (!search_task_start(2)) Serial.println("Search task failed to start!");
+
+  ble_transport.frame_size = PROTOCOL_MIN_FRAME; ble_transport.send = ble_send; ble_transport.context = NULL;
+  protocol_init(&protocol, &ble_transport);
+  game_server_start(&protocol);
+
+  // A game cut off by a reset or brown-out goes on where it was
+  if (!resume_open(&resume, "resume")) Serial.println("No resume partition in flash");
+  else switch (game_server_resume(&resume)) {
+    case 1: Serial.println("Game resumed"); break;
+    case -1: Serial.println("Saved game can't be set up, new game"); break;
+  }
+
+  // Wi-Fi comes up in the background, loop() opens the web stream once it has
+  wifi_link_start(WIFI_SSID, WIFI_PASSWORD);
 
   // Start the service
   pService->start();
@@ -71,11 +142,28 @@ void setup() {
 }
 
 void loop() {
-    // notify changed value
-    if (deviceConnected) {
-        pCharacteristic->setValue(value);
-        pCharacteristic->notify();
-        value++;
-        delay(1000);
+    unsigned char record[STATS_RECORD_SIZE];
+
+    // statistics records, only in SEARCH_STATS builds; decode the log with the host stats-csv tool
+    while (search_task_poll_stats(record)) {
+        Serial.print("stats ");
+        for (int i = 0; i < STATS_RECORD_SIZE; i++) Serial.printf("%02x", record[i]);
+        Serial.println();
+
+#if SEARCH_STATS
+        if (deviceConnected) {
+            pStatsCharacteristic->setValue(record, STATS_RECORD_SIZE);
+            pStatsCharacteristic->notify();
+        }
+#endif
+    }
+
+    // the WebSocket endpoint listens from the first connection on, across reconnects
+    if (wifi_link_poll()) {
+        if (!webStreamOpen && (webStreamOpen = web_stream_open(&webStream, WEB_STREAM_PORT, 0))) game_server_stream(&webStream);
+        Serial.printf("Wi-Fi up, ws://%s:%d\n", WiFi.localIP().toString().c_str(), WEB_STREAM_PORT);
     }
+
+    // client messages, engine moves and batched progress; idle polls sleep a tick
+    if (!game_server_poll()) delay(1);
 }
@@ -0,0 +1,218 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                 BINARY PROTOCOL                                 ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "protocol.h"
+
+static const char nibble_pieces[] = ".-pknbrq-P-KNBRQ";  // piece & 15, '-' - not a piece
+
+static inline int square_64(int square) { return (7 - (square >> 4)) * 8 + (square & 7); }  // 0x88 to a1 = 0
+static inline int square_0x88(int square) { return (7 - (square >> 3)) * 16 + (square & 7); }
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                     FRAMES                                      ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+void protocol_init(Protocol_Structure *protocol, Transport_Structure *transport)
+{
+    Protocol_Message_Structure message;
+
+    protocol->transport = transport;
+    protocol->send_sequence = protocol->receive_sequence = 0; protocol->synchronized = 0;
+    protocol->partial.type = 0; protocol->partial.length = 0;
+    while (protocol->inbox.pop(&message));
+    protocol->progress_count = 0; protocol->progress_time = 0;
+    protocol->frames_sent = protocol->frames_received = protocol->frames_lost = protocol->messages_dropped = 0;
+}
+
+void protocol_resynchronize(Protocol_Structure *protocol)
+{
+    if (protocol->partial.type) protocol->messages_dropped++;
+    protocol->synchronized = 0; protocol->partial.type = 0;
+}
+
+void protocol_receive_frame(Protocol_Structure *protocol, const unsigned char *frame, int length)
+{
+    Protocol_Message_Structure *partial = &protocol->partial; int type, first, more;
+
+    if (length < PROTOCOL_HEADER_SIZE) return;
+    type = frame[1] & ~(PROTOCOL_FIRST | PROTOCOL_MORE); first = frame[1] & PROTOCOL_FIRST; more = frame[1] & PROTOCOL_MORE;
+    protocol->frames_received++;
+
+    if (protocol->synchronized && frame[0] != protocol->receive_sequence) { // gap
+        protocol->frames_lost += (unsigned char)(frame[0] - protocol->receive_sequence);
+        if (partial->type) { protocol->messages_dropped++; partial->type = 0; }
+    }
+    protocol->receive_sequence = frame[0] + 1; protocol->synchronized = 1;
+
+    if (first) {
+        if (partial->type) protocol->messages_dropped++;  // can't happen on an ordered link
+        partial->type = type; partial->length = 0;
+    }
+    else if (!partial->type || partial->type != type) return;  // rest of a message whose start was lost
+
+    length -= PROTOCOL_HEADER_SIZE;
+    if (partial->length + length > PROTOCOL_MAX_MESSAGE) { protocol->messages_dropped++; partial->type = 0; return; }
+    memcpy(partial->payload + partial->length, frame + PROTOCOL_HEADER_SIZE, length); partial->length += length;
+
+    if (more) return;
+    if (!protocol->inbox.push(partial)) protocol->messages_dropped++;  // consumer behind
+    partial->type = 0;
+}
+
+int protocol_poll(Protocol_Structure *protocol, Protocol_Message_Structure *message) { return protocol->inbox.pop(message); }
+
+int protocol_send(Protocol_Structure *protocol, int type, const unsigned char *payload, int length)
+{
+    Transport_Structure *transport = protocol->transport; unsigned char frame[PROTOCOL_MAX_FRAME];
+    int frame_size = (transport->frame_size < PROTOCOL_MIN_FRAME) ? PROTOCOL_MIN_FRAME : (transport->frame_size > PROTOCOL_MAX_FRAME) ? PROTOCOL_MAX_FRAME : transport->frame_size;
+    int chunk = frame_size - PROTOCOL_HEADER_SIZE, sent = 0;
+
+    do { // an empty message is one header only frame
+        int size = (length - sent < chunk) ? length - sent : chunk;
+
+        frame[0] = protocol->send_sequence++; frame[1] = type | (sent ? 0 : PROTOCOL_FIRST) | ((sent + size < length) ? PROTOCOL_MORE : 0);
+        memcpy(frame + PROTOCOL_HEADER_SIZE, payload + sent, size);
+        if (!transport->send(transport, frame, size + PROTOCOL_HEADER_SIZE)) return 0;  // the sequence gap tells the receiver
+        protocol->frames_sent++; sent += size;
+    } while (sent < length);
+
+    return 1;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    PROGRESS                                     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+void protocol_queue_progress(Protocol_Structure *protocol, const Protocol_Progress_Structure *progress)
+{
+    unsigned char *entry;
+
+    if (protocol->progress_count == PROTOCOL_MAX_PROGRESS) protocol_flush_progress(protocol, 1);
+
+    entry = protocol->progress + 1 + protocol->progress_count++ * PROTOCOL_PROGRESS_SIZE;
+    entry[0] = (unsigned char)progress->depth; protocol_put_u16(entry + 1, (unsigned int)progress->score);
+    protocol_put_u16(entry + 3, protocol_encode_move(progress->move));
+    protocol_put_u32(entry + 5, progress->nodes); protocol_put_u32(entry + 9, progress->time);
+}
+
+int protocol_flush_progress(Protocol_Structure *protocol, int force)
+{
+    unsigned long now = time_ms();
+
+    if (!protocol->progress_count || (!force && now - protocol->progress_time < PROTOCOL_PROGRESS_MS)) return 0;
+
+    protocol->progress[0] = (unsigned char)protocol->progress_count;
+    protocol_send(protocol, PROTOCOL_PROGRESS, protocol->progress, 1 + protocol->progress_count * PROTOCOL_PROGRESS_SIZE);
+    protocol->progress_count = 0; protocol->progress_time = now;
+
+    return 1;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                MOVES AND BOARDS                                 ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+unsigned int protocol_encode_move(Move move)
+{
+    if (!move) return 0;
+    return square_64(MOVE_SOURCE(move)) | square_64(MOVE_TARGET(move)) << 6 | (MOVE_PROMOTED(move) ? MOVE_PROMOTED(move) - 3 : 0) << 12;  // knight 4 .. queen 7
+}
+
+Move protocol_decode_move(Engine_Structure *engine, unsigned int move)
+{
+    char move_string[6]; int source_square = square_0x88(move & 63), target_square = square_0x88(move >> 6 & 63), promoted = move >> 12;
+
+    if (promoted > 4) return 0;
+
+    move_string[0] = 'a' + (source_square & 7); move_string[1] = '8' - (source_square >> 4);
+    move_string[2] = 'a' + (target_square & 7); move_string[3] = '8' - (target_square >> 4);
+    move_string[4] = promoted ? "nbrq"[promoted - 1] : 0; move_string[5] = 0;
+
+    return parse_move(engine, move_string);
+}
+
+void protocol_encode_board(Position_Structure *position, unsigned char *board)
+{
+    int *board_array = position->board_array, castling = 0;
+
+    memset(board, 0, PROTOCOL_BOARD_SIZE);
+    for(int square = 0; square < 64; square++) board[square >> 1] |= (board_array[square_0x88(square)] & 15) << ((square & 1) * 4);
+
+    for(int king = 0x74, bit = 1; king >= 0x04; king -= 0x70, bit <<= 2) { // virgin king and rook, as in position_to_fen
+        if (!(board_array[king] & 32) || (board_array[king] & 7) != 3) continue;
+        if (board_array[king + 3] & 32 && (board_array[king + 3] & 7) == 6) castling |= bit;
+        if (board_array[king - 4] & 32 && (board_array[king - 4] & 7) == 6) castling |= bit << 1;
+    }
+
+    board[32] = (position->side == 8) ? 0 : 1; board[33] = (unsigned char)castling;
+    board[34] = (!(position->en_passant & 0x88) && ((position->en_passant >> 4) == 2 || (position->en_passant >> 4) == 5)) ? square_64(position->en_passant) : 255;  // castling skip squares aren't e.p. squares
+}
+
+int protocol_decode_board(const unsigned char *board, char *fen)
+{
+    char *field = fen; int kings[2] = { 0, 0 };
+
+    for(int rank = 7; rank >= 0; rank--) {
+        int empty = 0;
+
+        for(int file = 0; file < 8; file++) {
+            int square = rank * 8 + file, piece = board[square >> 1] >> ((square & 1) * 4) & 15;
+
+            if (!piece) { empty++; continue; }
+            if (nibble_pieces[piece] == '-') return 0;
+            if ((piece & 7) == 3) kings[piece >> 3]++;
+            if (empty) *field++ = '0' + empty;
+            *field++ = nibble_pieces[piece]; empty = 0;
+        }
+
+        if (empty) *field++ = '0' + empty;
+        if (rank) *field++ = '/';
+    }
+
+    if (kings[0] != 1 || kings[1] != 1 || board[32] > 1 || board[33] > 15 || (board[34] != 255 && (board[34] >> 3 != 2 && board[34] >> 3 != 5))) return 0;
+
+    field += sprintf(field, " %c ", board[32] ? 'b' : 'w');
+    for(int i = 0; i < 4; i++) if (board[33] >> i & 1) *field++ = "KQkq"[i];
+    if (!board[33]) *field++ = '-';
+    if (board[34] == 255) sprintf(field, " -");
+    else sprintf(field, " %c%c", 'a' + (board[34] & 7), '1' + (board[34] >> 3));
+
+    return 1;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    LOOPBACK                                     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#if !defined(ESP_PLATFORM)
+
+static int loopback_send(Transport_Structure *transport, const unsigned char *frame, int length)
+{
+    protocol_receive_frame((Protocol_Structure *)transport->context, frame, length);
+    return 1;
+}
+
+void loopback_connect(Protocol_Structure *a, Protocol_Structure *b, Transport_Structure transports[2], int frame_size)
+{
+    transports[0].frame_size = transports[1].frame_size = frame_size;
+    transports[0].send = transports[1].send = loopback_send;
+    transports[0].context = b; transports[1].context = a;
+
+    protocol_init(a, &transports[0]); protocol_init(b, &transports[1]);
+}
+
+#endif
@@ -0,0 +1,326 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                   FAST RESUME                                   ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include <esp_partition.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "resume.h"
+
+#define RECORD_MAGIC 0xa5
+#define RECORD_GAME 1
+#define RECORD_MOVE 2
+#define RECORD_TABLE 3
+
+#define RECORD_HEADER_SIZE 12  // magic, type, length u16, sequence u32, CRC-32 of type..sequence and the payload
+#define GAME_SIZE (2 + 16 + PROTOCOL_BOARD_SIZE + 2)  // without the moves, 2 bytes each
+#define MOVE_SIZE 11
+#define TABLE_ENTRY_SIZE 16  // key u64, move u32, score i16, depth u8, flags u8
+
+static inline int record_size(int length) { return (RECORD_HEADER_SIZE + length + 3) & ~3; }  // records start 4 byte aligned
+
+static unsigned int crc32(unsigned int crc, const unsigned char *data, int length)  // nibble table, 64 bytes instead of 1 KB
+{
+    static const unsigned int table[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+        0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+    };
+
+    crc = ~crc;
+    for(int i = 0; i < length; i++) { crc ^= data[i]; crc = (crc >> 4) ^ table[crc & 15]; crc = (crc >> 4) ^ table[crc & 15]; }
+
+    return ~crc;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                     FLASH                                       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#if defined(ESP_PLATFORM)
+
+static int flash_read(Resume_Structure *resume, unsigned long offset, void *data, int size)
+{
+    return esp_partition_read((const esp_partition_t *)resume->handle, offset, data, size) == ESP_OK;
+}
+
+static int flash_write(Resume_Structure *resume, unsigned long offset, const void *data, int size)
+{
+    return esp_partition_write((const esp_partition_t *)resume->handle, offset, data, size) == ESP_OK;
+}
+
+static int flash_erase(Resume_Structure *resume, int sector)
+{
+    return esp_partition_erase_range((const esp_partition_t *)resume->handle, (size_t)sector * RESUME_SECTOR_SIZE, RESUME_SECTOR_SIZE) == ESP_OK;
+}
+
+static int flash_open(Resume_Structure *resume, const char *name)
+{
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name);
+
+    if (!partition) return 0;
+    resume->handle = (unsigned long)partition; resume->size = partition->size;
+
+    return 1;
+}
+
+static void flash_close(Resume_Structure *resume) {}
+
+#else
+
+static int flash_read(Resume_Structure *resume, unsigned long offset, void *data, int size)
+{
+    return pread((int)resume->handle, data, size, offset) == size;
+}
+
+static int flash_write(Resume_Structure *resume, unsigned long offset, const void *data, int size)  // clears bits only, as NOR flash does
+{
+    unsigned char old[RESUME_SECTOR_SIZE];
+
+    if (size > RESUME_SECTOR_SIZE || !flash_read(resume, offset, old, size)) return 0;
+    for(int i = 0; i < size; i++) old[i] &= ((const unsigned char *)data)[i];
+
+    return pwrite((int)resume->handle, old, size, offset) == size;
+}
+
+static int flash_erase(Resume_Structure *resume, int sector)
+{
+    unsigned char erased[RESUME_SECTOR_SIZE];
+
+    memset(erased, 0xff, sizeof(erased));
+    return pwrite((int)resume->handle, erased, RESUME_SECTOR_SIZE, (off_t)sector * RESUME_SECTOR_SIZE) == RESUME_SECTOR_SIZE;
+}
+
+static int flash_open(Resume_Structure *resume, const char *name)
+{
+    struct stat status; int file = open(name, O_RDWR | O_CREAT, 0644);
+
+    if (file < 0) return 0;
+    resume->handle = (unsigned long)file;
+
+    if (fstat(file, &status)) { close(file); return 0; }
+    resume->size = status.st_size;
+    if (resume->size >= 2 * RESUME_SECTOR_SIZE && !(resume->size % RESUME_SECTOR_SIZE)) return 1;
+
+    // new or foreign file, erased to the size of the partition
+    if (ftruncate(file, RESUME_HOST_SIZE)) { close(file); return 0; }
+    resume->size = RESUME_HOST_SIZE;
+    for(int sector = 0; sector < RESUME_HOST_SIZE / RESUME_SECTOR_SIZE; sector++) if (!flash_erase(resume, sector)) { close(file); return 0; }
+
+    return 1;
+}
+
+static void flash_close(Resume_Structure *resume) { close((int)resume->handle); }
+
+#endif
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    RECORDS                                      ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static int write_record(Resume_Structure *resume, int type, const unsigned char *payload, int length)  // at the current place, which has room
+{
+    unsigned char header[RECORD_HEADER_SIZE]; unsigned long offset = (unsigned long)resume->sector * RESUME_SECTOR_SIZE + resume->offset;
+
+    header[0] = RECORD_MAGIC; header[1] = (unsigned char)type; protocol_put_u16(header + 2, length);
+    protocol_put_u32(header + 4, resume->sequence + 1);
+    protocol_put_u32(header + 8, crc32(crc32(0, header + 1, 7), payload, length));
+
+    // payload first, the header makes the record valid; a cut in between leaves an unreadable record
+    if (!flash_write(resume, offset + RECORD_HEADER_SIZE, payload, length) || !flash_write(resume, offset, header, RECORD_HEADER_SIZE)) return 0;
+
+    resume->sequence++; resume->offset += record_size(length); resume->writes++;
+    return 1;
+}
+
+static int read_record(Resume_Structure *resume, int sector, int offset, int *type, unsigned long *sequence, unsigned char *payload, int *length)  // 0 if erased or torn
+{
+    unsigned char header[RECORD_HEADER_SIZE]; unsigned long start = (unsigned long)sector * RESUME_SECTOR_SIZE + offset;
+
+    if (offset + RECORD_HEADER_SIZE > RESUME_SECTOR_SIZE || !flash_read(resume, start, header, RECORD_HEADER_SIZE) || header[0] != RECORD_MAGIC) return 0;
+
+    *type = header[1]; *length = protocol_get_u16(header + 2); *sequence = protocol_get_u32(header + 4);
+    if (offset + record_size(*length) > RESUME_SECTOR_SIZE || !flash_read(resume, start + RECORD_HEADER_SIZE, payload, *length)) return 0;
+
+    return crc32(crc32(0, header + 1, 7), payload, *length) == protocol_get_u32(header + 8);
+}
+
+static int encode_game(Resume_Game_Structure *game, unsigned char *payload)  // length
+{
+    payload[0] = (unsigned char)game->engine_side; payload[1] = (unsigned char)game->clock_running;
+    protocol_put_u32(payload + 2, game->clock_base); protocol_put_u32(payload + 6, game->clock_increment);
+    protocol_put_u32(payload + 10, game->clock_left[0]); protocol_put_u32(payload + 14, game->clock_left[1]);
+    memcpy(payload + 18, game->start, PROTOCOL_BOARD_SIZE);
+    protocol_put_u16(payload + 18 + PROTOCOL_BOARD_SIZE, game->move_count);
+    for(int i = 0; i < game->move_count; i++) protocol_put_u16(payload + GAME_SIZE + 2 * i, game->moves[i]);
+
+    return GAME_SIZE + 2 * game->move_count;
+}
+
+static int decode_game(const unsigned char *payload, int length, Resume_Game_Structure *game)  // 0 if malformed
+{
+    int move_count = length >= GAME_SIZE ? protocol_get_u16(payload + 18 + PROTOCOL_BOARD_SIZE) : -1;
+
+    if (move_count < 0 || move_count > RESUME_MAX_MOVES || length != GAME_SIZE + 2 * move_count) return 0;
+
+    game->engine_side = payload[0]; game->clock_running = payload[1];
+    game->clock_base = protocol_get_u32(payload + 2); game->clock_increment = protocol_get_u32(payload + 6);
+    game->clock_left[0] = protocol_get_u32(payload + 10); game->clock_left[1] = protocol_get_u32(payload + 14);
+    memcpy(game->start, payload + 18, PROTOCOL_BOARD_SIZE);
+    game->move_count = move_count;
+    for(int i = 0; i < move_count; i++) game->moves[i] = (unsigned short)protocol_get_u16(payload + GAME_SIZE + 2 * i);
+
+    return 1;
+}
+
+static int open_sector(Resume_Structure *resume)  // erase the next sector and write the whole game first
+{
+    static unsigned char payload[GAME_SIZE + 2 * RESUME_MAX_MOVES];  // one task saves, kept off its stack
+    int sector = (resume->sector + 1) % resume->sector_count;
+
+    if (!flash_erase(resume, sector)) return 0;
+    resume->erases++; resume->sector = sector; resume->offset = 0;
+
+    return write_record(resume, RECORD_GAME, payload, encode_game(&resume->game, payload));
+}
+
+static int append_record(Resume_Structure *resume, int type, const unsigned char *payload, int length)
+{
+    if (resume->offset + record_size(length) <= RESUME_SECTOR_SIZE) return write_record(resume, type, payload, length);
+    if (!open_sector(resume)) return 0;
+
+    return type != RECORD_TABLE || write_record(resume, type, payload, length);  // the new sector's GAME record already holds the game or move
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    INTERFACE                                    ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+int resume_open(Resume_Structure *resume, const char *name)
+{
+    memset(resume, 0, sizeof(*resume));
+    if (!flash_open(resume, name)) return 0;
+
+    resume->sector_count = resume->size / RESUME_SECTOR_SIZE;
+    if (resume->sector_count < 2) { flash_close(resume); return 0; }  // no room to keep one sector while the next is written
+
+    resume->sector = resume->sector_count - 1; resume->offset = RESUME_SECTOR_SIZE;  // the first record opens sector 0
+    return 1;
+}
+
+void resume_close(Resume_Structure *resume) { flash_close(resume); }
+
+int resume_load(Resume_Structure *resume)
+{
+    static unsigned char payload[RESUME_SECTOR_SIZE];
+    int newest = -1, type, length; unsigned long sequence, newest_sequence = 0;
+
+    for(int sector = 0; sector < resume->sector_count; sector++)
+        if (read_record(resume, sector, 0, &type, &sequence, payload, &length) && type == RECORD_GAME && (newest < 0 || sequence > newest_sequence)) {
+            newest = sector; newest_sequence = sequence;
+        }
+
+    if (newest < 0) return 0;
+
+    for(int offset = 0; read_record(resume, newest, offset, &type, &sequence, payload, &length); offset += record_size(length)) {
+        if (type == RECORD_GAME && !decode_game(payload, length, &resume->game)) break;
+
+        if (type == RECORD_MOVE) {
+            if (length != MOVE_SIZE || resume->game.move_count >= RESUME_MAX_MOVES) break;
+            resume->game.moves[resume->game.move_count++] = (unsigned short)protocol_get_u16(payload);
+            resume->game.clock_running = payload[2];
+            resume->game.clock_left[0] = protocol_get_u32(payload + 3); resume->game.clock_left[1] = protocol_get_u32(payload + 7);
+        }
+
+        resume->sequence = sequence;
+    }
+
+    resume->sector = newest; resume->offset = RESUME_SECTOR_SIZE;  // a torn tail is never written over
+    return 1;
+}
+
+int resume_load_table(Resume_Structure *resume, TT_Structure *tt)
+{
+    static unsigned char payload[RESUME_SECTOR_SIZE];
+    int type, length, table_offset = -1, count = 0;
+    unsigned long sequence;
+
+    // the last TABLE record after the last GAME record, an older game's entries are of no use
+    for(int offset = 0; read_record(resume, resume->sector, offset, &type, &sequence, payload, &length); offset += record_size(length)) {
+        if (type == RECORD_GAME) table_offset = -1;
+        if (type == RECORD_TABLE) table_offset = offset;
+    }
+
+    if (table_offset < 0 || !read_record(resume, resume->sector, table_offset, &type, &sequence, payload, &length)) return 0;
+    if (length < 2 || length != 2 + TABLE_ENTRY_SIZE * (count = protocol_get_u16(payload))) return 0;
+
+    tt_new_search(tt);  // allocates a table not configured yet, the entries count as the last search
+    for(int i = 0; i < count; i++) {
+        const unsigned char *entry = payload + 2 + TABLE_ENTRY_SIZE * i;
+        unsigned long long key = (unsigned long long)protocol_get_u32(entry + 4) << 32 | protocol_get_u32(entry);
+
+        tt_store(tt, key, entry[14], entry[15] & 3, (short)protocol_get_u16(entry + 12), protocol_get_u32(entry + 8));
+    }
+
+    return count;
+}
+
+int resume_save_game(Resume_Structure *resume)
+{
+    static unsigned char payload[GAME_SIZE + 2 * RESUME_MAX_MOVES];
+
+    return append_record(resume, RECORD_GAME, payload, encode_game(&resume->game, payload));
+}
+
+int resume_save_move(Resume_Structure *resume, unsigned int move, const unsigned long clock_left[2], int clock_running)
+{
+    unsigned char payload[MOVE_SIZE];
+
+    if (resume->game.move_count >= RESUME_MAX_MOVES) return 0;  // the game is kept as it was at the limit
+
+    resume->game.moves[resume->game.move_count++] = (unsigned short)move; resume->game.clock_running = clock_running;
+    resume->game.clock_left[0] = clock_left[0]; resume->game.clock_left[1] = clock_left[1];
+
+    protocol_put_u16(payload, move); payload[2] = (unsigned char)clock_running;
+    protocol_put_u32(payload + 3, clock_left[0]); protocol_put_u32(payload + 7, clock_left[1]);
+
+    return append_record(resume, RECORD_MOVE, payload, MOVE_SIZE);
+}
+
+int resume_save_table(Resume_Structure *resume, TT_Structure *tt)
+{
+#if RESUME_TABLE_ENTRIES
+    static unsigned long long keys[RESUME_TABLE_ENTRIES]; static TT_Entry_Structure entries[RESUME_TABLE_ENTRIES];
+    static unsigned char payload[2 + TABLE_ENTRY_SIZE * RESUME_TABLE_ENTRIES];
+    int count = tt_hot_entries(tt, keys, entries, RESUME_TABLE_ENTRIES);
+
+    if (!count) return 0;
+
+    protocol_put_u16(payload, count);
+    for(int i = 0; i < count; i++) {
+        unsigned char *entry = payload + 2 + TABLE_ENTRY_SIZE * i;
+
+        protocol_put_u32(entry, (unsigned long)(keys[i] & 0xffffffff)); protocol_put_u32(entry + 4, (unsigned long)(keys[i] >> 32));
+        protocol_put_u32(entry + 8, entries[i].move); protocol_put_u16(entry + 12, (unsigned short)entries[i].score);
+        entry[14] = entries[i].depth; entry[15] = entries[i].flags;
+    }
+
+    return append_record(resume, RECORD_TABLE, payload, 2 + TABLE_ENTRY_SIZE * count);
+#else
+    return 0;
+#endif
+}
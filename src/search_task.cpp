@@ -0,0 +1,278 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                  SEARCH TASK                                    ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <string.h>
+#include <atomic>
+
+#if defined(ESP_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#include "book.h"
+#include "search_task.h"
+#include "smp.h"
+#include "spsc_queue.h"
+#include "stats.h"
+#include "tt.h"
+
+#if defined(ESP_PLATFORM)
+#if defined(CONFIG_BT_CONTROLLER_PINNED_TO_CORE)
+#define SEARCH_TASK_CORE (1 - CONFIG_BT_CONTROLLER_PINNED_TO_CORE)  // the core without the BLE controller
+#else
+#define SEARCH_TASK_CORE 1
+#endif
+#define SEARCH_TASK_STACK_SIZE 16384  // bytes, peak search use is ~5 KB at depth 8
+#define SEARCH_TASK_PRIORITY 1  // same as loop(), they share the core by time slicing
+#endif
+
+static Spsc_Queue_Structure<Search_Request_Structure, 2> request_queue;
+static Spsc_Queue_Structure<Search_Result_Structure, 8> result_queue;
+
+#if SEARCH_STATS
+typedef struct { unsigned char bytes[STATS_RECORD_SIZE]; } Stats_Bytes_Structure;
+static Spsc_Queue_Structure<Stats_Bytes_Structure, 32> stats_queue;  // records are dropped while the consumer is behind
+static Stats_Structure task_stats;
+#endif
+
+static Search_Info_Structure task_search_info;  // static, too big for the task stack
+static Engine_Structure task_engine;
+static TT_Structure task_tt;  // shared with the helpers
+static Smp_Helper_Structure task_helpers[SMP_MAX_THREADS - 1];
+static int task_helper_count = 0;
+static const Book_Structure *task_book = NULL;
+static Search_Request_Structure task_request, task_next_request;
+static std::atomic<int> task_running{0};
+static std::atomic<unsigned> task_submits{0}, task_cancelled{0};  // requests queued, all up to this one cancelled (set before stop)
+static unsigned task_popped = 0;  // requests taken, the number of the one searched; runs ahead of task_submits until the submit counts its push
+static std::atomic<int> task_ponder_hit{0}, task_search_id{0};  // id of the last ponder hit, may arrive before its search starts
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                  TASK WAKE UP                                   ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#if defined(ESP_PLATFORM)
+
+static TaskHandle_t task_handle = NULL;
+
+static void wake_task() { if (task_handle) xTaskNotifyGive(task_handle); }
+static void wait_for_request() { ulTaskNotifyTake(pdTRUE, portMAX_DELAY); }  // notifications are counted, a wake up can't be lost
+static void wait_ms(int ms) { vTaskDelay(pdMS_TO_TICKS(ms) ? pdMS_TO_TICKS(ms) : 1); }
+
+#else
+
+static std::thread task_thread;
+static std::mutex wake_mutex;
+static std::condition_variable wake_condition;
+
+static void wake_task()
+{
+    { std::lock_guard<std::mutex> lock(wake_mutex); }  // orders the notify after a concurrent emptiness check
+    wake_condition.notify_one();
+}
+
+static void wait_for_request()
+{
+    std::unique_lock<std::mutex> lock(wake_mutex);
+    wake_condition.wait(lock, [] { return !request_queue.empty() || !task_running.load(); });
+}
+
+static void wait_ms(int ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+#endif
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                     SEARCH                                      ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static void post_result(Search_Info_Structure *search_info, int final, int stopped)
+{
+    Search_Result_Structure result;
+
+    result.id = task_request.id; result.final = final; result.stopped = stopped;
+    result.depth = search_info->completed_depth; result.score = search_info->best_score; result.best_move = search_info->best_move;
+    result.nodes = search_info->nodes; result.time = time_ms() - search_info->start_time;
+    result.ponder_move = (search_info->pv_line_length > 1 && search_info->pv_line[0] == result.best_move) ? search_info->pv_line[1] : 0;
+    move_to_string(result.best_move, result.move_string); move_to_string(result.ponder_move, result.ponder_string);
+    if (!result.ponder_move) result.ponder_string[0] = 0;
+    result.line_count = search_info->line_count; memcpy(result.lines, search_info->lines, sizeof(Pv_Line_Structure) * result.line_count);
+
+    if (!result.line_count && search_info->pv_line_length) { // a single PV search reports its principal variation as the one line
+        Pv_Line_Structure *line = &result.lines[0];
+
+        line->score = result.score; line->length = (search_info->pv_line_length < MULTI_PV_LENGTH) ? search_info->pv_line_length : MULTI_PV_LENGTH;
+        memcpy(line->moves, search_info->pv_line, sizeof(Move) * line->length); result.line_count = 1;
+    }
+
+    if (!final) { result_queue.push(&result); return; }  // progress is dropped while the consumer is behind
+    while (!result_queue.push(&result) && task_running.load()) wait_ms(1);
+}
+
+static void post_superseded(int id)  // final result of a queued request a newer one replaced before it started
+{
+    Search_Result_Structure result;
+
+    memset(&result, 0, sizeof(result)); result.id = id; result.final = 1; result.stopped = 1;
+    while (!result_queue.push(&result) && task_running.load()) wait_ms(1);
+}
+
+static int stopped_from_outside() { return task_cancelled.load() >= task_popped || (int)(task_submits.load() - task_popped) > 0; }  // cancelled or superseded
+
+static void poll_requests(Search_Info_Structure *search_info) { if (stopped_from_outside()) search_info->stop = 1; }  // every 2048 nodes, a newer request stops the search
+
+static void post_iteration(Search_Info_Structure *search_info)
+{
+#if SEARCH_STATS
+    unsigned char records[2][STATS_RECORD_SIZE];
+    int count = stats_iteration(&task_stats, search_info, records);
+
+    for(int i = 0; i < count; i++) stats_queue.push((Stats_Bytes_Structure *)records[i]);
+#endif
+
+    post_result(search_info, 0, 0);
+}
+
+static void run_search()
+{
+    Search_Info_Structure *search_info = &task_search_info; Position_Structure game;
+
+    memset((void *)search_info, 0, sizeof(*search_info));  // clears stop, a cancel or submit since the pop stops it again below
+    task_search_id.store(task_request.id);
+    search_info->pondering = task_request.ponder && task_ponder_hit.load() != task_request.id;
+    if (task_request.new_game) { tt_clear(&task_tt); memset(task_engine.history_table, 0, sizeof(task_engine.history_table)); }
+
+    search_info->start_time = time_ms();
+    search_info->on_poll = poll_requests; poll_requests(search_info);  // cancelled or superseded while starting
+    if (search_info->stop) { post_result(search_info, 1, 1); return; }
+    if (!load_fen(&game, task_request.fen[0] ? task_request.fen : START_POSITION)) { post_result(search_info, 1, 1); return; }
+    set_position(&task_engine, &game);
+    if (!load_moves(&task_engine, task_request.moves)) { post_result(search_info, 1, 1); return; }
+
+    if (task_book && !task_request.limits.multi_pv) search_info->best_move = book_move(task_book, &task_engine, (unsigned int)(time_ms() * 2654435761u) | 1);  // weighted pick, varies from game to game
+
+    if (!search_info->best_move) { // out of book
+#if SEARCH_STATS
+        stats_start(&task_stats, task_request.id);
+#endif
+        search_info->on_iteration = post_iteration;
+        search_parallel(&task_engine, task_helpers, task_helper_count, &task_request.limits, search_info);  // helpers, if any, run on the other core
+    }
+    while (search_info->pondering && !search_info->stop) { poll_requests(search_info); wait_ms(1); }  // depth limit or mate reached before the ponder hit
+    post_result(search_info, 1, stopped_from_outside());  // rather than out of time
+}
+
+static void start_threads(int threads)  // before the task exists, nothing reads these concurrently
+{
+    task_helper_count = (threads < 1) ? 0 : (threads > SMP_MAX_THREADS) ? SMP_MAX_THREADS - 1 : threads - 1;
+    task_engine.tt = &task_tt;
+}
+
+static void search_task_loop()
+{
+    while (task_running.load()) {
+        if (!request_queue.pop(&task_request)) { wait_for_request(); continue; }
+        for(task_popped++; request_queue.pop(&task_next_request); task_popped++) { post_superseded(task_request.id); task_request = task_next_request; }  // newest request wins
+
+        run_search();
+    }
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    INTERFACE                                    ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#if defined(ESP_PLATFORM)
+
+static void search_task(void *parameters)
+{
+    search_task_loop();
+
+    task_handle = NULL;
+    vTaskDelete(NULL);
+}
+
+int search_task_start(int threads)
+{
+    if (task_running.exchange(1)) return 1;
+
+    start_threads(threads);
+    if (xTaskCreatePinnedToCore(search_task, "search", SEARCH_TASK_STACK_SIZE, NULL, SEARCH_TASK_PRIORITY, &task_handle, SEARCH_TASK_CORE) != pdPASS) {
+        task_running.store(0);
+        return 0;
+    }
+
+    return 1;
+}
+
+void search_task_stop()
+{
+    if (!task_running.exchange(0)) return;
+
+    search_task_cancel();
+    wake_task();
+}
+
+#else
+
+int search_task_start(int threads)
+{
+    if (task_running.exchange(1)) return 1;
+
+    start_threads(threads);
+    task_thread = std::thread(search_task_loop);
+
+    return 1;
+}
+
+void search_task_stop()
+{
+    if (!task_running.exchange(0)) return;
+
+    search_task_cancel();
+    wake_task();
+    task_thread.join();
+}
+
+#endif
+
+int search_task_submit(const Search_Request_Structure *request)
+{
+    if (!request_queue.push(request)) return 0;  // the running search goes on
+    task_submits.fetch_add(1);  // the search sees it on its next poll and stops, a search of this request doesn't
+
+    wake_task();
+
+    return 1;
+}
+
+void search_task_book(const Book_Structure *book) { task_book = (book && book->entries) ? book : NULL; }
+
+void search_task_cancel() { task_cancelled.store(task_submits.load()); task_search_info.stop = 1; }  // every request submitted so far
+
+void search_task_ponder_hit(int id)
+{
+    task_ponder_hit.store(id);
+    if (task_search_id.load() == id) task_search_info.pondering = 0;  // a search not started yet sees task_ponder_hit instead
+}
+
+int search_task_poll(Search_Result_Structure *result) { return result_queue.pop(result); }
+
+TT_Structure *search_task_table() { return &task_tt; }
+
+#if SEARCH_STATS
+int search_task_poll_stats(unsigned char *record) { return stats_queue.pop((Stats_Bytes_Structure *)record); }
+#endif
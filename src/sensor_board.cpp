@@ -0,0 +1,85 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                  SENSOR BOARD                                   ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <stdlib.h>
+
+#include "sensor_board.h"
+
+static inline unsigned long long square_bit(int square) { return 1ULL << ((7 - (square >> 4)) * 8 + (square & 7)); }  // 0x88 to sensor bit
+
+static int compare_changed(const void *a, const void *b)
+{
+    unsigned long long x = ((const Sensor_Move_Structure *)a)->changed, y = ((const Sensor_Move_Structure *)b)->changed;
+
+    return (x > y) - (x < y);
+}
+
+unsigned long long position_occupancy(Position_Structure *position)
+{
+    unsigned long long occupancy = 0;
+
+    for(int square = 0; square < 128; square++) if (!(square & 0x88) && position->board_array[square] & 24) occupancy |= square_bit(square);
+    return occupancy;
+}
+
+void sensor_board_set_position(Sensor_Board_Structure *board, Engine_Structure *engine)
+{
+    Move moves[MAX_MOVES]; int count = generate_legal_moves(engine, moves);
+
+    for(int i = 0; i < count; i++) {
+        Move move = moves[i]; unsigned long long changed = square_bit(MOVE_SOURCE(move));
+
+        if (!MOVE_CAPTURE(move) || move & MOVE_EN_PASSANT) changed |= square_bit(MOVE_TARGET(move));  // a capture leaves the target occupied
+        if (move & MOVE_EN_PASSANT) changed |= square_bit(MOVE_CAPTURED_SQUARE(move));
+        if (move & MOVE_CASTLING) changed |= square_bit(MOVE_ROOK_SQUARE(move)) | square_bit(MOVE_SKIP_SQUARE(move));
+
+        board->moves[i].changed = changed; board->moves[i].move = move;
+    }
+
+    qsort(board->moves, count, sizeof(Sensor_Move_Structure), compare_changed);
+    board->move_count = count;
+
+    board->position = board->settled = position_occupancy(&engine->position); board->lifted = 0;
+    if (board->promotion < 4 || board->promotion > 7) board->promotion = 7;
+}
+
+static int resolve(Sensor_Board_Structure *board, Move *move)
+{
+    unsigned long long changed = board->position ^ board->settled; int low = 0, high = board->move_count, found = 0;
+
+    if (!changed) { board->lifted = 0; return SENSOR_NONE; }  // back as it was, e.g. a piece touched and put back
+
+    while (low < high) { // first move changing these squares
+        int middle = (low + high) / 2;
+
+        if (board->moves[middle].changed < changed) low = middle + 1;
+        else high = middle;
+    }
+
+    for (; low < board->move_count && board->moves[low].changed == changed; low++) {
+        Move candidate = board->moves[low].move;
+
+        if (MOVE_CAPTURE(candidate) && !(candidate & MOVE_EN_PASSANT) && !(board->lifted & square_bit(MOVE_TARGET(candidate)))) continue;  // its victim never left
+        if (MOVE_PROMOTED(candidate) && MOVE_PROMOTED(candidate) != board->promotion) continue;
+        if (found && MOVE_TARGET(candidate) != MOVE_TARGET(*move)) return SENSOR_UNRESOLVED;  // two victims lifted
+
+        *move = candidate; found = 1;
+    }
+
+    return found ? SENSOR_MOVE : SENSOR_UNRESOLVED;
+}
+
+int sensor_board_update(Sensor_Board_Structure *board, unsigned long long reading, unsigned long now, Move *move)
+{
+    board->lifted |= board->position & ~reading;  // every reading, a victim may be swapped for the capturing piece within the settle time
+
+    if (reading != board->reading) { board->reading = reading; board->reading_time = now; }
+    if (reading == board->settled || now - board->reading_time < SENSOR_SETTLE_MS) return (board->settled == board->position) ? SENSOR_NONE : SENSOR_UNRESOLVED;
+
+    board->settled = reading;
+
+    return resolve(board, move);
+}
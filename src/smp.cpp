@@ -0,0 +1,114 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                   LAZY SMP                                      ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <string.h>
+#include <atomic>
+
+#if defined(ESP_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <thread>
+#endif
+
+#include "smp.h"
+
+#if defined(ESP_PLATFORM)
+#if defined(CONFIG_BT_CONTROLLER_PINNED_TO_CORE)
+#define HELPER_CORE CONFIG_BT_CONTROLLER_PINNED_TO_CORE  // the main search already runs on the other core
+#else
+#define HELPER_CORE 0
+#endif
+#define HELPER_STACK_SIZE 16384
+#define HELPER_PRIORITY 1  // below the BLE tasks sharing this core, above IDLE0: the helper yields to it
+#define HELPER_YIELD_MS 20  // a tick at most this often, from the clock check every 2048 nodes
+
+static unsigned long helper_yield_time[SMP_MAX_THREADS];
+
+static void yield_core(Search_Info_Structure *search_info)  // IDLE0 feeds the task watchdog, Bluedroid gets the core
+{
+    unsigned long now = time_ms();
+
+    if (now - helper_yield_time[search_info->thread_id] < HELPER_YIELD_MS) return;
+    vTaskDelay(1); helper_yield_time[search_info->thread_id] = time_ms();
+}
+#endif
+
+static void run_helper(Smp_Helper_Structure *helper)  // searches until the main thread stops it
+{
+    search_iterative(&helper->engine, &helper->limits, &helper->search_info);
+}
+
+static void start_helper(Smp_Helper_Structure *helper, int thread_id, Engine_Structure *engine, Search_Limits_Structure *limits)
+{
+    Engine_Structure *copy = &helper->engine;
+
+    set_position(copy, &engine->position);
+    memcpy(copy->history_table, engine->history_table, sizeof(copy->history_table));
+    copy->undo_count = 0; copy->tt = engine->tt;
+
+    memset((void *)&helper->search_info, 0, sizeof(helper->search_info));
+    helper->search_info.thread_id = thread_id;
+#if defined(ESP_PLATFORM)
+    helper->search_info.on_poll = yield_core;
+#endif
+    memset(&helper->limits, 0, sizeof(helper->limits));  // no clock, the main thread decides when to stop
+    helper->limits.depth = limits->depth ? limits->depth + 1 : 0;
+}
+
+static inline int clamp_helpers(int helper_count) { return (helper_count < 0) ? 0 : (helper_count > SMP_MAX_THREADS - 1) ? SMP_MAX_THREADS - 1 : helper_count; }
+
+#if defined(ESP_PLATFORM)
+
+static std::atomic<int> helpers_running{0};
+
+static void helper_task(void *parameters)
+{
+    run_helper((Smp_Helper_Structure *)parameters);
+
+    helpers_running--;
+    vTaskDelete(NULL);
+}
+
+int search_parallel(Engine_Structure *engine, Smp_Helper_Structure *helpers, int helper_count, Search_Limits_Structure *limits, Search_Info_Structure *search_info)
+{
+    int threads = 1 + clamp_helpers(helper_count), score;
+
+    for(int i = 1; i < threads; i++) {
+        start_helper(&helpers[i - 1], i, engine, limits);
+        helpers_running++;
+        if (xTaskCreatePinnedToCore(helper_task, "search helper", HELPER_STACK_SIZE, &helpers[i - 1], HELPER_PRIORITY, NULL, HELPER_CORE) != pdPASS) { helpers_running--; threads = i; break; }
+    }
+
+    score = search_iterative(engine, limits, search_info);
+
+    for(int i = 1; i < threads; i++) helpers[i - 1].search_info.stop = 1;
+    while (helpers_running.load()) vTaskDelay(1);
+    for(int i = 1; i < threads; i++) search_info->nodes += helpers[i - 1].search_info.nodes;
+
+    return score;
+}
+
+#else
+
+int search_parallel(Engine_Structure *engine, Smp_Helper_Structure *helpers, int helper_count, Search_Limits_Structure *limits, Search_Info_Structure *search_info)
+{
+    std::thread threads[SMP_MAX_THREADS - 1]; int thread_count = 1 + clamp_helpers(helper_count), score;
+
+    for(int i = 1; i < thread_count; i++) {
+        start_helper(&helpers[i - 1], i, engine, limits);
+        threads[i - 1] = std::thread(run_helper, &helpers[i - 1]);
+    }
+
+    score = search_iterative(engine, limits, search_info);
+
+    for(int i = 1; i < thread_count; i++) helpers[i - 1].search_info.stop = 1;
+    for(int i = 1; i < thread_count; i++) { threads[i - 1].join(); search_info->nodes += helpers[i - 1].search_info.nodes; }
+
+    return score;
+}
+
+#endif
@@ -0,0 +1,82 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                SEARCH STATISTICS                                ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <string.h>
+
+#include "stats.h"
+
+static inline void put_u16(unsigned char *bytes, unsigned long value)
+{
+    if (value > 0xffff) value = 0xffff;
+    bytes[0] = (unsigned char)value; bytes[1] = (unsigned char)(value >> 8);
+}
+
+static inline void put_u32(unsigned char *bytes, unsigned long long value)
+{
+    if (value > 0xffffffffULL) value = 0xffffffffULL;
+    for(int i = 0; i < 4; i++) bytes[i] = (unsigned char)(value >> (8 * i));
+}
+
+static inline unsigned long get_u16(const unsigned char *bytes) { return bytes[0] | (unsigned long)bytes[1] << 8; }
+static inline unsigned long get_u32(const unsigned char *bytes) { return get_u16(bytes) | get_u16(bytes + 2) << 16; }
+
+static inline unsigned long per_mille(unsigned long long part, unsigned long long total) { return total ? (unsigned long)(part * 1000 / total) : 0; }
+
+void stats_start(Stats_Structure *stats, int id)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->id = id;
+}
+
+int stats_iteration(Stats_Structure *stats, Search_Info_Structure *search_info, unsigned char records[2][STATS_RECORD_SIZE])
+{
+#if SEARCH_STATS
+    unsigned long long nodes = search_info->nodes, cutoffs = 0;
+    unsigned long long iteration_nodes = nodes - stats->previous_nodes[0], previous_iteration_nodes = stats->previous_nodes[0] - stats->previous_nodes[1];
+
+    memset(records, 0, 2 * STATS_RECORD_SIZE);
+
+    records[0][0] = STATS_ITERATION; records[0][1] = (unsigned char)search_info->completed_depth; put_u16(records[0] + 2, stats->id & 0xffff);
+    put_u32(records[0] + 4, time_ms() - search_info->start_time);
+    put_u32(records[0] + 8, nodes);
+    put_u16(records[0] + 12, per_mille(search_info->qnodes, nodes));
+    put_u16(records[0] + 14, previous_iteration_nodes ? iteration_nodes * 100 / previous_iteration_nodes : 0);
+    put_u16(records[0] + 16, per_mille(search_info->tt_hits, search_info->tt_probes));
+    put_u16(records[0] + 18, search_info->stack_peak);
+
+    for(int i = 0; i < STATS_CUTOFF_BUCKETS; i++) cutoffs += search_info->cutoff_histogram[i];
+
+    records[1][0] = STATS_CUTOFFS; records[1][1] = records[0][1]; put_u16(records[1] + 2, stats->id & 0xffff);
+    for(int i = 0; i < STATS_CUTOFF_BUCKETS; i++) put_u16(records[1] + 4 + 2 * i, per_mille(search_info->cutoff_histogram[i], cutoffs));
+
+    stats->previous_nodes[1] = stats->previous_nodes[0]; stats->previous_nodes[0] = nodes;
+
+    return 2;
+#else
+    (void)stats; (void)search_info; (void)records;  // compiled out
+    return 0;
+#endif
+}
+
+int stats_decode(const unsigned char *bytes, Stats_Record_Structure *record)
+{
+    memset(record, 0, sizeof(*record));
+    record->type = bytes[0]; record->depth = bytes[1]; record->id = get_u16(bytes + 2);
+
+    if (record->type == STATS_ITERATION) {
+        record->time = get_u32(bytes + 4); record->nodes = get_u32(bytes + 8);
+        record->qnodes_permille = get_u16(bytes + 12); record->branching_factor = get_u16(bytes + 14);
+        record->tt_hit_permille = get_u16(bytes + 16); record->stack_peak = get_u16(bytes + 18);
+        return 1;
+    }
+
+    if (record->type == STATS_CUTOFFS) {
+        for(int i = 0; i < STATS_CUTOFF_BUCKETS; i++) record->cutoff_permille[i] = get_u16(bytes + 4 + 2 * i);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                              TRANSPOSITION TABLE                                ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include <esp_heap_caps.h>
+#endif
+
+#include "tt.h"
+
+#define BUCKET_SIZE 4
+
+typedef struct { unsigned long long key, data; } TT_Slot_Structure;  // key - position key ^ data, data - packed TT_Entry_Structure
+typedef struct TT_Bucket_Structure { TT_Slot_Structure slots[BUCKET_SIZE]; } TT_Bucket_Structure;
+
+static inline unsigned long long pack_entry(unsigned int move, int score, int depth, int flags)
+{
+    return move | (unsigned long long)(unsigned short)score << 32 | (unsigned long long)depth << 48 | (unsigned long long)flags << 56;
+}
+
+static inline void unpack_entry(unsigned long long data, TT_Entry_Structure *entry)
+{
+    entry->move = (unsigned int)data; entry->score = (short)(data >> 32);
+    entry->depth = (unsigned char)(data >> 48); entry->flags = (unsigned char)(data >> 56);
+}
+
+static void *tt_allocate(size_t size)  // prefer PSRAM on ESP32, internal SRAM otherwise
+{
+#if defined(ESP_PLATFORM)
+    void *table = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (table) return table;
+#endif
+    return malloc(size);
+}
+
+static void tt_free(void *table)
+{
+#if defined(ESP_PLATFORM)
+    heap_caps_free(table);
+#else
+    free(table);
+#endif
+}
+
+size_t tt_init(TT_Structure *tt, size_t size_in_bytes)
+{
+    TT_Bucket_Structure *table = NULL; size_t buckets = 1;
+
+    if (tt->buckets) tt_free(tt->buckets);
+    tt->buckets = NULL; tt->bucket_mask = 0; tt->configured = 1;
+
+    if (size_in_bytes < sizeof(TT_Bucket_Structure)) return 0;
+    while (buckets * 2 * sizeof(TT_Bucket_Structure) <= size_in_bytes) buckets *= 2;
+
+    while (buckets && !(table = (TT_Bucket_Structure *)tt_allocate(buckets * sizeof(TT_Bucket_Structure)))) buckets /= 2;  // shrink until it fits the heap
+    if (!table) return 0;
+
+    memset(table, 0, buckets * sizeof(TT_Bucket_Structure));
+    tt->bucket_mask = buckets - 1; tt->generation = 0;
+    tt->buckets = table;  // published last, Lazy SMP helpers may already be probing
+
+    return buckets * sizeof(TT_Bucket_Structure);
+}
+
+void tt_clear(TT_Structure *tt)
+{
+    if (tt->buckets) memset(tt->buckets, 0, (tt->bucket_mask + 1) * sizeof(TT_Bucket_Structure));
+    tt->generation = 0;
+}
+
+void tt_new_search(TT_Structure *tt)
+{
+    if (!tt) return;
+    if (!tt->configured) tt_init(tt, (size_t)TT_SIZE_KB * 1024);
+    tt->generation = (tt->generation + 1) & 63;
+}
+
+int tt_probe(TT_Structure *tt, unsigned long long key, TT_Entry_Structure *entry)
+{
+    TT_Bucket_Structure *table = tt ? tt->buckets : NULL;
+
+    if (!table) return 0;
+
+    TT_Slot_Structure *slot = table[key & tt->bucket_mask].slots;
+
+    for(int i = 0; i < BUCKET_SIZE; i++) {
+        unsigned long long data = slot[i].data;  // read once, another thread may be writing
+
+        if ((slot[i].key ^ data) == key && data >> 56) { unpack_entry(data, entry); return 1; }  // flags != 0, slot in use
+    }
+
+    return 0;
+}
+
+void tt_store(TT_Structure *tt, unsigned long long key, int depth, int bound, int score, unsigned int move)
+{
+    TT_Bucket_Structure *table = tt ? tt->buckets : NULL;
+
+    if (!table) return;
+
+    TT_Slot_Structure *slot = table[key & tt->bucket_mask].slots, *replace = slot;
+    TT_Entry_Structure entry, old_entry; int replace_value = 1 << 16, same_key = 0;
+
+    for(int i = 0; i < BUCKET_SIZE; i++) {
+        unsigned long long data = slot[i].data;
+        unpack_entry(data, &entry);
+
+        if ((slot[i].key ^ data) == key || !entry.flags) { replace = &slot[i]; old_entry = entry; same_key = entry.flags != 0; break; }  // same position or empty slot
+
+        // otherwise evict the shallowest entry, entries from previous searches count as shallower
+        int value = entry.depth - 8 * ((tt->generation - (entry.flags >> 2)) & 63);
+        if (value < replace_value) { replace = &slot[i]; replace_value = value; }
+    }
+
+    if (same_key && depth < old_entry.depth && bound != TT_EXACT) return;  // keep the deeper result
+    if (same_key && !move) move = old_entry.move;  // keep the old best move for ordering
+
+    unsigned long long data = pack_entry(move, score, depth, bound | tt->generation << 2);
+    replace->data = data; replace->key = key ^ data;
+}
+
+int tt_hot_entries(TT_Structure *tt, unsigned long long *keys, TT_Entry_Structure *entries, int max_entries)  // one pass, the shallowest kept entry is replaced
+{
+    TT_Bucket_Structure *table = tt ? tt->buckets : NULL; int count = 0, shallowest = 0;
+
+    if (!table || max_entries <= 0) return 0;
+
+    for(size_t bucket = 0; bucket <= tt->bucket_mask; bucket++)
+        for(int i = 0; i < BUCKET_SIZE; i++) {
+            TT_Slot_Structure slot = table[bucket].slots[i]; int depth = (slot.data >> 48) & 255;
+
+            if (!(slot.data >> 56) || (int)(slot.data >> 58) != tt->generation) continue;  // empty or from an older search
+            if (count == max_entries && depth <= entries[shallowest].depth) continue;
+
+            int kept = (count < max_entries) ? count++ : shallowest;
+            keys[kept] = slot.key ^ slot.data; unpack_entry(slot.data, &entries[kept]);
+
+            if (count == max_entries) // rare once the deep entries are in
+                for(int j = shallowest = 0; j < count; j++) if (entries[j].depth < entries[shallowest].depth) shallowest = j;
+        }
+
+    return count;
+}
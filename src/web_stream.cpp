@@ -0,0 +1,320 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                              WEBSOCKET INFO STREAM                              ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(ESP_PLATFORM)
+#include <lwip/sockets.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
+
+#include "web_stream.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0  // lwIP raises no SIGPIPE
+#endif
+
+#define OPCODE_TEXT 1
+#define OPCODE_CLOSE 8
+#define OPCODE_PING 9
+#define OPCODE_PONG 10
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                   HANDSHAKE                                     ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static inline unsigned int rotate(unsigned int value, int bits) { return value << bits | value >> (32 - bits); }
+
+static void sha1(const unsigned char *data, int length, unsigned char *digest)  // 20 bytes; only the handshake key is hashed
+{
+    unsigned int hash[5] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 }, words[80];
+    int blocks = (length + 9 + 63) / 64;  // the 0x80 byte and the 64 bit length fit the last block
+
+    for(int block = 0; block < blocks; block++) {
+        unsigned char bytes[64];
+
+        for(int i = 0; i < 64; i++) { int at = block * 64 + i; bytes[i] = (at < length) ? data[at] : (at == length) ? 0x80 : 0; }
+        if (block == blocks - 1) for(int i = 0; i < 8; i++) bytes[63 - i] = (unsigned char)((unsigned long long)length * 8 >> (8 * i));
+
+        for(int i = 0; i < 16; i++) words[i] = bytes[4 * i] << 24 | bytes[4 * i + 1] << 16 | bytes[4 * i + 2] << 8 | bytes[4 * i + 3];
+        for(int i = 16; i < 80; i++) words[i] = rotate(words[i - 3] ^ words[i - 8] ^ words[i - 14] ^ words[i - 16], 1);
+
+        unsigned int a = hash[0], b = hash[1], c = hash[2], d = hash[3], e = hash[4];
+
+        for(int i = 0; i < 80; i++) {
+            unsigned int f = (i < 20) ? (b & c) | (~b & d) : (i < 40 || i >= 60) ? b ^ c ^ d : (b & c) | (b & d) | (c & d);
+            unsigned int k = (i < 20) ? 0x5a827999 : (i < 40) ? 0x6ed9eba1 : (i < 60) ? 0x8f1bbcdc : 0xca62c1d6;
+            unsigned int t = rotate(a, 5) + f + e + k + words[i];
+
+            e = d; d = c; c = rotate(b, 30); b = a; a = t;
+        }
+
+        hash[0] += a; hash[1] += b; hash[2] += c; hash[3] += d; hash[4] += e;
+    }
+
+    for(int i = 0; i < 20; i++) digest[i] = (unsigned char)(hash[i >> 2] >> (24 - 8 * (i & 3)));
+}
+
+static void base64(const unsigned char *data, int length, char *text)  // 4 chars per 3 bytes + terminator
+{
+    static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    for(int i = 0; i < length; i += 3) {
+        unsigned int group = data[i] << 16 | (i + 1 < length ? data[i + 1] << 8 : 0) | (i + 2 < length ? data[i + 2] : 0);
+
+        *text++ = digits[group >> 18]; *text++ = digits[(group >> 12) & 63];
+        *text++ = (i + 1 < length) ? digits[(group >> 6) & 63] : '=';
+        *text++ = (i + 2 < length) ? digits[group & 63] : '=';
+    }
+    *text = 0;
+}
+
+static int find_key(const char *request, char *key)  // Sec-WebSocket-Key value, 0 if missing
+{
+    static const char name[] = "sec-websocket-key:";
+    int length = 0;
+
+    for(const char *line = request; line && *line; line = strstr(line, "\r\n"), line = line ? line + 2 : NULL) {
+        int i = 0;
+
+        while (name[i] && (line[i] | 32) == name[i]) i++;  // header names are case-insensitive
+        if (name[i]) continue;
+
+        for(line += i; *line == ' '; line++);
+        while (line[length] && line[length] != '\r' && length < 60) { key[length] = line[length]; length++; }
+        key[length] = 0;
+
+        return length > 0;
+    }
+
+    return 0;
+}
+
+static int answer_handshake(Web_Client_Structure *client)  // 1 once the request is answered, 0 while incomplete, -1 if malformed
+{
+    char key[100], accept[32]; unsigned char digest[20];
+
+    client->input[client->input_length < WEB_STREAM_INPUT ? client->input_length : WEB_STREAM_INPUT - 1] = 0;
+    if (!strstr((char *)client->input, "\r\n\r\n")) return client->input_length < WEB_STREAM_INPUT - 1 ? 0 : -1;
+    if (!find_key((char *)client->input, key)) return -1;
+
+    strcat(key, "258EAFA5-E914-47DA-95CA-C5AB0DC85B11");  // RFC 6455 GUID
+    sha1((unsigned char *)key, strlen(key), digest); base64(digest, 20, accept);
+
+    client->output_length = snprintf((char *)client->output, WEB_STREAM_OUTPUT, "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+                                     "Connection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n\r\n", accept);
+    client->input_length = 0; client->open = 1;
+
+    return 1;
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    FRAMES                                       ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+static void close_client(Web_Client_Structure *client)
+{
+    close(client->socket);
+    client->socket = -1; client->open = 0; client->input_length = client->output_length = 0;
+}
+
+static int write_output(Web_Client_Structure *client)  // as much as the socket takes, 0 if it is gone
+{
+    while (client->output_length) {
+        int sent = send(client->socket, client->output, client->output_length, MSG_NOSIGNAL);
+
+        if (sent < 0) return errno == EAGAIN || errno == EWOULDBLOCK;
+        memmove(client->output, client->output + sent, client->output_length - sent); client->output_length -= sent;
+    }
+
+    return 1;
+}
+
+static int queue_frame(Web_Client_Structure *client, int opcode, const unsigned char *payload, int length)  // 0 if the output buffer has no room
+{
+    int header = (length < 126) ? 2 : 4; unsigned char *frame = client->output + client->output_length;
+
+    if (client->output_length + header + length > WEB_STREAM_OUTPUT) return 0;
+
+    frame[0] = 0x80 | opcode;  // FIN, server frames aren't masked
+    if (length < 126) frame[1] = (unsigned char)length;
+    else { frame[1] = 126; frame[2] = (unsigned char)(length >> 8); frame[3] = (unsigned char)length; }
+    memcpy(frame + header, payload, length); client->output_length += header + length;
+
+    return 1;
+}
+
+static int read_frame(Web_Client_Structure *client, char *text, int size)  // 1 text, 2 a control frame handled, 0 incomplete, -1 close the client
+{
+    unsigned char *input = client->input; int opcode, length, header = 2, result = 2;
+
+    if (client->input_length < 2) return 0;
+    opcode = input[0] & 15; length = input[1] & 127;
+    if (!(input[1] & 0x80) || length == 127 || !(input[0] & 0x80)) return -1;  // clients mask; no huge or fragmented messages here
+    if (length == 126) { if (client->input_length < 4) return 0; length = input[2] << 8 | input[3]; header = 4; }
+    if (header + 4 + length > WEB_STREAM_INPUT) return -1;
+    if (client->input_length < header + 4 + length) return 0;
+
+    unsigned char *mask = input + header, *payload = mask + 4;
+    for(int i = 0; i < length; i++) payload[i] ^= mask[i & 3];
+
+    if (opcode == OPCODE_TEXT) {
+        int copied = (length < size - 1) ? length : size - 1;
+        memcpy(text, payload, copied); text[copied] = 0; result = 1;
+    }
+    else if (opcode == OPCODE_CLOSE) { queue_frame(client, OPCODE_CLOSE, payload, length < 2 ? length : 2); result = -1; }  // echo the status code
+    else if (opcode == OPCODE_PING) queue_frame(client, OPCODE_PONG, payload, length);
+
+    client->input_length -= header + 4 + length;
+    memmove(input, payload + length, client->input_length);
+
+    return result;
+}
+
+static int format_info(const Web_Stream_Info_Structure *info, char *text)  // length
+{
+    char move_string[6];
+    int length = snprintf(text, WEB_STREAM_TEXT, "{\"depth\":%d,\"score\":%d,\"nodes\":%llu,\"nps\":%llu,\"time\":%lu,\"pv\":\"", info->depth, info->score,
+                          info->nodes, info->time ? info->nodes * 1000 / info->time : 0, info->time);
+
+    for(int i = 0; i < info->pv_length && length < WEB_STREAM_TEXT - 10; i++) {
+        move_to_string(info->pv[i], move_string);
+        length += snprintf(text + length, WEB_STREAM_TEXT - length, i ? " %s" : "%s", move_string);
+    }
+
+    return length + snprintf(text + length, WEB_STREAM_TEXT - length, "\"}");
+}
+
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                    INTERFACE                                    ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+int web_stream_open(Web_Stream_Structure *stream, int port, int loopback)
+{
+    struct sockaddr_in address; socklen_t address_length = sizeof(address); int on = 1;
+
+    memset(stream, 0, sizeof(*stream));
+    for(int i = 0; i < WEB_STREAM_CLIENTS; i++) stream->clients[i].socket = -1;
+    if ((stream->listener = socket(AF_INET, SOCK_STREAM, 0)) < 0) return 0;
+
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET; address.sin_port = htons(port); address.sin_addr.s_addr = htonl(loopback ? INADDR_LOOPBACK : INADDR_ANY);
+    setsockopt(stream->listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+    if (bind(stream->listener, (struct sockaddr *)&address, sizeof(address)) || listen(stream->listener, WEB_STREAM_CLIENTS) ||
+        fcntl(stream->listener, F_SETFL, fcntl(stream->listener, F_GETFL, 0) | O_NONBLOCK) < 0 ||
+        getsockname(stream->listener, (struct sockaddr *)&address, &address_length)) { close(stream->listener); stream->listener = -1; return 0; }
+
+    stream->port = ntohs(address.sin_port);
+    return 1;
+}
+
+void web_stream_close(Web_Stream_Structure *stream)
+{
+    for(int i = 0; i < WEB_STREAM_CLIENTS; i++) if (stream->clients[i].socket >= 0) close_client(&stream->clients[i]);
+    if (stream->listener >= 0) close(stream->listener);
+    stream->listener = -1;
+}
+
+int web_stream_poll(Web_Stream_Structure *stream, char *text, int size)
+{
+    int socket_handle, on = 1;
+
+    while (stream->listener >= 0 && (socket_handle = accept(stream->listener, NULL, NULL)) >= 0) {
+        Web_Client_Structure *client = NULL;
+
+        for(int i = 0; i < WEB_STREAM_CLIENTS && !client; i++) if (stream->clients[i].socket < 0) client = &stream->clients[i];
+        if (!client) { close(socket_handle); continue; }  // full
+
+        fcntl(socket_handle, F_SETFL, fcntl(socket_handle, F_GETFL, 0) | O_NONBLOCK);
+        setsockopt(socket_handle, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));  // small frames go out at once
+        client->socket = socket_handle; client->open = 0; client->input_length = client->output_length = 0;
+    }
+
+    for(int i = 0; i < WEB_STREAM_CLIENTS; i++) {
+        Web_Client_Structure *client = &stream->clients[i]; int received, result = 0;
+
+        if (client->socket < 0) continue;
+
+        if (client->input_length < WEB_STREAM_INPUT) {
+            received = recv(client->socket, client->input + client->input_length, WEB_STREAM_INPUT - client->input_length, 0);
+            if (!received || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) { close_client(client); continue; }  // closed or reset
+            if (received > 0) client->input_length += received;
+        }
+
+        if (!client->open) result = answer_handshake(client);
+        else while ((result = read_frame(client, text, size)) == 2);
+
+        if (!write_output(client) || result < 0) { close_client(client); continue; }  // a close frame or a handshake reply goes out first
+        if (client->open && result == 1) return 1;
+    }
+
+    return 0;
+}
+
+int web_stream_clients(Web_Stream_Structure *stream)
+{
+    int count = 0;
+
+    for(int i = 0; i < WEB_STREAM_CLIENTS; i++) count += stream->clients[i].socket >= 0 && stream->clients[i].open;
+    return count;
+}
+
+void web_stream_info(Web_Stream_Structure *stream, const Web_Stream_Info_Structure *info)
+{
+    if (!web_stream_clients(stream)) return;
+
+    if (stream->info_pending) stream->infos_coalesced++;
+    stream->info = *info; stream->info_pending = 1;
+}
+
+int web_stream_flush(Web_Stream_Structure *stream, int force)
+{
+    char text[WEB_STREAM_TEXT]; int length, written = 0;
+
+    if (!stream->info_pending || (!force && time_ms() - stream->info_time < WEB_STREAM_INFO_MS)) return 0;
+
+    length = format_info(&stream->info, text);
+    stream->info_pending = 0; stream->info_time = time_ms(); stream->infos_sent++;
+
+    for(int i = 0; i < WEB_STREAM_CLIENTS; i++) {
+        Web_Client_Structure *client = &stream->clients[i];
+
+        if (client->socket < 0 || !client->open) continue;
+        if (client->output_length) { stream->infos_coalesced++; continue; }  // still sending the last frame, this one is skipped
+
+        queue_frame(client, OPCODE_TEXT, (const unsigned char *)text, length);
+        if (!write_output(client)) close_client(client);
+        else written = 1;
+    }
+
+    return written;
+}
+
+void web_stream_send(Web_Stream_Structure *stream, const char *text)
+{
+    for(int i = 0; i < WEB_STREAM_CLIENTS; i++) {
+        Web_Client_Structure *client = &stream->clients[i];
+
+        if (client->socket < 0 || !client->open) continue;
+        if (!queue_frame(client, OPCODE_TEXT, (const unsigned char *)text, strlen(text))) { close_client(client); stream->clients_dropped++; continue; }  // too slow to follow the game
+        if (!write_output(client)) close_client(client);
+    }
+}
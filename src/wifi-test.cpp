@@ -1,23 +0,0 @@
-#include <Arduino.h>
-#include <WiFi.h>
-
-const char* ssid = "SDProbots";
-const char* password = "robotsRus";
-
-void wifiTest(){
-    Serial.begin(9600);
-    delay(1000);
-
-    WiFi.mode(WIFI_STA); //Optional
-    WiFi.begin(ssid, password);
-    Serial.println("\nConnecting");
-
-    while(WiFi.status() != WL_CONNECTED){
-        Serial.print(".");
-        delay(100);
-    }
-
-    Serial.println("\nConnected to the WiFi network");
-    Serial.print("Local ESP32 IP: ");
-    Serial.println(WiFi.localIP());
-}
\ No newline at end of file
@@ -0,0 +1,55 @@
+/*********************************************************************************\
+;---------------------------------------------------------------------------------;
+;                                   WI-FI LINK                                    ;
+;---------------------------------------------------------------------------------;
+\*********************************************************************************/
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include "wifi_link.h"
+
+static volatile int link_up = 0, link_lost = 0;  // set on the driver's event task
+static int link_enabled = 0, link_announced = 0, retry_pending = 0;
+static unsigned long retry_delay = WIFI_LINK_RETRY_MS, retry_time = 0;
+
+static void on_event(WiFiEvent_t event, WiFiEventInfo_t info)
+{
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) link_up = 1;
+    else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) { link_up = 0; link_lost = 1; }  // a failed attempt or a dropped link
+}
+
+void wifi_link_start(const char *ssid, const char *password)
+{
+    if (!ssid || !*ssid) return;
+
+    link_enabled = 1;
+    WiFi.onEvent(on_event);
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(false);  // the backoff in wifi_link_poll() instead of the driver's retries
+    WiFi.begin(ssid, password);
+}
+
+int wifi_link_poll()
+{
+    unsigned long now = millis();
+
+    if (!link_enabled) return 0;
+
+    if (link_up) {
+        if (link_announced) return 0;
+        link_announced = 1; retry_delay = WIFI_LINK_RETRY_MS; retry_pending = 0;
+        return 1;
+    }
+    link_announced = 0;
+
+    if (link_lost) {
+        link_lost = 0; retry_pending = 1; retry_time = now + retry_delay;
+        retry_delay = (retry_delay * 2 < WIFI_LINK_RETRY_MAX_MS) ? retry_delay * 2 : WIFI_LINK_RETRY_MAX_MS;
+    }
+    if (retry_pending && (long)(now - retry_time) >= 0) { retry_pending = 0; WiFi.reconnect(); }
+
+    return 0;
+}
+
+int wifi_link_connected() { return link_up; }